@@ -53,6 +53,8 @@ int entry(int argc, char **argv)
 
   const std::string qdqw = "--quantize_dequantize_weights";
   const std::string qwmm = "--quantize_with_minmax";
+  const std::string mpp = "--mixed_precision_plan";
+  const std::string nt = "--num_threads";
 
   arser::Arser arser("circle-quantizer provides circle model quantization");
 
@@ -79,6 +81,20 @@ int entry(int argc, char **argv)
             "Three arguments required: input_dtype(float32) "
             "output_dtype(uint8) granularity(layer, channel)");
 
+  arser.add_argument(mpp)
+      .nargs(1)
+      .type(arser::DataType::STR)
+      .required(false)
+      .help("Type of each layer (uint8, int16 or float32) made by record-minmax. "
+            "Layers not in the plan are quantized to output_dtype. "
+            "Give the same plan to both quantization steps");
+
+  arser.add_argument(nt)
+      .nargs(1)
+      .type(arser::DataType::INT32)
+      .required(false)
+      .help("Number of threads to quantize weights (default: the number of cores)");
+
   arser.add_argument("input").nargs(1).type(arser::DataType::STR).help("Input circle model");
   arser.add_argument("output").nargs(1).type(arser::DataType::STR).help("Output circle model");
 
@@ -123,6 +139,17 @@ int entry(int argc, char **argv)
     options->param(AlgorithmParameters::Quantize_granularity, values.at(2));
   }
 
+  if (arser[mpp])
+  {
+    options->param(AlgorithmParameters::Quantize_layer_precision, arser.get<std::string>(mpp));
+  }
+
+  if (arser[nt])
+  {
+    options->param(AlgorithmParameters::Quantize_num_threads,
+                   std::to_string(arser.get<int>(nt)));
+  }
+
   std::string input_path = arser.get<std::string>("input");
   std::string output_path = arser.get<std::string>("output");
 
@@ -138,7 +165,13 @@ int entry(int argc, char **argv)
 
   // Import from input Circle file
   luci::Importer importer;
-  auto module = importer.importModule(circle_model);
+  auto module = importer.importModule(reinterpret_cast<const uint8_t *>(model_data.data()),
+                                      model_data.size());
+  if (module == nullptr)
+  {
+    std::cerr << "ERROR: Failed to import circle '" << input_path << "'" << std::endl;
+    return EXIT_FAILURE;
+  }
 
   for (size_t idx = 0; idx < module->size(); ++idx)
   {
@@ -61,6 +61,18 @@ int entry(int argc, char **argv)
   arser.add_argument("--all").nargs(0).required(false).default_value(false).help(
       "Enable all optimize options");
 
+  arser.add_argument("--fuse_activation_function")
+      .nargs(0)
+      .required(false)
+      .default_value(false)
+      .help("This will fuse Relu/Relu6/ReluN1To1 to the fused activation of preceding operator");
+
+  arser.add_argument("--fuse_batchnorm_with_conv")
+      .nargs(0)
+      .required(false)
+      .default_value(false)
+      .help("This will fold Mul/Add with constant into filter and bias of Conv2D/DepthwiseConv2D");
+
   arser.add_argument("--fuse_bcq")
       .nargs(0)
       .required(false)
@@ -73,6 +85,30 @@ int entry(int argc, char **argv)
       .default_value(false)
       .help("This will fuse operators to InstanceNorm operator");
 
+  arser.add_argument("--fuse_pad_with_conv")
+      .nargs(0)
+      .required(false)
+      .default_value(false)
+      .help("This will merge Pad into SAME padding of Conv2D/DepthwiseConv2D");
+
+  arser.add_argument("--remove_identity_arithmetic")
+      .nargs(0)
+      .required(false)
+      .default_value(false)
+      .help("This will remove Add/Sub with zero and Mul/Div with one");
+
+  arser.add_argument("--remove_redundant_reshape")
+      .nargs(0)
+      .required(false)
+      .default_value(false)
+      .help("This will remove Reshape of Reshape and Reshape which keeps the shape");
+
+  arser.add_argument("--remove_redundant_transpose")
+      .nargs(0)
+      .required(false)
+      .default_value(false)
+      .help("This will merge consecutive Transposes and remove identity Transpose");
+
   arser.add_argument("--resolve_customop_add")
       .nargs(0)
       .required(false)
@@ -91,6 +127,25 @@ int entry(int argc, char **argv)
       .default_value(false)
       .help("This will convert Custom(Matmul) to Matmul operator");
 
+  arser.add_argument("--sparsify_weights")
+      .nargs(0)
+      .required(false)
+      .default_value(false)
+      .help("This will store pruned weights of FullyConnected and 1x1 Conv2D in block sparse "
+            "format. This is applied after all the other optimizations");
+
+  arser.add_argument("--sparsify_block_size")
+      .nargs(1)
+      .type(arser::DataType::STR)
+      .required(false)
+      .help("Block size of sparse weights as \"rows,cols\" (default: 1,4)");
+
+  arser.add_argument("--sparsify_min_sparsity")
+      .nargs(1)
+      .type(arser::DataType::FLOAT)
+      .required(false)
+      .help("Weights with this ratio of zero blocks or more are sparsified (default: 0.5)");
+
   arser.add_argument("--mute_warnings")
       .nargs(0)
       .required(false)
@@ -119,22 +174,48 @@ int entry(int argc, char **argv)
 
   if (arser.get<bool>("--all"))
   {
+    options->enable(Algorithms::FuseActivationFunction);
+    options->enable(Algorithms::FuseBatchNormWithConv);
     options->enable(Algorithms::FuseBCQ);
     options->enable(Algorithms::FuseInstanceNorm);
+    options->enable(Algorithms::FusePadWithConv);
+    options->enable(Algorithms::RemoveIdentityArithmetic);
+    options->enable(Algorithms::RemoveRedundantReshape);
+    options->enable(Algorithms::RemoveRedundantTranspose);
     options->enable(Algorithms::ResolveCustomOpAdd);
     options->enable(Algorithms::ResolveCustomOpBatchMatMul);
     options->enable(Algorithms::ResolveCustomOpMatMul);
   }
+  if (arser.get<bool>("--fuse_activation_function"))
+    options->enable(Algorithms::FuseActivationFunction);
+  if (arser.get<bool>("--fuse_batchnorm_with_conv"))
+    options->enable(Algorithms::FuseBatchNormWithConv);
   if (arser.get<bool>("--fuse_bcq"))
     options->enable(Algorithms::FuseBCQ);
   if (arser.get<bool>("--fuse_instnorm"))
     options->enable(Algorithms::FuseInstanceNorm);
+  if (arser.get<bool>("--fuse_pad_with_conv"))
+    options->enable(Algorithms::FusePadWithConv);
+  if (arser.get<bool>("--remove_identity_arithmetic"))
+    options->enable(Algorithms::RemoveIdentityArithmetic);
+  if (arser.get<bool>("--remove_redundant_reshape"))
+    options->enable(Algorithms::RemoveRedundantReshape);
+  if (arser.get<bool>("--remove_redundant_transpose"))
+    options->enable(Algorithms::RemoveRedundantTranspose);
   if (arser.get<bool>("--resolve_customop_add"))
     options->enable(Algorithms::ResolveCustomOpAdd);
   if (arser.get<bool>("--resolve_customop_batchmatmul"))
     options->enable(Algorithms::ResolveCustomOpBatchMatMul);
   if (arser.get<bool>("--resolve_customop_matmul"))
     options->enable(Algorithms::ResolveCustomOpMatMul);
+  if (arser.get<bool>("--sparsify_weights"))
+    options->enable(Algorithms::SparsifyWeights);
+  if (arser["--sparsify_block_size"])
+    options->param(AlgorithmParameters::Sparsify_block_size,
+                   arser.get<std::string>("--sparsify_block_size"));
+  if (arser["--sparsify_min_sparsity"])
+    options->param(AlgorithmParameters::Sparsify_min_sparsity,
+                   std::to_string(arser.get<float>("--sparsify_min_sparsity")));
 
   if (arser.get<bool>("--mute_warnings"))
     settings->set(luci::UserSettings::Key::MuteWarnings, true);
@@ -166,7 +247,13 @@ int entry(int argc, char **argv)
 
   // Import from input Circle file
   luci::Importer importer;
-  auto module = importer.importModule(circle_model);
+  auto module = importer.importModule(reinterpret_cast<const uint8_t *>(model_data.data()),
+                                      model_data.size());
+  if (module == nullptr)
+  {
+    std::cerr << "ERROR: Failed to import circle '" << input_path << "'" << std::endl;
+    return EXIT_FAILURE;
+  }
 
   for (size_t idx = 0; idx < module->size(); ++idx)
   {
@@ -175,6 +262,9 @@ int entry(int argc, char **argv)
     // call luci optimizations
     optimizer.optimize(graph);
 
+    // NOTE Sparse weights are not supported by the other passes
+    optimizer.sparsify(graph);
+
     if (!luci::validate(graph))
     {
       std::cerr << "ERROR: Optimized graph is invalid" << std::endl;
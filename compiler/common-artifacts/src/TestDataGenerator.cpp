@@ -105,7 +105,8 @@ int entry(int argc, char **argv)
   }
 
   // load luci module
-  std::unique_ptr<luci::Module> module = luci::Importer().importModule(circle_model);
+  std::unique_ptr<luci::Module> module = luci::Importer().importModule(
+    reinterpret_cast<const uint8_t *>(model_data.data()), model_data.size());
   luci_interpreter::Interpreter interpreter(module.get());
 
   /**
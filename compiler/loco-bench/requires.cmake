@@ -0,0 +1,4 @@
+require("loco")
+require("logo-core")
+require("logo")
+require("safemain")
@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <loco.h>
+#include <loco/IR/Algorithm.h>
+
+#include <logo/Phase.h>
+#include <logo/RemoveDeadNodePass.h>
+#include <logo/RemoveForwardNodePass.h>
+
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+using milliseconds_f = std::chrono::duration<float, std::milli>;
+
+template <typename Callable> float measure(Callable cb)
+{
+  auto beg = std::chrono::steady_clock::now();
+  cb();
+  auto end = std::chrono::steady_clock::now();
+
+  return std::chrono::duration_cast<milliseconds_f>(end - beg).count();
+}
+
+/**
+ * @brief Synthetic graph of EltwiseAdd nodes
+ *
+ * Each EltwiseAdd takes the previous one and a random earlier one. Every 4th EltwiseAdd is
+ * behind a Forward, and every 8th has a dead EltwiseAdd user, so that RemoveForwardNodePass
+ * and RemoveDeadNodePass have work to do.
+ */
+struct SyntheticGraph
+{
+  SyntheticGraph(uint32_t num_adds)
+  {
+    std::mt19937 rng{1};
+
+    graph = loco::make_graph();
+
+    for (uint32_t n = 0; n < 16; ++n)
+    {
+      auto pull = graph->nodes()->create<loco::Pull>();
+      loco::link(graph->inputs()->create(), pull);
+      nodes.emplace_back(pull);
+    }
+
+    for (uint32_t n = 0; n < num_adds; ++n)
+    {
+      auto add = graph->nodes()->create<loco::EltwiseAdd>();
+      add->lhs(nodes.back());
+      add->rhs(nodes.at(rng() % nodes.size()));
+      adds.emplace_back(add);
+
+      loco::Node *node = add;
+      if (n % 4 == 0)
+      {
+        auto forward = graph->nodes()->create<loco::Forward>();
+        forward->input(add);
+        node = forward;
+      }
+      if (n % 8 == 0)
+      {
+        auto dead = graph->nodes()->create<loco::EltwiseAdd>();
+        dead->lhs(add);
+        dead->rhs(add);
+      }
+      nodes.emplace_back(node);
+    }
+
+    push = graph->nodes()->create<loco::Push>();
+    push->from(nodes.back());
+    loco::link(graph->outputs()->create(), push);
+  }
+
+  std::unique_ptr<loco::Graph> graph;
+  // Pull, EltwiseAdd or Forward nodes that EltwiseAdd(s) may take
+  std::vector<loco::Node *> nodes;
+  std::vector<loco::EltwiseAdd *> adds;
+  loco::Push *push = nullptr;
+};
+
+} // namespace
+
+/**
+ * @brief Time loco graph building, queries and logo passes on a large synthetic graph
+ *
+ * Usage: loco-bench [number of EltwiseAdd nodes] [number of query iterations]
+ */
+int entry(int argc, char **argv)
+{
+  const uint32_t num_adds = (argc > 1) ? std::stoul(argv[1]) : 100000;
+  const uint32_t num_iterations = (argc > 2) ? std::stoul(argv[2]) : 20;
+
+  std::unique_ptr<SyntheticGraph> g;
+  auto build_ms = measure([&]() { g = std::make_unique<SyntheticGraph>(num_adds); });
+  const auto num_nodes = g->graph->nodes()->size();
+
+  // Queries as passes do, with an edit in each iteration to invalidate what is cached
+  std::mt19937 rng{2};
+  size_t checksum = 0;
+  auto query_ms = measure([&]() {
+    for (uint32_t n = 0; n < num_iterations; ++n)
+    {
+      checksum += loco::postorder_traversal(loco::output_nodes(g->graph.get())).size();
+      checksum += loco::active_nodes(loco::output_nodes(g->graph.get())).size();
+      for (auto node : g->nodes)
+        checksum += loco::succs(node).size();
+
+      auto add = g->adds.at(rng() % g->adds.size());
+      add->rhs(g->nodes.at(rng() % 16));
+    }
+  });
+
+  logo::Phase phase;
+  phase.emplace_back(std::make_unique<logo::RemoveForwardNodePass>());
+  phase.emplace_back(std::make_unique<logo::RemoveDeadNodePass>());
+
+  logo::PhaseRunner<logo::PhaseStrategy::Saturate> phase_runner{g->graph.get()};
+  auto phase_ms = measure([&]() { phase_runner.run(phase); });
+  const auto num_remaining = g->graph->nodes()->size();
+
+  auto destroy_ms = measure([&]() { g.reset(); });
+
+  std::cout << "nodes      : " << num_nodes << " -> " << num_remaining << std::endl;
+  std::cout << "build      : " << build_ms << " ms" << std::endl;
+  std::cout << "queries    : " << query_ms << " ms (" << num_iterations << " iterations, checksum "
+            << checksum << ")" << std::endl;
+  std::cout << "passes     : " << phase_ms << " ms" << std::endl;
+  std::cout << "destroy    : " << destroy_ms << " ms" << std::endl;
+
+  return 0;
+}
@@ -19,6 +19,7 @@
 
 #include <algorithm>
 #include <memory>
+#include <unordered_map>
 #include <vector>
 
 namespace loco
@@ -27,6 +28,8 @@ namespace loco
 /**
  * @brief Object Pool
  * @note ObjectPool owns registered objects.
+ * @note Erased objects are removed from the sequence on the next access, so that erasing many
+ *       objects does not move the rest each time. Accesses thus update the pool after erase.
  */
 template <typename T> class ObjectPool
 {
@@ -35,16 +38,25 @@ public:
 
 public:
   /// @brief Return the number of objects
-  uint32_t size(void) const { return _pool.size(); }
+  uint32_t size(void) const
+  {
+    compact();
+    return _pool.size();
+  }
 
   /// @brief Access N-th object
-  T *at(uint32_t n) const { return _pool.at(n).get(); }
+  T *at(uint32_t n) const
+  {
+    compact();
+    return _pool.at(n).get();
+  }
 
 protected:
   /// @brief Take the ownership of a given object and returns its raw pointer
   template <typename U> U *take(std::unique_ptr<U> &&o)
   {
     auto res = o.get();
+    _index[res] = _pool.size();
     _pool.emplace_back(std::move(o));
     return res;
   }
@@ -56,20 +68,38 @@ protected:
    */
   bool erase(T *ptr)
   {
-    auto pred = [ptr](const std::unique_ptr<T> &o) { return o.get() == ptr; };
-    auto it = std::find_if(_pool.begin(), _pool.end(), pred);
+    auto it = _index.find(ptr);
 
-    if (it == _pool.end())
+    if (it == _index.end())
     {
       return false;
     }
 
-    _pool.erase(it);
+    _pool.at(it->second).reset();
+    _index.erase(it);
+    ++_erased;
     return true;
   }
 
 private:
-  std::vector<std::unique_ptr<T>> _pool;
+  /// @brief Remove the slots of erased objects, keeping the order of the others
+  void compact(void) const
+  {
+    if (_erased == 0)
+      return;
+
+    auto is_erased = [](const std::unique_ptr<T> &o) { return o == nullptr; };
+    _pool.erase(std::remove_if(_pool.begin(), _pool.end(), is_erased), _pool.end());
+    for (uint32_t n = 0; n < _pool.size(); ++n)
+      _index[_pool[n].get()] = n;
+    _erased = 0;
+  }
+
+private:
+  mutable std::vector<std::unique_ptr<T>> _pool;
+  // Position of each object in _pool
+  mutable std::unordered_map<const T *, uint32_t> _index;
+  mutable uint32_t _erased = 0;
 };
 
 } // namespace loco
@@ -26,7 +26,10 @@
 
 #include "loco/ADT/ObjectPool.h"
 
+#include <atomic>
+#include <cstdint>
 #include <initializer_list>
+#include <mutex>
 #include <set>
 #include <string>
 #include <memory>
@@ -222,7 +225,37 @@ public:
   OutputContext *outputs(void) { return &_output_ctx; }
   const OutputContext *outputs(void) const { return &_output_ctx; }
 
+public:
+  /**
+   * @brief Return a counter that increases on every change of nodes or edges
+   *
+   * Analyses may cache their results with this revision and reuse them until it changes.
+   */
+  uint64_t revision(void) const { return _revision.load(); }
+
+private:
+  friend class Use;
+  friend class NodePool;
+  friend std::vector<Node *> postorder_traversal(const std::vector<Node *> &roots);
+
+  /// @brief Mark the graph as modified. Only "Use" and "NodePool" invoke this method.
+  void touch(void) { ++_revision; }
+
+  /// @brief The last result of postorder_traversal over this graph
+  struct PostorderCache
+  {
+    bool valid = false;
+    uint64_t revision = 0;
+    std::vector<Node *> roots;
+    std::vector<Node *> order;
+  };
+
 private:
+  // NOTE These fields SHOULD outlive nodes as node destruction updates them
+  std::atomic<uint64_t> _revision{0};
+  std::mutex _postorder_mutex;
+  PostorderCache _postorder_cache;
+
   NodeContext _node_ctx;
   InputContext _input_ctx;
   OutputContext _output_ctx;
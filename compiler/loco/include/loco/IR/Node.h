@@ -26,6 +26,7 @@
 #include "loco/IR/CastHelpers.h"
 
 #include <array>
+#include <cstddef>
 #include <memory>
 #include <set>
 
@@ -66,6 +67,19 @@ public:
 
   virtual ~Node();
 
+public:
+  /**
+   * @brief Allocate nodes from a shared node arena
+   *
+   * Nodes of similar size are carved out of large chunks and recycled through free lists,
+   * so nodes created together stay close in memory regardless of their concrete type.
+   *
+   * @note  Nodes are allocated by the global allocator in AddressSanitizer builds, so that
+   *        use-after-free of nodes is detected
+   */
+  static void *operator new(std::size_t size);
+  static void operator delete(void *ptr, std::size_t size);
+
 public:
   Graph *graph(void) { return _graph; }
   const Graph *graph(void) const { return _graph; }
@@ -102,6 +116,15 @@ public:
    */
   virtual void drop(void) = 0;
 
+public:
+  /**
+   * @brief Return the first edge to this node, or nullptr if there is no user
+   *
+   * The other edges are reached with Use::next(). This allows a caller to redirect
+   * some of the users only, while replace(node).with(...) redirects all of them.
+   */
+  Use *uses(void) const { return _uses; }
+
 private:
   /**
    * @brief Associated Graph
@@ -111,11 +134,13 @@ private:
   Graph *_graph = nullptr;
 
   /**
-   * @brief The edges to a node that uses this node as its argument
+   * @brief The first edge to a node that uses this node as its argument
+   *
+   * The edges form an intrusive list through "Use", so linking and unlinking an edge is O(1).
    *
    * @note "succs" function below accesses this private field.
    */
-  std::set<Use *> _uses;
+  Use *_uses = nullptr;
 };
 
 /// @brief Enumerate all the predecessors of a given node
@@ -41,13 +41,7 @@ public:
     return ObjectPool<Node>::take<Derived>(std::move(ptr));
   }
 
-  void destroy(Node *node)
-  {
-    if (!ObjectPool<Node>::erase(node))
-    {
-      throw std::invalid_argument{"node"};
-    }
-  }
+  void destroy(Node *node);
 
 private:
   /// Only "Graph" is permitted to invoke this private method.
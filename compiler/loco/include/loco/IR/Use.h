@@ -61,9 +61,17 @@ public:
 public:
   Node *user(void) const { return _user; }
 
+public:
+  /// @brief Return the next edge to the same node (in no particular order)
+  Use *next(void) const { return _next; }
+
 private:
   Node *_node{nullptr};
   Node *_user{nullptr};
+
+  // Neighbours in the use list of "_node"
+  Use *_prev{nullptr};
+  Use *_next{nullptr};
 };
 
 } // namespace loco
@@ -16,9 +16,12 @@
 
 #include "loco/IR/Algorithm.h"
 
+#include "loco/IR/Graph.h"
+
 #include <cassert>
+#include <mutex>
 #include <set>
-#include <stack>
+#include <unordered_set>
 
 namespace
 {
@@ -52,10 +55,43 @@ namespace loco
 // TODO Support cyclic graphs
 std::vector<loco::Node *> postorder_traversal(const std::vector<loco::Node *> &roots)
 {
+  // The result is cached per graph when every root belongs to the same graph
+  loco::Graph *g = nullptr;
+  for (uint32_t n = 0; n < roots.size(); ++n)
+  {
+    assert((roots.at(n) != nullptr) && "root is invalid");
+    if (n == 0)
+    {
+      g = roots.at(n)->graph();
+    }
+    else if (roots.at(n)->graph() != g)
+    {
+      g = nullptr;
+    }
+  }
+
+  std::unique_lock<std::mutex> lock;
+  uint64_t revision = 0;
+
+  if (g != nullptr)
+  {
+    lock = std::unique_lock<std::mutex>{g->_postorder_mutex};
+    revision = g->revision();
+
+    const auto &cache = g->_postorder_cache;
+    if (cache.valid && cache.revision == revision && cache.roots == roots)
+    {
+      return cache.order;
+    }
+  }
+
   std::vector<loco::Node *> res;
 
-  std::set<loco::Node *> visited_nodes;
-  std::stack<Frame> frames;
+  std::unordered_set<loco::Node *> visited_nodes;
+  std::vector<Frame> frames;
+
+  // Only a traversal that stays in "g" is cached, as other graphs do not invalidate it
+  bool cacheable = (g != nullptr);
 
   auto visited = [&visited_nodes](loco::Node *node) {
     return visited_nodes.find(node) != visited_nodes.end();
@@ -65,22 +101,22 @@ std::vector<loco::Node *> postorder_traversal(const std::vector<loco::Node *> &r
   // type.
   for (auto node : roots)
   {
-    assert((node != nullptr) && "root is invalid");
-    frames.push(Frame{node});
+    frames.emplace_back(node);
   }
 
   while (!frames.empty())
   {
-    auto &top_frame = frames.top();
+    auto &top_frame = frames.back();
 
     if (top_frame.pos() == -1)
     {
       if (visited(top_frame.ptr()))
       {
-        frames.pop();
+        frames.pop_back();
         continue;
       }
       visited_nodes.insert(top_frame.ptr());
+      cacheable = cacheable && (top_frame.node().graph() == g);
     }
 
     top_frame.advance();
@@ -94,7 +130,8 @@ std::vector<loco::Node *> postorder_traversal(const std::vector<loco::Node *> &r
       // NOTE "next" may be nullptr if a graph is under construction.
       if (auto next = top_frame.node().arg(top_frame.pos()))
       {
-        frames.push(Frame{next});
+        // NOTE "top_frame" is invalidated by emplace_back
+        frames.emplace_back(next);
       }
     }
     else
@@ -102,18 +139,25 @@ std::vector<loco::Node *> postorder_traversal(const std::vector<loco::Node *> &r
       // Let's visit the current argument (all the arguments are already visited)
       auto curr = top_frame.ptr();
       res.emplace_back(curr);
-      frames.pop();
+      frames.pop_back();
     }
   }
 
+  if (cacheable)
+  {
+    auto &cache = g->_postorder_cache;
+    cache.valid = true;
+    cache.revision = revision;
+    cache.roots = roots;
+    cache.order = res;
+  }
+
   return res;
 }
 
 std::set<loco::Node *> active_nodes(const std::vector<loco::Node *> &roots)
 {
-  // This implementation works but may be inefficient
-  //
-  // TODO Use efficient implementation if necessary
+  // NOTE postorder_traversal reuses its last result while the graph is unchanged
   auto nodes = postorder_traversal(roots);
   return std::set<loco::Node *>{nodes.begin(), nodes.end()};
 }
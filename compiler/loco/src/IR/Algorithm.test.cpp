@@ -102,6 +102,31 @@ TEST(AlgorithmTest, postorder_traversal_incomplte_graph)
   ASSERT_EQ(concat, seq.at(1));
 }
 
+TEST(AlgorithmTest, postorder_traversal_after_update)
+{
+  auto g = loco::make_graph();
+
+  auto pull_1 = g->nodes()->create<loco::Pull>();
+  auto pull_2 = g->nodes()->create<loco::Pull>();
+  auto push = g->nodes()->create<loco::Push>();
+
+  push->from(pull_1);
+
+  auto seq_1 = loco::postorder_traversal({push});
+
+  ASSERT_EQ(2, seq_1.size());
+  ASSERT_EQ(pull_1, seq_1.at(0));
+
+  // The same traversal SHOULD NOT return a stale sequence after the graph is changed
+  push->from(pull_2);
+
+  auto seq_2 = loco::postorder_traversal({push});
+
+  ASSERT_EQ(2, seq_2.size());
+  ASSERT_EQ(pull_2, seq_2.at(0));
+  ASSERT_EQ(push, seq_2.at(1));
+}
+
 TEST(AlgorithmTest, active_nodes)
 {
   auto g = loco::make_graph();
@@ -82,6 +82,44 @@ TEST(GraphTest, create_and_destroy_node)
   ASSERT_THROW(g->nodes()->destroy(pull), std::invalid_argument);
 }
 
+TEST(GraphTest, destroy_node_keeps_order)
+{
+  auto g = loco::make_graph();
+
+  auto pull_0 = g->nodes()->create<loco::Pull>();
+  auto pull_1 = g->nodes()->create<loco::Pull>();
+  auto pull_2 = g->nodes()->create<loco::Pull>();
+
+  g->nodes()->destroy(pull_1);
+  auto pull_3 = g->nodes()->create<loco::Pull>();
+  g->nodes()->destroy(pull_0);
+
+  ASSERT_EQ(2, g->nodes()->size());
+  ASSERT_EQ(pull_2, g->nodes()->at(0));
+  ASSERT_EQ(pull_3, g->nodes()->at(1));
+}
+
+TEST(GraphTest, revision)
+{
+  auto g = loco::make_graph();
+
+  auto pull = g->nodes()->create<loco::Pull>();
+  auto push = g->nodes()->create<loco::Push>();
+
+  auto rev_0 = g->revision();
+  push->from(pull);
+  auto rev_1 = g->revision();
+  ASSERT_NE(rev_0, rev_1);
+
+  // Setting the same argument again is not a change
+  push->from(pull);
+  ASSERT_EQ(rev_1, g->revision());
+
+  push->from(nullptr);
+  g->nodes()->destroy(push);
+  ASSERT_NE(rev_1, g->revision());
+}
+
 TEST(GraphTest, create_input)
 {
   auto g = loco::make_graph();
@@ -138,8 +176,10 @@ TEST(GraphTest, consturctor_with_param_node)
   ASSERT_EQ(22, test_node->i());
   ASSERT_FLOAT_EQ(test_node->f(), 11.11);
 
-  ASSERT_NO_THROW(g->nodes()->destroy(test_node));
-  ASSERT_THROW(g->nodes()->destroy(test_node), std::invalid_argument);
+  // Conversion to a virtual base reads the object, so it is done before destruction
+  loco::Node *node = test_node;
+  ASSERT_NO_THROW(g->nodes()->destroy(node));
+  ASSERT_THROW(g->nodes()->destroy(node), std::invalid_argument);
 }
 
 TEST(GraphTest, getters_over_const_instance)
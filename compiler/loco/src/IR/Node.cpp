@@ -17,7 +17,119 @@
 #include "loco/IR/Node.h"
 #include "loco/IR/Use.h"
 
+#include <algorithm>
 #include <cassert>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+// AddressSanitizer cannot detect use-after-free of arena blocks, which are recycled without
+// being returned to the system. Nodes are allocated by the global allocator in ASan builds.
+#if defined(__SANITIZE_ADDRESS__)
+#define LOCO_NODE_ARENA 0
+#elif defined(__has_feature)
+#if __has_feature(address_sanitizer)
+#define LOCO_NODE_ARENA 0
+#endif
+#endif
+
+#ifndef LOCO_NODE_ARENA
+#define LOCO_NODE_ARENA 1
+#endif
+
+namespace
+{
+
+/**
+ * @brief Size-classed arena for nodes
+ *
+ * Memory is taken from the system in large chunks and is never returned. Freed blocks are kept
+ * in a free list per size class and reused by the next node of that class.
+ */
+class NodeArena final
+{
+private:
+  static constexpr std::size_t granularity = 16;
+  static constexpr std::size_t max_block_size = 1024;
+  static constexpr std::size_t chunk_size = 64 * 1024;
+
+  struct FreeBlock
+  {
+    FreeBlock *next;
+  };
+
+public:
+  static NodeArena *get(void)
+  {
+    // NOTE This arena is never destroyed as nodes may outlive any static object
+    static NodeArena *arena = new NodeArena;
+    return arena;
+  }
+
+public:
+  void *allocate(std::size_t size)
+  {
+    if (size > max_block_size)
+    {
+      return ::operator new(size);
+    }
+
+    const auto cls = size_class(size);
+
+    std::lock_guard<std::mutex> lock{_mutex};
+
+    if (auto block = _free[cls])
+    {
+      _free[cls] = block->next;
+      return block;
+    }
+
+    const auto block_size = (cls + 1) * granularity;
+
+    if (_cursor == nullptr || _cursor + block_size > _limit)
+    {
+      _chunks.emplace_back(new char[chunk_size]);
+      _cursor = _chunks.back().get();
+      _limit = _cursor + chunk_size;
+    }
+
+    auto res = _cursor;
+    _cursor += block_size;
+    return res;
+  }
+
+  void deallocate(void *ptr, std::size_t size)
+  {
+    if (size > max_block_size)
+    {
+      ::operator delete(ptr);
+      return;
+    }
+
+    const auto cls = size_class(size);
+
+    std::lock_guard<std::mutex> lock{_mutex};
+
+    auto block = static_cast<FreeBlock *>(ptr);
+    block->next = _free[cls];
+    _free[cls] = block;
+  }
+
+private:
+  static std::size_t size_class(std::size_t size)
+  {
+    return (std::max<std::size_t>(size, 1) - 1) / granularity;
+  }
+
+private:
+  std::mutex _mutex;
+  std::vector<std::unique_ptr<char[]>> _chunks;
+  char *_cursor = nullptr;
+  char *_limit = nullptr;
+  FreeBlock *_free[max_block_size / granularity] = {nullptr};
+};
+
+} // namespace
 
 namespace loco
 {
@@ -25,7 +137,26 @@ namespace loco
 Node::~Node()
 {
   // To detect dangling references
-  assert(_uses.size() == 0);
+  assert(_uses == nullptr);
+}
+
+void *Node::operator new(std::size_t size)
+{
+#if LOCO_NODE_ARENA
+  return NodeArena::get()->allocate(size);
+#else
+  return ::operator new(size);
+#endif
+}
+
+void Node::operator delete(void *ptr, std::size_t size)
+{
+#if LOCO_NODE_ARENA
+  NodeArena::get()->deallocate(ptr, size);
+#else
+  (void)size;
+  ::operator delete(ptr);
+#endif
 }
 
 std::set<Node *> preds(const Node *node)
@@ -47,7 +178,7 @@ std::set<Node *> succs(const Node *node)
 {
   std::set<Node *> res;
 
-  for (auto use : node->_uses)
+  for (auto use = node->_uses; use != nullptr; use = use->next())
   {
     auto user = use->user();
     assert(user != nullptr);
@@ -70,11 +201,8 @@ void Subst<SubstQualifier::Default>::with(Node *into) const
     return;
   }
 
-  auto *uses = &(_from->_uses);
-
-  while (!uses->empty())
+  while (auto use = _from->_uses)
   {
-    auto use = *(uses->begin());
     use->node(into);
   }
 }
@@ -49,6 +49,64 @@ TEST(NodeTest, succs)
   ASSERT_NE(succs.find(&succ_2), succs.end());
 }
 
+TEST(NodeTest, succs_after_unlink)
+{
+  ::MockupNode node;
+  ::MockupNode succ_1;
+  ::MockupNode succ_2;
+  ::MockupNode succ_3;
+
+  succ_1.in(&node);
+  succ_2.in(&node);
+  succ_3.in(&node);
+
+  // Unlink an edge in the middle of the use list
+  succ_2.in(nullptr);
+
+  auto succs = loco::succs(&node);
+
+  ASSERT_EQ(2, succs.size());
+  ASSERT_NE(succs.find(&succ_1), succs.end());
+  ASSERT_EQ(succs.find(&succ_2), succs.end());
+  ASSERT_NE(succs.find(&succ_3), succs.end());
+
+  succ_1.in(nullptr);
+  succ_3.in(nullptr);
+
+  ASSERT_TRUE(loco::succs(&node).empty());
+}
+
+TEST(NodeTest, redirect_some_uses)
+{
+  ::MockupNode node;
+  ::MockupNode into;
+  ::MockupNode succ_1;
+  ::MockupNode succ_2;
+
+  succ_1.in(&node);
+  succ_2.in(&node);
+
+  // Redirect the edge from succ_2 only
+  for (auto use = node.uses(); use != nullptr; use = use->next())
+  {
+    if (use->user() == &succ_2)
+    {
+      use->node(&into);
+      break;
+    }
+  }
+
+  ASSERT_EQ(&node, succ_1.in());
+  ASSERT_EQ(&into, succ_2.in());
+  ASSERT_EQ(1, loco::succs(&node).size());
+  ASSERT_EQ(1, loco::succs(&into).size());
+
+  succ_1.in(nullptr);
+  succ_2.in(nullptr);
+
+  ASSERT_EQ(nullptr, node.uses());
+}
+
 TEST(NodeTest, replace_with)
 {
   ::MockupNode node_1;
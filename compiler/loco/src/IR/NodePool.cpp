@@ -15,6 +15,9 @@
  */
 
 #include "loco/IR/NodePool.h"
+#include "loco/IR/Graph.h"
+
+#include <stdexcept>
 
 namespace loco
 {
@@ -28,4 +31,17 @@ NodePool::~NodePool()
   }
 }
 
+void NodePool::destroy(Node *node)
+{
+  if (!ObjectPool<Node>::erase(node))
+  {
+    throw std::invalid_argument{"node"};
+  }
+
+  if (_graph != nullptr)
+  {
+    _graph->touch();
+  }
+}
+
 } // namespace loco
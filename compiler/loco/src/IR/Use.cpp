@@ -16,6 +16,7 @@
 
 #include "loco/IR/Use.h"
 #include "loco/IR/Node.h"
+#include "loco/IR/Graph.h"
 
 #include <cassert>
 
@@ -24,10 +25,31 @@ namespace loco
 
 void Use::node(Node *node)
 {
+  if (_node == node)
+  {
+    return;
+  }
+
   if (_node != nullptr)
   {
-    assert(_node->_uses.find(this) != _node->_uses.end());
-    _node->_uses.erase(this);
+    // Unlink itself from the use list of the current node
+    if (_prev != nullptr)
+    {
+      _prev->_next = _next;
+    }
+    else
+    {
+      assert(_node->_uses == this);
+      _node->_uses = _next;
+    }
+
+    if (_next != nullptr)
+    {
+      _next->_prev = _prev;
+    }
+
+    _prev = nullptr;
+    _next = nullptr;
     _node = nullptr;
   }
 
@@ -36,10 +58,21 @@ void Use::node(Node *node)
   if (node != nullptr)
   {
     _node = node;
-    _node->_uses.insert(this);
+    _next = node->_uses;
+    if (_next != nullptr)
+    {
+      _next->_prev = this;
+    }
+    node->_uses = this;
   }
 
   assert(_node == node);
+
+  // Edges are changed, so cached traversals over the graph are no longer valid
+  if (_user != nullptr && _user->graph() != nullptr)
+  {
+    _user->graph()->touch();
+  }
 }
 
 } // namespace loco
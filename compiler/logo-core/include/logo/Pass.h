@@ -41,6 +41,31 @@ public:
   virtual bool run(loco::Graph *graph) = 0;
 };
 
+/**
+ * @brief Pass which rewrites the graph around a single node
+ *
+ * PhaseRunner<PhaseStrategy::Worklist> runs this kind of pass only over the nodes near
+ * changes, instead of the whole graph. A pass whose decision depends on nodes further than
+ * direct predecessors or successors of changed nodes should remain a graph-level Pass.
+ * Created and removed nodes are found from the direct neighbours of the node, so the pass
+ * should change only the node itself and the inputs of its successors.
+ */
+class NodePass : public Pass
+{
+public:
+  /**
+   * @brief  Run the pass on the node
+   *
+   * @return false if there was nothing changed
+   */
+  virtual bool apply(loco::Node *node) = 0;
+
+  /**
+   * @brief  Run the pass on all the active nodes of the graph
+   */
+  bool run(loco::Graph *graph) override;
+};
+
 std::string pass_name(const Pass *);
 
 } // namespace logo
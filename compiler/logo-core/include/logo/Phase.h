@@ -21,6 +21,7 @@
 
 #include <loco.h>
 
+#include <chrono>
 #include <vector>
 #include <memory>
 
@@ -70,9 +71,18 @@ public:
   void changed(bool changed) { _changed = changed; }
   bool changed(void) const { return _changed; }
 
+  // Number of changes made by the pass (node-level changes for NodePass)
+  void changes(uint32_t changes) { _changes = changes; }
+  uint32_t changes(void) const { return _changes; }
+
+  void elapsed(std::chrono::microseconds elapsed) { _elapsed = elapsed; }
+  std::chrono::microseconds elapsed(void) const { return _elapsed; }
+
 private:
   const Pass *_pass;
   bool _changed;
+  uint32_t _changes = 0;
+  std::chrono::microseconds _elapsed{0};
 };
 
 struct PhaseEventListener
@@ -130,14 +140,16 @@ public:
     }
   }
 
-  void notifyPassEnd(Pass *pass, bool changed) const
+  void notifyPassEnd(Pass *pass, uint32_t changes, std::chrono::microseconds elapsed) const
   {
     if (_listener)
     {
       PhaseEventInfo<PhaseEvent::PassEnd> info;
 
       info.pass(pass);
-      info.changed(changed);
+      info.changed(changes > 0);
+      info.changes(changes);
+      info.elapsed(elapsed);
 
       _listener->notify(&info);
     }
@@ -153,6 +165,8 @@ enum class PhaseStrategy
   Saturate,
   // Same as Saturate but will restart from the first when there is a change
   Restart,
+  // Run NodePass(es) only over the nodes around changes until there is no change
+  Worklist,
 };
 
 template <PhaseStrategy S> class PhaseRunner;
@@ -187,6 +201,21 @@ private:
   loco::Graph *_graph;
 };
 
+template <> class PhaseRunner<PhaseStrategy::Worklist> final : public PhaseRunnerMixinObservable
+{
+public:
+  PhaseRunner(loco::Graph *graph) : _graph{graph}
+  {
+    // DO NOTHING
+  }
+
+public:
+  void run(const Phase &) const;
+
+private:
+  loco::Graph *_graph;
+};
+
 } // namespace logo
 
 #endif // __LOGO_PHASE_H__
@@ -19,6 +19,18 @@
 namespace logo
 {
 
+bool NodePass::run(loco::Graph *graph)
+{
+  bool changed = false;
+
+  for (auto node : loco::postorder_traversal(loco::output_nodes(graph)))
+  {
+    changed |= apply(node);
+  }
+
+  return changed;
+}
+
 std::string pass_name(const Pass *t)
 {
   if (t->name() == nullptr)
@@ -16,6 +16,149 @@
 
 #include <logo/Phase.h>
 
+#include <loco/IR/Use.h>
+
+#include <algorithm>
+#include <deque>
+#include <unordered_set>
+
+namespace
+{
+
+using Clock = std::chrono::steady_clock;
+
+std::chrono::microseconds elapsed_since(const Clock::time_point &begin)
+{
+  return std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - begin);
+}
+
+/**
+ * @brief Queue of nodes to visit, which ignores nodes already in the queue
+ */
+class NodeQueue final
+{
+public:
+  bool empty(void) const { return _queue.empty(); }
+
+  void push(loco::Node *node)
+  {
+    if (_queued.insert(node).second)
+      _queue.push_back(node);
+  }
+
+  loco::Node *pop(void)
+  {
+    auto node = _queue.front();
+    _queue.pop_front();
+    _queued.erase(node);
+    return node;
+  }
+
+private:
+  std::deque<loco::Node *> _queue;
+  std::unordered_set<loco::Node *> _queued;
+};
+
+/**
+ * @brief Return the node with its arguments and users
+ *
+ * NOTE This walks arguments and uses directly instead of preds/succs, which build std::set for
+ *      every call, as this is called for every node visited. Duplicates are filtered by NodeQueue.
+ */
+std::vector<loco::Node *> neighbours(loco::Node *node)
+{
+  std::vector<loco::Node *> nodes{node};
+  for (uint32_t n = 0; n < node->arity(); ++n)
+  {
+    if (auto pred = node->arg(n))
+      nodes.emplace_back(pred);
+  }
+  for (auto use = node->uses(); use != nullptr; use = use->next())
+    nodes.emplace_back(use->user());
+  return nodes;
+}
+
+/**
+ * @brief Nodes reachable from graph outputs, which are updated only around changes
+ *
+ * NOTE Nodes not reachable from outputs are not visited, as in the other strategies
+ */
+class ActiveNodes final
+{
+public:
+  explicit ActiveNodes(loco::Graph *g) { reset(g); }
+
+public:
+  bool contains(loco::Node *node) const { return _nodes.find(node) != _nodes.end(); }
+
+  void reset(loco::Graph *g)
+  {
+    auto outputs = loco::output_nodes(g);
+    auto nodes = loco::active_nodes(outputs);
+    _outputs = std::unordered_set<loco::Node *>(outputs.begin(), outputs.end());
+    _nodes = std::unordered_set<loco::Node *>(nodes.begin(), nodes.end());
+  }
+
+  /**
+   * @brief Update the set after the graph has changed only around the given nodes
+   *
+   * @return nodes which have become active
+   */
+  std::vector<loco::Node *> update(const std::vector<loco::Node *> &around)
+  {
+    std::vector<loco::Node *> added;
+    std::vector<loco::Node *> stack;
+
+    // Created (or revived) nodes are reachable through predecessors of active nodes
+    for (auto node : around)
+    {
+      if (contains(node))
+        stack.emplace_back(node);
+    }
+    while (!stack.empty())
+    {
+      auto node = stack.back();
+      stack.pop_back();
+      for (auto pred : loco::preds(node))
+      {
+        if (_nodes.insert(pred).second)
+        {
+          added.emplace_back(pred);
+          stack.emplace_back(pred);
+        }
+      }
+    }
+
+    // As the graph is acyclic, a node is no longer reachable when no active node uses it
+    stack = around;
+    while (!stack.empty())
+    {
+      auto node = stack.back();
+      stack.pop_back();
+      if (!contains(node) || _outputs.find(node) != _outputs.end())
+        continue;
+
+      bool used = false;
+      for (auto succ : loco::succs(node))
+        used = used || contains(succ);
+      if (used)
+        continue;
+
+      _nodes.erase(node);
+      for (auto pred : loco::preds(node))
+        stack.emplace_back(pred);
+    }
+
+    return added;
+  }
+
+private:
+  std::unordered_set<loco::Node *> _outputs;
+  std::unordered_set<loco::Node *> _nodes;
+};
+
+} // namespace
+
 namespace logo
 {
 
@@ -31,10 +174,11 @@ void PhaseRunner<PhaseStrategy::Saturate>::run(const Phase &phase) const
     {
       notifyPassBegin(pass.get());
 
+      auto begin = Clock::now();
       bool pass_changed = pass->run(_graph);
       changed = changed || pass_changed;
 
-      notifyPassEnd(pass.get(), pass_changed);
+      notifyPassEnd(pass.get(), pass_changed ? 1 : 0, elapsed_since(begin));
     }
   }
 
@@ -53,10 +197,11 @@ void PhaseRunner<PhaseStrategy::Restart>::run(const Phase &phase) const
     {
       notifyPassBegin(pass.get());
 
+      auto begin = Clock::now();
       bool pass_changed = pass->run(_graph);
       changed = changed || pass_changed;
 
-      notifyPassEnd(pass.get(), pass_changed);
+      notifyPassEnd(pass.get(), pass_changed ? 1 : 0, elapsed_since(begin));
 
       if (changed)
       {
@@ -68,4 +213,113 @@ void PhaseRunner<PhaseStrategy::Restart>::run(const Phase &phase) const
   notifyPhaseEnd();
 }
 
+void PhaseRunner<PhaseStrategy::Worklist>::run(const Phase &phase) const
+{
+  notifyPhaseBegin();
+
+  // Each NodePass has its own queue of nodes to visit, and each graph-level Pass is marked dirty
+  // when the graph has changed since its last run
+  std::vector<NodeQueue> queues(phase.size());
+  std::vector<bool> dirty(phase.size(), true);
+  ActiveNodes active{_graph};
+
+  auto enqueue = [&](loco::Node *node) {
+    for (auto &queue : queues)
+      queue.push(node);
+  };
+
+  auto enqueue_all = [&](void) {
+    for (auto node : loco::postorder_traversal(loco::output_nodes(_graph)))
+      enqueue(node);
+  };
+
+  // The pass which has made the change is also marked, as it may have more to do
+  auto mark_dirty = [&](void) { std::fill(dirty.begin(), dirty.end(), true); };
+
+  enqueue_all();
+
+  for (bool changed = true; changed;)
+  {
+    changed = false;
+
+    for (uint32_t n = 0; n < phase.size(); ++n)
+    {
+      auto pass = phase.at(n).get();
+      auto node_pass = dynamic_cast<NodePass *>(pass);
+
+      if (node_pass == nullptr)
+      {
+        if (!dirty[n])
+          continue;
+
+        notifyPassBegin(pass);
+
+        auto begin = Clock::now();
+        bool pass_changed = pass->run(_graph);
+        dirty[n] = false;
+
+        notifyPassEnd(pass, pass_changed ? 1 : 0, elapsed_since(begin));
+
+        if (pass_changed)
+        {
+          // There is no way to know what was changed
+          active.reset(_graph);
+          enqueue_all();
+          mark_dirty();
+          changed = true;
+        }
+        continue;
+      }
+
+      if (queues.at(n).empty())
+        continue;
+
+      notifyPassBegin(pass);
+
+      auto begin = Clock::now();
+      uint32_t changes = 0;
+      while (!queues.at(n).empty())
+      {
+        auto node = queues.at(n).pop();
+        if (!active.contains(node))
+          continue;
+
+        // Nodes around the node before the change
+        auto affected = neighbours(node);
+
+        if (!node_pass->apply(node))
+          continue;
+
+        changes++;
+
+        // Nodes around the node after the change, and nodes created (or revived) by the pass
+        auto current = neighbours(node);
+        affected.insert(affected.end(), current.begin(), current.end());
+        for (auto added : active.update(affected))
+        {
+          auto around = neighbours(added);
+          affected.insert(affected.end(), around.begin(), around.end());
+        }
+
+        // Every pass including this one visits them again
+        for (auto affected_node : affected)
+        {
+          if (active.contains(affected_node))
+            enqueue(affected_node);
+        }
+      }
+
+      notifyPassEnd(pass, changes, elapsed_since(begin));
+
+      if (changes > 0)
+      {
+        mark_dirty();
+        changed = true;
+      }
+    }
+  }
+
+  notifyPhaseEnd();
+}
+
 } // namespace logo
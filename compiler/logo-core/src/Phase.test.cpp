@@ -0,0 +1,271 @@
+/*
+ * Copyright (c) 2019 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <logo/Phase.h>
+
+#include <loco.h>
+
+#include <gtest/gtest.h>
+
+#include <map>
+
+namespace
+{
+
+// Pull - Forward - Forward - Forward - Push
+struct ForwardChain
+{
+  ForwardChain()
+  {
+    pull = g->nodes()->create<loco::Pull>();
+    loco::link(g->inputs()->create(), pull);
+
+    loco::Node *last = pull;
+    for (uint32_t n = 0; n < 3; ++n)
+    {
+      auto forward = g->nodes()->create<loco::Forward>();
+      forward->input(last);
+      last = forward;
+    }
+
+    push = g->nodes()->create<loco::Push>();
+    push->from(last);
+    loco::link(g->outputs()->create(), push);
+  }
+
+  std::unique_ptr<loco::Graph> g = loco::make_graph();
+  loco::Pull *pull = nullptr;
+  loco::Push *push = nullptr;
+};
+
+struct RemoveForward final : public logo::NodePass
+{
+  const char *name(void) const final { return "RemoveForward"; }
+
+  bool apply(loco::Node *node) final
+  {
+    auto forward = dynamic_cast<loco::Forward *>(node);
+    if (forward == nullptr)
+      return false;
+
+    loco::replace(forward).with(forward->input());
+    return true;
+  }
+};
+
+// Replace ReLU with a new Forward node
+struct ReLUToForward final : public logo::NodePass
+{
+  const char *name(void) const final { return "ReLUToForward"; }
+
+  bool apply(loco::Node *node) final
+  {
+    auto relu = dynamic_cast<loco::ReLU *>(node);
+    if (relu == nullptr)
+      return false;
+
+    auto forward = node->graph()->nodes()->create<loco::Forward>();
+    forward->input(relu->input());
+    loco::replace(relu).with(forward);
+    return true;
+  }
+};
+
+// Remove the first Forward node found, one at a time
+struct RemoveOneForward final : public logo::Pass
+{
+  const char *name(void) const final { return "RemoveOneForward"; }
+
+  bool run(loco::Graph *g) final
+  {
+    for (auto node : loco::active_nodes(loco::output_nodes(g)))
+    {
+      if (auto forward = dynamic_cast<loco::Forward *>(node))
+      {
+        loco::replace(forward).with(forward->input());
+        return true;
+      }
+    }
+    return false;
+  }
+};
+
+struct CountRun final : public logo::Pass
+{
+  const char *name(void) const final { return "CountRun"; }
+
+  bool run(loco::Graph *) final
+  {
+    ++count;
+    return false;
+  }
+
+  uint32_t count = 0;
+};
+
+struct ChangeCollector final : public logo::PhaseEventListener
+{
+  void notify(const logo::PhaseEventInfo<logo::PhaseEvent::PassEnd> *info) final
+  {
+    changes[logo::pass_name(info->pass())] += info->changes();
+  }
+
+  std::map<std::string, uint32_t> changes;
+};
+
+} // namespace
+
+TEST(LogoPhaseTests, node_pass_run_over_graph)
+{
+  ForwardChain chain;
+  RemoveForward pass;
+
+  ASSERT_TRUE(pass.run(chain.g.get()));
+  ASSERT_EQ(chain.push->from(), chain.pull);
+  ASSERT_FALSE(pass.run(chain.g.get()));
+}
+
+TEST(LogoPhaseTests, worklist_strategy)
+{
+  ForwardChain chain;
+
+  logo::Phase phase;
+  phase.emplace_back(std::make_unique<RemoveForward>());
+  phase.emplace_back(std::make_unique<CountRun>());
+  auto count_run = dynamic_cast<CountRun *>(phase.back().get());
+
+  ChangeCollector collector;
+  logo::PhaseRunner<logo::PhaseStrategy::Worklist> runner{chain.g.get()};
+  runner.attach(&collector);
+  runner.run(phase);
+
+  ASSERT_EQ(chain.push->from(), chain.pull);
+  ASSERT_EQ(collector.changes["RemoveForward"], 3);
+  ASSERT_EQ(collector.changes["CountRun"], 0);
+  // Graph-level pass is not run again when nothing has changed since its last run
+  ASSERT_EQ(count_run->count, 1);
+}
+
+TEST(LogoPhaseTests, saturate_strategy_reports_changes)
+{
+  ForwardChain chain;
+
+  logo::Phase phase;
+  phase.emplace_back(std::make_unique<RemoveForward>());
+
+  ChangeCollector collector;
+  logo::PhaseRunner<logo::PhaseStrategy::Saturate> runner{chain.g.get()};
+  runner.attach(&collector);
+  runner.run(phase);
+
+  ASSERT_EQ(chain.push->from(), chain.pull);
+  ASSERT_EQ(collector.changes["RemoveForward"], 1);
+}
+
+TEST(LogoPhaseTests, worklist_strategy_visits_created_nodes)
+{
+  // Pull - ReLU - ReLU - Push
+  auto g = loco::make_graph();
+  auto pull = g->nodes()->create<loco::Pull>();
+  loco::link(g->inputs()->create(), pull);
+  auto relu_1 = g->nodes()->create<loco::ReLU>();
+  relu_1->input(pull);
+  auto relu_2 = g->nodes()->create<loco::ReLU>();
+  relu_2->input(relu_1);
+  auto push = g->nodes()->create<loco::Push>();
+  push->from(relu_2);
+  loco::link(g->outputs()->create(), push);
+
+  // Forward nodes are created after RemoveForward has visited the graph once
+  logo::Phase phase;
+  phase.emplace_back(std::make_unique<RemoveForward>());
+  phase.emplace_back(std::make_unique<ReLUToForward>());
+
+  ChangeCollector collector;
+  logo::PhaseRunner<logo::PhaseStrategy::Worklist> runner{g.get()};
+  runner.attach(&collector);
+  runner.run(phase);
+
+  ASSERT_EQ(push->from(), pull);
+  ASSERT_EQ(collector.changes["ReLUToForward"], 2);
+  ASSERT_EQ(collector.changes["RemoveForward"], 2);
+}
+
+TEST(LogoPhaseTests, worklist_strategy_reruns_changed_pass)
+{
+  ForwardChain chain;
+
+  logo::Phase phase;
+  phase.emplace_back(std::make_unique<RemoveOneForward>());
+
+  ChangeCollector collector;
+  logo::PhaseRunner<logo::PhaseStrategy::Worklist> runner{chain.g.get()};
+  runner.attach(&collector);
+  runner.run(phase);
+
+  ASSERT_EQ(chain.push->from(), chain.pull);
+  ASSERT_EQ(collector.changes["RemoveOneForward"], 3);
+}
+
+TEST(LogoPhaseTests, worklist_strategy_same_as_saturate)
+{
+  auto make_phase = [](void) {
+    logo::Phase phase;
+    phase.emplace_back(std::make_unique<RemoveForward>());
+    phase.emplace_back(std::make_unique<ReLUToForward>());
+    phase.emplace_back(std::make_unique<RemoveOneForward>());
+    return phase;
+  };
+
+  // Pull - ReLU - Forward - ReLU - Forward - Push
+  struct Chain
+  {
+    Chain()
+    {
+      pull = g->nodes()->create<loco::Pull>();
+      loco::link(g->inputs()->create(), pull);
+
+      loco::Node *last = pull;
+      for (uint32_t n = 0; n < 2; ++n)
+      {
+        auto relu = g->nodes()->create<loco::ReLU>();
+        relu->input(last);
+        auto forward = g->nodes()->create<loco::Forward>();
+        forward->input(relu);
+        last = forward;
+      }
+
+      push = g->nodes()->create<loco::Push>();
+      push->from(last);
+      loco::link(g->outputs()->create(), push);
+    }
+
+    std::unique_ptr<loco::Graph> g = loco::make_graph();
+    loco::Pull *pull = nullptr;
+    loco::Push *push = nullptr;
+  };
+
+  Chain saturate;
+  logo::PhaseRunner<logo::PhaseStrategy::Saturate>{saturate.g.get()}.run(make_phase());
+
+  Chain worklist;
+  logo::PhaseRunner<logo::PhaseStrategy::Worklist>{worklist.g.get()}.run(make_phase());
+
+  ASSERT_EQ(saturate.push->from(), saturate.pull);
+  ASSERT_EQ(worklist.push->from(), worklist.pull);
+  ASSERT_EQ(loco::active_nodes(loco::output_nodes(saturate.g.get())).size(),
+            loco::active_nodes(loco::output_nodes(worklist.g.get())).size());
+}
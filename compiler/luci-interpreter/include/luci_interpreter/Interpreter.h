@@ -49,7 +49,8 @@ public:
 class Interpreter
 {
 public:
-  explicit Interpreter(const luci::Module *module);
+  // `num_threads` is the number of threads the kernels are allowed to use.
+  explicit Interpreter(const luci::Module *module, int32_t num_threads = 1);
 
   ~Interpreter();
 
@@ -64,6 +65,7 @@ public:
   const Tensor *getTensor(const loco::Node *node) { return _node_to_tensor[node]; }
 
 private:
+  std::unique_ptr<class ThreadPool> _thread_pool;
   std::unique_ptr<class RuntimeModule> _runtime_module;
 
   // Observer functionality support.
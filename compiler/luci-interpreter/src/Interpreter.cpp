@@ -69,11 +69,17 @@ private:
 
 } // namespace
 
-Interpreter::Interpreter(const luci::Module *module)
+Interpreter::Interpreter(const luci::Module *module, int32_t num_threads)
 {
+  if (num_threads < 1)
+    throw std::runtime_error("Number of threads should be positive.");
+
+  if (num_threads > 1)
+    _thread_pool = std::make_unique<ThreadPool>(num_threads);
+
   _runtime_to_ir = std::make_unique<RuntimeToIR>();
   _event_notifier = std::make_unique<EventNotifierImpl>(*_runtime_to_ir, _observers);
-  _runtime_module = std::make_unique<RuntimeModule>(_event_notifier.get());
+  _runtime_module = std::make_unique<RuntimeModule>(_event_notifier.get(), _thread_pool.get());
   ModuleLoader loader(module, _runtime_module.get(), *_runtime_to_ir, _node_to_tensor);
   loader.load();
 }
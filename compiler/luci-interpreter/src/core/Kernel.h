@@ -24,6 +24,8 @@
 namespace luci_interpreter
 {
 
+class ThreadPool;
+
 // Base class for all kernels.
 class Kernel
 {
@@ -47,10 +49,17 @@ public:
   // Executes the kernel.
   virtual void execute() const = 0;
 
+  // Sets the thread pool which the kernel may use to parallelize execution (can be nullptr).
+  void setThreadPool(ThreadPool *thread_pool) { _thread_pool = thread_pool; }
+  ThreadPool *getThreadPool() const { return _thread_pool; }
+
 protected:
   // NOTE Prefer not to use these in derived classes.
   const std::vector<const Tensor *> _inputs;
   const std::vector<Tensor *> _outputs;
+
+private:
+  ThreadPool *_thread_pool = nullptr;
 };
 
 // Base class for kernels with parameters.
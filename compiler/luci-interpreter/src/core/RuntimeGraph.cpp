@@ -47,6 +47,7 @@ void RuntimeGraph::setOutputTensors(const std::vector<Tensor *> &output_tensors)
 void RuntimeGraph::addKernel(std::unique_ptr<Kernel> &&kernel)
 {
   assert(kernel != nullptr);
+  kernel->setThreadPool(_owning_module->getThreadPool());
   _kernels.push_back(std::move(kernel));
 }
 
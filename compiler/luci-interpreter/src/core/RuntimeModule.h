@@ -19,6 +19,7 @@
 
 #include "core/RuntimeGraph.h"
 #include "core/EventNotifier.h"
+#include "core/ThreadPool.h"
 
 #include <memory>
 #include <vector>
@@ -29,9 +30,13 @@ namespace luci_interpreter
 class RuntimeModule
 {
 public:
-  explicit RuntimeModule(EventNotifier *event_notifier) : _event_notifier(event_notifier) {}
+  explicit RuntimeModule(EventNotifier *event_notifier, ThreadPool *thread_pool = nullptr)
+      : _event_notifier(event_notifier), _thread_pool(thread_pool)
+  {
+  }
 
   EventNotifier *getEventNotifier() const { return _event_notifier; }
+  ThreadPool *getThreadPool() const { return _thread_pool; }
 
   RuntimeGraph *addGraph()
   {
@@ -51,6 +56,7 @@ private:
   RuntimeGraph *getMainGraph() const { return _graphs[0].get(); }
 
   EventNotifier *const _event_notifier;
+  ThreadPool *const _thread_pool;
   std::vector<std::unique_ptr<RuntimeGraph>> _graphs;
 };
 
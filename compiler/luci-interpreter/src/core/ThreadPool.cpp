@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "core/ThreadPool.h"
+
+#include <cassert>
+
+namespace luci_interpreter
+{
+
+ThreadPool::ThreadPool(int32_t num_threads)
+{
+  assert(num_threads >= 1);
+  for (int32_t i = 1; i < num_threads; ++i)
+  {
+    _workers.emplace_back(&ThreadPool::workerLoop, this);
+  }
+}
+
+ThreadPool::~ThreadPool()
+{
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _stop = true;
+  }
+  _work_cond.notify_all();
+  for (std::thread &worker : _workers)
+  {
+    worker.join();
+  }
+}
+
+void ThreadPool::run(int32_t num_tasks, const std::function<void(int32_t)> &fn)
+{
+  if (_workers.empty() || num_tasks <= 1)
+  {
+    for (int32_t task = 0; task < num_tasks; ++task)
+      fn(task);
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    assert(_fn == nullptr);
+    _fn = &fn;
+    _num_tasks = num_tasks;
+    _next_task = 0;
+    _num_pending = num_tasks;
+    ++_generation;
+  }
+  _work_cond.notify_all();
+
+  runTasks();
+
+  std::unique_lock<std::mutex> lock(_mutex);
+  _done_cond.wait(lock, [this]() { return _num_pending == 0; });
+  _fn = nullptr;
+}
+
+void ThreadPool::runTasks()
+{
+  while (true)
+  {
+    const std::function<void(int32_t)> *fn = nullptr;
+    int32_t task = 0;
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      if (_fn == nullptr || _next_task >= _num_tasks)
+        return;
+      fn = _fn;
+      task = _next_task++;
+    }
+
+    (*fn)(task);
+
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      if (--_num_pending == 0)
+        _done_cond.notify_all();
+    }
+  }
+}
+
+void ThreadPool::workerLoop()
+{
+  uint64_t seen_generation = 0;
+  while (true)
+  {
+    {
+      std::unique_lock<std::mutex> lock(_mutex);
+      _work_cond.wait(lock, [&]() { return _stop || _generation != seen_generation; });
+      if (_stop)
+        return;
+      seen_generation = _generation;
+    }
+    runTasks();
+  }
+}
+
+} // namespace luci_interpreter
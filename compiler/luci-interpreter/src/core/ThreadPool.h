@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LUCI_INTERPRETER_CORE_THREADPOOL_H
+#define LUCI_INTERPRETER_CORE_THREADPOOL_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace luci_interpreter
+{
+
+// A fixed-size pool of worker threads used by kernels to parallelize their execution.
+class ThreadPool
+{
+public:
+  // `num_threads` is the total number of threads, including the calling one.
+  explicit ThreadPool(int32_t num_threads);
+
+  ThreadPool(const ThreadPool &) = delete;
+  ThreadPool &operator=(const ThreadPool &) = delete;
+
+  ~ThreadPool();
+
+  int32_t getNumThreads() const { return static_cast<int32_t>(_workers.size()) + 1; }
+
+  // Calls `fn(task)` for each task in [0, num_tasks) and waits until all of them are finished.
+  // The calling thread takes part in the execution. Must not be called from inside a task.
+  void run(int32_t num_tasks, const std::function<void(int32_t)> &fn);
+
+private:
+  void runTasks();
+  void workerLoop();
+
+private:
+  std::vector<std::thread> _workers;
+
+  std::mutex _mutex;
+  std::condition_variable _work_cond;
+  std::condition_variable _done_cond;
+
+  // State of the current `run` call, guarded by `_mutex`.
+  const std::function<void(int32_t)> *_fn = nullptr;
+  int32_t _num_tasks = 0;
+  int32_t _next_task = 0;
+  int32_t _num_pending = 0;
+  uint64_t _generation = 0;
+  bool _stop = false;
+};
+
+} // namespace luci_interpreter
+
+#endif // LUCI_INTERPRETER_CORE_THREADPOOL_H
@@ -76,9 +76,14 @@ void Add::evalFloat() const
   }
   else
   {
-    tflite::reference_ops::Add(params, getTensorShape(input1()), getTensorData<float>(input1()),
-                               getTensorShape(input2()), getTensorData<float>(input2()),
-                               getTensorShape(output()), getTensorData<float>(output()));
+    parallelForElements(getThreadPool(), output()->shape().num_elements(),
+                        [&](int32_t begin, int32_t end) {
+                          const tflite::RuntimeShape shape({end - begin});
+                          tflite::reference_ops::Add(
+                              params, shape, getTensorData<float>(input1()) + begin, shape,
+                              getTensorData<float>(input2()) + begin, shape,
+                              getTensorData<float>(output()) + begin);
+                        });
   }
 }
 
@@ -131,9 +136,14 @@ void Add::evalQuantized() const
   }
   else
   {
-    tflite::reference_ops::Add(params, getTensorShape(input1()), getTensorData<uint8_t>(input1()),
-                               getTensorShape(input2()), getTensorData<uint8_t>(input2()),
-                               getTensorShape(output()), getTensorData<uint8_t>(output()));
+    parallelForElements(getThreadPool(), output()->shape().num_elements(),
+                        [&](int32_t begin, int32_t end) {
+                          const tflite::RuntimeShape shape({end - begin});
+                          tflite::reference_ops::Add(
+                              params, shape, getTensorData<uint8_t>(input1()) + begin, shape,
+                              getTensorData<uint8_t>(input2()) + begin, shape,
+                              getTensorData<uint8_t>(output()) + begin);
+                        });
   }
 }
 
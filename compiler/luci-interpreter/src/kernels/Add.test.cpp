@@ -18,6 +18,8 @@
 #include "kernels/Add.h"
 #include "kernels/TestUtils.h"
 
+#include "core/ThreadPool.h"
+
 namespace luci_interpreter
 {
 namespace kernels
@@ -169,6 +171,78 @@ TEST(AddTest, Float)
   }
 }
 
+TEST(AddTest, FloatMultiThreaded)
+{
+  // Elements are large enough to be split into several slices
+  Shape shape{4, 100, 100, 1};
+  std::vector<float> input1_data(shape.num_elements());
+  std::vector<float> input2_data(shape.num_elements());
+  for (size_t i = 0; i < input1_data.size(); ++i)
+  {
+    input1_data[i] = static_cast<float>(static_cast<int>(i * 7 % 11) - 5) * 0.5f;
+    input2_data[i] = static_cast<float>(static_cast<int>(i * 5 % 13) - 6) * 0.25f;
+  }
+  Tensor input1_tensor = makeInputTensor<DataType::FLOAT32>(shape, input1_data);
+  Tensor input2_tensor = makeInputTensor<DataType::FLOAT32>(shape, input2_data);
+  Tensor ref_output_tensor = makeOutputTensor(DataType::FLOAT32);
+  Tensor output_tensor = makeOutputTensor(DataType::FLOAT32);
+
+  AddParams params{};
+  params.activation = Activation::RELU;
+
+  Add ref_kernel(&input1_tensor, &input2_tensor, &ref_output_tensor, params);
+  ref_kernel.configure();
+  ref_kernel.execute();
+
+  ThreadPool thread_pool(3);
+  Add kernel(&input1_tensor, &input2_tensor, &output_tensor, params);
+  kernel.setThreadPool(&thread_pool);
+  kernel.configure();
+  kernel.execute();
+
+  EXPECT_THAT(extractTensorData<float>(output_tensor),
+              ::testing::ElementsAreArray(extractTensorData<float>(ref_output_tensor)));
+  EXPECT_THAT(extractTensorShape(output_tensor),
+              ::testing::ElementsAreArray(extractTensorShape(ref_output_tensor)));
+}
+
+TEST(AddTest, Uint8MultiThreaded)
+{
+  std::pair<float, int32_t> quant_param = quantizationParams<uint8_t>(-3.f, 3.f);
+
+  // Elements are large enough to be split into several slices
+  Shape shape{4, 100, 100, 1};
+  std::vector<uint8_t> input1_data(shape.num_elements());
+  std::vector<uint8_t> input2_data(shape.num_elements());
+  for (size_t i = 0; i < input1_data.size(); ++i)
+  {
+    input1_data[i] = static_cast<uint8_t>(i * 7 % 251);
+    input2_data[i] = static_cast<uint8_t>(i * 5 % 241);
+  }
+  Tensor input1_tensor{DataType::U8, shape, {{quant_param.first}, {quant_param.second}}, ""};
+  Tensor input2_tensor{DataType::U8, shape, {{quant_param.first}, {quant_param.second}}, ""};
+  input1_tensor.writeData(input1_data.data(), input1_data.size() * sizeof(uint8_t));
+  input2_tensor.writeData(input2_data.data(), input2_data.size() * sizeof(uint8_t));
+  Tensor ref_output_tensor = makeOutputTensor(DataType::U8, quant_param.first, quant_param.second);
+  Tensor output_tensor = makeOutputTensor(DataType::U8, quant_param.first, quant_param.second);
+
+  AddParams params{};
+  params.activation = Activation::NONE;
+
+  Add ref_kernel(&input1_tensor, &input2_tensor, &ref_output_tensor, params);
+  ref_kernel.configure();
+  ref_kernel.execute();
+
+  ThreadPool thread_pool(3);
+  Add kernel(&input1_tensor, &input2_tensor, &output_tensor, params);
+  kernel.setThreadPool(&thread_pool);
+  kernel.configure();
+  kernel.execute();
+
+  EXPECT_THAT(extractTensorData<uint8_t>(output_tensor),
+              ::testing::ElementsAreArray(extractTensorData<uint8_t>(ref_output_tensor)));
+}
+
 } // namespace
 } // namespace kernels
 } // namespace luci_interpreter
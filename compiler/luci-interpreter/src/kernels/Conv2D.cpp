@@ -18,10 +18,12 @@
 
 #include "kernels/Utils.h"
 
+#include "core/ThreadPool.h"
+
 #include <tensorflow/lite/kernels/internal/optimized/legacy_optimized_ops.h>
+#include <tensorflow/lite/kernels/internal/reference/integer_ops/conv.h>
 
 #include <stdexcept>
-#include <thread>
 
 namespace luci_interpreter
 {
@@ -43,8 +45,11 @@ void Conv2D::configure()
   // (2) | float int8   float float  | hybrid
   // (3) | uint8 uint8  int32 uint8  | quantized
   // (4) | int8  int8   int32 int8   | quantized per channel
+  // (5) | int16 int8   int64 int16  | quantized per channel 16x8
   //
-  // We only support (1) and (3) for now.
+  // We only support (1), (3) and (4) for now.
+  // NOTE (5) is not supported as TensorFlow Lite v2.1.0, whose kernels are used here, does not
+  //      have the 16x8 kernel yet.
   if (input()->element_type() == DataType::FLOAT32 && filter()->element_type() == DataType::FLOAT32)
   {
     assert(bias() == nullptr || bias()->element_type() == DataType::FLOAT32);
@@ -53,6 +58,18 @@ void Conv2D::configure()
   {
     assert(bias() == nullptr || bias()->element_type() == DataType::S32);
   }
+  else if (input()->element_type() == DataType::S8 && filter()->element_type() == DataType::S8)
+  {
+    LUCI_INTERPRETER_CHECK(filter()->quantized_dimension() == 0);
+    LUCI_INTERPRETER_CHECK(filter()->scales().size() ==
+                           static_cast<size_t>(filter()->shape().dim(0)));
+    LUCI_INTERPRETER_CHECK(filter()->zero_points().size() == filter()->scales().size());
+    for (auto zero_point : filter()->zero_points())
+    {
+      LUCI_INTERPRETER_CHECK(zero_point == 0);
+    }
+    LUCI_INTERPRETER_CHECK(bias() == nullptr || bias()->element_type() == DataType::S32);
+  }
   else
   {
     throw std::runtime_error("Unsupported type.");
@@ -94,7 +111,9 @@ void Conv2D::configure()
       _params.dilation_height_factor != 1 || _params.dilation_width_factor != 1;
   const bool need_non_dilated_im2col = _params.stride_height != 1 || _params.stride_width != 1 ||
                                        filter_height != 1 || filter_width != 1;
-  const bool need_im2col = need_dilated_im2col || need_non_dilated_im2col;
+  // NOTE Per-channel int8 kernel does not use Im2Col
+  const bool need_im2col = input()->element_type() != DataType::S8 &&
+                           (need_dilated_im2col || need_non_dilated_im2col);
   if (need_im2col)
   {
     const int input_depth = input_shape.dim(3);
@@ -103,6 +122,13 @@ void Conv2D::configure()
     _im2col =
         std::make_unique<Tensor>(input()->element_type(), im2col_shape, AffineQuantization{}, "");
   }
+
+  // Output multipliers of per-channel kernel do not change among executions
+  if (input()->element_type() == DataType::S8)
+  {
+    quantizeChannelMultipliers(input()->scale(), filter()->scales(), output()->scale(),
+                               &_output_multipliers, &_output_shifts);
+  }
 }
 
 void Conv2D::execute() const
@@ -119,6 +145,9 @@ void Conv2D::execute() const
     case DataType::U8:
       evalQuantized();
       break;
+    case DataType::S8:
+      evalQuantizedS8PerChannel();
+      break;
     default:
       throw std::runtime_error("Unsupported type.");
   }
@@ -140,11 +169,32 @@ void Conv2D::evalFloat() const
   params.float_activation_min = activation_min;
   params.float_activation_max = activation_max;
 
-  tflite::optimized_ops::Conv(params, getTensorShape(input()), getTensorData<float>(input()),
-                              getTensorShape(filter()), getTensorData<float>(filter()),
-                              getTensorShape(bias()), getTensorData<float>(bias()),
-                              getTensorShape(output()), getTensorData<float>(output()),
-                              getTensorShape(_im2col.get()), getTensorData<float>(_im2col.get()));
+  // Each slice of output rows uses the corresponding part of the Im2Col tensor.
+  const int32_t output_depth = output()->shape().dim(3);
+  const int32_t im2col_depth = _im2col != nullptr ? _im2col->shape().dim(3) : 0;
+  const auto eval_slice = [&](const ConvSlice &slice) {
+    tflite::ConvParams slice_params = params;
+    slice_params.padding_values.height = slice.padding_height;
+    tflite::RuntimeShape im2col_shape;
+    float *im2col_data = nullptr;
+    if (_im2col != nullptr)
+    {
+      im2col_shape.ReplaceWith(4, slice.output_shape.DimsData());
+      im2col_shape.SetDim(3, im2col_depth);
+      im2col_data = getTensorData<float>(_im2col.get()) +
+                    slice.output_offset / output_depth * im2col_depth;
+    }
+    tflite::optimized_ops::Conv(slice_params, slice.input_shape,
+                                getTensorData<float>(input()) + slice.input_offset,
+                                getTensorShape(filter()), getTensorData<float>(filter()),
+                                getTensorShape(bias()), getTensorData<float>(bias()),
+                                slice.output_shape,
+                                getTensorData<float>(output()) + slice.output_offset, im2col_shape,
+                                im2col_data);
+  };
+  parallelForConvSlices(getThreadPool(), input()->shape(), output()->shape(),
+                        filter()->shape().dim(1), _params.stride_height,
+                        _params.dilation_height_factor, _padding_height, eval_slice);
 }
 
 void Conv2D::evalQuantized() const
@@ -179,9 +229,10 @@ void Conv2D::evalQuantized() const
   params.quantized_activation_max = activation_max;
 
   // TODO This should only be done once (although it takes only a few microseconds).
-  //  Also, the user should be able to adjust the number of threads.
+  // NOTE gemmlowp parallelizes the computation itself, so the threads of the pool are not used.
   auto gemmlowp_context = std::make_unique<gemmlowp::GemmContext>();
-  gemmlowp_context->set_max_num_threads(static_cast<int>(std::thread::hardware_concurrency()));
+  gemmlowp_context->set_max_num_threads(
+      getThreadPool() != nullptr ? static_cast<int>(getThreadPool()->getNumThreads()) : 1);
 
   tflite::optimized_ops::Conv(
       params, getTensorShape(input()), getTensorData<uint8_t>(input()), getTensorShape(filter()),
@@ -190,5 +241,40 @@ void Conv2D::evalQuantized() const
       getTensorData<uint8_t>(_im2col.get()), gemmlowp_context.get());
 }
 
+void Conv2D::evalQuantizedS8PerChannel() const
+{
+  int32_t activation_min{};
+  int32_t activation_max{};
+  calculateActivationRangeQuantized(_params.activation, output(), &activation_min, &activation_max);
+
+  tflite::ConvParams params{};
+  params.padding_values.height = _padding_height;
+  params.padding_values.width = _padding_width;
+  params.stride_height = _params.stride_height;
+  params.stride_width = _params.stride_width;
+  params.dilation_height_factor = _params.dilation_height_factor;
+  params.dilation_width_factor = _params.dilation_width_factor;
+  // The kernel expects input zero point to be negated.
+  // Filter is quantized symmetrically, so its zero points are zero.
+  params.input_offset = -input()->zero_point(); // Note the '-'.
+  params.weights_offset = 0;
+  params.output_offset = output()->zero_point();
+  params.quantized_activation_min = activation_min;
+  params.quantized_activation_max = activation_max;
+
+  const auto eval_slice = [&](const ConvSlice &slice) {
+    tflite::ConvParams slice_params = params;
+    slice_params.padding_values.height = slice.padding_height;
+    tflite::reference_integer_ops::ConvPerChannel(
+        slice_params, _output_multipliers.data(), _output_shifts.data(), slice.input_shape,
+        getTensorData<int8_t>(input()) + slice.input_offset, getTensorShape(filter()),
+        getTensorData<int8_t>(filter()), getTensorShape(bias()), getTensorData<int32_t>(bias()),
+        slice.output_shape, getTensorData<int8_t>(output()) + slice.output_offset);
+  };
+  parallelForConvSlices(getThreadPool(), input()->shape(), output()->shape(),
+                        filter()->shape().dim(1), _params.stride_height,
+                        _params.dilation_height_factor, _padding_height, eval_slice);
+}
+
 } // namespace kernels
 } // namespace luci_interpreter
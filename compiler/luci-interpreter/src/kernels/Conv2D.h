@@ -21,6 +21,7 @@
 #include "core/KernelParams.h"
 
 #include <memory>
+#include <vector>
 
 namespace luci_interpreter
 {
@@ -44,11 +45,15 @@ public:
 private:
   void evalFloat() const;
   void evalQuantized() const;
+  void evalQuantizedS8PerChannel() const;
 
 private:
   std::unique_ptr<Tensor> _im2col;
   int32_t _padding_height{};
   int32_t _padding_width{};
+  // Per-channel output multipliers and shifts for int8 kernel
+  std::vector<int32_t> _output_multipliers;
+  std::vector<int32_t> _output_shifts;
 };
 
 } // namespace kernels
@@ -17,6 +17,8 @@
 #include "kernels/Conv2D.h"
 #include "kernels/TestUtils.h"
 
+#include "core/ThreadPool.h"
+
 namespace luci_interpreter
 {
 namespace kernels
@@ -180,6 +182,127 @@ TEST(Conv2DTest, Uint8)
   EXPECT_THAT(extractTensorShape(output_tensor), ::testing::ElementsAreArray(ref_output_shape));
 }
 
+TEST(Conv2DTest, SInt8PerChannel)
+{
+  std::pair<float, int32_t> input_quant_param = quantizationParams<int8_t>(-63.5, 64);
+  std::pair<float, int32_t> output_quant_param = quantizationParams<int8_t>(-127, 128);
+  std::vector<float> filter_scales{1.0, 0.5, 0.25};
+  std::vector<float> bias_scales;
+  for (float filter_scale : filter_scales)
+    bias_scales.push_back(input_quant_param.first * filter_scale);
+  Shape bias_shape = {3};
+  Tensor input_tensor{
+      DataType::S8, {2, 2, 4, 1}, {{input_quant_param.first}, {input_quant_param.second}}, ""};
+  Tensor filter_tensor{DataType::S8, {3, 2, 2, 1}, {filter_scales, {0, 0, 0}, 0}, ""};
+  Tensor bias_tensor{DataType::S32, bias_shape, {bias_scales, {0, 0, 0}, 0}, ""};
+  Tensor output_tensor =
+      makeOutputTensor(DataType::S8, output_quant_param.first, output_quant_param.second);
+  std::vector<int8_t> quantized_input = quantize<int8_t>(
+      {
+          // First batch
+          1, 1, 1, 1, // row = 1
+          2, 2, 2, 2, // row = 2
+          // Second batch
+          1, 2, 3, 4, // row = 1
+          1, 2, 3, 4, // row = 2
+      },
+      input_quant_param.first, input_quant_param.second);
+  std::vector<int8_t> quantized_filter{
+      1,  2,  3,  4, // first 2x2 filter, scale = 1.0
+      -2, 2,  -2, 2, // second 2x2 filter, scale = 0.5
+      -4, -4, 4,  4, // third 2x2 filter, scale = 0.25
+  };
+  std::vector<int32_t> bias_data{2, 8, 24};
+  input_tensor.writeData(quantized_input.data(), quantized_input.size() * sizeof(int8_t));
+  filter_tensor.writeData(quantized_filter.data(), quantized_filter.size() * sizeof(int8_t));
+  bias_tensor.writeData(bias_data.data(), bias_data.size() * sizeof(int32_t));
+
+  Conv2DParams params{};
+  params.padding = Padding::VALID;
+  params.stride_height = 2;
+  params.stride_width = 2;
+  params.dilation_height_factor = 1;
+  params.dilation_width_factor = 1;
+  params.activation = Activation::NONE;
+
+  Conv2D kernel(&input_tensor, &filter_tensor, &bias_tensor, &output_tensor, params);
+  kernel.configure();
+  kernel.execute();
+
+  std::vector<float> ref_output_data{
+      18, 2, 5, // first batch, left
+      18, 2, 5, // first batch, right
+      17, 4, 3, // second batch, left
+      37, 4, 3, // second batch, right
+  };
+  std::vector<int32_t> ref_output_shape{2, 1, 2, 3};
+  EXPECT_THAT(dequantize<int8_t>(extractTensorData<int8_t>(output_tensor),
+                                 output_quant_param.first, output_quant_param.second),
+              ElementsAreArray(ArrayFloatNear(ref_output_data)));
+  EXPECT_THAT(extractTensorShape(output_tensor), ::testing::ElementsAreArray(ref_output_shape));
+}
+
+TEST(Conv2DTest, FloatMultiThreaded)
+{
+  Shape input_shape{2, 7, 5, 3};
+  Shape filter_shape{4, 3, 3, 3};
+  Shape bias_shape{4};
+  std::vector<float> input_data(input_shape.num_elements());
+  std::vector<float> filter_data(filter_shape.num_elements());
+  std::vector<float> bias_data{1, -2, 3, -4};
+  for (size_t i = 0; i < input_data.size(); ++i)
+    input_data[i] = static_cast<float>(static_cast<int>(i * 7 % 11) - 5);
+  for (size_t i = 0; i < filter_data.size(); ++i)
+    filter_data[i] = static_cast<float>(static_cast<int>(i * 5 % 7) - 3);
+  Tensor input_tensor = makeInputTensor<DataType::FLOAT32>(input_shape, input_data);
+  Tensor filter_tensor = makeInputTensor<DataType::FLOAT32>(filter_shape, filter_data);
+  Tensor bias_tensor = makeInputTensor<DataType::FLOAT32>(bias_shape, bias_data);
+  Tensor ref_output_tensor = makeOutputTensor(DataType::FLOAT32);
+  Tensor output_tensor = makeOutputTensor(DataType::FLOAT32);
+
+  Conv2DParams params{};
+  params.padding = Padding::SAME;
+  params.stride_height = 2;
+  params.stride_width = 1;
+  params.dilation_height_factor = 1;
+  params.dilation_width_factor = 1;
+  params.activation = Activation::NONE;
+
+  Conv2D ref_kernel(&input_tensor, &filter_tensor, &bias_tensor, &ref_output_tensor, params);
+  ref_kernel.configure();
+  ref_kernel.execute();
+
+  ThreadPool thread_pool(3);
+  Conv2D kernel(&input_tensor, &filter_tensor, &bias_tensor, &output_tensor, params);
+  kernel.setThreadPool(&thread_pool);
+  kernel.configure();
+  kernel.execute();
+
+  EXPECT_THAT(extractTensorData<float>(output_tensor),
+              ElementsAreArray(ArrayFloatNear(extractTensorData<float>(ref_output_tensor))));
+  EXPECT_THAT(extractTensorShape(output_tensor),
+              ::testing::ElementsAreArray(extractTensorShape(ref_output_tensor)));
+}
+
+TEST(Conv2DTest, SInt8PerChannelNonZeroFilterZeroPoint_NEG)
+{
+  Tensor input_tensor{DataType::S8, {2, 2, 4, 1}, {{0.5}, {0}}, ""};
+  Tensor filter_tensor{DataType::S8, {3, 2, 2, 1}, {{1.0, 0.5, 0.25}, {0, 1, 0}, 0}, ""};
+  Tensor bias_tensor{DataType::S32, {3}, {{0.5, 0.25, 0.125}, {0, 0, 0}, 0}, ""};
+  Tensor output_tensor = makeOutputTensor(DataType::S8, 1.0, 0);
+
+  Conv2DParams params{};
+  params.padding = Padding::VALID;
+  params.stride_height = 2;
+  params.stride_width = 2;
+  params.dilation_height_factor = 1;
+  params.dilation_width_factor = 1;
+  params.activation = Activation::NONE;
+
+  Conv2D kernel(&input_tensor, &filter_tensor, &bias_tensor, &output_tensor, params);
+  EXPECT_ANY_THROW(kernel.configure());
+}
+
 } // namespace
 } // namespace kernels
 } // namespace luci_interpreter
@@ -20,6 +20,7 @@
 
 #include <tensorflow/lite/kernels/internal/reference/depthwiseconv_float.h>
 #include <tensorflow/lite/kernels/internal/reference/depthwiseconv_uint8.h>
+#include <tensorflow/lite/kernels/internal/reference/integer_ops/depthwise_conv.h>
 
 #include <stdexcept>
 
@@ -45,7 +46,9 @@ void DepthwiseConv2D::configure()
   // (4) | int8  int8   int32 int8   | quantized per channel
   // (5) | int16 int8   int64 int16  | quantized per channel 16x8
   //
-  // We only support (1) and (3) for now.
+  // We only support (1), (3) and (4) for now.
+  // NOTE (5) is not supported as TensorFlow Lite v2.1.0, whose kernels are used here, does not
+  //      have the 16x8 kernel yet.
   if (input()->element_type() == DataType::FLOAT32 && filter()->element_type() == DataType::FLOAT32)
   {
     assert(bias() == nullptr || bias()->element_type() == DataType::FLOAT32);
@@ -54,6 +57,18 @@ void DepthwiseConv2D::configure()
   {
     assert(bias() == nullptr || bias()->element_type() == DataType::S32);
   }
+  else if (input()->element_type() == DataType::S8 && filter()->element_type() == DataType::S8)
+  {
+    LUCI_INTERPRETER_CHECK(filter()->quantized_dimension() == 3);
+    LUCI_INTERPRETER_CHECK(filter()->scales().size() ==
+                           static_cast<size_t>(filter()->shape().dim(3)));
+    LUCI_INTERPRETER_CHECK(filter()->zero_points().size() == filter()->scales().size());
+    for (auto zero_point : filter()->zero_points())
+    {
+      LUCI_INTERPRETER_CHECK(zero_point == 0);
+    }
+    LUCI_INTERPRETER_CHECK(bias() == nullptr || bias()->element_type() == DataType::S32);
+  }
   else
   {
     throw std::runtime_error("Unsupported type.");
@@ -89,6 +104,13 @@ void DepthwiseConv2D::configure()
                                   filter_width, output_width);
 
   output()->resize({batches, output_height, output_width, channels_out});
+
+  // Output multipliers of per-channel kernel do not change among executions
+  if (input()->element_type() == DataType::S8)
+  {
+    quantizeChannelMultipliers(input()->scale(), filter()->scales(), output()->scale(),
+                               &_output_multipliers, &_output_shifts);
+  }
 }
 
 void DepthwiseConv2D::execute() const
@@ -105,6 +127,9 @@ void DepthwiseConv2D::execute() const
     case DataType::U8:
       evalQuantized();
       break;
+    case DataType::S8:
+      evalQuantizedS8PerChannel();
+      break;
     default:
       throw std::runtime_error("Unsupported type.");
   }
@@ -127,10 +152,18 @@ void DepthwiseConv2D::evalFloat() const
   params.float_activation_min = activation_min;
   params.float_activation_max = activation_max;
 
-  tflite::reference_ops::DepthwiseConv(
-      params, getTensorShape(input()), getTensorData<float>(input()), getTensorShape(filter()),
-      getTensorData<float>(filter()), getTensorShape(bias()), getTensorData<float>(bias()),
-      getTensorShape(output()), getTensorData<float>(output()));
+  const auto eval_slice = [&](const ConvSlice &slice) {
+    tflite::DepthwiseParams slice_params = params;
+    slice_params.padding_values.height = slice.padding_height;
+    tflite::reference_ops::DepthwiseConv(
+        slice_params, slice.input_shape, getTensorData<float>(input()) + slice.input_offset,
+        getTensorShape(filter()), getTensorData<float>(filter()), getTensorShape(bias()),
+        getTensorData<float>(bias()), slice.output_shape,
+        getTensorData<float>(output()) + slice.output_offset);
+  };
+  parallelForConvSlices(getThreadPool(), input()->shape(), output()->shape(),
+                        filter()->shape().dim(1), _params.stride_height,
+                        _params.dilation_height_factor, _padding_height, eval_slice);
 }
 
 void DepthwiseConv2D::evalQuantized() const
@@ -165,10 +198,54 @@ void DepthwiseConv2D::evalQuantized() const
   params.quantized_activation_min = activation_min;
   params.quantized_activation_max = activation_max;
 
-  tflite::reference_ops::DepthwiseConv(
-      params, getTensorShape(input()), getTensorData<uint8_t>(input()), getTensorShape(filter()),
-      getTensorData<uint8_t>(filter()), getTensorShape(bias()), getTensorData<int32_t>(bias()),
-      getTensorShape(output()), getTensorData<uint8_t>(output()));
+  const auto eval_slice = [&](const ConvSlice &slice) {
+    tflite::DepthwiseParams slice_params = params;
+    slice_params.padding_values.height = slice.padding_height;
+    tflite::reference_ops::DepthwiseConv(
+        slice_params, slice.input_shape, getTensorData<uint8_t>(input()) + slice.input_offset,
+        getTensorShape(filter()), getTensorData<uint8_t>(filter()), getTensorShape(bias()),
+        getTensorData<int32_t>(bias()), slice.output_shape,
+        getTensorData<uint8_t>(output()) + slice.output_offset);
+  };
+  parallelForConvSlices(getThreadPool(), input()->shape(), output()->shape(),
+                        filter()->shape().dim(1), _params.stride_height,
+                        _params.dilation_height_factor, _padding_height, eval_slice);
+}
+
+void DepthwiseConv2D::evalQuantizedS8PerChannel() const
+{
+  int32_t activation_min{};
+  int32_t activation_max{};
+  calculateActivationRangeQuantized(_params.activation, output(), &activation_min, &activation_max);
+
+  tflite::DepthwiseParams params{};
+  params.padding_values.height = _padding_height;
+  params.padding_values.width = _padding_width;
+  params.stride_height = _params.stride_height;
+  params.stride_width = _params.stride_width;
+  params.dilation_height_factor = _params.dilation_height_factor;
+  params.dilation_width_factor = _params.dilation_width_factor;
+  params.depth_multiplier = _params.depth_multiplier;
+  // The kernel expects input zero point to be negated.
+  // Filter is quantized symmetrically, so its zero points are zero.
+  params.input_offset = -input()->zero_point(); // Note the '-'.
+  params.weights_offset = 0;
+  params.output_offset = output()->zero_point();
+  params.quantized_activation_min = activation_min;
+  params.quantized_activation_max = activation_max;
+
+  const auto eval_slice = [&](const ConvSlice &slice) {
+    tflite::DepthwiseParams slice_params = params;
+    slice_params.padding_values.height = slice.padding_height;
+    tflite::reference_integer_ops::DepthwiseConvPerChannel(
+        slice_params, _output_multipliers.data(), _output_shifts.data(), slice.input_shape,
+        getTensorData<int8_t>(input()) + slice.input_offset, getTensorShape(filter()),
+        getTensorData<int8_t>(filter()), getTensorShape(bias()), getTensorData<int32_t>(bias()),
+        slice.output_shape, getTensorData<int8_t>(output()) + slice.output_offset);
+  };
+  parallelForConvSlices(getThreadPool(), input()->shape(), output()->shape(),
+                        filter()->shape().dim(1), _params.stride_height,
+                        _params.dilation_height_factor, _padding_height, eval_slice);
 }
 
 } // namespace kernels
@@ -20,6 +20,8 @@
 #include "core/Kernel.h"
 #include "core/KernelParams.h"
 
+#include <vector>
+
 namespace luci_interpreter
 {
 namespace kernels
@@ -42,10 +44,14 @@ public:
 private:
   void evalFloat() const;
   void evalQuantized() const;
+  void evalQuantizedS8PerChannel() const;
 
 private:
   int32_t _padding_height{};
   int32_t _padding_width{};
+  // Per-channel output multipliers and shifts for int8 kernel
+  std::vector<int32_t> _output_multipliers;
+  std::vector<int32_t> _output_shifts;
 };
 
 } // namespace kernels
@@ -17,6 +17,8 @@
 #include "kernels/DepthwiseConv2D.h"
 #include "kernels/TestUtils.h"
 
+#include "core/ThreadPool.h"
+
 namespace luci_interpreter
 {
 namespace kernels
@@ -130,6 +132,128 @@ TEST(DepthwiseConv2DTest, Uint8)
   EXPECT_THAT(extractTensorShape(output_tensor), ::testing::ElementsAreArray({1, 2, 1, 4}));
 }
 
+TEST(DepthwiseConv2DTest, SInt8PerChannel)
+{
+  std::pair<float, int32_t> input_quant_param = quantizationParams<int8_t>(-63.5, 64);
+  std::pair<float, int32_t> output_quant_param = quantizationParams<int8_t>(-63.5, 64);
+  std::vector<float> filter_scales{1.0, 0.5, 2.0, 0.25};
+  std::vector<float> bias_scales;
+  for (float filter_scale : filter_scales)
+    bias_scales.push_back(input_quant_param.first * filter_scale);
+
+  Tensor input_tensor{
+      DataType::S8, {1, 2, 3, 2}, {{input_quant_param.first}, {input_quant_param.second}}, ""};
+  Tensor filter_tensor{DataType::S8, {1, 2, 2, 4}, {filter_scales, {0, 0, 0, 0}, 3}, ""};
+  Tensor bias_tensor{DataType::S32, {4}, {bias_scales, {0, 0, 0, 0}, 0}, ""};
+  Tensor output_tensor =
+      makeOutputTensor(DataType::S8, output_quant_param.first, output_quant_param.second);
+
+  std::vector<int8_t> quant_input = quantize<int8_t>(
+      {
+          3, 2, 1, -1, -2, -3, // row 1
+          4, 3, 2, -2, -3, -4, // row 2
+      },
+      input_quant_param.first, input_quant_param.second);
+  std::vector<int8_t> quant_filter{
+      1, 2, 3, 4, //
+      3, 4, 5, 6, //
+      7, 8, 5, 6, //
+      3, 4, 1, 2, //
+  };
+  std::vector<int32_t> quant_bias{3, -8, 2, 48};
+
+  input_tensor.writeData(quant_input.data(), quant_input.size() * sizeof(int8_t));
+  filter_tensor.writeData(quant_filter.data(), quant_filter.size() * sizeof(int8_t));
+  bias_tensor.writeData(quant_bias.data(), quant_bias.size() * sizeof(int32_t));
+
+  DepthwiseConv2DParams params{};
+  params.padding = Padding::VALID;
+  params.depth_multiplier = 2;
+  params.stride_height = 1;
+  params.stride_width = 1;
+  params.dilation_height_factor = 1;
+  params.dilation_width_factor = 1;
+  params.activation = Activation::NONE;
+
+  DepthwiseConv2D kernel(&input_tensor, &filter_tensor, &bias_tensor, &output_tensor, params);
+  kernel.configure();
+  kernel.execute();
+
+  std::vector<float> ref_output_data{
+      41.5, 23, 30,  10,   //
+      1.5,  -3, -62, -4.5, //
+  };
+  EXPECT_THAT(dequantize(extractTensorData<int8_t>(output_tensor), output_tensor.scale(),
+                         output_tensor.zero_point()),
+              ElementsAreArray(ArrayFloatNear(ref_output_data)));
+  EXPECT_THAT(extractTensorShape(output_tensor), ::testing::ElementsAreArray({1, 1, 2, 4}));
+}
+
+TEST(DepthwiseConv2DTest, SInt8PerChannelWrongScales_NEG)
+{
+  Tensor input_tensor{DataType::S8, {1, 2, 3, 2}, {{0.5}, {0}}, ""};
+  // Filter has 4 output channels but 2 scales
+  Tensor filter_tensor{DataType::S8, {1, 2, 2, 4}, {{1.0, 0.5}, {0, 0}, 3}, ""};
+  Tensor bias_tensor{DataType::S32, {4}, {{0.5, 0.25}, {0, 0}, 0}, ""};
+  Tensor output_tensor = makeOutputTensor(DataType::S8, 0.5, 0);
+
+  DepthwiseConv2DParams params{};
+  params.padding = Padding::VALID;
+  params.depth_multiplier = 2;
+  params.stride_height = 1;
+  params.stride_width = 1;
+  params.dilation_height_factor = 1;
+  params.dilation_width_factor = 1;
+  params.activation = Activation::NONE;
+
+  DepthwiseConv2D kernel(&input_tensor, &filter_tensor, &bias_tensor, &output_tensor, params);
+  EXPECT_ANY_THROW(kernel.configure());
+}
+
+TEST(DepthwiseConv2DTest, FloatMultiThreaded)
+{
+  Shape input_shape{2, 9, 4, 2};
+  Shape filter_shape{1, 3, 3, 4};
+  Shape bias_shape{4};
+  std::vector<float> input_data(input_shape.num_elements());
+  std::vector<float> filter_data(filter_shape.num_elements());
+  std::vector<float> bias_data{1, -2, 3, -4};
+  for (size_t i = 0; i < input_data.size(); ++i)
+    input_data[i] = static_cast<float>(static_cast<int>(i * 7 % 11) - 5);
+  for (size_t i = 0; i < filter_data.size(); ++i)
+    filter_data[i] = static_cast<float>(static_cast<int>(i * 5 % 7) - 3);
+  Tensor input_tensor = makeInputTensor<DataType::FLOAT32>(input_shape, input_data);
+  Tensor filter_tensor = makeInputTensor<DataType::FLOAT32>(filter_shape, filter_data);
+  Tensor bias_tensor = makeInputTensor<DataType::FLOAT32>(bias_shape, bias_data);
+  Tensor ref_output_tensor = makeOutputTensor(DataType::FLOAT32);
+  Tensor output_tensor = makeOutputTensor(DataType::FLOAT32);
+
+  DepthwiseConv2DParams params{};
+  params.padding = Padding::SAME;
+  params.depth_multiplier = 2;
+  params.stride_height = 1;
+  params.stride_width = 1;
+  params.dilation_height_factor = 2;
+  params.dilation_width_factor = 1;
+  params.activation = Activation::NONE;
+
+  DepthwiseConv2D ref_kernel(&input_tensor, &filter_tensor, &bias_tensor, &ref_output_tensor,
+                             params);
+  ref_kernel.configure();
+  ref_kernel.execute();
+
+  ThreadPool thread_pool(3);
+  DepthwiseConv2D kernel(&input_tensor, &filter_tensor, &bias_tensor, &output_tensor, params);
+  kernel.setThreadPool(&thread_pool);
+  kernel.configure();
+  kernel.execute();
+
+  EXPECT_THAT(extractTensorData<float>(output_tensor),
+              ElementsAreArray(ArrayFloatNear(extractTensorData<float>(ref_output_tensor))));
+  EXPECT_THAT(extractTensorShape(output_tensor),
+              ::testing::ElementsAreArray(extractTensorShape(ref_output_tensor)));
+}
+
 } // namespace
 } // namespace kernels
 } // namespace luci_interpreter
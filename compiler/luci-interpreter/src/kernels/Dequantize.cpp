@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "kernels/Dequantize.h"
+
+#include <cassert>
+#include <stdexcept>
+
+namespace luci_interpreter
+{
+namespace kernels
+{
+
+Dequantize::Dequantize(const Tensor *input, Tensor *output) : Kernel({input}, {output}) {}
+
+void Dequantize::configure()
+{
+  assert(input()->element_type() == DataType::U8 || input()->element_type() == DataType::S8 ||
+         input()->element_type() == DataType::S16);
+  assert(output()->element_type() == DataType::FLOAT32);
+  output()->resize(input()->shape());
+}
+
+void Dequantize::execute() const
+{
+  switch (input()->element_type())
+  {
+    case DataType::U8:
+      evalDequantize<uint8_t>();
+      break;
+    case DataType::S8:
+      evalDequantize<int8_t>();
+      break;
+    case DataType::S16:
+      evalDequantize<int16_t>();
+      break;
+    default:
+      throw std::runtime_error("Unsupported type.");
+  }
+}
+
+template <typename T> void Dequantize::evalDequantize() const
+{
+  const float scale = input()->scale();
+  const float zero_point = input()->zero_point();
+
+  const auto *input_data = input()->data<T>();
+  auto *output_data = output()->data<float>();
+  const int32_t num_elements = input()->shape().num_elements();
+  for (int32_t i = 0; i < num_elements; ++i)
+    output_data[i] = (static_cast<float>(input_data[i]) - zero_point) * scale;
+}
+
+} // namespace kernels
+} // namespace luci_interpreter
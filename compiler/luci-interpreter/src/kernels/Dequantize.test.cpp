@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "kernels/Dequantize.h"
+#include "kernels/TestUtils.h"
+
+namespace luci_interpreter
+{
+namespace kernels
+{
+namespace
+{
+
+using namespace testing;
+
+TEST(DequantizeTest, Uint8)
+{
+  Shape shape{2, 2};
+  std::vector<uint8_t> input_data{0, 2, 3, 255};
+  Tensor input_tensor{DataType::U8, shape, {{0.5f}, {2}}, ""};
+  input_tensor.writeData(input_data.data(), input_data.size() * sizeof(uint8_t));
+  Tensor output_tensor = makeOutputTensor(DataType::FLOAT32);
+
+  Dequantize kernel(&input_tensor, &output_tensor);
+  kernel.configure();
+  kernel.execute();
+
+  EXPECT_THAT(extractTensorData<float>(output_tensor),
+              ElementsAreArray(ArrayFloatNear({-1.0f, 0.0f, 0.5f, 126.5f})));
+  EXPECT_THAT(extractTensorShape(output_tensor), ::testing::ElementsAreArray({2, 2}));
+}
+
+TEST(DequantizeTest, Int16)
+{
+  Shape shape{3};
+  std::vector<int16_t> input_data{-1024, 0, 32767};
+  Tensor input_tensor{DataType::S16, shape, {{1.0f / 1024}, {0}}, ""};
+  input_tensor.writeData(input_data.data(), input_data.size() * sizeof(int16_t));
+  Tensor output_tensor = makeOutputTensor(DataType::FLOAT32);
+
+  Dequantize kernel(&input_tensor, &output_tensor);
+  kernel.configure();
+  kernel.execute();
+
+  EXPECT_THAT(extractTensorData<float>(output_tensor),
+              ElementsAreArray(ArrayFloatNear({-1.0f, 0.0f, 32767.0f / 1024})));
+}
+
+} // namespace
+} // namespace kernels
+} // namespace luci_interpreter
@@ -19,7 +19,9 @@
 #include "kernels/Utils.h"
 
 #include <tensorflow/lite/kernels/internal/reference/fully_connected.h>
+#include <tensorflow/lite/kernels/internal/reference/integer_ops/fully_connected.h>
 
+#include <algorithm>
 #include <stdexcept>
 
 namespace luci_interpreter
@@ -28,6 +30,66 @@ namespace luci_interpreter
 namespace kernels
 {
 
+namespace
+{
+
+void fillQuantizedParams(const Tensor *input, const Tensor *weights, const Tensor *output,
+                         Activation activation, tflite::FullyConnectedParams &params)
+{
+  const auto input_scale = static_cast<double>(input->scale());
+  const auto weights_scale = static_cast<double>(weights->scale());
+  const auto output_scale = static_cast<double>(output->scale());
+
+  const double real_multiplier = input_scale * weights_scale / output_scale;
+  int32_t output_multiplier{};
+  int output_shift{};
+  quantizeMultiplier(real_multiplier, &output_multiplier, &output_shift);
+
+  int32_t activation_min{};
+  int32_t activation_max{};
+  calculateActivationRangeQuantized(activation, output, &activation_min, &activation_max);
+
+  // The kernel expects input and weights zero points to be negated.
+  params.input_offset = -input->zero_point();     // Note the '-'.
+  params.weights_offset = -weights->zero_point(); // Note the '-'.
+  params.output_offset = output->zero_point();
+  params.output_multiplier = output_multiplier;
+  params.output_shift = output_shift;
+  params.quantized_activation_min = activation_min;
+  params.quantized_activation_max = activation_max;
+  params.weights_format = tflite::FullyConnectedWeightsFormat::kDefault;
+}
+
+// Splits the computation between threads by batches and output units, calling
+// 'eval(input_shape, input_data, weights_shape, weights_data, bias_shape, bias_data,
+// output_shape, output_data)' for each of the slices.
+template <typename T, typename BiasT, typename EvalFn>
+void evalSlices(ThreadPool *thread_pool, const Tensor *input, const Tensor *weights,
+                const Tensor *bias, Tensor *output, const EvalFn &eval)
+{
+  const int32_t batches = output->shape().dim(0);
+  const int32_t num_units = weights->shape().dim(0);
+  const int32_t accum_depth = weights->shape().dim(1);
+  // Do not bother splitting the work into pieces that are too small.
+  const int32_t min_chunk_size = std::max(1, 16384 / std::max(accum_depth, 1));
+
+  parallelFor(thread_pool, batches, num_units, min_chunk_size,
+              [&](int32_t batch, int32_t unit_begin, int32_t unit_end) {
+                const int32_t num_slice_units = unit_end - unit_begin;
+                const BiasT *bias_data = getTensorData<BiasT>(bias);
+                eval(tflite::RuntimeShape({1, accum_depth}),
+                     getTensorData<T>(input) + batch * accum_depth,
+                     tflite::RuntimeShape({num_slice_units, accum_depth}),
+                     getTensorData<T>(weights) + unit_begin * accum_depth,
+                     tflite::RuntimeShape({num_slice_units}),
+                     bias_data != nullptr ? bias_data + unit_begin : nullptr,
+                     tflite::RuntimeShape({1, num_slice_units}),
+                     getTensorData<T>(output) + batch * num_units + unit_begin);
+              });
+}
+
+} // namespace
+
 FullyConnected::FullyConnected(const Tensor *input, const Tensor *weights, const Tensor *bias,
                                Tensor *output, const FullyConnectedParams &params)
     : KernelWithParams<FullyConnectedParams>({input, weights, bias}, {output}, params)
@@ -36,12 +98,21 @@ FullyConnected::FullyConnected(const Tensor *input, const Tensor *weights, const
 
 void FullyConnected::configure()
 {
-  if (weights()->element_type() != DataType::FLOAT32)
+  if (weights()->element_type() == DataType::FLOAT32)
+  {
+    assert(input()->element_type() == DataType::FLOAT32);
+    assert(bias() == nullptr || bias()->element_type() == DataType::FLOAT32);
+  }
+  else if (weights()->element_type() == DataType::U8 || weights()->element_type() == DataType::S8)
+  {
+    assert(input()->element_type() == weights()->element_type());
+    assert(bias() == nullptr || bias()->element_type() == DataType::S32);
+  }
+  else
+  {
     throw std::runtime_error("Unsupported type.");
-
-  assert(input()->element_type() == DataType::FLOAT32);
-  assert(weights()->element_type() == DataType::FLOAT32);
-  assert(bias() == nullptr || bias()->element_type() == DataType::FLOAT32);
+  }
+  assert(output()->element_type() == input()->element_type());
 
   const Shape &input_shape = input()->shape();
   const Shape &weights_shape = weights()->shape();
@@ -56,7 +127,23 @@ void FullyConnected::configure()
   output()->resize({batch_size, num_units});
 }
 
-void FullyConnected::execute() const { evalFloat(); }
+void FullyConnected::execute() const
+{
+  switch (input()->element_type())
+  {
+    case DataType::FLOAT32:
+      evalFloat();
+      break;
+    case DataType::U8:
+      evalQuantized();
+      break;
+    case DataType::S8:
+      evalQuantizedS8();
+      break;
+    default:
+      throw std::runtime_error("Unsupported type.");
+  }
+}
 
 void FullyConnected::evalFloat() const
 {
@@ -69,10 +156,32 @@ void FullyConnected::evalFloat() const
   params.float_activation_max = activation_max;
   params.weights_format = tflite::FullyConnectedWeightsFormat::kDefault;
 
-  tflite::reference_ops::FullyConnected(
-      params, getTensorShape(input()), getTensorData<float>(input()), getTensorShape(weights()),
-      getTensorData<float>(weights()), getTensorShape(bias()), getTensorData<float>(bias()),
-      getTensorShape(output()), getTensorData<float>(output()));
+  evalSlices<float, float>(getThreadPool(), input(), weights(), bias(), output(),
+                           [&params](const auto &... args) {
+                             tflite::reference_ops::FullyConnected(params, args...);
+                           });
+}
+
+void FullyConnected::evalQuantized() const
+{
+  tflite::FullyConnectedParams params{};
+  fillQuantizedParams(input(), weights(), output(), _params.activation, params);
+
+  evalSlices<uint8_t, int32_t>(getThreadPool(), input(), weights(), bias(), output(),
+                               [&params](const auto &... args) {
+                                 tflite::reference_ops::FullyConnected(params, args...);
+                               });
+}
+
+void FullyConnected::evalQuantizedS8() const
+{
+  tflite::FullyConnectedParams params{};
+  fillQuantizedParams(input(), weights(), output(), _params.activation, params);
+
+  evalSlices<int8_t, int32_t>(getThreadPool(), input(), weights(), bias(), output(),
+                              [&params](const auto &... args) {
+                                tflite::reference_integer_ops::FullyConnected(params, args...);
+                              });
 }
 
 } // namespace kernels
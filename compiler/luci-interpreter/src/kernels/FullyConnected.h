@@ -41,6 +41,8 @@ public:
 
 private:
   void evalFloat() const;
+  void evalQuantized() const;
+  void evalQuantizedS8() const;
 };
 
 } // namespace kernels
@@ -17,6 +17,8 @@
 #include "kernels/FullyConnected.h"
 #include "kernels/TestUtils.h"
 
+#include "core/ThreadPool.h"
+
 namespace luci_interpreter
 {
 namespace kernels
@@ -62,6 +64,149 @@ TEST(FullyConnectedTest, Float)
               ElementsAreArray(ArrayFloatNear(ref_output_data)));
 }
 
+template <typename T> void checkQuantized(DataType element_type)
+{
+  std::pair<float, int32_t> input_quant_param = quantizationParams<T>(-63.5, 64);
+  std::pair<float, int32_t> output_quant_param = quantizationParams<T>(-127, 128);
+  Tensor input_tensor{
+      element_type, {3, 2, 2, 1}, {{input_quant_param.first}, {input_quant_param.second}}, ""};
+  Tensor weights_tensor{
+      element_type, {3, 6}, {{input_quant_param.first}, {input_quant_param.second}}, ""};
+  Tensor bias_tensor{
+      DataType::S32, {3}, {{input_quant_param.first * input_quant_param.first}, {0}}, ""};
+  Tensor output_tensor =
+      makeOutputTensor(element_type, output_quant_param.first, output_quant_param.second);
+
+  std::vector<T> quantized_input = quantize<T>(
+      {
+          -3, -5, 5,  4, 9,  -2, // batch = 0
+          -3, -2, -4, 9, -8, 1,  // batch = 1
+      },
+      input_quant_param.first, input_quant_param.second);
+  std::vector<T> quantized_weights = quantize<T>(
+      {
+          -3, -7, 4, -4, -6, 4,  // unit = 0
+          3,  5,  2, 3,  -3, -8, // unit = 1
+          -3, 7,  4, 9,  0,  -5, // unit = 2
+      },
+      input_quant_param.first, input_quant_param.second);
+  std::vector<int32_t> bias_data =
+      quantize<int32_t>({-1, -5, -8}, input_quant_param.first * input_quant_param.first, 0);
+  input_tensor.writeData(quantized_input.data(), quantized_input.size() * sizeof(T));
+  weights_tensor.writeData(quantized_weights.data(), quantized_weights.size() * sizeof(T));
+  bias_tensor.writeData(bias_data.data(), bias_data.size() * sizeof(int32_t));
+
+  FullyConnectedParams params{};
+  params.activation = Activation::RELU;
+
+  FullyConnected kernel(&input_tensor, &weights_tensor, &bias_tensor, &output_tensor, params);
+  kernel.configure();
+  kernel.execute();
+
+  std::vector<float> ref_output_data{
+      0,  0,  32, // batch = 0
+      22, 11, 47, // batch = 1
+  };
+  EXPECT_THAT(dequantize<T>(extractTensorData<T>(output_tensor), output_quant_param.first,
+                            output_quant_param.second),
+              ElementsAreArray(ArrayFloatNear(ref_output_data)));
+}
+
+TEST(FullyConnectedTest, Uint8) { checkQuantized<uint8_t>(DataType::U8); }
+
+TEST(FullyConnectedTest, SInt8) { checkQuantized<int8_t>(DataType::S8); }
+
+TEST(FullyConnectedTest, FloatMultiThreaded)
+{
+  // Output units are large enough to be split into several slices
+  Shape input_shape{3, 64};
+  Shape weights_shape{200, 64};
+  Shape bias_shape{200};
+  std::vector<float> input_data(input_shape.num_elements());
+  std::vector<float> weights_data(weights_shape.num_elements());
+  std::vector<float> bias_data(bias_shape.num_elements());
+  for (size_t i = 0; i < input_data.size(); ++i)
+    input_data[i] = static_cast<float>(static_cast<int>(i * 7 % 11) - 5);
+  for (size_t i = 0; i < weights_data.size(); ++i)
+    weights_data[i] = static_cast<float>(static_cast<int>(i * 5 % 7) - 3);
+  for (size_t i = 0; i < bias_data.size(); ++i)
+    bias_data[i] = static_cast<float>(static_cast<int>(i % 5) - 2);
+  Tensor input_tensor = makeInputTensor<DataType::FLOAT32>(input_shape, input_data);
+  Tensor weights_tensor = makeInputTensor<DataType::FLOAT32>(weights_shape, weights_data);
+  Tensor bias_tensor = makeInputTensor<DataType::FLOAT32>(bias_shape, bias_data);
+  Tensor ref_output_tensor = makeOutputTensor(DataType::FLOAT32);
+  Tensor output_tensor = makeOutputTensor(DataType::FLOAT32);
+
+  FullyConnectedParams params{};
+  params.activation = Activation::RELU;
+
+  FullyConnected ref_kernel(&input_tensor, &weights_tensor, &bias_tensor, &ref_output_tensor,
+                            params);
+  ref_kernel.configure();
+  ref_kernel.execute();
+
+  ThreadPool thread_pool(3);
+  FullyConnected kernel(&input_tensor, &weights_tensor, &bias_tensor, &output_tensor, params);
+  kernel.setThreadPool(&thread_pool);
+  kernel.configure();
+  kernel.execute();
+
+  EXPECT_THAT(extractTensorData<float>(output_tensor),
+              ElementsAreArray(ArrayFloatNear(extractTensorData<float>(ref_output_tensor))));
+  EXPECT_THAT(extractTensorShape(output_tensor),
+              ::testing::ElementsAreArray(extractTensorShape(ref_output_tensor)));
+}
+
+TEST(FullyConnectedTest, Uint8MultiThreaded)
+{
+  std::pair<float, int32_t> input_quant_param = quantizationParams<uint8_t>(-63.5, 64);
+  std::pair<float, int32_t> output_quant_param = quantizationParams<uint8_t>(-127, 128);
+  const float bias_scale = input_quant_param.first * input_quant_param.first;
+
+  // Output units are large enough to be split into several slices
+  Shape input_shape{3, 64};
+  Shape weights_shape{200, 64};
+  Shape bias_shape{200};
+  std::vector<uint8_t> input_data(input_shape.num_elements());
+  std::vector<uint8_t> weights_data(weights_shape.num_elements());
+  std::vector<int32_t> bias_data(bias_shape.num_elements());
+  for (size_t i = 0; i < input_data.size(); ++i)
+    input_data[i] = static_cast<uint8_t>(input_quant_param.second + i * 7 % 11 - 5);
+  for (size_t i = 0; i < weights_data.size(); ++i)
+    weights_data[i] = static_cast<uint8_t>(input_quant_param.second + i * 5 % 7 - 3);
+  for (size_t i = 0; i < bias_data.size(); ++i)
+    bias_data[i] = static_cast<int32_t>(i % 5) - 2;
+  Tensor input_tensor{
+      DataType::U8, input_shape, {{input_quant_param.first}, {input_quant_param.second}}, ""};
+  Tensor weights_tensor{
+      DataType::U8, weights_shape, {{input_quant_param.first}, {input_quant_param.second}}, ""};
+  Tensor bias_tensor{DataType::S32, bias_shape, {{bias_scale}, {0}}, ""};
+  input_tensor.writeData(input_data.data(), input_data.size() * sizeof(uint8_t));
+  weights_tensor.writeData(weights_data.data(), weights_data.size() * sizeof(uint8_t));
+  bias_tensor.writeData(bias_data.data(), bias_data.size() * sizeof(int32_t));
+  Tensor ref_output_tensor =
+      makeOutputTensor(DataType::U8, output_quant_param.first, output_quant_param.second);
+  Tensor output_tensor =
+      makeOutputTensor(DataType::U8, output_quant_param.first, output_quant_param.second);
+
+  FullyConnectedParams params{};
+  params.activation = Activation::NONE;
+
+  FullyConnected ref_kernel(&input_tensor, &weights_tensor, &bias_tensor, &ref_output_tensor,
+                            params);
+  ref_kernel.configure();
+  ref_kernel.execute();
+
+  ThreadPool thread_pool(3);
+  FullyConnected kernel(&input_tensor, &weights_tensor, &bias_tensor, &output_tensor, params);
+  kernel.setThreadPool(&thread_pool);
+  kernel.configure();
+  kernel.execute();
+
+  EXPECT_THAT(extractTensorData<uint8_t>(output_tensor),
+              ::testing::ElementsAreArray(extractTensorData<uint8_t>(ref_output_tensor)));
+}
+
 } // namespace
 } // namespace kernels
 } // namespace luci_interpreter
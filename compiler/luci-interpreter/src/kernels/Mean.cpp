@@ -145,6 +145,7 @@ void Mean::configure()
   tflite::MeanParams params{};
   resolveAxes(axes_data, num_axes, &params);
   const bool need_temporaries =
+      input()->element_type() == DataType::S8 ||
       !(_params.keep_dims && input_num_dims == 4 && params.axis_count == 2 &&
         ((params.axis[0] == 1 && params.axis[1] == 2) ||
          (params.axis[0] == 2 && params.axis[1] == 1)));
@@ -154,8 +155,10 @@ void Mean::configure()
         std::make_unique<Tensor>(DataType::S32, Shape(input_num_dims), AffineQuantization{}, "");
     _resolved_axes =
         std::make_unique<Tensor>(DataType::S32, Shape(num_axes), AffineQuantization{}, "");
-    _temp_sum = std::make_unique<Tensor>(input()->element_type(), output()->shape(),
-                                         AffineQuantization{}, "");
+    // NOTE Quantized kernels accumulate sums in int
+    const DataType sum_type =
+        input()->element_type() == DataType::FLOAT32 ? DataType::FLOAT32 : DataType::S32;
+    _temp_sum = std::make_unique<Tensor>(sum_type, output()->shape(), AffineQuantization{}, "");
   }
 }
 
@@ -169,6 +172,9 @@ void Mean::execute() const
     case DataType::U8:
       evalQuantized();
       break;
+    case DataType::S8:
+      evalQuantizedS8();
+      break;
     default:
       throw std::runtime_error("Unsupported type.");
   }
@@ -245,5 +251,33 @@ void Mean::evalQuantized() const
   }
 }
 
+void Mean::evalQuantizedS8() const
+{
+  const auto *axes_data = getTensorData<int32_t>(axes());
+  int num_axes = axes()->shape().num_elements();
+
+  // NOTE TensorFlow Lite v2.1.0 has the specialized 4D implementation for uint8 only
+  if (input()->zero_point() == output()->zero_point() && input()->scale() == output()->scale())
+  {
+    tflite::reference_ops::Mean(
+        getTensorData<int8_t>(input()), getTensorShape(input()).DimsData(),
+        input()->shape().num_dims(), getTensorData<int8_t>(output()),
+        getTensorShape(output()).DimsData(), output()->shape().num_dims(), axes_data, num_axes,
+        _params.keep_dims, getTensorData<int>(_temp_index.get()),
+        getTensorData<int>(_resolved_axes.get()), getTensorData<int>(_temp_sum.get()));
+  }
+  else
+  {
+    tflite::reference_ops::QuantizedMeanOrSum<>(
+        getTensorData<int8_t>(input()), input()->zero_point(), input()->scale(),
+        getTensorShape(input()).DimsData(), input()->shape().num_dims(),
+        getTensorData<int8_t>(output()), output()->zero_point(), output()->scale(),
+        getTensorShape(output()).DimsData(), output()->shape().num_dims(), axes_data, num_axes,
+        _params.keep_dims, getTensorData<int>(_temp_index.get()),
+        getTensorData<int>(_resolved_axes.get()), getTensorData<int>(_temp_sum.get()),
+        /*compute_sum=*/false);
+  }
+}
+
 } // namespace kernels
 } // namespace luci_interpreter
@@ -160,6 +160,69 @@ TEST(MeanTest, Uint8NotKeepDims)
   EXPECT_THAT(extractTensorShape(output_tensor), ::testing::ElementsAreArray(ref_output_shape));
 }
 
+TEST(MeanTest, Int8NotKeepDims)
+{
+  float kQuantizedTolerance = getTolerance(-1.0, 1.0, 255);
+  std::vector<float> input_data = {0.4, -0.2, 0.3, 0.4, -0.5, 0.6};
+  std::pair<float, int32_t> quant_param = quantizationParams<int8_t>(-1.0f, 1.0f);
+
+  std::vector<int32_t> axis_data{1};
+  Tensor input_tensor{DataType::S8, {1, 3, 2}, {{quant_param.first}, {quant_param.second}}, ""};
+  Tensor axis_tensor = makeInputTensor<DataType::S32>({1}, axis_data);
+  Tensor output_tensor = makeOutputTensor(DataType::S8, quant_param.first, quant_param.second);
+  std::vector<int8_t> quantize_input =
+      quantize<int8_t>(input_data, quant_param.first, quant_param.second);
+  input_tensor.writeData(quantize_input.data(), quantize_input.size() * sizeof(int8_t));
+
+  ReducerParams params{};
+  params.keep_dims = false;
+
+  Mean kernel(&input_tensor, &axis_tensor, &output_tensor, params);
+  kernel.configure();
+  kernel.execute();
+
+  std::vector<float> ref_output_data{0.066667, 0.266667};
+  std::initializer_list<int32_t> ref_output_shape{1, 2};
+  EXPECT_THAT(dequantize<int8_t>(extractTensorData<int8_t>(output_tensor), output_tensor.scale(),
+                                 output_tensor.zero_point()),
+              ElementsAreArray(ArrayFloatNear(ref_output_data, kQuantizedTolerance)));
+  EXPECT_THAT(extractTensorShape(output_tensor), ::testing::ElementsAreArray(ref_output_shape));
+}
+
+TEST(MeanTest, Int8KeepDims4DMeanRequantized)
+{
+  std::vector<float> input_data = {1.0,  -2.0, 3.0, 4.0, 0.5, 1.5, 2.0,  2.0,
+                                   -1.0, 0.0,  1.0, 3.0, 2.0, 2.5, -3.0, 1.0};
+  std::pair<float, int32_t> input_quant_param = quantizationParams<int8_t>(-4.0f, 4.0f);
+  std::pair<float, int32_t> output_quant_param = quantizationParams<int8_t>(-2.0f, 2.0f);
+
+  std::vector<int32_t> axis_data{1, 2};
+  Tensor input_tensor{DataType::S8,
+                      {2, 2, 2, 2},
+                      {{input_quant_param.first}, {input_quant_param.second}},
+                      ""};
+  Tensor axis_tensor = makeInputTensor<DataType::S32>({2}, axis_data);
+  Tensor output_tensor =
+      makeOutputTensor(DataType::S8, output_quant_param.first, output_quant_param.second);
+  std::vector<int8_t> quantize_input =
+      quantize<int8_t>(input_data, input_quant_param.first, input_quant_param.second);
+  input_tensor.writeData(quantize_input.data(), quantize_input.size() * sizeof(int8_t));
+
+  ReducerParams params{};
+  params.keep_dims = true;
+
+  Mean kernel(&input_tensor, &axis_tensor, &output_tensor, params);
+  kernel.configure();
+  kernel.execute();
+
+  std::vector<float> ref_output_data{1.625, 1.375, -0.25, 1.625};
+  std::initializer_list<int32_t> ref_output_shape{2, 1, 1, 2};
+  EXPECT_THAT(dequantize<int8_t>(extractTensorData<int8_t>(output_tensor), output_tensor.scale(),
+                                 output_tensor.zero_point()),
+              ElementsAreArray(ArrayFloatNear(ref_output_data, getTolerance(-4.0, 4.0, 255))));
+  EXPECT_THAT(extractTensorShape(output_tensor), ::testing::ElementsAreArray(ref_output_shape));
+}
+
 } // namespace
 } // namespace kernels
 } // namespace luci_interpreter
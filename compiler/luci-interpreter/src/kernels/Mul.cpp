@@ -72,9 +72,14 @@ void Mul::evalFloat() const
   }
   else
   {
-    tflite::reference_ops::Mul(params, getTensorShape(input1()), getTensorData<float>(input1()),
-                               getTensorShape(input2()), getTensorData<float>(input2()),
-                               getTensorShape(output()), getTensorData<float>(output()));
+    parallelForElements(getThreadPool(), output()->shape().num_elements(),
+                        [&](int32_t begin, int32_t end) {
+                          const tflite::RuntimeShape shape({end - begin});
+                          tflite::reference_ops::Mul(
+                              params, shape, getTensorData<float>(input1()) + begin, shape,
+                              getTensorData<float>(input2()) + begin, shape,
+                              getTensorData<float>(output()) + begin);
+                        });
   }
 }
 
@@ -18,6 +18,8 @@
 #include "kernels/Mul.h"
 #include "kernels/TestUtils.h"
 
+#include "core/ThreadPool.h"
+
 namespace luci_interpreter
 {
 namespace kernels
@@ -80,6 +82,41 @@ TEST(MulTest, Float)
   }
 }
 
+TEST(MulTest, FloatMultiThreaded)
+{
+  // Elements are large enough to be split into several slices
+  Shape shape{4, 100, 100, 1};
+  std::vector<float> input1_data(shape.num_elements());
+  std::vector<float> input2_data(shape.num_elements());
+  for (size_t i = 0; i < input1_data.size(); ++i)
+  {
+    input1_data[i] = static_cast<float>(static_cast<int>(i * 7 % 11) - 5) * 0.5f;
+    input2_data[i] = static_cast<float>(static_cast<int>(i * 5 % 13) - 6) * 0.25f;
+  }
+  Tensor input1_tensor = makeInputTensor<DataType::FLOAT32>(shape, input1_data);
+  Tensor input2_tensor = makeInputTensor<DataType::FLOAT32>(shape, input2_data);
+  Tensor ref_output_tensor = makeOutputTensor(DataType::FLOAT32);
+  Tensor output_tensor = makeOutputTensor(DataType::FLOAT32);
+
+  MulParams params{};
+  params.activation = Activation::RELU;
+
+  Mul ref_kernel(&input1_tensor, &input2_tensor, &ref_output_tensor, params);
+  ref_kernel.configure();
+  ref_kernel.execute();
+
+  ThreadPool thread_pool(3);
+  Mul kernel(&input1_tensor, &input2_tensor, &output_tensor, params);
+  kernel.setThreadPool(&thread_pool);
+  kernel.configure();
+  kernel.execute();
+
+  EXPECT_THAT(extractTensorData<float>(output_tensor),
+              ::testing::ElementsAreArray(extractTensorData<float>(ref_output_tensor)));
+  EXPECT_THAT(extractTensorShape(output_tensor),
+              ::testing::ElementsAreArray(extractTensorShape(ref_output_tensor)));
+}
+
 } // namespace
 } // namespace kernels
 } // namespace luci_interpreter
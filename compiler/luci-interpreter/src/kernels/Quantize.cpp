@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "kernels/Quantize.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+namespace luci_interpreter
+{
+namespace kernels
+{
+
+Quantize::Quantize(const Tensor *input, Tensor *output) : Kernel({input}, {output}) {}
+
+void Quantize::configure()
+{
+  assert(input()->element_type() == DataType::FLOAT32 ||
+         input()->element_type() == DataType::U8 || input()->element_type() == DataType::S16);
+  assert(output()->element_type() == DataType::U8 || output()->element_type() == DataType::S16);
+  output()->resize(input()->shape());
+}
+
+void Quantize::execute() const
+{
+  switch (input()->element_type())
+  {
+    case DataType::FLOAT32:
+      if (output()->element_type() == DataType::U8)
+        evalQuantize<float, uint8_t>();
+      else
+        evalQuantize<float, int16_t>();
+      break;
+    case DataType::U8:
+      if (output()->element_type() == DataType::U8)
+        evalQuantize<uint8_t, uint8_t>();
+      else
+        evalQuantize<uint8_t, int16_t>();
+      break;
+    case DataType::S16:
+      if (output()->element_type() == DataType::U8)
+        evalQuantize<int16_t, uint8_t>();
+      else
+        evalQuantize<int16_t, int16_t>();
+      break;
+    default:
+      throw std::runtime_error("Unsupported type.");
+  }
+}
+
+template <typename InputT, typename OutputT> void Quantize::evalQuantize() const
+{
+  // A quantized input is requantized through its real value
+  const bool is_float_input = std::is_floating_point<InputT>::value;
+  const float input_scale = is_float_input ? 1.0f : input()->scale();
+  const float input_zero_point = is_float_input ? 0.0f : input()->zero_point();
+  const float output_scale = output()->scale();
+  const float output_zero_point = output()->zero_point();
+
+  const float qmin = std::numeric_limits<OutputT>::lowest();
+  const float qmax = std::numeric_limits<OutputT>::max();
+
+  const auto *input_data = input()->data<InputT>();
+  auto *output_data = output()->data<OutputT>();
+  const int32_t num_elements = input()->shape().num_elements();
+  for (int32_t i = 0; i < num_elements; ++i)
+  {
+    const float value = (static_cast<float>(input_data[i]) - input_zero_point) * input_scale;
+    const float q = std::round(value / output_scale) + output_zero_point;
+    output_data[i] = static_cast<OutputT>(std::min(qmax, std::max(qmin, q)));
+  }
+}
+
+} // namespace kernels
+} // namespace luci_interpreter
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "kernels/Quantize.h"
+#include "kernels/TestUtils.h"
+
+namespace luci_interpreter
+{
+namespace kernels
+{
+namespace
+{
+
+using namespace testing;
+
+TEST(QuantizeTest, FloatUint8)
+{
+  Shape shape{2, 3};
+  std::vector<float> input_data{-1.0f, 0.0f, 0.5f, 1.0f, 1.5f, 10.0f};
+  Tensor input_tensor = makeInputTensor<DataType::FLOAT32>(shape, input_data);
+  Tensor output_tensor = makeOutputTensor(DataType::U8, 0.5f, 2);
+
+  Quantize kernel(&input_tensor, &output_tensor);
+  kernel.configure();
+  kernel.execute();
+
+  // Values out of the range are saturated
+  EXPECT_THAT(extractTensorData<uint8_t>(output_tensor),
+              ::testing::ElementsAreArray({0, 2, 3, 4, 5, 22}));
+  EXPECT_THAT(extractTensorShape(output_tensor), ::testing::ElementsAreArray({2, 3}));
+}
+
+TEST(QuantizeTest, FloatInt16)
+{
+  Shape shape{4};
+  std::vector<float> input_data{-1.0f, -0.25f, 0.5f, 100.0f};
+  Tensor input_tensor = makeInputTensor<DataType::FLOAT32>(shape, input_data);
+  Tensor output_tensor = makeOutputTensor(DataType::S16, 1.0f / 1024, 0);
+
+  Quantize kernel(&input_tensor, &output_tensor);
+  kernel.configure();
+  kernel.execute();
+
+  EXPECT_THAT(extractTensorData<int16_t>(output_tensor),
+              ::testing::ElementsAreArray({-1024, -256, 512, 32767}));
+}
+
+TEST(QuantizeTest, Uint8Int16)
+{
+  Shape shape{4};
+  std::vector<uint8_t> input_data{0, 2, 3, 6};
+  Tensor input_tensor{DataType::U8, shape, {{0.5f}, {2}}, ""};
+  input_tensor.writeData(input_data.data(), input_data.size() * sizeof(uint8_t));
+  Tensor output_tensor = makeOutputTensor(DataType::S16, 0.25f, 0);
+
+  Quantize kernel(&input_tensor, &output_tensor);
+  kernel.configure();
+  kernel.execute();
+
+  // Real values are -1, 0, 0.5, 2
+  EXPECT_THAT(extractTensorData<int16_t>(output_tensor),
+              ::testing::ElementsAreArray({-4, 0, 2, 8}));
+}
+
+} // namespace
+} // namespace kernels
+} // namespace luci_interpreter
@@ -18,8 +18,12 @@
 
 #include "kernels/Utils.h"
 
+#include <tensorflow/lite/kernels/internal/common.h>
+#include <tensorflow/lite/kernels/internal/quantization_util.h>
 #include <tensorflow/lite/kernels/internal/reference/softmax.h>
 
+#include <algorithm>
+#include <limits>
 #include <stdexcept>
 
 namespace luci_interpreter
@@ -37,6 +41,31 @@ void Softmax::configure()
 {
   assert(input()->element_type() == output()->element_type());
   output()->resize(input()->shape());
+
+  if (input()->element_type() == DataType::U8 || input()->element_type() == DataType::S8)
+  {
+    // Same as TensorFlow Lite
+    constexpr int scaled_diff_integer_bits = 5;
+    tflite::PreprocessSoftmaxScaling(_params.beta, input()->scale(), scaled_diff_integer_bits,
+                                     &_input_multiplier, &_input_left_shift);
+    _diff_min = -tflite::CalculateInputRadius(scaled_diff_integer_bits, _input_left_shift);
+
+    // The kernel maps [0, 1) to the whole range of the type
+    constexpr float kernel_scale = 1.0f / 256;
+    const int32_t kernel_zero_point = input()->element_type() == DataType::U8 ? 0 : -128;
+    if (output()->scale() == kernel_scale && output()->zero_point() == kernel_zero_point)
+    {
+      _temp_output.reset();
+    }
+    else
+    {
+      _temp_output =
+          std::make_unique<Tensor>(input()->element_type(), input()->shape(),
+                                   AffineQuantization{{kernel_scale}, {kernel_zero_point}}, "");
+      quantizeMultiplier(static_cast<double>(kernel_scale) / output()->scale(),
+                         &_output_multiplier, &_output_shift);
+    }
+  }
 }
 
 void Softmax::execute() const
@@ -46,6 +75,12 @@ void Softmax::execute() const
     case DataType::FLOAT32:
       evalFloat();
       break;
+    case DataType::U8:
+      evalQuantized<uint8_t>();
+      break;
+    case DataType::S8:
+      evalQuantized<int8_t>();
+      break;
     default:
       throw std::runtime_error("Unsupported type.");
   }
@@ -60,5 +95,34 @@ void Softmax::evalFloat() const
                                  getTensorShape(output()), getTensorData<float>(output()));
 }
 
+template <typename T> void Softmax::evalQuantized() const
+{
+  tflite::SoftmaxParams params{};
+  params.input_multiplier = _input_multiplier;
+  params.input_left_shift = _input_left_shift;
+  params.diff_min = _diff_min;
+
+  Tensor *kernel_output = _temp_output != nullptr ? _temp_output.get() : output();
+  tflite::reference_ops::Softmax(params, getTensorShape(input()), getTensorData<T>(input()),
+                                 getTensorShape(kernel_output), getTensorData<T>(kernel_output));
+  if (_temp_output == nullptr)
+    return;
+
+  // Requantize to the scale and zero point of the output
+  const auto kernel_zero_point = static_cast<int32_t>(_temp_output->zero_point());
+  const auto output_zero_point = static_cast<int32_t>(output()->zero_point());
+  const int32_t qmin = std::numeric_limits<T>::min();
+  const int32_t qmax = std::numeric_limits<T>::max();
+  const T *kernel_data = getTensorData<T>(_temp_output.get());
+  T *output_data = getTensorData<T>(output());
+  const int32_t size = output()->shape().num_elements();
+  for (int32_t i = 0; i < size; ++i)
+  {
+    const int32_t value = tflite::MultiplyByQuantizedMultiplier(
+        kernel_data[i] - kernel_zero_point, _output_multiplier, _output_shift);
+    output_data[i] = static_cast<T>(std::min(std::max(value + output_zero_point, qmin), qmax));
+  }
+}
+
 } // namespace kernels
 } // namespace luci_interpreter
@@ -20,6 +20,8 @@
 #include "core/Kernel.h"
 #include "core/KernelParams.h"
 
+#include <memory>
+
 namespace luci_interpreter
 {
 namespace kernels
@@ -38,6 +40,16 @@ public:
 
 private:
   void evalFloat() const;
+  template <typename T> void evalQuantized() const;
+
+private:
+  // Quantized kernel computes output with scale 1/256, which is requantized if the output differs
+  std::unique_ptr<Tensor> _temp_output;
+  int32_t _input_multiplier = 0;
+  int _input_left_shift = 0;
+  int _diff_min = 0;
+  int32_t _output_multiplier = 0;
+  int _output_shift = 0;
 };
 
 } // namespace kernels
@@ -55,6 +55,82 @@ TEST(SoftmaxTest, Float)
               ElementsAreArray(ArrayFloatNear(ref_output_data)));
 }
 
+TEST(SoftmaxTest, Uint8)
+{
+  std::vector<float> input_data{
+      5,  -9, 8,  //
+      -7, 2,  -4, //
+      1,  -2, 9,  //
+      3,  -6, -1, //
+  };
+  std::pair<float, int32_t> input_quant_param = quantizationParams<uint8_t>(-10.0f, 10.0f);
+  Tensor input_tensor{DataType::U8,
+                      {2, 1, 2, 3},
+                      {{input_quant_param.first}, {input_quant_param.second}},
+                      ""};
+  std::vector<uint8_t> quantize_input =
+      quantize<uint8_t>(input_data, input_quant_param.first, input_quant_param.second);
+  input_tensor.writeData(quantize_input.data(), quantize_input.size() * sizeof(uint8_t));
+  // Output quantization of TensorFlow Lite, which the kernel produces directly
+  Tensor output_tensor = makeOutputTensor(DataType::U8, 1.0f / 256, 0);
+
+  SoftmaxParams params{};
+  params.beta = 0.1;
+
+  Softmax kernel(&input_tensor, &output_tensor, params);
+  kernel.configure();
+  kernel.execute();
+
+  std::vector<float> ref_output_data{
+      0.38514, 0.09497, 0.51989, //
+      0.20792, 0.51141, 0.28067, //
+      0.25212, 0.18678, 0.56110, //
+      0.48149, 0.19576, 0.32275, //
+  };
+  EXPECT_THAT(dequantize<uint8_t>(extractTensorData<uint8_t>(output_tensor), output_tensor.scale(),
+                                  output_tensor.zero_point()),
+              ElementsAreArray(ArrayFloatNear(ref_output_data, 2.0f / 256)));
+}
+
+TEST(SoftmaxTest, Int8Requantized)
+{
+  std::vector<float> input_data{
+      5,  -9, 8,  //
+      -7, 2,  -4, //
+      1,  -2, 9,  //
+      3,  -6, -1, //
+  };
+  std::pair<float, int32_t> input_quant_param = quantizationParams<int8_t>(-10.0f, 10.0f);
+  Tensor input_tensor{DataType::S8,
+                      {2, 1, 2, 3},
+                      {{input_quant_param.first}, {input_quant_param.second}},
+                      ""};
+  std::vector<int8_t> quantize_input =
+      quantize<int8_t>(input_data, input_quant_param.first, input_quant_param.second);
+  input_tensor.writeData(quantize_input.data(), quantize_input.size() * sizeof(int8_t));
+  // Output quantization from recorded min/max, as luci quantizer produces
+  std::pair<float, int32_t> output_quant_param = quantizationParams<int8_t>(0.0f, 0.6f);
+  Tensor output_tensor =
+      makeOutputTensor(DataType::S8, output_quant_param.first, output_quant_param.second);
+
+  SoftmaxParams params{};
+  params.beta = 0.1;
+
+  Softmax kernel(&input_tensor, &output_tensor, params);
+  kernel.configure();
+  kernel.execute();
+
+  std::vector<float> ref_output_data{
+      0.38514, 0.09497, 0.51989, //
+      0.20792, 0.51141, 0.28067, //
+      0.25212, 0.18678, 0.56110, //
+      0.48149, 0.19576, 0.32275, //
+  };
+  EXPECT_THAT(dequantize<int8_t>(extractTensorData<int8_t>(output_tensor), output_tensor.scale(),
+                                 output_tensor.zero_point()),
+              ElementsAreArray(ArrayFloatNear(ref_output_data, 2.0f / 256)));
+}
+
 } // namespace
 } // namespace kernels
 } // namespace luci_interpreter
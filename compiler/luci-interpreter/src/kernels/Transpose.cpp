@@ -75,6 +75,11 @@ void Transpose::execute() const
                                        getTensorData<uint8_t>(input()), getTensorShape(output()),
                                        getTensorData<uint8_t>(output()));
       break;
+    case DataType::S8:
+      tflite::reference_ops::Transpose(params, getTensorShape(input()),
+                                       getTensorData<int8_t>(input()), getTensorShape(output()),
+                                       getTensorData<int8_t>(output()));
+      break;
     default:
       throw std::runtime_error("Unsupported type.");
   }
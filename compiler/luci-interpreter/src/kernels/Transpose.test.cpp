@@ -50,7 +50,7 @@ template <typename T> class TransposeTest : public ::testing::Test
 {
 };
 
-using DataTypes = ::testing::Types<float, uint8_t>;
+using DataTypes = ::testing::Types<float, uint8_t, int8_t>;
 TYPED_TEST_CASE(TransposeTest, DataTypes);
 
 TYPED_TEST(TransposeTest, Small3D)
@@ -29,6 +29,18 @@ namespace luci_interpreter
 namespace kernels
 {
 
+namespace
+{
+
+tflite::RuntimeShape getBatchShape(const Tensor *tensor)
+{
+  tflite::RuntimeShape shape = getTensorShape(tensor);
+  shape.SetDim(0, 1);
+  return shape;
+}
+
+} // namespace
+
 TransposeConv::TransposeConv(const Tensor *output_shape, const Tensor *filter, const Tensor *input,
                              Tensor *output, const TransposeConvParams &params)
     : KernelWithParams<TransposeConvParams>({output_shape, filter, input}, {output}, params)
@@ -45,8 +57,6 @@ void TransposeConv::configure()
   assert(input()->shape().dim(3) == filter()->shape().dim(3));
   if (input()->element_type() == DataType::U8)
   {
-    _scratch_tensor =
-        std::make_unique<Tensor>(DataType::S32, output()->shape(), AffineQuantization{}, "");
     double real_multiplier = 0.0;
     const double input_product_scale = input()->scale() * filter()->scale();
     assert(input_product_scale >= 0);
@@ -62,6 +72,10 @@ void TransposeConv::configure()
   for (int i = 0; i < num_dims; i++)
     out_shape.dim(i) = shape_data[i];
   output()->resize(out_shape);
+
+  // Scratch buffer is split by batches, so it must have the shape of the resized output
+  if (input()->element_type() == DataType::U8)
+    _scratch_tensor = std::make_unique<Tensor>(DataType::S32, out_shape, AffineQuantization{}, "");
 }
 
 void TransposeConv::execute() const
@@ -104,10 +118,18 @@ void TransposeConv::evalFloat() const
   op_params.stride_height = params().stride_height;
   op_params.stride_width = params().stride_width;
   op_params.output_multiplier = _output_multiplier;
-  tflite::reference_ops::TransposeConv(
-      op_params, getTensorShape(input()), getTensorData<float>(input()), getTensorShape(filter()),
-      getTensorData<float>(filter()), getTensorShape(output()), getTensorData<float>(output()),
-      tflite::RuntimeShape(), (float *)nullptr);
+
+  // Batches are computed independently, possibly in parallel.
+  const tflite::RuntimeShape input_shape = getBatchShape(input());
+  const tflite::RuntimeShape output_shape = getBatchShape(output());
+  const auto eval_batch = [&](int32_t batch, int32_t, int32_t) {
+    tflite::reference_ops::TransposeConv(
+        op_params, input_shape, getTensorData<float>(input()) + batch * input_shape.FlatSize(),
+        getTensorShape(filter()), getTensorData<float>(filter()), output_shape,
+        getTensorData<float>(output()) + batch * output_shape.FlatSize(), tflite::RuntimeShape(),
+        (float *)nullptr);
+  };
+  parallelFor(getThreadPool(), output()->shape().dim(0), 1, 1, eval_batch);
 }
 
 void TransposeConv::evalQuantized() const
@@ -143,10 +165,18 @@ void TransposeConv::evalQuantized() const
   op_params.quantized_activation_min = std::numeric_limits<uint8_t>::min();
   op_params.quantized_activation_max = std::numeric_limits<uint8_t>::max();
 
-  tflite::reference_ops::TransposeConv(
-      op_params, getTensorShape(input()), getTensorData<uint8>(input()), getTensorShape(filter()),
-      getTensorData<uint8>(filter()), getTensorShape(output()), getTensorData<uint8>(output()),
-      tflite::RuntimeShape(), (uint8 *)nullptr, getTensorData<int32_t>(_scratch_tensor.get()));
+  // Batches are computed independently, possibly in parallel.
+  const tflite::RuntimeShape input_shape = getBatchShape(input());
+  const tflite::RuntimeShape output_shape = getBatchShape(output());
+  const auto eval_batch = [&](int32_t batch, int32_t, int32_t) {
+    tflite::reference_ops::TransposeConv(
+        op_params, input_shape, getTensorData<uint8>(input()) + batch * input_shape.FlatSize(),
+        getTensorShape(filter()), getTensorData<uint8>(filter()), output_shape,
+        getTensorData<uint8>(output()) + batch * output_shape.FlatSize(), tflite::RuntimeShape(),
+        (uint8 *)nullptr,
+        getTensorData<int32_t>(_scratch_tensor.get()) + batch * output_shape.FlatSize());
+  };
+  parallelFor(getThreadPool(), output()->shape().dim(0), 1, 1, eval_batch);
 }
 
 } // namespace kernels
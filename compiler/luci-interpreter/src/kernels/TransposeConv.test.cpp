@@ -17,6 +17,8 @@
 #include "kernels/TransposeConv.h"
 #include "kernels/TestUtils.h"
 
+#include "core/ThreadPool.h"
+
 namespace luci_interpreter
 {
 namespace kernels
@@ -88,6 +90,92 @@ TEST(TransposeConvTest, FloatTwoFiltersTest)
   SUCCEED();
 }
 
+TEST(TransposeConvTest, FloatMultiThreaded)
+{
+  // Batches are computed by different threads
+  Shape input_shape{3, 4, 4, 2};
+  Shape filter_shape{1, 3, 3, 2};
+  std::vector<float> input_data(input_shape.num_elements());
+  std::vector<float> filter_data(filter_shape.num_elements());
+  for (size_t i = 0; i < input_data.size(); ++i)
+    input_data[i] = static_cast<float>(static_cast<int>(i * 7 % 11) - 5);
+  for (size_t i = 0; i < filter_data.size(); ++i)
+    filter_data[i] = static_cast<float>(static_cast<int>(i * 5 % 7) - 3);
+  Tensor output_shape_tensor = makeInputTensor<DataType::S32>({4}, {3, 8, 8, 1});
+  Tensor filter_tensor = makeInputTensor<DataType::FLOAT32>(filter_shape, filter_data);
+  Tensor input_tensor = makeInputTensor<DataType::FLOAT32>(input_shape, input_data);
+  Tensor ref_output_tensor = makeOutputTensor(DataType::FLOAT32);
+  Tensor output_tensor = makeOutputTensor(DataType::FLOAT32);
+
+  TransposeConvParams params{};
+  params.padding = luci::Padding::SAME;
+  params.stride_height = 2;
+  params.stride_width = 2;
+
+  TransposeConv ref_kernel(&output_shape_tensor, &filter_tensor, &input_tensor,
+                           &ref_output_tensor, params);
+  ref_kernel.configure();
+  ref_kernel.execute();
+
+  ThreadPool thread_pool(3);
+  TransposeConv kernel(&output_shape_tensor, &filter_tensor, &input_tensor, &output_tensor,
+                       params);
+  kernel.setThreadPool(&thread_pool);
+  kernel.configure();
+  kernel.execute();
+
+  EXPECT_THAT(extractTensorData<float>(output_tensor),
+              ::testing::ElementsAreArray(extractTensorData<float>(ref_output_tensor)));
+  EXPECT_THAT(extractTensorShape(output_tensor), ::testing::ElementsAreArray({3, 8, 8, 1}));
+}
+
+TEST(TransposeConvTest, Uint8MultiThreaded)
+{
+  std::pair<float, int32_t> input_quant_param = quantizationParams<uint8_t>(-8.f, 8.f);
+  std::pair<float, int32_t> output_quant_param = quantizationParams<uint8_t>(-64.f, 64.f);
+
+  // Batches are computed by different threads, each with its own part of the scratch buffer
+  Shape input_shape{3, 4, 4, 2};
+  Shape filter_shape{1, 3, 3, 2};
+  std::vector<uint8_t> input_data(input_shape.num_elements());
+  std::vector<uint8_t> filter_data(filter_shape.num_elements());
+  for (size_t i = 0; i < input_data.size(); ++i)
+    input_data[i] = static_cast<uint8_t>(i * 7 % 251);
+  for (size_t i = 0; i < filter_data.size(); ++i)
+    filter_data[i] = static_cast<uint8_t>(i * 5 % 241);
+  Tensor output_shape_tensor = makeInputTensor<DataType::S32>({4}, {3, 8, 8, 1});
+  Tensor filter_tensor{
+      DataType::U8, filter_shape, {{input_quant_param.first}, {input_quant_param.second}}, ""};
+  Tensor input_tensor{
+      DataType::U8, input_shape, {{input_quant_param.first}, {input_quant_param.second}}, ""};
+  filter_tensor.writeData(filter_data.data(), filter_data.size() * sizeof(uint8_t));
+  input_tensor.writeData(input_data.data(), input_data.size() * sizeof(uint8_t));
+  Tensor ref_output_tensor =
+      makeOutputTensor(DataType::U8, output_quant_param.first, output_quant_param.second);
+  Tensor output_tensor =
+      makeOutputTensor(DataType::U8, output_quant_param.first, output_quant_param.second);
+
+  TransposeConvParams params{};
+  params.padding = luci::Padding::SAME;
+  params.stride_height = 2;
+  params.stride_width = 2;
+
+  TransposeConv ref_kernel(&output_shape_tensor, &filter_tensor, &input_tensor,
+                           &ref_output_tensor, params);
+  ref_kernel.configure();
+  ref_kernel.execute();
+
+  ThreadPool thread_pool(3);
+  TransposeConv kernel(&output_shape_tensor, &filter_tensor, &input_tensor, &output_tensor,
+                       params);
+  kernel.setThreadPool(&thread_pool);
+  kernel.configure();
+  kernel.execute();
+
+  EXPECT_THAT(extractTensorData<uint8_t>(output_tensor),
+              ::testing::ElementsAreArray(extractTensorData<uint8_t>(ref_output_tensor)));
+}
+
 // TODO Uint8Simple
 // Implement GetDequantizedOutput Function.
 // Create Test for Uint8 Case
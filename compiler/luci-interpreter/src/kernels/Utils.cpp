@@ -17,6 +17,9 @@
 
 #include "kernels/Utils.h"
 
+#include "core/ThreadPool.h"
+
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 #include <limits>
@@ -27,6 +30,66 @@ namespace luci_interpreter
 namespace kernels
 {
 
+void parallelFor(ThreadPool *thread_pool, int32_t outer_size, int32_t inner_size,
+                 int32_t min_chunk_size,
+                 const std::function<void(int32_t, int32_t, int32_t)> &fn)
+{
+  const int64_t total_size = static_cast<int64_t>(outer_size) * inner_size;
+  if (total_size == 0)
+    return;
+
+  const int64_t num_threads = thread_pool != nullptr ? thread_pool->getNumThreads() : 1;
+  const int64_t chunk_size =
+      std::max<int64_t>((total_size + num_threads - 1) / num_threads, min_chunk_size);
+  const int64_t num_chunks = (total_size + chunk_size - 1) / chunk_size;
+
+  const auto run_chunk = [&](int32_t chunk) {
+    int64_t begin = chunk * chunk_size;
+    const int64_t end = std::min(begin + chunk_size, total_size);
+    while (begin < end)
+    {
+      const auto outer = static_cast<int32_t>(begin / inner_size);
+      const auto inner_begin = static_cast<int32_t>(begin % inner_size);
+      const auto inner_end =
+          static_cast<int32_t>(std::min<int64_t>(inner_size, inner_begin + (end - begin)));
+      fn(outer, inner_begin, inner_end);
+      begin += inner_end - inner_begin;
+    }
+  };
+
+  if (num_chunks == 1)
+    run_chunk(0);
+  else
+    thread_pool->run(static_cast<int32_t>(num_chunks), run_chunk);
+}
+
+void parallelForConvSlices(ThreadPool *thread_pool, const Shape &input_shape,
+                           const Shape &output_shape, int32_t filter_height, int32_t stride,
+                           int32_t dilation_rate, int32_t padding,
+                           const std::function<void(const ConvSlice &)> &fn)
+{
+  assert(input_shape.num_dims() == 4 && output_shape.num_dims() == 4);
+  const int32_t batches = output_shape.dim(0);
+  const int32_t input_height = input_shape.dim(1);
+  const int32_t input_row_size = input_shape.dim(2) * input_shape.dim(3);
+  const int32_t output_height = output_shape.dim(1);
+  const int32_t output_row_size = output_shape.dim(2) * output_shape.dim(3);
+
+  parallelFor(thread_pool, batches, output_height, 1,
+              [&](int32_t batch, int32_t out_begin, int32_t out_end) {
+                const InputRowRange rows =
+                    computeInputRowRange(out_begin, out_end, input_height, filter_height, stride,
+                                         dilation_rate, padding);
+                const ConvSlice slice{
+                    {1, rows.end - rows.begin, input_shape.dim(2), input_shape.dim(3)},
+                    (batch * input_height + rows.begin) * input_row_size,
+                    {1, out_end - out_begin, output_shape.dim(2), output_shape.dim(3)},
+                    (batch * output_height + out_begin) * output_row_size,
+                    rows.padding};
+                fn(slice);
+              });
+}
+
 void calculateActivationRange(Activation activation, float *activation_min, float *activation_max)
 {
   switch (activation)
@@ -160,6 +223,25 @@ void quantizeMultiplierSmallerThanOneExp(double double_multiplier, int32_t *quan
   *left_shift = shift;
 }
 
+void quantizeChannelMultipliers(float input_scale, const std::vector<float> &filter_scales,
+                                float output_scale, std::vector<int32_t> *multipliers,
+                                std::vector<int32_t> *shifts)
+{
+  const size_t num_channels = filter_scales.size();
+  multipliers->resize(num_channels);
+  shifts->resize(num_channels);
+
+  for (size_t c = 0; c < num_channels; ++c)
+  {
+    const double effective_scale = static_cast<double>(input_scale) *
+                                   static_cast<double>(filter_scales[c]) /
+                                   static_cast<double>(output_scale);
+    int shift{};
+    quantizeMultiplier(effective_scale, &multipliers->at(c), &shift);
+    shifts->at(c) = shift;
+  }
+}
+
 Shape calculateShapeForBroadcast(const Shape &input1_shape, const Shape &input2_shape)
 {
   const int num_input1_dims = input1_shape.num_dims();
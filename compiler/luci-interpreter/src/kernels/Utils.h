@@ -23,11 +23,25 @@
 
 #include <tensorflow/lite/kernels/internal/types.h>
 
+#include <algorithm>
 #include <cassert>
 #include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <vector>
 
 namespace luci_interpreter
 {
+
+// Checks a condition on kernel arguments, which holds in release builds unlike 'assert'
+#define LUCI_INTERPRETER_CHECK(cond)                                                       \
+  if (!(cond))                                                                             \
+    throw std::runtime_error(std::string(__FILE__) + ":" + std::to_string(__LINE__) + "(" + \
+                             std::string(#cond) + ") was not true.");
+
+class ThreadPool;
+
 namespace kernels
 {
 
@@ -65,6 +79,65 @@ inline int32_t computeOutputSize(Padding padding, int32_t image_size, int32_t fi
   }
 }
 
+// Input rows needed to compute a range of output rows of a convolution-like operation,
+// along with the padding to use for this range.
+struct InputRowRange
+{
+  int32_t begin;
+  int32_t end;
+  int32_t padding;
+};
+
+inline InputRowRange computeInputRowRange(int32_t out_begin, int32_t out_end, int32_t in_size,
+                                          int32_t filter_size, int32_t stride,
+                                          int32_t dilation_rate, int32_t padding)
+{
+  const int32_t effective_filter_size = (filter_size - 1) * dilation_rate + 1;
+  const int32_t origin = out_begin * stride - padding;
+  InputRowRange range{};
+  range.begin = std::max(origin, 0);
+  range.end = std::min((out_end - 1) * stride - padding + effective_filter_size, in_size);
+  range.end = std::max(range.end, range.begin);
+  range.padding = range.begin - origin;
+  return range;
+}
+
+// Splits the iteration space [0, outer_size) x [0, inner_size) between the threads of
+// 'thread_pool' and calls 'fn(outer, inner_begin, inner_end)' for contiguous ranges of it.
+// A range never crosses the 'outer' boundary. Each thread gets at least 'min_chunk_size'
+// elements of the iteration space. If 'thread_pool' is nullptr, the calling thread is used.
+void parallelFor(ThreadPool *thread_pool, int32_t outer_size, int32_t inner_size,
+                 int32_t min_chunk_size,
+                 const std::function<void(int32_t, int32_t, int32_t)> &fn);
+
+// Splits an elementwise operation on 'size' elements between the threads of 'thread_pool' and
+// calls 'fn(begin, end)' for contiguous ranges of elements. Small operations are not split.
+inline void parallelForElements(ThreadPool *thread_pool, int32_t size,
+                                const std::function<void(int32_t, int32_t)> &fn)
+{
+  constexpr int32_t min_chunk_size = 16384;
+  parallelFor(thread_pool, 1, size, min_chunk_size,
+              [&fn](int32_t, int32_t begin, int32_t end) { fn(begin, end); });
+}
+
+// A range of output rows of one batch of a convolution-like operation on NHWC tensors.
+// Offsets are in elements from the beginning of the corresponding tensor.
+struct ConvSlice
+{
+  tflite::RuntimeShape input_shape;
+  int32_t input_offset;
+  tflite::RuntimeShape output_shape;
+  int32_t output_offset;
+  int32_t padding_height;
+};
+
+// Splits the output rows of a convolution-like operation between the threads of 'thread_pool'
+// and calls 'fn' for each of the resulting slices.
+void parallelForConvSlices(ThreadPool *thread_pool, const Shape &input_shape,
+                           const Shape &output_shape, int32_t filter_height, int32_t stride,
+                           int32_t dilation_rate, int32_t padding,
+                           const std::function<void(const ConvSlice &)> &fn);
+
 void calculateActivationRange(Activation activation, float *activation_min, float *activation_max);
 
 void calculateActivationRangeQuantized(Activation activation, const Tensor *output,
@@ -87,6 +160,14 @@ void quantizeMultiplier(double double_multiplier, int32_t *quantized_multiplier,
 void quantizeMultiplierSmallerThanOneExp(double double_multiplier, int32_t *quantized_multiplier,
                                          int *left_shift);
 
+// Quantize per-channel multipliers of convolution-like kernels.
+//
+// The effective scale of output channel 'c' is 'input_scale * filter_scales[c] / output_scale'.
+// 'multipliers' and 'shifts' are resized to the number of channels.
+void quantizeChannelMultipliers(float input_scale, const std::vector<float> &filter_scales,
+                                float output_scale, std::vector<int32_t> *multipliers,
+                                std::vector<int32_t> *shifts);
+
 Shape calculateShapeForBroadcast(const Shape &input1_shape, const Shape &input2_shape);
 
 inline tflite::RuntimeShape getTensorShape(const Tensor *tensor)
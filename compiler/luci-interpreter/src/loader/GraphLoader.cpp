@@ -144,6 +144,10 @@ void GraphLoader::loadTensors()
 
     if (const auto *const_node = dynamic_cast<const luci::CircleConst *>(node))
     {
+      // Kernels read values by the shape, while a sparse constant has non-zero values only
+      if (const_node->sparsityparam() != nullptr)
+        throw std::runtime_error("Sparse constant is not supported: " + node->name());
+
       size_t data_size{};
       const void *const_data = getNodeData(const_node, &data_size);
       if (const_data != nullptr)
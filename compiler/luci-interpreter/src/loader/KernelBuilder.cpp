@@ -23,6 +23,7 @@
 #include "kernels/Conv2D.h"
 #include "kernels/DepthToSpace.h"
 #include "kernels/DepthwiseConv2D.h"
+#include "kernels/Dequantize.h"
 #include "kernels/Elu.h"
 #include "kernels/FullyConnected.h"
 #include "kernels/If.h"
@@ -35,6 +36,7 @@
 #include "kernels/Mean.h"
 #include "kernels/Mul.h"
 #include "kernels/Pad.h"
+#include "kernels/Quantize.h"
 #include "kernels/Reshape.h"
 #include "kernels/Reverse.h"
 #include "kernels/Slice.h"
@@ -223,6 +225,16 @@ std::unique_ptr<Kernel> KernelBuilder::visit(const luci::CircleDepthwiseConv2D *
   return std::make_unique<kernels::DepthwiseConv2D>(input, filter, bias, output, params);
 }
 
+std::unique_ptr<Kernel> KernelBuilder::visit(const luci::CircleDequantize *node)
+{
+  assert(node->arity() == 1);
+
+  const Tensor *input = getInputTensor(node->input());
+  Tensor *output = getOutputTensor(node);
+
+  return std::make_unique<kernels::Dequantize>(input, output);
+}
+
 std::unique_ptr<Kernel> KernelBuilder::visit(const luci::CircleElu *node)
 {
   assert(node->arity() == 1);
@@ -404,6 +416,16 @@ std::unique_ptr<Kernel> KernelBuilder::visit(const luci::CirclePad *node)
   return std::make_unique<kernels::Pad>(input, paddings, output);
 }
 
+std::unique_ptr<Kernel> KernelBuilder::visit(const luci::CircleQuantize *node)
+{
+  assert(node->arity() == 1);
+
+  const Tensor *input = getInputTensor(node->input());
+  Tensor *output = getOutputTensor(node);
+
+  return std::make_unique<kernels::Quantize>(input, output);
+}
+
 std::unique_ptr<Kernel> KernelBuilder::visit(const luci::CircleReshape *node)
 {
   assert(node->arity() == 2);
@@ -24,6 +24,7 @@
 #include <kernels/Conv2D.h>
 #include <kernels/DepthToSpace.h>
 #include <kernels/DepthwiseConv2D.h>
+#include <kernels/Dequantize.h>
 #include <kernels/Elu.h>
 #include <kernels/FullyConnected.h>
 #include <kernels/L2Normalize.h>
@@ -35,6 +36,7 @@
 #include <kernels/Mean.h>
 #include <kernels/Mul.h>
 #include <kernels/Pad.h>
+#include <kernels/Quantize.h>
 #include <kernels/Reshape.h>
 #include <kernels/Reverse.h>
 #include <kernels/Slice.h>
@@ -276,6 +278,20 @@ TEST_F(KernelBuilderTest, DepthwiseConv2D)
   EXPECT_THAT(kernel->params().activation, Eq(op->fusedActivationFunction()));
 }
 
+TEST_F(KernelBuilderTest, Dequantize)
+{
+  auto *input = createInputNode();
+
+  auto *op = createNode<luci::CircleDequantize>();
+  op->input(input);
+
+  auto kernel = buildKernel<kernels::Dequantize>(op);
+  ASSERT_THAT(kernel, NotNull());
+
+  checkTensor(kernel->input(), input);
+  checkTensor(kernel->output(), op);
+}
+
 TEST_F(KernelBuilderTest, Elu)
 {
   auto *input = createInputNode();
@@ -495,6 +511,20 @@ TEST_F(KernelBuilderTest, Pad)
   checkTensor(kernel->output(), op);
 }
 
+TEST_F(KernelBuilderTest, Quantize)
+{
+  auto *input = createInputNode();
+
+  auto *op = createNode<luci::CircleQuantize>();
+  op->input(input);
+
+  auto kernel = buildKernel<kernels::Quantize>(op);
+  ASSERT_THAT(kernel, NotNull());
+
+  checkTensor(kernel->input(), input);
+  checkTensor(kernel->output(), op);
+}
+
 TEST_F(KernelBuilderTest, Reshape)
 {
   auto *input = createInputNode();
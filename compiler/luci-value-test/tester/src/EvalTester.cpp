@@ -59,7 +59,8 @@ std::unique_ptr<luci::Module> importModel(const std::string &filename)
   }
   std::vector<char> model_data((std::istreambuf_iterator<char>(fs)),
                                std::istreambuf_iterator<char>());
-  return luci::Importer().importModule(circle::GetModel(model_data.data()));
+  return luci::Importer().importModule(reinterpret_cast<const uint8_t *>(model_data.data()),
+                                      model_data.size());
 }
 
 template <typename NodeT> size_t getTensorSize(const NodeT *node)
@@ -21,6 +21,7 @@
 
 #include <loco.h>
 
+#include <cstdint>
 #include <memory>
 
 namespace luci
@@ -45,6 +46,11 @@ public:
     // TODO make this pure virtual
     virtual luci::Module *module(void) const;
 
+    // Size of constant data from which buffer data is stored outside of flatbuffers
+    // NOTE Default is a little less than 2GB, which is the limit of flatbuffers. This can be
+    //      lowered to store buffer data of a small model in the same way, e.g. for testing
+    virtual uint64_t ext_buffer_threshold(void) const;
+
   public: // Exporter -> Client
     // Exporter calls store for export data
     // Notice: Please DO NOT STORE ptr and size when implementing this in Client
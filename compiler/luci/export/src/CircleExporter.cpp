@@ -19,6 +19,7 @@
 #include "CircleExporterImpl.h"
 
 #include <oops/InternalExn.h>
+#include <flatbuffers/flatbuffers.h>
 
 #include <fstream>
 #include <memory>
@@ -29,6 +30,13 @@ namespace luci
 // TODO remove this
 Module *CircleExporter::Contract::module(void) const { return nullptr; }
 
+uint64_t CircleExporter::Contract::ext_buffer_threshold(void) const
+{
+  // Leave some room for other parts of the model such as tensors and operators
+  constexpr uint64_t margin = 256 * 1024 * 1024;
+  return FLATBUFFERS_MAX_BUFFER_SIZE - margin;
+}
+
 CircleExporter::CircleExporter()
 {
   // NOTHING TO DO
@@ -39,7 +47,7 @@ bool CircleExporter::invoke(Contract *contract) const
   auto module = contract->module();
   if (module != nullptr)
   {
-    CircleExporterImpl impl(module);
+    CircleExporterImpl impl(module, contract->ext_buffer_threshold());
 
     const char *ptr = impl.getBufferPointer();
     const size_t size = impl.getBufferSize();
@@ -52,7 +60,7 @@ bool CircleExporter::invoke(Contract *contract) const
   if (graph == nullptr)
     return false;
 
-  CircleExporterImpl impl(graph);
+  CircleExporterImpl impl(graph, contract->ext_buffer_threshold());
 
   const char *ptr = impl.getBufferPointer();
   const size_t size = impl.getBufferSize();
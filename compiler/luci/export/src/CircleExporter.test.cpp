@@ -0,0 +1,310 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/CircleExporter.h"
+#include "CircleExporterUtils.h"
+
+#include <luci/Importer.h>
+#include <luci/IR/CircleNodes.h>
+#include <luci/IR/Module.h>
+#include <mio/circle/schema_generated.h>
+#include <oops/UserExn.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+namespace
+{
+
+class VectorExpContract final : public luci::CircleExporter::Contract
+{
+public:
+  VectorExpContract(luci::Module *module) : _module{module}
+  {
+    // NOTHING TO DO
+  }
+
+public:
+  loco::Graph *graph(void) const final { return nullptr; }
+  luci::Module *module(void) const final { return _module; }
+
+  uint64_t ext_buffer_threshold(void) const final
+  {
+    return _has_threshold ? _threshold : Contract::ext_buffer_threshold();
+  }
+
+  bool store(const char *ptr, const size_t size) const final
+  {
+    _data.assign(ptr, ptr + size);
+    return true;
+  }
+
+public:
+  void ext_buffer_threshold(uint64_t threshold)
+  {
+    _has_threshold = true;
+    _threshold = threshold;
+  }
+
+  const uint8_t *data(void) const { return reinterpret_cast<const uint8_t *>(_data.data()); }
+  size_t size(void) const { return _data.size(); }
+
+private:
+  luci::Module *_module;
+  bool _has_threshold = false;
+  uint64_t _threshold = 0;
+  mutable std::vector<char> _data;
+};
+
+luci::CircleConst *create_const(loco::Graph *g, const std::vector<float> &values)
+{
+  auto node = g->nodes()->create<luci::CircleConst>();
+  node->dtype(loco::DataType::FLOAT32);
+  node->rank(1);
+  node->dim(0) = values.size();
+  node->size<loco::DataType::FLOAT32>(values.size());
+  for (uint32_t i = 0; i < values.size(); ++i)
+    node->at<loco::DataType::FLOAT32>(i) = values[i];
+  return node;
+}
+
+/**
+ *  [Input] -- [Add(lhs)] -- [Add(rhs)] -- [Output]
+ */
+std::unique_ptr<luci::Module> make_add_module(const std::vector<float> &lhs,
+                                              const std::vector<float> &rhs)
+{
+  auto g = loco::make_graph();
+
+  auto input = g->nodes()->create<luci::CircleInput>();
+  auto graph_input = g->inputs()->create();
+  input->index(graph_input->index());
+  input->dtype(loco::DataType::FLOAT32);
+  input->rank(1);
+  input->dim(0) = lhs.size();
+
+  auto add_lhs = g->nodes()->create<luci::CircleAdd>();
+  add_lhs->x(input);
+  add_lhs->y(create_const(g.get(), lhs));
+  add_lhs->fusedActivationFunction(luci::FusedActFunc::NONE);
+
+  auto add_rhs = g->nodes()->create<luci::CircleAdd>();
+  add_rhs->x(add_lhs);
+  add_rhs->y(create_const(g.get(), rhs));
+  add_rhs->fusedActivationFunction(luci::FusedActFunc::NONE);
+
+  auto output = g->nodes()->create<luci::CircleOutput>();
+  auto graph_output = g->outputs()->create();
+  output->index(graph_output->index());
+  output->from(add_rhs);
+  graph_output->dtype(loco::DataType::FLOAT32);
+  graph_output->shape({static_cast<uint32_t>(lhs.size())});
+
+  auto module = luci::make_module();
+  module->add(std::move(g));
+  return module;
+}
+
+std::vector<std::vector<float>> const_values(luci::Module *module)
+{
+  std::vector<std::vector<float>> values;
+  auto nodes = module->graph()->nodes();
+  for (uint32_t n = 0; n < nodes->size(); ++n)
+  {
+    auto const_node = dynamic_cast<luci::CircleConst *>(nodes->at(n));
+    if (const_node == nullptr)
+      continue;
+
+    std::vector<float> const_value;
+    for (uint32_t i = 0; i < const_node->size<loco::DataType::FLOAT32>(); ++i)
+      const_value.push_back(const_node->at<loco::DataType::FLOAT32>(i));
+    values.push_back(const_value);
+  }
+  std::sort(values.begin(), values.end());
+  return values;
+}
+
+// Returns ids of buffers which have data, used by tensors of the first subgraph
+std::vector<uint32_t> const_buffer_ids(const circle::Model *model)
+{
+  std::vector<uint32_t> ids;
+  for (const auto *tensor : *model->subgraphs()->Get(0)->tensors())
+  {
+    const auto *buffer = model->buffers()->Get(tensor->buffer());
+    if (buffer->data() != nullptr || buffer->offset() > 1)
+      ids.push_back(tensor->buffer());
+  }
+  return ids;
+}
+
+// Returns offsets of buffer data from the beginning of the file
+std::vector<uint64_t> buffer_data_offsets(const VectorExpContract &contract)
+{
+  std::vector<uint64_t> offsets;
+  auto model = circle::GetModel(contract.data());
+  for (const auto *buffer : *model->buffers())
+  {
+    if (buffer->data() != nullptr)
+      offsets.push_back(buffer->data()->data() - contract.data());
+    else if (buffer->offset() > 1)
+      offsets.push_back(buffer->offset());
+  }
+  return offsets;
+}
+
+} // namespace
+
+TEST(CircleExporterTest, ext_buffer_round_trip)
+{
+  auto module = make_add_module({1.0f, 2.0f, 3.0f, 4.0f}, {5.0f, 6.0f, 7.0f, 8.0f});
+
+  // Store buffer data of this small model outside of flatbuffers
+  VectorExpContract contract(module.get());
+  contract.ext_buffer_threshold(0);
+  ASSERT_TRUE(luci::CircleExporter().invoke(&contract));
+
+  auto model = circle::GetModel(contract.data());
+  uint32_t num_ext_buffers = 0;
+  for (const auto *buffer : *model->buffers())
+  {
+    if (buffer->offset() <= 1)
+      continue;
+
+    ASSERT_EQ(buffer->data(), nullptr);
+    ASSERT_LE(buffer->offset() + buffer->size(), contract.size());
+    ++num_ext_buffers;
+  }
+  ASSERT_EQ(num_ext_buffers, 2u);
+
+  auto imported = luci::Importer().importModule(contract.data(), contract.size());
+  ASSERT_NE(imported, nullptr);
+
+  std::vector<std::vector<float>> expected = {{1.0f, 2.0f, 3.0f, 4.0f}, {5.0f, 6.0f, 7.0f, 8.0f}};
+  ASSERT_EQ(const_values(imported.get()), expected);
+}
+
+TEST(CircleExporterTest, no_ext_buffer_by_default)
+{
+  auto module = make_add_module({1.0f, 2.0f}, {3.0f, 4.0f});
+
+  VectorExpContract contract(module.get());
+  ASSERT_TRUE(luci::CircleExporter().invoke(&contract));
+
+  auto model = circle::GetModel(contract.data());
+  for (const auto *buffer : *model->buffers())
+    ASSERT_EQ(buffer->offset(), 0u);
+}
+
+TEST(CircleExporterTest, ext_buffer_out_of_file_NEG)
+{
+  auto module = make_add_module({1.0f, 2.0f, 3.0f, 4.0f}, {5.0f, 6.0f, 7.0f, 8.0f});
+
+  VectorExpContract contract(module.get());
+  contract.ext_buffer_threshold(0);
+  ASSERT_TRUE(luci::CircleExporter().invoke(&contract));
+
+  // Buffer data at the end of the file is cut off
+  auto imported = luci::Importer().importModule(contract.data(), contract.size() - 1);
+  ASSERT_EQ(imported, nullptr);
+}
+
+TEST(CircleExporterTest, ext_buffer_without_model_data_NEG)
+{
+  auto module = make_add_module({1.0f, 2.0f, 3.0f, 4.0f}, {5.0f, 6.0f, 7.0f, 8.0f});
+
+  VectorExpContract contract(module.get());
+  contract.ext_buffer_threshold(0);
+  ASSERT_TRUE(luci::CircleExporter().invoke(&contract));
+
+  // Model pointer alone cannot reach buffer data outside of flatbuffers
+  auto model = circle::GetModel(contract.data());
+  EXPECT_THROW(luci::Importer().importModule(model), oops::UserExn);
+}
+
+TEST(CircleExporterTest, share_identical_const_buffer)
+{
+  auto module = make_add_module({1.0f, 2.0f, 3.0f, 4.0f}, {1.0f, 2.0f, 3.0f, 4.0f});
+
+  VectorExpContract contract(module.get());
+  ASSERT_TRUE(luci::CircleExporter().invoke(&contract));
+
+  auto ids = const_buffer_ids(circle::GetModel(contract.data()));
+  ASSERT_EQ(ids.size(), 2u);
+  ASSERT_EQ(ids[0], ids[1]);
+  ASSERT_EQ(buffer_data_offsets(contract).size(), 1u);
+
+  auto imported = luci::Importer().importModule(contract.data(), contract.size());
+  ASSERT_NE(imported, nullptr);
+  std::vector<std::vector<float>> expected = {{1.0f, 2.0f, 3.0f, 4.0f}, {1.0f, 2.0f, 3.0f, 4.0f}};
+  ASSERT_EQ(const_values(imported.get()), expected);
+}
+
+TEST(CircleExporterTest, different_const_buffer_NEG)
+{
+  auto module = make_add_module({1.0f, 2.0f, 3.0f, 4.0f}, {1.0f, 2.0f, 3.0f, 5.0f});
+
+  VectorExpContract contract(module.get());
+  ASSERT_TRUE(luci::CircleExporter().invoke(&contract));
+
+  auto ids = const_buffer_ids(circle::GetModel(contract.data()));
+  ASSERT_EQ(ids.size(), 2u);
+  ASSERT_NE(ids[0], ids[1]);
+}
+
+TEST(CircleExporterTest, buffer_data_align)
+{
+  ASSERT_EQ(luci::buffer_data_align(0), 16u);
+  ASSERT_EQ(luci::buffer_data_align(65535), 16u);
+  ASSERT_EQ(luci::buffer_data_align(65536), 4096u);
+}
+
+TEST(CircleExporterTest, aligned_buffer_data)
+{
+  // 64KB of data is page aligned, while 4 bytes of data is aligned to 16
+  auto module = make_add_module(std::vector<float>(16384, 1.0f), {2.0f});
+
+  for (uint64_t threshold : {uint64_t{0}, std::numeric_limits<uint64_t>::max()})
+  {
+    VectorExpContract contract(module.get());
+    contract.ext_buffer_threshold(threshold);
+    ASSERT_TRUE(luci::CircleExporter().invoke(&contract));
+
+    auto model = circle::GetModel(contract.data());
+    for (const auto *buffer : *model->buffers())
+    {
+      uint64_t offset = 0;
+      uint64_t size = 0;
+      if (buffer->data() != nullptr)
+      {
+        offset = buffer->data()->data() - contract.data();
+        size = buffer->data()->size();
+      }
+      else if (buffer->offset() > 1)
+      {
+        offset = buffer->offset();
+        size = buffer->size();
+      }
+      else
+        continue;
+
+      ASSERT_EQ(offset % luci::buffer_data_align(size), 0u);
+    }
+    ASSERT_EQ(buffer_data_offsets(contract).size(), 2u);
+  }
+}
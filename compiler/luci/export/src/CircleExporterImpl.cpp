@@ -21,11 +21,14 @@
 #include "CircleOperationExporter.h"
 #include "CircleExporterUtils.h"
 
+#include <loco/IR/DataTypeTraits.h>
 #include <oops/InternalExn.h>
 #include <mio/circle/schema_generated.h>
 #include <flatbuffers/flatbuffers.h>
 
 #include <cassert>
+#include <cstring>
+#include <map>
 #include <unordered_map>
 #include <string>
 #include <stdexcept>
@@ -92,6 +95,23 @@ void registerGraphOutputTensors(loco::Graph *graph, luci::SubGraphContext &ctx)
   }
 }
 
+uint64_t const_data_size(loco::Graph *graph)
+{
+  uint64_t total = 0;
+  for (uint32_t n = 0; n < graph->nodes()->size(); ++n)
+  {
+    auto const_node = dynamic_cast<luci::CircleConst *>(graph->nodes()->at(n));
+    if (const_node == nullptr)
+      continue;
+
+    uint64_t num_elements = 1;
+    for (uint32_t r = 0; r < const_node->rank(); ++r)
+      num_elements *= const_node->dim(r).value();
+    total += num_elements * loco::size(const_node->dtype());
+  }
+  return total;
+}
+
 } // namespace
 
 namespace
@@ -129,8 +149,17 @@ namespace luci
 using namespace circle;
 using namespace flatbuffers;
 
-CircleExporterImpl::CircleExporterImpl(loco::Graph *graph) { exportGraph(graph); }
-CircleExporterImpl::CircleExporterImpl(Module *module) { exportModule(module); }
+CircleExporterImpl::CircleExporterImpl(loco::Graph *graph, uint64_t ext_buffer_threshold)
+    : _ext_buffer_threshold{ext_buffer_threshold}
+{
+  exportGraph(graph);
+}
+
+CircleExporterImpl::CircleExporterImpl(Module *module, uint64_t ext_buffer_threshold)
+    : _ext_buffer_threshold{ext_buffer_threshold}
+{
+  exportModule(module);
+}
 
 ::flatbuffers::Offset<::circle::SubGraph>
 CircleExporterImpl::exportSubgraph(SerializedGraphData &gd)
@@ -158,6 +187,8 @@ void CircleExporterImpl::exportGraph(loco::Graph *graph)
   SerializedModelData md;
   SerializedGraphData gd;
 
+  md._ext_buffer = const_data_size(graph) >= _ext_buffer_threshold;
+
   // This version is taken from comment in fbs
   constexpr uint32_t version = 0;
 
@@ -201,6 +232,9 @@ void CircleExporterImpl::exportGraph(loco::Graph *graph)
   auto model_offset = CreateModel(_builder, version, operator_codes, subgraphs, description,
                                   buffers, metadata_buffer);
   FinishModelBuffer(_builder, model_offset);
+
+  if (md._ext_buffer)
+    finalizeExtBuffers(md);
 }
 
 void CircleExporterImpl::exportModule(Module *module)
@@ -210,6 +244,11 @@ void CircleExporterImpl::exportModule(Module *module)
 
   SerializedModelData md;
 
+  uint64_t const_size = 0;
+  for (size_t g = 0; g < module->size(); ++g)
+    const_size += const_data_size(module->graph(g));
+  md._ext_buffer = const_size >= _ext_buffer_threshold;
+
   _builder.Clear();
 
   // prepare model data
@@ -271,13 +310,60 @@ void CircleExporterImpl::exportModule(Module *module)
   auto model_offset = CreateModel(_builder, version, operator_codes, subgraphs, description,
                                   buffers, metadata_buffer);
   FinishModelBuffer(_builder, model_offset);
+
+  if (md._ext_buffer)
+    finalizeExtBuffers(md);
+}
+
+void CircleExporterImpl::finalizeExtBuffers(SerializedModelData &md)
+{
+  // Buffer data follows flatbuffers
+  auto align_up = [](uint64_t value, uint64_t align) {
+    return (value + align - 1) / align * align;
+  };
+
+  std::map<uint32_t, uint64_t> offsets;
+  uint64_t file_size = _builder.GetSize();
+  for (const auto &it : md._ext_buffer_data)
+  {
+    auto offset = align_up(file_size, buffer_data_align(it.second.size()));
+    offsets[it.first] = offset;
+    file_size = offset + it.second.size();
+  }
+
+  _ext_model.assign(file_size, 0);
+  std::memcpy(_ext_model.data(), _builder.GetBufferPointer(), _builder.GetSize());
+
+  auto model = circle::GetMutableModel(_ext_model.data());
+  auto buffers = model->mutable_buffers();
+
+  for (const auto &it : md._ext_buffer_data)
+  {
+    auto buffer = buffers->GetMutableObject(it.first);
+    auto offset = offsets.at(it.first);
+    assert(buffer->offset() == 1 && buffer->size() == it.second.size());
+    if (!buffer->mutate_offset(offset))
+      INTERNAL_EXN_V("Failed to update offset of buffer", it.first);
+
+    std::memcpy(_ext_model.data() + offset, it.second.data(), it.second.size());
+  }
+
+  // flatbuffers are not needed anymore
+  _builder.Clear();
 }
 
 const char *CircleExporterImpl::getBufferPointer() const
 {
+  if (!_ext_model.empty())
+    return reinterpret_cast<const char *>(_ext_model.data());
   return reinterpret_cast<const char *>(_builder.GetBufferPointer());
 }
 
-size_t CircleExporterImpl::getBufferSize() const { return _builder.GetSize(); }
+size_t CircleExporterImpl::getBufferSize() const
+{
+  if (!_ext_model.empty())
+    return _ext_model.size();
+  return _builder.GetSize();
+}
 
 } // namespace luci
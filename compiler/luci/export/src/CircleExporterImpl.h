@@ -22,12 +22,12 @@
 
 #include "SerializedData.h"
 
-#include "SerializedData.h"
-
 #include <mio/circle/schema_generated.h>
 
 #include <loco.h>
 
+#include <vector>
+
 namespace luci
 {
 
@@ -40,8 +40,12 @@ public:
   CircleExporterImpl() = delete;
   ~CircleExporterImpl() = default;
 
-  explicit CircleExporterImpl(loco::Graph *graph);
-  explicit CircleExporterImpl(Module *module);
+  /**
+   * @param ext_buffer_threshold size of constant data from which buffer data is stored outside
+   *                             of flatbuffers
+   */
+  CircleExporterImpl(loco::Graph *graph, uint64_t ext_buffer_threshold);
+  CircleExporterImpl(Module *module, uint64_t ext_buffer_threshold);
 
   /**
    * @return pointer to buffer with serialized graph
@@ -73,8 +77,17 @@ private:
    */
   void exportModule(Module *module);
 
+  /**
+   * @brief append buffer data stored outside of flatbuffers and update their offsets
+   * @param md information about serialized parts of model
+   */
+  void finalizeExtBuffers(SerializedModelData &md);
+
 private:
   flatbuffers::FlatBufferBuilder _builder;
+  uint64_t _ext_buffer_threshold;
+  // model file contents when buffer data is stored outside of flatbuffers
+  std::vector<uint8_t> _ext_model;
 };
 
 } // namespace luci
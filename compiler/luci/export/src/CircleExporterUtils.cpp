@@ -155,6 +155,16 @@ circle::Padding getOpPadding(const luci::Padding pad)
   INTERNAL_EXN_V("Unsupported luci::Padding", oops::to_uint32(pad));
 }
 
+size_t buffer_data_align(size_t size)
+{
+  // NOTE 16 follows 'force_align' of Buffer.data in schema
+  constexpr size_t default_align = 16;
+  constexpr size_t page_size = 4096;
+  constexpr size_t page_align_threshold = 16 * page_size;
+
+  return size >= page_align_threshold ? page_size : default_align;
+}
+
 namespace
 {
 
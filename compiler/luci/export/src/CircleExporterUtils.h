@@ -42,6 +42,12 @@ circle::Padding getOpPadding(const loco::Padding2D *pad, const loco::Stride<2> *
                              const ShapeDescription &ifm, const ShapeDescription &ofm);
 circle::Padding getOpPadding(const luci::Padding pad);
 
+/**
+ * @brief Returns alignment of buffer data of given size in the model file
+ * @note  Large buffers are placed at page aligned offsets to be mmap-ed with fewer pages
+ */
+size_t buffer_data_align(size_t size);
+
 using CircleTensorIndex = int32_t;
 
 void set_tensor_index(loco::Node *node, const CircleTensorIndex &tensor_id);
@@ -66,6 +66,7 @@ public:
   void visit(luci::CircleCustom *) final;
   void visit(luci::CircleDepthToSpace *) final;
   void visit(luci::CircleDepthwiseConv2D *) final;
+  void visit(luci::CircleDequantize *) final;
   void visit(luci::CircleDiv *) final;
   void visit(luci::CircleElu *) final;
   void visit(luci::CircleEqual *) final;
@@ -108,6 +109,7 @@ public:
   void visit(luci::CirclePad *) final;
   void visit(luci::CirclePow *) final;
   void visit(luci::CirclePRelu *) final;
+  void visit(luci::CircleQuantize *) final;
   void visit(luci::CircleRange *) final;
   void visit(luci::CircleRank *) final;
   void visit(luci::CircleReduceAny *) final;
@@ -440,6 +442,12 @@ void OperationExporter::visit(luci::CircleDepthwiseConv2D *node)
                     .Union());
 }
 
+void OperationExporter::visit(luci::CircleDequantize *node)
+{
+  export_simple(node, circle::BuiltinOperator_DEQUANTIZE, circle::BuiltinOptions_DequantizeOptions,
+                CreateDequantizeOptions(builder).Union());
+}
+
 void OperationExporter::visit(luci::CircleDiv *node)
 {
   export_simple(
@@ -728,6 +736,12 @@ void OperationExporter::visit(luci::CirclePRelu *node)
   export_simple(node, circle::BuiltinOperator_PRELU);
 }
 
+void OperationExporter::visit(luci::CircleQuantize *node)
+{
+  export_simple(node, circle::BuiltinOperator_QUANTIZE, circle::BuiltinOptions_QuantizeOptions,
+                CreateQuantizeOptions(builder).Union());
+}
+
 void OperationExporter::visit(luci::CircleRange *node)
 {
   export_simple(node, circle::BuiltinOperator_RANGE, circle::BuiltinOptions_RangeOptions,
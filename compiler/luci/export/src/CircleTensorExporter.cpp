@@ -29,6 +29,9 @@
 #include <loco/IR/DataTypeTraits.h>
 #include <oops/InternalExn.h>
 
+#include <algorithm>
+#include <limits>
+
 using namespace circle;
 using namespace flatbuffers;
 
@@ -63,6 +66,9 @@ public:
   luci::CircleQuantParam *quantparam(void) const { return _quantparam; }
   void quantparam(luci::CircleQuantParam *qp) { _quantparam = qp; }
 
+  luci::SparsityParam *sparsityparam(void) const { return _sparsityparam; }
+  void sparsityparam(luci::SparsityParam *sp) { _sparsityparam = sp; }
+
 private:
   std::string _name;
 
@@ -72,6 +78,7 @@ private:
 
   luci::CircleConst *_content = nullptr;
   luci::CircleQuantParam *_quantparam = nullptr;
+  luci::SparsityParam *_sparsityparam = nullptr;
 };
 
 using CircleTensorContext = std::vector<CircleTensoInfo>;
@@ -109,6 +116,7 @@ void allocateCircleTensorInfo(CircleNode *node, CircleTensorContext &ctx)
 
   tensor_info.content(dynamic_cast<luci::CircleConst *>(node));
   tensor_info.quantparam(node->quantparam());
+  tensor_info.sparsityparam(node->sparsityparam());
 
   set_tensor_index(node, tensor_index);
 
@@ -234,47 +242,44 @@ flatbuffers::Offset<circle::Buffer> encodeOpBuffer(FlatBufferBuilder &builder)
   return CreateBuffer(builder);
 }
 
-template <typename NodeT>
-flatbuffers::Offset<circle::Buffer> encodeOpBuffer(FlatBufferBuilder &builder, NodeT *)
-{
-  return CreateBuffer(builder);
-}
-
 template <loco::DataType DT>
-flatbuffers::Offset<circle::Buffer> encodeOpBufferByDType(FlatBufferBuilder &builder,
-                                                          luci::CircleConst *c)
+void copyRawDataByDType(luci::CircleConst *c, std::vector<uint8_t> &raw_data)
 {
   using NativeType = typename loco::DataTypeImpl<DT>::Type;
 
-  std::vector<NativeType> raw_data;
   const uint32_t size = c->size<DT>();
-  raw_data.reserve(size);
+  raw_data.resize(size * sizeof(NativeType));
+  auto ptr = reinterpret_cast<NativeType *>(raw_data.data());
   for (uint32_t i = 0; i < size; ++i)
   {
-    raw_data.push_back(c->at<DT>(i));
+    ptr[i] = c->at<DT>(i);
   }
-  const size_t raw_size = size * sizeof(NativeType);
-  auto array_offset = builder.CreateVector(reinterpret_cast<uint8_t *>(raw_data.data()), raw_size);
-  return CreateBuffer(builder, array_offset);
 }
 
-template <>
-flatbuffers::Offset<circle::Buffer> encodeOpBuffer(FlatBufferBuilder &builder, luci::CircleConst *c)
+std::vector<uint8_t> encodeRawData(luci::CircleConst *c)
 {
+  std::vector<uint8_t> raw_data;
+
   switch (c->dtype())
   {
     case loco::DataType::FLOAT32:
-      return encodeOpBufferByDType<loco::DataType::FLOAT32>(builder, c);
+      copyRawDataByDType<loco::DataType::FLOAT32>(c, raw_data);
+      return raw_data;
     case loco::DataType::S16:
-      return encodeOpBufferByDType<loco::DataType::S16>(builder, c);
+      copyRawDataByDType<loco::DataType::S16>(c, raw_data);
+      return raw_data;
     case loco::DataType::S32:
-      return encodeOpBufferByDType<loco::DataType::S32>(builder, c);
+      copyRawDataByDType<loco::DataType::S32>(c, raw_data);
+      return raw_data;
     case loco::DataType::S64:
-      return encodeOpBufferByDType<loco::DataType::S64>(builder, c);
+      copyRawDataByDType<loco::DataType::S64>(c, raw_data);
+      return raw_data;
     case loco::DataType::U8:
-      return encodeOpBufferByDType<loco::DataType::U8>(builder, c);
+      copyRawDataByDType<loco::DataType::U8>(c, raw_data);
+      return raw_data;
     case loco::DataType::BOOL:
-      return encodeOpBufferByDType<loco::DataType::BOOL>(builder, c);
+      copyRawDataByDType<loco::DataType::BOOL>(c, raw_data);
+      return raw_data;
     default:
       break;
   }
@@ -282,6 +287,62 @@ flatbuffers::Offset<circle::Buffer> encodeOpBuffer(FlatBufferBuilder &builder, l
   INTERNAL_EXN_V("Unsupported datatype", oops::to_uint32(c->dtype()));
 }
 
+// FNV-1a hash of raw data
+uint64_t hashRawData(const std::vector<uint8_t> &raw_data)
+{
+  uint64_t hash = 14695981039346656037ULL;
+  for (auto byte : raw_data)
+  {
+    hash ^= byte;
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
+
+flatbuffers::Offset<circle::Buffer> encodeOpBuffer(FlatBufferBuilder &builder,
+                                                   SerializedModelData &md,
+                                                   const std::vector<uint8_t> &raw_data)
+{
+  if (md._ext_buffer)
+  {
+    // NOTE This buffer will be registered with the current size of md._buffers as its id
+    // NOTE offset is set to 1 as a placeholder, which is updated when the model is finalized
+    auto buffer_id = static_cast<uint32_t>(md._buffers.size());
+    md._ext_buffer_data[buffer_id] = raw_data;
+    return CreateBuffer(builder, 0, 1, raw_data.size());
+  }
+
+  // NOTE FlatBufferBuilder aligns data from the end of buffer, which becomes alignment from the
+  //      beginning of the file as the whole buffer is padded to the largest alignment at finish
+  builder.PreAlign(raw_data.size(), buffer_data_align(raw_data.size()));
+  auto array_offset = builder.CreateVector(raw_data.data(), raw_data.size());
+  return CreateBuffer(builder, array_offset);
+}
+
+/**
+ * @brief Returns id of the buffer for constant data, which is shared among identical data
+ */
+uint32_t registerConstBuffer(FlatBufferBuilder &builder, SerializedModelData &md,
+                             luci::CircleConst *c)
+{
+  auto raw_data = encodeRawData(c);
+  auto hash = hashRawData(raw_data);
+
+  auto &candidates = md._const_buffers[hash];
+  for (const auto &candidate : candidates)
+  {
+    if (encodeRawData(candidate.second) == raw_data)
+      return candidate.first;
+  }
+
+  auto buffer = encodeOpBuffer(builder, md, raw_data);
+  auto buffer_id = static_cast<uint32_t>(md._buffers.size());
+  md._buffers.push_back(buffer);
+  candidates.emplace_back(buffer_id, c);
+
+  return buffer_id;
+}
+
 flatbuffers::Offset<circle::QuantizationParameters>
 encodeQuantizationParameters(FlatBufferBuilder &builder, luci::CircleQuantParam *quantparam)
 {
@@ -308,6 +369,63 @@ encodeQuantizationParameters(FlatBufferBuilder &builder, luci::CircleQuantParam
                                               0, quantparam->quantized_dimension);
 }
 
+flatbuffers::Offset<void> encodeSparseIndexVector(FlatBufferBuilder &builder,
+                                                  const std::vector<int32_t> &values,
+                                                  circle::SparseIndexVector &type)
+{
+  type = circle::SparseIndexVector_NONE;
+  if (values.empty())
+    return 0;
+
+  // Use the narrowest type that holds all the values
+  int32_t max = 0;
+  for (auto v : values)
+    max = std::max(max, v);
+
+  if (max <= std::numeric_limits<uint8_t>::max())
+  {
+    type = circle::SparseIndexVector_Uint8Vector;
+    std::vector<uint8_t> narrowed(values.begin(), values.end());
+    return circle::CreateUint8Vector(builder, builder.CreateVector(narrowed)).Union();
+  }
+  if (max <= std::numeric_limits<uint16_t>::max())
+  {
+    type = circle::SparseIndexVector_Uint16Vector;
+    std::vector<uint16_t> narrowed(values.begin(), values.end());
+    return circle::CreateUint16Vector(builder, builder.CreateVector(narrowed)).Union();
+  }
+  type = circle::SparseIndexVector_Int32Vector;
+  return circle::CreateInt32Vector(builder, builder.CreateVector(values)).Union();
+}
+
+flatbuffers::Offset<circle::SparsityParameters>
+encodeSparsityParameters(FlatBufferBuilder &builder, luci::SparsityParam *sparsityparam)
+{
+  if (sparsityparam == nullptr)
+    return 0;
+
+  std::vector<flatbuffers::Offset<circle::DimensionMetadata>> dim_metadata;
+  for (const auto &dm : sparsityparam->dim_metadata)
+  {
+    auto format = dm.format == luci::DimensionType::SPARSE_CSR ? circle::DimensionType_SPARSE_CSR
+                                                               : circle::DimensionType_DENSE;
+    circle::SparseIndexVector segments_type;
+    auto segments = encodeSparseIndexVector(builder, dm.array_segments, segments_type);
+    circle::SparseIndexVector indices_type;
+    auto indices = encodeSparseIndexVector(builder, dm.array_indices, indices_type);
+    dim_metadata.push_back(circle::CreateDimensionMetadata(
+        builder, format, dm.dense_size, segments_type, segments, indices_type, indices));
+  }
+
+  flatbuffers::Offset<flatbuffers::Vector<int32_t>> block_map;
+  if (sparsityparam->block_map.size())
+    block_map = builder.CreateVector(sparsityparam->block_map);
+
+  return circle::CreateSparsityParameters(builder,
+                                          builder.CreateVector(sparsityparam->traversal_order),
+                                          block_map, builder.CreateVector(dim_metadata));
+}
+
 void exportOpDefinedTensor(const CircleTensoInfo &info, FlatBufferBuilder &builder,
                            SerializedModelData &md, SerializedGraphData &gd)
 {
@@ -317,17 +435,24 @@ void exportOpDefinedTensor(const CircleTensoInfo &info, FlatBufferBuilder &build
     shape_offset = encodeShape(builder, info.shape());
 
   // encode and register output tensor buffer
-  auto buffer =
-      info.content() == nullptr ? encodeOpBuffer(builder) : encodeOpBuffer(builder, info.content());
+  uint32_t buffer_id = 0;
+  if (info.content() == nullptr)
+  {
+    buffer_id = static_cast<uint32_t>(md._buffers.size());
+    md._buffers.push_back(encodeOpBuffer(builder));
+  }
+  else
+  {
+    buffer_id = registerConstBuffer(builder, md, info.content());
+  }
 
   auto quantparam = encodeQuantizationParameters(builder, info.quantparam());
 
-  auto buffer_id = static_cast<uint32_t>(md._buffers.size());
-  md._buffers.push_back(buffer);
+  auto sparsityparam = encodeSparsityParameters(builder, info.sparsityparam());
 
   auto name_offset = builder.CreateString(info.name());
   auto tensor_offset = CreateTensor(builder, shape_offset, info.dtype(), buffer_id, name_offset,
-                                    quantparam, /*is_variable*/ false);
+                                    quantparam, /*is_variable*/ false, sparsityparam);
   gd._tensors.push_back(tensor_offset);
 }
 
@@ -37,6 +37,8 @@ const char *to_str(logo::PhaseStrategy s)
       return "Saturate";
     case logo::PhaseStrategy::Restart:
       return "Restart";
+    case logo::PhaseStrategy::Worklist:
+      return "Worklist";
   }
   assert(false);
   return "";
@@ -77,7 +79,8 @@ void ProgressReporter::notify(const logo::PhaseEventInfo<logo::PhaseEvent::PassE
   LOGGER(l);
 
   VERBOSE(l, 4) << "After " << logo::pass_name(info->pass())
-                << " (changed: " << to_char(info->changed()) << ")";
+                << " (changed: " << to_char(info->changed()) << ", changes: " << info->changes()
+                << ", elapsed: " << info->elapsed().count() << "us)";
   VERBOSE(l, 4) << fmt(graph());
 }
 
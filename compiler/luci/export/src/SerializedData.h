@@ -19,6 +19,8 @@
 
 #include <mio/circle/schema_generated.h>
 
+#include <map>
+#include <utility>
 #include <vector>
 
 #include <unordered_map>
@@ -60,6 +62,8 @@ template <> struct hash<luci::OpCode>
 namespace luci
 {
 
+class CircleConst;
+
 /**
  * @breif Record the information of T/F Lite SubGraph and its mapping to loco
  */
@@ -84,6 +88,13 @@ struct SerializedModelData final
   std::unordered_map<OpCode, uint32_t> _operator_codes;
   std::vector<flatbuffers::Offset<circle::Buffer>> _buffers;
 
+  /// @brief Store buffer data outside of flatbuffers (for models larger than 2GB)
+  bool _ext_buffer = false;
+  /// @brief Buffer data stored outside of flatbuffers, indexed by buffer id
+  std::map<uint32_t, std::vector<uint8_t>> _ext_buffer_data;
+  /// @brief Buffer ids with their CircleConst keyed by hash of the data to share identical buffers
+  std::unordered_map<uint64_t, std::vector<std::pair<uint32_t, CircleConst *>>> _const_buffers;
+
   /**
    * @brief if opcode is not registered in table of opcodes add it
    * @param builtin_code
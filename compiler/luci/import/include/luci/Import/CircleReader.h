@@ -23,6 +23,7 @@
 #include <luci/IR/AttrPadding.h>
 #include <luci/IR/CircleNode.h>
 #include <luci/IR/CircleQuantParam.h>
+#include <luci/IR/SparsityParam.h>
 
 #include <loco.h>
 
@@ -46,6 +47,7 @@ Padding luci_padding(const circle::Padding padding);
 MirrorPadMode luci_mirrorpad_mode(const circle::MirrorPadMode mode);
 std::unique_ptr<CircleQuantParam>
 luci_quantparam(const circle::QuantizationParametersT *quantization);
+std::unique_ptr<SparsityParam> luci_sparsityparam(const circle::SparsityParametersT *sparsity);
 
 /// @brief Copy common tensor attributes such as name, type, etc. to node.
 void copy_tensor_attributes(const circle::TensorT &tensor, CircleNode *node);
@@ -84,7 +86,11 @@ public:
   std::string opcode_name(const circle::OperatorT &op) const;
 
 public:
+  // NOTE throws if the model has buffer data outside of flatbuffers
   bool parse(const circle::Model *model);
+  // NOTE data is contents of the model file, which is required to read buffer data
+  //      stored outside of flatbuffers
+  bool parse(const circle::Model *model, const uint8_t *data, size_t size);
   bool select_subgraph(uint32_t subgraph);
 
 private:
@@ -30,6 +30,8 @@
 namespace luci
 {
 
+class CircleReader;
+
 class Importer final
 {
 public:
@@ -43,7 +45,13 @@ public:
 
 public:
   std::unique_ptr<loco::Graph> import(const circle::Model *model) const;
+  // NOTE throws if the model has buffer data outside of flatbuffers
   std::unique_ptr<Module> importModule(const circle::Model *model) const;
+  // Import from contents of a model file, which may have buffer data outside of flatbuffers
+  std::unique_ptr<Module> importModule(const uint8_t *data, size_t size) const;
+
+private:
+  std::unique_ptr<Module> importModule(CircleReader &reader) const;
 
 private:
   const GraphBuilderSource *_source = nullptr;
@@ -16,8 +16,11 @@
 
 #include "luci/Import/CircleReader.h"
 
+#include <oops/UserExn.h>
+
 #include <memory>
 #include <sstream>
+#include <stdexcept>
 #include <string>
 
 namespace luci
@@ -174,6 +177,58 @@ luci_quantparam(const circle::QuantizationParametersT *quantization)
   return nullptr;
 }
 
+namespace
+{
+
+std::vector<int32_t> luci_sparse_index_vector(const circle::SparseIndexVectorUnion &vector)
+{
+  switch (vector.type)
+  {
+    case circle::SparseIndexVector_NONE:
+      return std::vector<int32_t>{};
+    case circle::SparseIndexVector_Int32Vector:
+      return vector.AsInt32Vector()->values;
+    case circle::SparseIndexVector_Uint16Vector:
+    {
+      const auto &values = vector.AsUint16Vector()->values;
+      return std::vector<int32_t>(values.begin(), values.end());
+    }
+    case circle::SparseIndexVector_Uint8Vector:
+    {
+      const auto &values = vector.AsUint8Vector()->values;
+      return std::vector<int32_t>(values.begin(), values.end());
+    }
+    default:
+      break;
+  }
+  throw std::runtime_error("Invalid SparseIndexVector type");
+}
+
+} // namespace
+
+std::unique_ptr<SparsityParam> luci_sparsityparam(const circle::SparsityParametersT *sparsity)
+{
+  assert(sparsity != nullptr);
+
+  auto sparsityparam = std::make_unique<SparsityParam>();
+
+  sparsityparam->traversal_order = sparsity->traversal_order;
+  sparsityparam->block_map = sparsity->block_map;
+  for (const auto &dm : sparsity->dim_metadata)
+  {
+    DimMetaData dim_metadata;
+    dim_metadata.format = dm->format == circle::DimensionType_SPARSE_CSR
+                              ? DimensionType::SPARSE_CSR
+                              : DimensionType::DENSE;
+    dim_metadata.dense_size = dm->dense_size;
+    dim_metadata.array_segments = luci_sparse_index_vector(dm->array_segments);
+    dim_metadata.array_indices = luci_sparse_index_vector(dm->array_indices);
+    sparsityparam->dim_metadata.emplace_back(dim_metadata);
+  }
+
+  return sparsityparam;
+}
+
 void copy_tensor_attributes(const circle::TensorT &tensor, CircleNode *node)
 {
   node->name(tensor_name(tensor));
@@ -193,6 +248,10 @@ void copy_tensor_attributes(const circle::TensorT &tensor, CircleNode *node)
     if (quantparam)
       node->quantparam(std::move(quantparam));
   }
+
+  const auto *sparsity = tensor.sparsity.get();
+  if (sparsity != nullptr)
+    node->sparsityparam(luci_sparsityparam(sparsity));
 }
 
 circle::BuiltinOperator CircleReader::builtin_code(const circle::OperatorT &op) const
@@ -222,11 +281,32 @@ std::string CircleReader::opcode_name(const circle::OperatorT &op) const
   return ::luci::opcode_name(opcode);
 }
 
-bool CircleReader::parse(const circle::Model *model)
+bool CircleReader::parse(const circle::Model *model) { return parse(model, nullptr, 0); }
+
+bool CircleReader::parse(const circle::Model *model, const uint8_t *data, size_t size)
 {
   assert(model != nullptr);
 
-  _model.reset(model->UnPack());
+  std::unique_ptr<circle::ModelT> model_t(model->UnPack());
+
+  // Load buffer data stored outside of flatbuffers
+  for (auto &buffer : model_t->buffers)
+  {
+    // NOTE offset is valid only if > 1
+    if (buffer->offset <= 1)
+      continue;
+
+    // NOTE Model pointer alone cannot reach data outside of flatbuffers
+    if (data == nullptr)
+      throw oops::UserExn("Buffer is stored outside of flatbuffers, model data and size required");
+
+    if (buffer->offset > size || buffer->size > size - buffer->offset)
+      return false;
+
+    buffer->data.assign(data + buffer->offset, data + buffer->offset + buffer->size);
+  }
+
+  _model = std::move(model_t);
 
   // for direct pointer access
   _model_ptr = model;
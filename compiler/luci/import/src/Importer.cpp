@@ -248,6 +248,26 @@ std::unique_ptr<loco::Graph> Importer::import(const circle::Model *model) const
 }
 
 std::unique_ptr<Module> Importer::importModule(const circle::Model *model) const
+{
+  CircleReader reader;
+  if (!reader.parse(model))
+    return nullptr;
+
+  return importModule(reader);
+}
+
+std::unique_ptr<Module> Importer::importModule(const uint8_t *data, size_t size) const
+{
+  assert(data != nullptr);
+
+  CircleReader reader;
+  if (!reader.parse(circle::GetModel(data), data, size))
+    return nullptr;
+
+  return importModule(reader);
+}
+
+std::unique_ptr<Module> Importer::importModule(CircleReader &reader) const
 {
   auto module = make_module();
 
@@ -259,10 +279,6 @@ std::unique_ptr<Module> Importer::importModule(const circle::Model *model) const
     source_ptr = _source;
   }
 
-  CircleReader reader;
-  if (!reader.parse(model))
-    return nullptr;
-
   for (uint32_t g = 0; g < reader.num_subgraph(); ++g)
   {
     auto graph = loco::make_graph();
@@ -22,8 +22,6 @@
 #include <loco.h>
 #include <oops/UserExn.h>
 
-#include <cassert>
-
 namespace
 {
 
@@ -51,7 +49,15 @@ static void copy_data(const std::vector<uint8_t> &raw_data, uint32_t num_element
 {
   using T = typename loco::DataTypeImpl<DT>::Type;
 
-  assert(raw_data.size() == num_elements * sizeof(T));
+  // Passes and kernels read values of a constant by its shape, and should not read out of it
+  if (raw_data.size() != num_elements * sizeof(T))
+  {
+    auto buffer_size = raw_data.size();
+    auto expected_size = num_elements * sizeof(T);
+    throw oops::UserExn("Size of constant does not match its shape", "Buffer size", buffer_size,
+                        "Expected size", expected_size);
+  }
+
   const auto *data = reinterpret_cast<const T *>(raw_data.data());
 
   const_node->size<DT>(num_elements);
@@ -101,6 +107,13 @@ CircleConst *create_circleconst(GraphBuilderContext *context, int32_t tensor_ind
     return nullptr;
   }
 
+  if (const_tensor.sparsity != nullptr)
+  {
+    // sparse tensor has the values of non-zero elements only, kept as they are with its
+    // sparsityparam. Passes which read values by the shape skip such constants.
+    num_elements = buffer.size() / loco::size(luci_datatype(const_tensor.type));
+  }
+
   auto const_node = graph->nodes()->create<CircleConst>();
   copy_tensor_attributes(const_tensor, const_node);
   const_node->shape_status(luci::ShapeStatus::VALID);
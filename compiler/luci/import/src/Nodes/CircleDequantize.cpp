@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/Import/Nodes/CircleDequantize.h"
+
+#include <luci/IR/Nodes/CircleDequantize.h>
+
+#include <loco.h>
+
+namespace luci
+{
+
+bool CircleDequantizeGraphBuilder::validate(const ValidateArgs &args) const
+{
+  const auto &inputs = args.op.inputs;
+  const auto &outputs = args.op.outputs;
+  if (inputs.size() != 1 || outputs.size() != 1)
+    return false;
+
+  // Input is a quantized or float16 tensor and output is a float32 tensor
+  const auto &tensors = args.reader.tensors();
+  switch (tensors.at(inputs[0])->type)
+  {
+    case circle::TensorType_UINT8:
+    case circle::TensorType_INT8:
+    case circle::TensorType_INT16:
+    case circle::TensorType_FLOAT16:
+      break;
+    default:
+      return false;
+  }
+
+  if (tensors.at(outputs[0])->type != circle::TensorType_FLOAT32)
+    return false;
+
+  return true;
+}
+
+CircleNode *CircleDequantizeGraphBuilder::build_node(const circle::OperatorT &,
+                                                   const std::vector<CircleNode *> &inputs,
+                                                   loco::Graph *graph) const
+{
+  auto *node = graph->nodes()->create<CircleDequantize>();
+  node->input(inputs[0]);
+
+  // DequantizeOptions is empty
+
+  return node;
+}
+
+} // namespace luci
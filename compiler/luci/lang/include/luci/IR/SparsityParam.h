@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __LUCI_IR_SPARSITYPARAM_H__
+#define __LUCI_IR_SPARSITYPARAM_H__
+
+#include <cstdint>
+#include <vector>
+
+namespace luci
+{
+
+enum class DimensionType
+{
+  DENSE,
+  SPARSE_CSR,
+};
+
+struct DimMetaData
+{
+  DimensionType format{DimensionType::DENSE};
+  // Size of the dimension if DENSE
+  int32_t dense_size{0};
+  // Segments and indices of non-zero elements as in CSR if SPARSE_CSR
+  std::vector<int32_t> array_segments;
+  std::vector<int32_t> array_indices;
+};
+
+/**
+ * @brief Sparse format of a tensor, same as SparsityParameters of circle
+ * @note  CircleConst with this has the values of non-zero elements (or blocks) only
+ */
+struct SparsityParam
+{
+  std::vector<int32_t> traversal_order;
+  std::vector<int32_t> block_map;
+  std::vector<DimMetaData> dim_metadata;
+};
+
+} // namespace luci
+
+#endif // __LUCI_IR_SPARSITYPARAM_H__
@@ -19,6 +19,11 @@
 #include "luci/IR/CircleNodeVisitor.h"
 
 #include <loco/IR/Graph.h>
+#include <loco/IR/Use.h>
+
+#include <cassert>
+#include <set>
+#include <vector>
 
 namespace luci
 {
@@ -37,20 +42,58 @@ struct VirtualOutputDetector final : public luci::CircleNodeMutableVisitor<bool>
   bool visit(luci::CircleNode *) final { return false; }
 };
 
-bool DeadNodeQueryServiceImpl::isDeadNode(loco::Node *node)
+namespace
+{
+
+bool is_graph_input(loco::Node *node)
 {
-  auto g = node->graph();
-  auto input_nodes_vec = loco::input_nodes(g);
-  auto output_nodes_vec = loco::output_nodes(g);
+  auto input = dynamic_cast<luci::CircleInput *>(node);
+  return input != nullptr && input->indexed() && input->index() < node->graph()->inputs()->size();
+}
 
-  auto input_nodes = std::set<loco::Node *>(input_nodes_vec.begin(), input_nodes_vec.end());
-  auto output_nodes = std::set<loco::Node *>(output_nodes_vec.begin(), output_nodes_vec.end());
-  auto active_nodes = loco::active_nodes(output_nodes_vec);
+bool is_graph_output(loco::Node *node)
+{
+  auto output = dynamic_cast<luci::CircleOutput *>(node);
+  return output != nullptr && output->indexed() &&
+         output->index() < node->graph()->outputs()->size();
+}
+
+/**
+ * @brief Return true if some graph output is computed from the node
+ *
+ * NOTE This follows successors rather than collecting active nodes from every output, so
+ *      asking about a dead node costs only its own (dead) successors.
+ */
+bool is_active(loco::Node *node)
+{
+  std::set<loco::Node *> visited;
+  std::vector<loco::Node *> stack{node};
 
-  if (active_nodes.find(node) != active_nodes.end())
+  while (!stack.empty())
+  {
+    auto current = stack.back();
+    stack.pop_back();
+
+    if (!visited.insert(current).second)
+      continue;
+    if (is_graph_output(current))
+      return true;
+
+    for (auto use = current->uses(); use != nullptr; use = use->next())
+      stack.push_back(use->user());
+  }
+
+  return false;
+}
+
+} // namespace
+
+bool DeadNodeQueryServiceImpl::isDeadNode(loco::Node *node)
+{
+  if (is_active(node))
     return false;
   // input and output nodes are not dead node even if it is not active.
-  if (input_nodes.find(node) != input_nodes.end())
+  if (is_graph_input(node))
     return false;
 
   // if node is one of virtual mulitple outputs, we need to ask the real node
@@ -61,9 +104,9 @@ bool DeadNodeQueryServiceImpl::isDeadNode(loco::Node *node)
     {
       assert(node->arity() == 1);
       loco::Node *real_node = node->arg(0);
-      if (active_nodes.find(real_node) != active_nodes.end())
+      if (is_active(real_node))
         return false;
-      if (input_nodes.find(real_node) != input_nodes.end())
+      if (is_graph_input(real_node))
         return false;
     }
   }
@@ -210,6 +210,7 @@ private:
   IMPLEMENT(luci::CircleCustom)
   IMPLEMENT(luci::CircleDepthToSpace)
   IMPLEMENT(luci::CircleDepthwiseConv2D)
+  IMPLEMENT(luci::CircleDequantize)
   IMPLEMENT(luci::CircleDiv)
   IMPLEMENT(luci::CircleElu)
   IMPLEMENT(luci::CircleExp)
@@ -250,6 +251,7 @@ private:
   IMPLEMENT(luci::CirclePad)
   IMPLEMENT(luci::CirclePow)
   IMPLEMENT(luci::CirclePRelu)
+  IMPLEMENT(luci::CircleQuantize)
   IMPLEMENT(luci::CircleRange)
   IMPLEMENT(luci::CircleRank)
   IMPLEMENT(luci::CircleReduceAny)
@@ -564,6 +566,12 @@ bool CircleNodeSummaryBuilder::summary(const luci::CircleDepthwiseConv2D *node,
   return true;
 }
 
+bool CircleNodeSummaryBuilder::summary(const luci::CircleDequantize *node,
+                                       locop::NodeSummary &s) const
+{
+  return use_input(tbl(), node, s);
+}
+
 bool CircleNodeSummaryBuilder::summary(const luci::CircleDiv *node, locop::NodeSummary &s) const
 {
   return use_xy(tbl(), node, s);
@@ -874,6 +882,12 @@ bool CircleNodeSummaryBuilder::summary(const luci::CirclePRelu *node, locop::Nod
   return true;
 }
 
+bool CircleNodeSummaryBuilder::summary(const luci::CircleQuantize *node,
+                                       locop::NodeSummary &s) const
+{
+  return use_input(tbl(), node, s);
+}
+
 bool CircleNodeSummaryBuilder::summary(const luci::CircleRange *node, locop::NodeSummary &s) const
 {
   s.args().append("start", tbl()->lookup(node->start()));
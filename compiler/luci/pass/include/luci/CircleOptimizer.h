@@ -32,20 +32,31 @@ public:
   {
     enum Algorithm
     {
+      FuseActivationFunction,
+      FuseBatchNormWithConv,
       FuseBCQ,
       FuseInstanceNorm,
+      FusePadWithConv,
       ResolveCustomOpAdd,
       ResolveCustomOpBatchMatMul,
       ResolveCustomOpMatMul,
       QuantizeDequantizeWeights,
       QuantizeWithMinMax,
+      RemoveIdentityArithmetic,
+      RemoveRedundantReshape,
+      RemoveRedundantTranspose,
+      SparsifyWeights,
     };
 
     enum AlgorithmParameters
     {
       Quantize_input_dtype,
       Quantize_output_dtype,
-      Quantize_granularity // layer-wise or channel-wise
+      Quantize_granularity,     // layer-wise or channel-wise
+      Quantize_layer_precision, // path to the type of each layer (optional)
+      Quantize_num_threads,     // threads to quantize weights, all the cores if not given
+      Sparsify_block_size,      // e.g. "1,4"
+      Sparsify_min_sparsity,    // ratio of zero blocks to sparsify weights
     };
 
     virtual ~Options() = default;
@@ -65,6 +76,8 @@ public:
 
   void quantize(loco::Graph *) const;
 
+  void sparsify(loco::Graph *) const;
+
 private:
   std::unique_ptr<Options> _options;
 };
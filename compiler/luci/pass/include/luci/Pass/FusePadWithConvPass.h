@@ -0,0 +1,38 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __LUCI_FUSE_PAD_WITH_CONV_PASS_H__
+#define __LUCI_FUSE_PAD_WITH_CONV_PASS_H__
+
+#include <logo/Pass.h>
+
+namespace luci
+{
+
+/**
+ * @brief  Class to merge Pad into the following Conv2D/DepthwiseConv2D, when the padding
+ *         is the same as SAME padding of the convolution
+ */
+struct FusePadWithConvPass final : public logo::NodePass
+{
+  const char *name(void) const final { return "luci::FusePadWithConvPass"; }
+
+  bool apply(loco::Node *node) final;
+};
+
+} // namespace luci
+
+#endif // __LUCI_FUSE_PAD_WITH_CONV_PASS_H__
@@ -17,6 +17,11 @@
 #ifndef __LUCI_QUANTIZATION_PARAMETERS_H__
 #define __LUCI_QUANTIZATION_PARAMETERS_H__
 
+#include <loco/IR/DataType.h>
+
+#include <map>
+#include <string>
+
 namespace luci
 {
 
@@ -26,6 +31,14 @@ enum QuantizationGranularity
   ChannelWise = 1,
 };
 
+/**
+ * @brief Quantized type of each layer, keyed by the name of the layer
+ *
+ * Layers mapped to FLOAT32 are not quantized. Layers not in the map are quantized
+ * to the output type of the pass.
+ */
+using LayerPrecisionMap = std::map<std::string, loco::DataType>;
+
 } // namespace luci
 
 #endif // __LUCI_QUANTIZATION_PARAMETERS_H__
@@ -28,6 +28,9 @@ namespace luci
 
 /**
  * @brief Pass to quantize activation, weights, and bias
+ *
+ * With a LayerPrecisionMap, each layer is quantized to its own type (or kept in float), and
+ * CircleQuantize/CircleDequantize are inserted between layers of different types.
  */
 class QuantizeWithMinMaxPass : public logo::Pass
 {
@@ -38,8 +41,22 @@ public:
   {
     // DO NOTHING
   }
+
+  QuantizeWithMinMaxPass(loco::DataType input_dtype, loco::DataType output_dtype,
+                         QuantizationGranularity granularity,
+                         const LayerPrecisionMap &layer_precision)
+      : _input_dtype{input_dtype}, _output_dtype{output_dtype}, _granularity{granularity},
+        _layer_precision{layer_precision}
+  {
+    // DO NOTHING
+  }
+
   virtual const char *name(void) const { return "luci::QuantizeWithMinMaxPass"; }
 
+public:
+  /// @brief Set the number of threads to quantize weights, 0 (default) for the number of cores
+  void num_threads(uint32_t num_threads) { _num_threads = num_threads; }
+
 public:
   bool run(loco::Graph *graph);
 
@@ -47,6 +64,8 @@ private:
   loco::DataType _input_dtype;
   loco::DataType _output_dtype;
   QuantizationGranularity _granularity;
+  LayerPrecisionMap _layer_precision;
+  uint32_t _num_threads = 0;
 };
 
 } // namespace luci
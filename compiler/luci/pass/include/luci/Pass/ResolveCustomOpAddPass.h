@@ -25,11 +25,11 @@ namespace luci
 /**
  * @brief  Class to resolve certain custom op of subgraph into add op in circle schema.
  */
-struct ResolveCustomOpAddPass final : public logo::Pass
+struct ResolveCustomOpAddPass final : public logo::NodePass
 {
   const char *name(void) const final { return "luci::ResolveCustomOpAddPass"; }
 
-  bool run(loco::Graph *g) final;
+  bool apply(loco::Node *node) final;
 };
 
 } // namespace luci
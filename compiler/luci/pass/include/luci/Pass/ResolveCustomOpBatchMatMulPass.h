@@ -25,11 +25,11 @@ namespace luci
 /**
  * @brief  Class to resolve certain custom op of subgraph into batchmatmul op in circle schema.
  */
-struct ResolveCustomOpBatchMatMulPass final : public logo::Pass
+struct ResolveCustomOpBatchMatMulPass final : public logo::NodePass
 {
   const char *name(void) const final { return "luci::ResolveCustomOpBatchMatMulPass"; }
 
-  bool run(loco::Graph *g) final;
+  bool apply(loco::Node *node) final;
 };
 
 } // namespace luci
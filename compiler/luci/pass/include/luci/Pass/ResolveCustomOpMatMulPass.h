@@ -25,11 +25,11 @@ namespace luci
 /**
  * @brief  Class to resolve certain custom op of subgraph into matmul op in circle schema.
  */
-struct ResolveCustomOpMatMulPass final : public logo::Pass
+struct ResolveCustomOpMatMulPass final : public logo::NodePass
 {
   const char *name(void) const final { return "luci::ResolveCustomOpMatMulPass"; }
 
-  bool run(loco::Graph *g) final;
+  bool apply(loco::Node *node) final;
 };
 
 } // namespace luci
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __LUCI_SPARSIFY_WEIGHTS_PASS_H__
+#define __LUCI_SPARSIFY_WEIGHTS_PASS_H__
+
+#include <loco.h>
+
+#include <logo/Pass.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace luci
+{
+
+/**
+ * @brief Pass to store float weights of FullyConnected and 1x1 Conv2D in block sparse format
+ *
+ * Weights are regarded as a matrix of [output depth, input depth] and split into blocks of
+ * block_size. Weights with at least min_sparsity of all-zero blocks are stored in block
+ * compressed sparse row format, which keeps the non-zero blocks only.
+ *
+ * @note Zeros are not made by this pass. Weights SHOULD be pruned in advance.
+ * @note This SHOULD be the last transformation, as the other passes assume dense constants.
+ */
+class SparsifyWeightsPass : public logo::Pass
+{
+public:
+  SparsifyWeightsPass(const std::vector<int32_t> &block_size, float min_sparsity)
+      : _block_size{block_size}, _min_sparsity{min_sparsity}
+  {
+    // DO NOTHING
+  }
+
+  virtual const char *name(void) const { return "luci::SparsifyWeightsPass"; }
+
+public:
+  bool run(loco::Graph *graph);
+
+private:
+  std::vector<int32_t> _block_size;
+  float _min_sparsity;
+};
+
+} // namespace luci
+
+#endif //__LUCI_SPARSIFY_WEIGHTS_PASS_H__
@@ -16,13 +16,20 @@
 
 #include "luci/CircleOptimizer.h"
 
+#include "luci/Pass/FuseActivationFunctionPass.h"
+#include "luci/Pass/FuseBatchNormWithConvPass.h"
 #include "luci/Pass/FuseBCQPass.h"
 #include "luci/Pass/FuseInstanceNormPass.h"
+#include "luci/Pass/FusePadWithConvPass.h"
+#include "luci/Pass/RemoveIdentityArithmeticPass.h"
+#include "luci/Pass/RemoveRedundantReshapePass.h"
+#include "luci/Pass/RemoveRedundantTransposePass.h"
 #include "luci/Pass/ResolveCustomOpAddPass.h"
 #include "luci/Pass/ResolveCustomOpBatchMatMulPass.h"
 #include "luci/Pass/ResolveCustomOpMatMulPass.h"
 #include "luci/Pass/QuantizeWithMinMaxPass.h"
 #include "luci/Pass/QuantizeDequantizeWeightsPass.h"
+#include "luci/Pass/SparsifyWeightsPass.h"
 // TODO add more passes
 
 #include "luci/Pass/ShapeInferencePass.h"
@@ -37,6 +44,7 @@
 #include <logo/Phase.h>
 
 #include <memory>
+#include <sstream>
 
 namespace
 {
@@ -85,6 +93,78 @@ bool OptimizeOptionsImpl::query(Algorithm algo)
   return true;
 }
 
+// Type of each layer given with Quantize_layer_precision, or empty if not given
+LayerPrecisionMap read_layer_precision_param(const CircleOptimizer::Options *options,
+                                             const std::string &granularity)
+{
+  using AlgorithmParameters = CircleOptimizer::Options::AlgorithmParameters;
+
+  auto path = options->param(AlgorithmParameters::Quantize_layer_precision);
+  if (path.empty())
+    return LayerPrecisionMap{};
+
+  auto layer_precision = read_layer_precision(path);
+  for (const auto &layer : layer_precision)
+  {
+    // int16 is supported only for channel-wise quantization
+    if (layer.second == loco::DataType::S16 && str_to_granularity(granularity) != ChannelWise)
+      throw std::runtime_error("Layer " + layer.first + " is int16, which is supported only " +
+                               "with channel granularity");
+  }
+
+  return layer_precision;
+}
+
+// Block size given with Sparsify_block_size, 1x4 if not given
+std::vector<int32_t> read_block_size_param(const CircleOptimizer::Options *options)
+{
+  using AlgorithmParameters = CircleOptimizer::Options::AlgorithmParameters;
+
+  auto str = options->param(AlgorithmParameters::Sparsify_block_size);
+  if (str.empty())
+    return std::vector<int32_t>{1, 4};
+
+  std::vector<int32_t> block_size;
+  std::istringstream ss(str);
+  std::string token;
+  while (std::getline(ss, token, ','))
+  {
+    try
+    {
+      block_size.push_back(std::stoi(token));
+    }
+    catch (const std::exception &)
+    {
+      throw std::runtime_error("Invalid block size: " + str);
+    }
+  }
+  return block_size;
+}
+
+// Number of threads given with Quantize_num_threads, 0 (all the cores) if not given
+uint32_t read_num_threads_param(const CircleOptimizer::Options *options)
+{
+  using AlgorithmParameters = CircleOptimizer::Options::AlgorithmParameters;
+
+  auto str = options->param(AlgorithmParameters::Quantize_num_threads);
+  if (str.empty())
+    return 0;
+
+  int32_t num_threads = -1;
+  try
+  {
+    num_threads = std::stoi(str);
+  }
+  catch (const std::exception &)
+  {
+    // Reported below
+  }
+  if (num_threads < 0)
+    throw std::runtime_error("Invalid number of threads: " + str);
+
+  return static_cast<uint32_t>(num_threads);
+}
+
 } // namespace
 
 namespace luci
@@ -125,6 +205,31 @@ void CircleOptimizer::optimize(loco::Graph *g) const
   {
     phase.emplace_back(std::make_unique<FuseBCQPass>());
   }
+  if (_options->query(Options::Algorithm::RemoveIdentityArithmetic))
+  {
+    phase.emplace_back(std::make_unique<luci::RemoveIdentityArithmeticPass>());
+  }
+  if (_options->query(Options::Algorithm::RemoveRedundantTranspose))
+  {
+    phase.emplace_back(std::make_unique<luci::RemoveRedundantTransposePass>());
+  }
+  if (_options->query(Options::Algorithm::RemoveRedundantReshape))
+  {
+    phase.emplace_back(std::make_unique<luci::RemoveRedundantReshapePass>());
+  }
+  if (_options->query(Options::Algorithm::FusePadWithConv))
+  {
+    phase.emplace_back(std::make_unique<luci::FusePadWithConvPass>());
+  }
+  if (_options->query(Options::Algorithm::FuseBatchNormWithConv))
+  {
+    phase.emplace_back(std::make_unique<luci::FuseBatchNormWithConvPass>());
+  }
+  // NOTE Activation should be fused after the other fusions which need no activation
+  if (_options->query(Options::Algorithm::FuseActivationFunction))
+  {
+    phase.emplace_back(std::make_unique<luci::FuseActivationFunctionPass>());
+  }
 
   // Shape inference is needed for added nodes doing above transformations
   phase.emplace_back(std::make_unique<luci::ShapeInferencePass>());
@@ -132,8 +237,8 @@ void CircleOptimizer::optimize(loco::Graph *g) const
   phase.emplace_back(std::make_unique<logo::RemoveDeadNodeWithQueryPass>());
   /* TRANSFORM DECLARATION END */
 
-  ProgressReporter prog(g, logo::PhaseStrategy::Saturate);
-  logo::PhaseRunner<logo::PhaseStrategy::Saturate> phase_runner{g};
+  ProgressReporter prog(g, logo::PhaseStrategy::Worklist);
+  logo::PhaseRunner<logo::PhaseStrategy::Worklist> phase_runner{g};
   phase_runner.attach(&prog);
   phase_runner.run(phase);
 }
@@ -163,8 +268,12 @@ void CircleOptimizer::quantize(loco::Graph *g) const
       throw std::runtime_error("Unsupported granularity. List of supported granularity: " +
                                to_string(fakeq_supported_granularity));
 
+    auto layer_precision = read_layer_precision_param(_options.get(), granularity);
+
     luci::QuantizeDequantizeWeightsPass fake_quantizer(
-        str_to_dtype(input_dtype), str_to_dtype(output_dtype), str_to_granularity(granularity));
+        str_to_dtype(input_dtype), str_to_dtype(output_dtype), str_to_granularity(granularity),
+        layer_precision);
+    fake_quantizer.num_threads(read_num_threads_param(_options.get()));
     fake_quantizer.run(g);
   }
 
@@ -191,8 +300,11 @@ void CircleOptimizer::quantize(loco::Graph *g) const
       throw std::runtime_error("Unsupported granularity. List of supported granularity: " +
                                to_string(qwmm_supported_granularity));
 
+    auto layer_precision = read_layer_precision_param(_options.get(), granularity);
+
     luci::QuantizeWithMinMaxPass quantizer(str_to_dtype(input_dtype), str_to_dtype(output_dtype),
-                                           str_to_granularity(granularity));
+                                           str_to_granularity(granularity), layer_precision);
+    quantizer.num_threads(read_num_threads_param(_options.get()));
     quantizer.run(g);
   }
 
@@ -202,10 +314,26 @@ void CircleOptimizer::quantize(loco::Graph *g) const
   phase.emplace_back(std::make_unique<luci::ShapeInferencePass>());
   phase.emplace_back(std::make_unique<luci::TypeInferencePass>());
 
-  ProgressReporter prog(g, logo::PhaseStrategy::Saturate);
-  logo::PhaseRunner<logo::PhaseStrategy::Saturate> phase_runner{g};
+  ProgressReporter prog(g, logo::PhaseStrategy::Worklist);
+  logo::PhaseRunner<logo::PhaseStrategy::Worklist> phase_runner{g};
   phase_runner.attach(&prog);
   phase_runner.run(phase);
 }
 
+void CircleOptimizer::sparsify(loco::Graph *g) const
+{
+  if (_options->query(Options::Algorithm::SparsifyWeights))
+  {
+    auto block_size = read_block_size_param(_options.get());
+
+    auto min_sparsity_str = _options->param(Options::AlgorithmParameters::Sparsify_min_sparsity);
+    float min_sparsity = 0.5f;
+    if (!min_sparsity_str.empty())
+      min_sparsity = std::stof(min_sparsity_str);
+
+    luci::SparsifyWeightsPass sparsifier(block_size, min_sparsity);
+    sparsifier.run(g);
+  }
+}
+
 } // namespace luci
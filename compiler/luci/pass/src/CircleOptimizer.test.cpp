@@ -0,0 +1,339 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/CircleOptimizer.h"
+
+#include "luci/Pass/FuseActivationFunctionPass.h"
+#include "luci/Pass/FuseBatchNormWithConvPass.h"
+#include "luci/Pass/RemoveIdentityArithmeticPass.h"
+#include "luci/Pass/RemoveRedundantReshapePass.h"
+#include "luci/Pass/RemoveRedundantTransposePass.h"
+#include "luci/Pass/ShapeInferencePass.h"
+#include "luci/Pass/TypeInferencePass.h"
+
+#include <luci/IR/CircleNodes.h>
+
+#include <logo/Phase.h>
+#include <logo/RemoveDeadNodeWithQueryPass.h>
+
+#include <loco.h>
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+using Algorithm = luci::CircleOptimizer::Options::Algorithm;
+
+template <loco::DataType DT>
+luci::CircleConst *create_const(loco::Graph *g, const std::vector<uint32_t> &shape,
+                                const std::vector<typename loco::DataTypeImpl<DT>::Type> &values)
+{
+  auto node = g->nodes()->create<luci::CircleConst>();
+  node->dtype(DT);
+  node->rank(shape.size());
+  for (uint32_t i = 0; i < shape.size(); ++i)
+    node->dim(i) = shape[i];
+  node->size<DT>(values.size());
+  for (uint32_t i = 0; i < values.size(); ++i)
+    node->at<DT>(i) = values[i];
+  return node;
+}
+
+/**
+ * @brief Append a block which needs every pass below, some of them more than once, to be
+ *        reduced to a single Conv2D
+ *
+ *  [X] -- [Transpose] -- [Transpose] -- [Mul(one)] -- [Conv2D] -- [Mul(scale)] -- [Add(shift)]
+ *      -- [Relu] -- [Reshape] -- [Reshape] -- [Y]
+ *
+ * X and Y are [1, 4, 4, 2], and the two Transposes and the two Reshapes cancel each other.
+ */
+loco::Node *append_block(loco::Graph *g, loco::Node *x)
+{
+  constexpr auto F32 = loco::DataType::FLOAT32;
+  constexpr auto S32 = loco::DataType::S32;
+
+  auto to_nchw = g->nodes()->create<luci::CircleTranspose>();
+  to_nchw->a(x);
+  to_nchw->perm(create_const<S32>(g, {4}, {0, 3, 1, 2}));
+  auto to_nhwc = g->nodes()->create<luci::CircleTranspose>();
+  to_nhwc->a(to_nchw);
+  to_nhwc->perm(create_const<S32>(g, {4}, {0, 2, 3, 1}));
+
+  auto one = g->nodes()->create<luci::CircleMul>();
+  one->x(to_nhwc);
+  one->y(create_const<F32>(g, {1}, {1.0f}));
+  one->fusedActivationFunction(luci::FusedActFunc::NONE);
+
+  auto conv = g->nodes()->create<luci::CircleConv2D>();
+  conv->input(one);
+  conv->filter(create_const<F32>(g, {2, 1, 1, 2}, {1.0f, 2.0f, 3.0f, 4.0f}));
+  conv->bias(create_const<F32>(g, {2}, {0.5f, -0.5f}));
+  conv->padding(luci::Padding::VALID);
+  conv->stride()->h(1);
+  conv->stride()->w(1);
+  conv->dilation()->h(1);
+  conv->dilation()->w(1);
+  conv->fusedActivationFunction(luci::FusedActFunc::NONE);
+
+  auto scale = g->nodes()->create<luci::CircleMul>();
+  scale->x(conv);
+  scale->y(create_const<F32>(g, {1, 1, 1, 2}, {2.0f, 10.0f}));
+  scale->fusedActivationFunction(luci::FusedActFunc::NONE);
+  auto shift = g->nodes()->create<luci::CircleAdd>();
+  shift->x(scale);
+  shift->y(create_const<F32>(g, {2}, {1.0f, -1.0f}));
+  shift->fusedActivationFunction(luci::FusedActFunc::NONE);
+
+  auto relu = g->nodes()->create<luci::CircleRelu>();
+  relu->features(shift);
+
+  auto flatten = g->nodes()->create<luci::CircleReshape>();
+  flatten->tensor(relu);
+  flatten->shape(create_const<S32>(g, {2}, {1, 32}));
+  flatten->newShape()->rank(2);
+  flatten->newShape()->dim(0) = 1;
+  flatten->newShape()->dim(1) = 32;
+  auto unflatten = g->nodes()->create<luci::CircleReshape>();
+  unflatten->tensor(flatten);
+  unflatten->shape(create_const<S32>(g, {4}, {1, 4, 4, 2}));
+  unflatten->newShape()->rank(4);
+  unflatten->newShape()->dim(0) = 1;
+  unflatten->newShape()->dim(1) = 4;
+  unflatten->newShape()->dim(2) = 4;
+  unflatten->newShape()->dim(3) = 2;
+
+  return unflatten;
+}
+
+std::unique_ptr<loco::Graph> make_graph(uint32_t num_blocks)
+{
+  auto g = loco::make_graph();
+
+  auto input = g->nodes()->create<luci::CircleInput>();
+  auto graph_input = g->inputs()->create();
+  input->index(graph_input->index());
+  input->dtype(loco::DataType::FLOAT32);
+  input->rank(4);
+  input->dim(0) = 1;
+  input->dim(1) = 4;
+  input->dim(2) = 4;
+  input->dim(3) = 2;
+
+  loco::Node *last = input;
+  for (uint32_t n = 0; n < num_blocks; ++n)
+    last = append_block(g.get(), last);
+
+  auto output = g->nodes()->create<luci::CircleOutput>();
+  output->from(last);
+  auto graph_output = g->outputs()->create();
+  output->index(graph_output->index());
+  graph_output->dtype(loco::DataType::FLOAT32);
+  graph_output->shape({1, 4, 4, 2});
+
+  return g;
+}
+
+/**
+ * @brief Describe the nodes reachable from outputs, independent of the creation order of nodes
+ */
+std::string describe(loco::Graph *g)
+{
+  std::map<loco::Node *, uint32_t> ids;
+  std::ostringstream oss;
+
+  for (auto node : loco::postorder_traversal(loco::output_nodes(g)))
+  {
+    auto circle_node = dynamic_cast<luci::CircleNode *>(node);
+    const auto id = static_cast<uint32_t>(ids.size());
+    ids[node] = id;
+
+    oss << id << ": " << static_cast<uint32_t>(circle_node->opcode()) << "(";
+    for (uint32_t i = 0; i < node->arity(); ++i)
+      oss << (i > 0 ? ", " : "") << ids.at(node->arg(i));
+    oss << ")";
+
+    using FusedAct = luci::LuciNodeMixin<luci::LuciNodeTrait::FusedActFunc>;
+    if (auto fused = dynamic_cast<FusedAct *>(node))
+      oss << " act " << static_cast<uint32_t>(fused->fusedActivationFunction());
+
+    if (auto constant = dynamic_cast<luci::CircleConst *>(node))
+    {
+      if (constant->dtype() == loco::DataType::FLOAT32)
+      {
+        for (uint32_t i = 0; i < constant->size<loco::DataType::FLOAT32>(); ++i)
+          oss << " " << constant->at<loco::DataType::FLOAT32>(i);
+      }
+      else if (constant->dtype() == loco::DataType::S32)
+      {
+        for (uint32_t i = 0; i < constant->size<loco::DataType::S32>(); ++i)
+          oss << " " << constant->at<loco::DataType::S32>(i);
+      }
+    }
+    oss << std::endl;
+  }
+
+  return oss.str();
+}
+
+/**
+ * @brief Append a depthwise separable block of MobileNetV1 with stride 2, as it is converted
+ *        from TensorFlow without folding BatchNorm
+ *
+ *  [X] -- [Pad] -- [DepthwiseConv2D(VALID)] -- [Mul] -- [Add] -- [Relu6]
+ *      -- [Conv2D(1x1)] -- [Mul] -- [Add] -- [Relu6] -- [Y]
+ *
+ * X is [1, 4, 4, 2] and Y is [1, 2, 2, 2].
+ */
+loco::Node *append_separable_block(loco::Graph *g, loco::Node *x)
+{
+  constexpr auto F32 = loco::DataType::FLOAT32;
+  constexpr auto S32 = loco::DataType::S32;
+
+  auto batchnorm_relu6 = [g](loco::Node *x) {
+    auto mul = g->nodes()->create<luci::CircleMul>();
+    mul->x(x);
+    mul->y(create_const<F32>(g, {2}, {0.5f, 2.0f}));
+    mul->fusedActivationFunction(luci::FusedActFunc::NONE);
+    auto add = g->nodes()->create<luci::CircleAdd>();
+    add->x(mul);
+    add->y(create_const<F32>(g, {2}, {0.1f, -0.1f}));
+    add->fusedActivationFunction(luci::FusedActFunc::NONE);
+    auto relu6 = g->nodes()->create<luci::CircleRelu6>();
+    relu6->features(add);
+    return relu6;
+  };
+
+  auto pad = g->nodes()->create<luci::CirclePad>();
+  pad->input(x);
+  pad->paddings(create_const<S32>(g, {4, 2}, {0, 0, 0, 1, 0, 1, 0, 0}));
+
+  auto dwconv = g->nodes()->create<luci::CircleDepthwiseConv2D>();
+  dwconv->input(pad);
+  dwconv->filter(create_const<F32>(g, {1, 3, 3, 2}, std::vector<float>(18, 0.1f)));
+  dwconv->bias(create_const<F32>(g, {2}, {0.0f, 0.0f}));
+  dwconv->padding(luci::Padding::VALID);
+  dwconv->stride()->h(2);
+  dwconv->stride()->w(2);
+  dwconv->dilation()->h(1);
+  dwconv->dilation()->w(1);
+  dwconv->depthMultiplier(1);
+  dwconv->fusedActivationFunction(luci::FusedActFunc::NONE);
+
+  auto conv = g->nodes()->create<luci::CircleConv2D>();
+  conv->input(batchnorm_relu6(dwconv));
+  conv->filter(create_const<F32>(g, {2, 1, 1, 2}, {1.0f, 2.0f, 3.0f, 4.0f}));
+  conv->bias(create_const<F32>(g, {2}, {0.0f, 0.0f}));
+  conv->padding(luci::Padding::SAME);
+  conv->stride()->h(1);
+  conv->stride()->w(1);
+  conv->dilation()->h(1);
+  conv->dilation()->w(1);
+  conv->fusedActivationFunction(luci::FusedActFunc::NONE);
+
+  return batchnorm_relu6(conv);
+}
+
+uint32_t count_active_nodes(loco::Graph *g)
+{
+  return loco::postorder_traversal(loco::output_nodes(g)).size();
+}
+
+} // namespace
+
+TEST(CircleOptimizerTest, worklist_same_as_saturate)
+{
+  const uint32_t num_blocks = 3;
+
+  // CircleOptimizer runs the passes with PhaseStrategy::Worklist
+  auto worklist = make_graph(num_blocks);
+  luci::CircleOptimizer optimizer;
+  auto options = optimizer.options();
+  options->enable(Algorithm::RemoveIdentityArithmetic);
+  options->enable(Algorithm::RemoveRedundantTranspose);
+  options->enable(Algorithm::RemoveRedundantReshape);
+  options->enable(Algorithm::FuseBatchNormWithConv);
+  options->enable(Algorithm::FuseActivationFunction);
+  optimizer.optimize(worklist.get());
+
+  // The same passes, in the same order as CircleOptimizer, with PhaseStrategy::Saturate
+  auto saturate = make_graph(num_blocks);
+  logo::Phase phase;
+  phase.emplace_back(std::make_unique<luci::RemoveIdentityArithmeticPass>());
+  phase.emplace_back(std::make_unique<luci::RemoveRedundantTransposePass>());
+  phase.emplace_back(std::make_unique<luci::RemoveRedundantReshapePass>());
+  phase.emplace_back(std::make_unique<luci::FuseBatchNormWithConvPass>());
+  phase.emplace_back(std::make_unique<luci::FuseActivationFunctionPass>());
+  phase.emplace_back(std::make_unique<luci::ShapeInferencePass>());
+  phase.emplace_back(std::make_unique<luci::TypeInferencePass>());
+  phase.emplace_back(std::make_unique<logo::RemoveDeadNodeWithQueryPass>());
+  logo::PhaseRunner<logo::PhaseStrategy::Saturate>{saturate.get()}.run(phase);
+
+  ASSERT_EQ(describe(worklist.get()), describe(saturate.get()));
+
+  // Each block is reduced to Conv2D with its filter and bias
+  ASSERT_EQ(count_active_nodes(worklist.get()), 2 + num_blocks * 3);
+  auto last = dynamic_cast<luci::CircleConv2D *>(
+      dynamic_cast<luci::CircleOutput *>(loco::output_nodes(worklist.get()).at(0))->from());
+  ASSERT_NE(last, nullptr);
+  ASSERT_EQ(last->fusedActivationFunction(), luci::FusedActFunc::RELU);
+}
+
+TEST(CircleOptimizerTest, separable_block_fused)
+{
+  auto g = loco::make_graph();
+
+  auto input = g->nodes()->create<luci::CircleInput>();
+  input->index(g->inputs()->create()->index());
+  input->dtype(loco::DataType::FLOAT32);
+  input->rank(4);
+  input->dim(0) = 1;
+  input->dim(1) = 4;
+  input->dim(2) = 4;
+  input->dim(3) = 2;
+
+  auto output = g->nodes()->create<luci::CircleOutput>();
+  output->from(append_separable_block(g.get(), input));
+  auto graph_output = g->outputs()->create();
+  output->index(graph_output->index());
+  graph_output->dtype(loco::DataType::FLOAT32);
+  graph_output->shape({1, 2, 2, 2});
+
+  luci::CircleOptimizer optimizer;
+  auto options = optimizer.options();
+  options->enable(Algorithm::FuseActivationFunction);
+  options->enable(Algorithm::FuseBatchNormWithConv);
+  options->enable(Algorithm::FusePadWithConv);
+  optimizer.optimize(g.get());
+
+  // Input -- DepthwiseConv2D(SAME, RELU6) -- Conv2D(RELU6) -- Output
+  auto conv = dynamic_cast<luci::CircleConv2D *>(output->from());
+  ASSERT_NE(conv, nullptr);
+  ASSERT_EQ(conv->fusedActivationFunction(), luci::FusedActFunc::RELU6);
+  auto dwconv = dynamic_cast<luci::CircleDepthwiseConv2D *>(conv->input());
+  ASSERT_NE(dwconv, nullptr);
+  ASSERT_EQ(dwconv->fusedActivationFunction(), luci::FusedActFunc::RELU6);
+  ASSERT_EQ(dwconv->padding(), luci::Padding::SAME);
+  ASSERT_EQ(dwconv->input(), input);
+  // Input, Output and two convolutions with their filter and bias
+  ASSERT_EQ(count_active_nodes(g.get()), 8);
+}
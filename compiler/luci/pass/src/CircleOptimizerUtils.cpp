@@ -16,6 +16,9 @@
 
 #include "CircleOptimizerUtils.h"
 
+#include <fstream>
+#include <sstream>
+
 namespace luci
 {
 
@@ -86,4 +89,37 @@ QuantizationGranularity str_to_granularity(const std::string &str)
   throw std::runtime_error("Quantization granularity must be either 'layer' or 'channel'");
 }
 
+LayerPrecisionMap read_layer_precision(const std::string &path)
+{
+  static const std::vector<std::string> supported_dtype{"uint8", "int16", "float32"};
+
+  std::ifstream fs(path);
+  if (fs.fail())
+    throw std::runtime_error("Cannot open layer precision file \"" + path + "\"");
+
+  LayerPrecisionMap layer_precision;
+  std::string line;
+  while (std::getline(fs, line))
+  {
+    if (line.empty() || line[0] == '#')
+      continue;
+
+    // Type is the last word, as a layer name may have spaces
+    auto pos = line.find_last_of(" \t");
+    auto name_end = line.find_last_not_of(" \t", pos);
+    if (pos == std::string::npos || name_end == std::string::npos)
+      throw std::runtime_error("Invalid line in layer precision file: " + line);
+
+    auto name = line.substr(0, name_end + 1);
+    auto dtype = to_lower_case(line.substr(pos + 1));
+    if (!in_array(dtype, supported_dtype))
+      throw std::runtime_error("Unsupported type of layer " + name +
+                               ". List of supported types: " + to_string(supported_dtype));
+
+    layer_precision[name] = str_to_dtype(dtype);
+  }
+
+  return layer_precision;
+}
+
 } // namespace luci
@@ -37,6 +37,13 @@ loco::DataType str_to_dtype(const std::string &);
 
 QuantizationGranularity str_to_granularity(const std::string &);
 
+/**
+ * @brief Read the type of each layer from a file
+ * @details Each line is "<layer name> <type>", where type is uint8, int16 or float32.
+ *          Empty lines and lines starting with '#' are ignored.
+ */
+LayerPrecisionMap read_layer_precision(const std::string &path);
+
 } // namespace luci
 
 #endif // __LUCI_CIRCLE_OPTIMIZER_UTILS_H__
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "CircleOptimizerUtils.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+namespace
+{
+
+class ReadLayerPrecisionTest : public ::testing::Test
+{
+protected:
+  void SetUp() override { _path = ::testing::TempDir() + "luci_layer_precision.txt"; }
+
+  void TearDown() override { std::remove(_path.c_str()); }
+
+  void write(const std::string &content)
+  {
+    std::ofstream fs(_path);
+    fs << content;
+  }
+
+protected:
+  std::string _path;
+};
+
+} // namespace
+
+TEST_F(ReadLayerPrecisionTest, simple)
+{
+  write("# <layer name> <type>\n"
+        "\n"
+        "conv uint8\n"
+        "fc\tINT16\n"
+        "layer with spaces  float32\n");
+
+  auto layer_precision = luci::read_layer_precision(_path);
+
+  ASSERT_EQ(3, layer_precision.size());
+  ASSERT_EQ(loco::DataType::U8, layer_precision.at("conv"));
+  ASSERT_EQ(loco::DataType::S16, layer_precision.at("fc"));
+  ASSERT_EQ(loco::DataType::FLOAT32, layer_precision.at("layer with spaces"));
+}
+
+TEST_F(ReadLayerPrecisionTest, last_line_wins)
+{
+  write("conv uint8\n"
+        "conv float32\n");
+
+  auto layer_precision = luci::read_layer_precision(_path);
+
+  ASSERT_EQ(1, layer_precision.size());
+  ASSERT_EQ(loco::DataType::FLOAT32, layer_precision.at("conv"));
+}
+
+TEST_F(ReadLayerPrecisionTest, unsupported_type_NEG)
+{
+  write("conv int8\n");
+
+  EXPECT_ANY_THROW(luci::read_layer_precision(_path));
+}
+
+TEST_F(ReadLayerPrecisionTest, missing_type_NEG)
+{
+  write("conv\n");
+
+  EXPECT_ANY_THROW(luci::read_layer_precision(_path));
+}
+
+TEST_F(ReadLayerPrecisionTest, no_file_NEG)
+{
+  EXPECT_ANY_THROW(luci::read_layer_precision(_path + ".none"));
+}
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/Pass/FuseActivationFunctionPass.h"
+
+#include <luci/IR/CircleNodes.h>
+
+namespace
+{
+
+using FusableNode = luci::LuciNodeMixin<luci::LuciNodeTrait::FusedActFunc>;
+
+bool fuse_activation(luci::CircleNode *activation, loco::Node *features, luci::FusedActFunc func)
+{
+  auto pred = dynamic_cast<luci::CircleNode *>(features);
+  auto fusable = dynamic_cast<FusableNode *>(features);
+  if (pred == nullptr || fusable == nullptr)
+    return false;
+
+  if (fusable->fusedActivationFunction() != luci::FusedActFunc::NONE)
+    return false;
+
+  // Output of the preceding node should not be used by others
+  if (loco::succs(pred).size() != 1)
+    return false;
+
+  // Fusion may change the quantization range of the output
+  if (pred->quantparam() != nullptr || activation->quantparam() != nullptr)
+    return false;
+
+  fusable->fusedActivationFunction(func);
+  loco::replace(activation).with(pred);
+
+  return true;
+}
+
+} // namespace
+
+namespace luci
+{
+
+bool FuseActivationFunctionPass::apply(loco::Node *node)
+{
+  if (auto relu = dynamic_cast<luci::CircleRelu *>(node))
+    return fuse_activation(relu, relu->features(), luci::FusedActFunc::RELU);
+
+  if (auto relu6 = dynamic_cast<luci::CircleRelu6 *>(node))
+    return fuse_activation(relu6, relu6->features(), luci::FusedActFunc::RELU6);
+
+  if (auto relu_n1_to_1 = dynamic_cast<luci::CircleReluN1To1 *>(node))
+    return fuse_activation(relu_n1_to_1, relu_n1_to_1->features(),
+                           luci::FusedActFunc::RELU_N1_TO_1);
+
+  return false;
+}
+
+} // namespace luci
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/Pass/FuseActivationFunctionPass.h"
+
+#include <luci/IR/CircleNodes.h>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+
+/**
+ *  [Input] -- [Add(bias)] -- [Relu] -- [Output]
+ */
+class AddReluGraph
+{
+public:
+  AddReluGraph()
+  {
+    input = g->nodes()->create<luci::CircleInput>();
+    bias = g->nodes()->create<luci::CircleConst>();
+    add = g->nodes()->create<luci::CircleAdd>();
+    relu = g->nodes()->create<luci::CircleRelu>();
+    output = g->nodes()->create<luci::CircleOutput>();
+
+    bias->dtype(loco::DataType::FLOAT32);
+    bias->rank(1);
+    bias->dim(0) = 1;
+    bias->size<loco::DataType::FLOAT32>(1);
+    bias->at<loco::DataType::FLOAT32>(0) = 1.0f;
+
+    add->x(input);
+    add->y(bias);
+    add->fusedActivationFunction(luci::FusedActFunc::NONE);
+    relu->features(add);
+    output->from(relu);
+
+    auto graph_output = g->outputs()->create();
+    output->index(graph_output->index());
+  }
+
+public:
+  std::unique_ptr<loco::Graph> g = loco::make_graph();
+  luci::CircleInput *input = nullptr;
+  luci::CircleConst *bias = nullptr;
+  luci::CircleAdd *add = nullptr;
+  luci::CircleRelu *relu = nullptr;
+  luci::CircleOutput *output = nullptr;
+};
+
+} // namespace
+
+TEST(FuseActivationFunctionPass, fuse_relu)
+{
+  AddReluGraph graph;
+  luci::FuseActivationFunctionPass pass;
+
+  ASSERT_TRUE(pass.apply(graph.relu));
+
+  ASSERT_EQ(graph.output->from(), graph.add);
+  ASSERT_EQ(graph.add->fusedActivationFunction(), luci::FusedActFunc::RELU);
+}
+
+TEST(FuseActivationFunctionPass, fuse_relu6)
+{
+  AddReluGraph graph;
+  auto relu6 = graph.g->nodes()->create<luci::CircleRelu6>();
+  relu6->features(graph.add);
+  graph.output->from(relu6);
+  graph.relu->drop();
+  luci::FuseActivationFunctionPass pass;
+
+  ASSERT_TRUE(pass.apply(relu6));
+
+  ASSERT_EQ(graph.output->from(), graph.add);
+  ASSERT_EQ(graph.add->fusedActivationFunction(), luci::FusedActFunc::RELU6);
+}
+
+TEST(FuseActivationFunctionPass, run_over_graph)
+{
+  AddReluGraph graph;
+  luci::FuseActivationFunctionPass pass;
+
+  ASSERT_TRUE(pass.run(graph.g.get()));
+  ASSERT_FALSE(pass.run(graph.g.get()));
+
+  ASSERT_EQ(graph.output->from(), graph.add);
+}
+
+TEST(FuseActivationFunctionPass, fused_activation_NEG)
+{
+  AddReluGraph graph;
+  graph.add->fusedActivationFunction(luci::FusedActFunc::RELU6);
+  luci::FuseActivationFunctionPass pass;
+
+  ASSERT_FALSE(pass.apply(graph.relu));
+  ASSERT_EQ(graph.output->from(), graph.relu);
+}
+
+TEST(FuseActivationFunctionPass, multiple_users_NEG)
+{
+  AddReluGraph graph;
+  auto another_output = graph.g->nodes()->create<luci::CircleOutput>();
+  another_output->from(graph.add);
+  another_output->index(graph.g->outputs()->create()->index());
+  luci::FuseActivationFunctionPass pass;
+
+  ASSERT_FALSE(pass.apply(graph.relu));
+  ASSERT_EQ(graph.output->from(), graph.relu);
+  ASSERT_EQ(graph.add->fusedActivationFunction(), luci::FusedActFunc::NONE);
+}
+
+TEST(FuseActivationFunctionPass, quantized_NEG)
+{
+  AddReluGraph graph;
+  graph.add->quantparam(std::make_unique<luci::CircleQuantParam>());
+  luci::FuseActivationFunctionPass pass;
+
+  ASSERT_FALSE(pass.apply(graph.relu));
+  ASSERT_EQ(graph.output->from(), graph.relu);
+}
+
+TEST(FuseActivationFunctionPass, not_fusable_NEG)
+{
+  AddReluGraph graph;
+  graph.relu->features(graph.input);
+  luci::FuseActivationFunctionPass pass;
+
+  ASSERT_FALSE(pass.apply(graph.relu));
+  ASSERT_EQ(graph.output->from(), graph.relu);
+}
@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/Pass/FuseBatchNormWithConvPass.h"
+
+#include <luci/IR/CircleNodes.h>
+
+#include <cassert>
+#include <vector>
+
+namespace
+{
+
+using FusableNode = luci::LuciNodeMixin<luci::LuciNodeTrait::FusedActFunc>;
+
+/**
+ * @brief  Read values of the constant which is broadcast along the last (channel) axis
+ */
+bool read_channel_values(luci::CircleConst *node, uint32_t depth, std::vector<float> &values)
+{
+  if (node->dtype() != loco::DataType::FLOAT32 || node->sparsityparam() != nullptr)
+    return false;
+
+  // Broadcasting should not change the shape of convolution output
+  if (node->rank() > 4)
+    return false;
+
+  for (uint32_t axis = 0; axis + 1 < node->rank(); ++axis)
+  {
+    if (node->dim(axis).value() != 1)
+      return false;
+  }
+
+  const auto size = node->size<loco::DataType::FLOAT32>();
+  if (size == depth)
+  {
+    for (uint32_t c = 0; c < depth; ++c)
+      values.push_back(node->at<loco::DataType::FLOAT32>(c));
+  }
+  else if (size == 1)
+  {
+    values.assign(depth, node->at<loco::DataType::FLOAT32>(0));
+  }
+  else
+  {
+    return false;
+  }
+
+  return true;
+}
+
+luci::CircleConst *clone_const(luci::CircleConst *node)
+{
+  auto clone = node->graph()->nodes()->create<luci::CircleConst>();
+  clone->dtype(node->dtype());
+  clone->rank(node->rank());
+  for (uint32_t axis = 0; axis < node->rank(); ++axis)
+    clone->dim(axis) = node->dim(axis);
+
+  const auto size = node->size<loco::DataType::FLOAT32>();
+  clone->size<loco::DataType::FLOAT32>(size);
+  for (uint32_t i = 0; i < size; ++i)
+    clone->at<loco::DataType::FLOAT32>(i) = node->at<loco::DataType::FLOAT32>(i);
+
+  clone->name(node->name());
+  clone->shape_status(luci::ShapeStatus::VALID);
+
+  return clone;
+}
+
+/**
+ * @brief  Fold 'terminal' (Mul or Add of 'param') into 'conv'
+ *
+ *         [conv] -- [terminal(param)]   =>   [conv with folded filter/bias]
+ */
+bool fuse_with_conv(luci::CircleNode *terminal, loco::Node *conv_node, luci::CircleConst *param,
+                    bool is_mul)
+{
+  auto conv = dynamic_cast<luci::CircleNode *>(conv_node);
+  auto conv2d = dynamic_cast<luci::CircleConv2D *>(conv_node);
+  auto dwconv = dynamic_cast<luci::CircleDepthwiseConv2D *>(conv_node);
+  if (conv2d == nullptr && dwconv == nullptr)
+    return false;
+
+  auto fusable = dynamic_cast<FusableNode *>(conv_node);
+  auto bias_node = dynamic_cast<luci::LuciNodeMixin<luci::LuciNodeTrait::Bias> *>(conv_node);
+  assert(fusable != nullptr && bias_node != nullptr);
+
+  if (fusable->fusedActivationFunction() != luci::FusedActFunc::NONE)
+    return false;
+
+  // Convolution is updated in place, so its output should not be used by others
+  if (loco::succs(conv).size() != 1)
+    return false;
+
+  if (conv->quantparam() != nullptr || terminal->quantparam() != nullptr)
+    return false;
+
+  auto filter = dynamic_cast<luci::CircleConst *>(conv2d ? conv2d->filter() : dwconv->filter());
+  auto bias = dynamic_cast<luci::CircleConst *>(bias_node->bias());
+  if (filter == nullptr || bias == nullptr)
+    return false;
+  // Values of sparse constants are compressed, and cannot be scaled channel by channel
+  if (filter->sparsityparam() != nullptr || bias->sparsityparam() != nullptr)
+    return false;
+  if (filter->dtype() != loco::DataType::FLOAT32 || bias->dtype() != loco::DataType::FLOAT32)
+    return false;
+  if (filter->rank() != 4)
+    return false;
+
+  // Filter is OHWI for Conv2D and 1HW(I*M) for DepthwiseConv2D
+  const uint32_t depth = conv2d ? filter->dim(0).value() : filter->dim(3).value();
+  if (bias->size<loco::DataType::FLOAT32>() != depth)
+    return false;
+
+  std::vector<float> values;
+  if (!read_channel_values(param, depth, values))
+    return false;
+
+  auto new_bias = clone_const(bias);
+  for (uint32_t c = 0; c < depth; ++c)
+  {
+    auto &b = new_bias->at<loco::DataType::FLOAT32>(c);
+    b = is_mul ? b * values[c] : b + values[c];
+  }
+  bias_node->bias(new_bias);
+
+  if (is_mul)
+  {
+    auto new_filter = clone_const(filter);
+    const auto size = new_filter->size<loco::DataType::FLOAT32>();
+    const auto block = size / depth;
+    for (uint32_t i = 0; i < size; ++i)
+    {
+      const uint32_t c = conv2d ? i / block : i % depth;
+      new_filter->at<loco::DataType::FLOAT32>(i) *= values[c];
+    }
+    if (conv2d)
+      conv2d->filter(new_filter);
+    else
+      dwconv->filter(new_filter);
+  }
+
+  fusable->fusedActivationFunction(
+      dynamic_cast<FusableNode *>(terminal)->fusedActivationFunction());
+  loco::replace(terminal).with(conv);
+
+  return true;
+}
+
+template <class BINARY> bool fuse_binary_with_conv(BINARY *node, bool is_mul)
+{
+  bool fused = false;
+
+  if (auto param = dynamic_cast<luci::CircleConst *>(node->y()))
+    fused = fuse_with_conv(node, node->x(), param, is_mul);
+  else if (auto param = dynamic_cast<luci::CircleConst *>(node->x()))
+    fused = fuse_with_conv(node, node->y(), param, is_mul);
+
+  if (fused)
+  {
+    // Detach dead node so that the convolution can be fused again with the next one
+    node->x(nullptr);
+    node->y(nullptr);
+  }
+
+  return fused;
+}
+
+} // namespace
+
+namespace luci
+{
+
+bool FuseBatchNormWithConvPass::apply(loco::Node *node)
+{
+  if (auto mul = dynamic_cast<luci::CircleMul *>(node))
+    return fuse_binary_with_conv(mul, true);
+
+  if (auto add = dynamic_cast<luci::CircleAdd *>(node))
+    return fuse_binary_with_conv(add, false);
+
+  return false;
+}
+
+} // namespace luci
@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/Pass/FuseBatchNormWithConvPass.h"
+
+#include <luci/IR/CircleNodes.h>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+
+luci::CircleConst *create_const(loco::Graph *g, const std::vector<uint32_t> &shape,
+                                const std::vector<float> &values)
+{
+  auto node = g->nodes()->create<luci::CircleConst>();
+  node->dtype(loco::DataType::FLOAT32);
+  node->rank(shape.size());
+  for (uint32_t i = 0; i < shape.size(); ++i)
+    node->dim(i) = shape[i];
+  node->size<loco::DataType::FLOAT32>(values.size());
+  for (uint32_t i = 0; i < values.size(); ++i)
+    node->at<loco::DataType::FLOAT32>(i) = values[i];
+  return node;
+}
+
+/**
+ *  [Input] -- [Conv2D] -- [Mul(scale)] -- [Add(shift)] -- [Output]
+ */
+class ConvBatchNormGraph
+{
+public:
+  ConvBatchNormGraph()
+  {
+    input = g->nodes()->create<luci::CircleInput>();
+    conv = g->nodes()->create<luci::CircleConv2D>();
+    mul = g->nodes()->create<luci::CircleMul>();
+    add = g->nodes()->create<luci::CircleAdd>();
+    output = g->nodes()->create<luci::CircleOutput>();
+
+    // 2 output channels, 1x1 kernel, 2 input channels
+    filter = create_const(g.get(), {2, 1, 1, 2}, {1.0f, 2.0f, 3.0f, 4.0f});
+    bias = create_const(g.get(), {2}, {0.5f, -0.5f});
+    scale = create_const(g.get(), {1, 1, 1, 2}, {2.0f, 10.0f});
+    shift = create_const(g.get(), {2}, {1.0f, 1.0f});
+
+    conv->input(input);
+    conv->filter(filter);
+    conv->bias(bias);
+    conv->padding(luci::Padding::VALID);
+    conv->fusedActivationFunction(luci::FusedActFunc::NONE);
+    mul->x(conv);
+    mul->y(scale);
+    mul->fusedActivationFunction(luci::FusedActFunc::NONE);
+    add->x(mul);
+    add->y(shift);
+    add->fusedActivationFunction(luci::FusedActFunc::RELU6);
+    output->from(add);
+
+    auto graph_output = g->outputs()->create();
+    output->index(graph_output->index());
+  }
+
+public:
+  std::unique_ptr<loco::Graph> g = loco::make_graph();
+  luci::CircleInput *input = nullptr;
+  luci::CircleConv2D *conv = nullptr;
+  luci::CircleMul *mul = nullptr;
+  luci::CircleAdd *add = nullptr;
+  luci::CircleOutput *output = nullptr;
+  luci::CircleConst *filter = nullptr;
+  luci::CircleConst *bias = nullptr;
+  luci::CircleConst *scale = nullptr;
+  luci::CircleConst *shift = nullptr;
+};
+
+} // namespace
+
+TEST(FuseBatchNormWithConvPass, fold_mul_add)
+{
+  ConvBatchNormGraph graph;
+  luci::FuseBatchNormWithConvPass pass;
+
+  ASSERT_TRUE(pass.apply(graph.mul));
+  ASSERT_TRUE(pass.apply(graph.add));
+
+  ASSERT_EQ(graph.output->from(), graph.conv);
+  ASSERT_EQ(graph.conv->fusedActivationFunction(), luci::FusedActFunc::RELU6);
+
+  auto filter = dynamic_cast<luci::CircleConst *>(graph.conv->filter());
+  auto bias = dynamic_cast<luci::CircleConst *>(graph.conv->bias());
+  ASSERT_NE(filter, nullptr);
+  ASSERT_NE(bias, nullptr);
+  EXPECT_FLOAT_EQ(filter->at<loco::DataType::FLOAT32>(0), 2.0f);
+  EXPECT_FLOAT_EQ(filter->at<loco::DataType::FLOAT32>(1), 4.0f);
+  EXPECT_FLOAT_EQ(filter->at<loco::DataType::FLOAT32>(2), 30.0f);
+  EXPECT_FLOAT_EQ(filter->at<loco::DataType::FLOAT32>(3), 40.0f);
+  EXPECT_FLOAT_EQ(bias->at<loco::DataType::FLOAT32>(0), 2.0f);
+  EXPECT_FLOAT_EQ(bias->at<loco::DataType::FLOAT32>(1), -4.0f);
+
+  // Original constants are kept as they may be shared
+  EXPECT_FLOAT_EQ(graph.filter->at<loco::DataType::FLOAT32>(0), 1.0f);
+}
+
+TEST(FuseBatchNormWithConvPass, conv_with_activation_NEG)
+{
+  ConvBatchNormGraph graph;
+  graph.conv->fusedActivationFunction(luci::FusedActFunc::RELU);
+  luci::FuseBatchNormWithConvPass pass;
+
+  ASSERT_FALSE(pass.apply(graph.mul));
+  ASSERT_EQ(graph.add->x(), graph.mul);
+}
+
+TEST(FuseBatchNormWithConvPass, run_over_graph)
+{
+  ConvBatchNormGraph graph;
+  luci::FuseBatchNormWithConvPass pass;
+
+  while (pass.run(graph.g.get()))
+    ;
+
+  ASSERT_EQ(graph.output->from(), graph.conv);
+}
+
+TEST(FuseBatchNormWithConvPass, sparse_filter_NEG)
+{
+  ConvBatchNormGraph graph;
+  // Values of a sparse filter are compressed, so they are not scaled channel by channel
+  graph.filter->sparsityparam(std::make_unique<luci::SparsityParam>());
+  luci::FuseBatchNormWithConvPass pass;
+
+  ASSERT_FALSE(pass.apply(graph.mul));
+  ASSERT_EQ(graph.add->x(), graph.mul);
+}
@@ -119,6 +119,9 @@ bool NodeFiller<ARG_TYPE_1, ARG_TYPE_2>::with_commutative_args_of(const COMM_NOD
 /// @return true  When node has shape of '1 x .. x 1 x depth'
 bool is_1D_with_dummy_dim(luci::CircleConst *node, uint32_t depth)
 {
+  // Values of a sparse constant do not match its shape
+  if (node->sparsityparam() != nullptr)
+    return false;
   auto rank = node->rank();
   uint32_t axis;
   for (axis = 0; axis < rank - 1; ++axis)
@@ -132,6 +135,9 @@ bool is_1D_with_dummy_dim(luci::CircleConst *node, uint32_t depth)
 /// @return true if node shape consists of ones, except the one before the last dim: 1,...1,depth,1
 bool is_quasi_1D_with_dummy_dim(luci::CircleConst *node, uint32_t depth)
 {
+  // Values of a sparse constant do not match its shape
+  if (node->sparsityparam() != nullptr)
+    return false;
   auto rank = node->rank();
   // minimal accepted shape is [1 x depth x 1]
   if (rank < 3)
@@ -164,7 +170,7 @@ bool is_instance_mean_v0(luci::CircleMean *mean)
   // TODO Support non-Const case?
   // TODO What if input is NCHW format in Circle?
   auto red_indices = dynamic_cast<luci::CircleConst *>(mean->reduction_indices());
-  if (not red_indices)
+  if (not red_indices || red_indices->sparsityparam() != nullptr)
     return false;
   if (red_indices->rank() != 1)
     return false;
@@ -209,7 +215,7 @@ bool is_instance_mean_v1(luci::CircleMean *mean)
   // TODO Support non-Const case?
   // TODO What if input is NCHW format in Circle?
   auto red_indices = dynamic_cast<luci::CircleConst *>(mean->reduction_indices());
-  if (not red_indices)
+  if (not red_indices || red_indices->sparsityparam() != nullptr)
     return false;
   if (red_indices->rank() != 1)
     return false;
@@ -423,6 +429,7 @@ bool InstanceNormPattern::matched()
       fill(&mean_as_variance, &const_as_epsilon).with_commutative_args_of(add_as_variance));
 
   CHECK_OR_FALSE(const_as_epsilon->dtype() == loco::DataType::FLOAT32);
+  CHECK_OR_FALSE(const_as_epsilon->sparsityparam() == nullptr);
   // TODO Support regarding broadcast
   CHECK_OR_FALSE(const_as_epsilon->size<loco::DataType::FLOAT32>() == 1);
 
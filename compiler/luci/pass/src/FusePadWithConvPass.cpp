@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/Pass/FusePadWithConvPass.h"
+
+#include <luci/IR/CircleNodes.h>
+
+#include <loco/Service/ShapeInference.h>
+
+#include <algorithm>
+
+namespace
+{
+
+/**
+ * @brief  Return whether 'before' and 'after' padding on an axis of 'input_size' is the same as
+ *         SAME padding of convolution with 'stride' and 'filter_size'
+ */
+bool is_same_padding(int64_t before, int64_t after, int64_t input_size, int64_t filter_size,
+                     int64_t stride, int64_t dilation)
+{
+  const int64_t effective_filter_size = (filter_size - 1) * dilation + 1;
+  const int64_t output_size = (input_size + stride - 1) / stride;
+  const int64_t total = std::max<int64_t>(
+      (output_size - 1) * stride + effective_filter_size - input_size, 0);
+
+  return before == total / 2 && after == total - total / 2;
+}
+
+int64_t pad_value(luci::CircleConst *paddings, uint32_t n)
+{
+  if (paddings->dtype() == loco::DataType::S32)
+    return paddings->at<loco::DataType::S32>(n);
+  return paddings->at<loco::DataType::S64>(n);
+}
+
+template <class CONV> bool fuse_pad(CONV *conv)
+{
+  auto pad = dynamic_cast<luci::CirclePad *>(conv->input());
+  if (pad == nullptr || conv->padding() != luci::Padding::VALID)
+    return false;
+
+  if (loco::succs(pad).size() != 1)
+    return false;
+
+  auto paddings = dynamic_cast<luci::CircleConst *>(pad->paddings());
+  if (paddings == nullptr || paddings->sparsityparam() != nullptr)
+    return false;
+  if (paddings->dtype() != loco::DataType::S32 && paddings->dtype() != loco::DataType::S64)
+    return false;
+  if (paddings->rank() != 2 || paddings->dim(0).value() != 4 || paddings->dim(1).value() != 2)
+    return false;
+
+  // Only height and width (NHWC) can be padded
+  if (pad_value(paddings, 0) != 0 || pad_value(paddings, 1) != 0 ||
+      pad_value(paddings, 6) != 0 || pad_value(paddings, 7) != 0)
+    return false;
+
+  auto filter = dynamic_cast<luci::CircleNode *>(conv->filter());
+  if (filter == nullptr || filter->rank() != 4)
+    return false;
+
+  if (not loco::shape_known(pad->input()))
+    return false;
+  auto input_shape = loco::shape_get(pad->input()).template as<loco::TensorShape>();
+  if (input_shape.rank() != 4)
+    return false;
+
+  // Filter is OHWI for Conv2D and 1HWC for DepthwiseConv2D
+  if (!is_same_padding(pad_value(paddings, 2), pad_value(paddings, 3),
+                       input_shape.dim(1).value(), filter->dim(1).value(), conv->stride()->h(),
+                       conv->dilation()->h()))
+    return false;
+  if (!is_same_padding(pad_value(paddings, 4), pad_value(paddings, 5),
+                       input_shape.dim(2).value(), filter->dim(2).value(), conv->stride()->w(),
+                       conv->dilation()->w()))
+    return false;
+
+  conv->input(pad->input());
+  conv->padding(luci::Padding::SAME);
+
+  return true;
+}
+
+} // namespace
+
+namespace luci
+{
+
+bool FusePadWithConvPass::apply(loco::Node *node)
+{
+  if (auto conv2d = dynamic_cast<luci::CircleConv2D *>(node))
+    return fuse_pad(conv2d);
+
+  if (auto dwconv = dynamic_cast<luci::CircleDepthwiseConv2D *>(node))
+    return fuse_pad(dwconv);
+
+  return false;
+}
+
+} // namespace luci
@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/Pass/FusePadWithConvPass.h"
+#include "luci/Pass/ShapeInferencePass.h"
+
+#include <luci/IR/CircleNodes.h>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+
+luci::CircleConst *create_paddings(loco::Graph *g, const std::vector<int32_t> &values)
+{
+  auto node = g->nodes()->create<luci::CircleConst>();
+  node->dtype(loco::DataType::S32);
+  node->rank(2);
+  node->dim(0) = 4;
+  node->dim(1) = 2;
+  node->size<loco::DataType::S32>(values.size());
+  for (uint32_t i = 0; i < values.size(); ++i)
+    node->at<loco::DataType::S32>(i) = values[i];
+  return node;
+}
+
+/**
+ *  [Input] -- [Pad] -- [Conv2D(3x3, VALID)] -- [Output]
+ */
+class PadConvGraph
+{
+public:
+  PadConvGraph(const std::vector<int32_t> &pad_values)
+  {
+    input = g->nodes()->create<luci::CircleInput>();
+    pad = g->nodes()->create<luci::CirclePad>();
+    conv = g->nodes()->create<luci::CircleConv2D>();
+    output = g->nodes()->create<luci::CircleOutput>();
+
+    auto graph_input = g->inputs()->create();
+    input->index(graph_input->index());
+    input->dtype(loco::DataType::FLOAT32);
+    input->shape({1, 4, 4, 1});
+
+    filter = g->nodes()->create<luci::CircleConst>();
+    filter->dtype(loco::DataType::FLOAT32);
+    filter->shape({1, 3, 3, 1});
+    filter->size<loco::DataType::FLOAT32>(9);
+
+    bias = g->nodes()->create<luci::CircleConst>();
+    bias->dtype(loco::DataType::FLOAT32);
+    bias->shape({1});
+    bias->size<loco::DataType::FLOAT32>(1);
+
+    pad->input(input);
+    pad->paddings(create_paddings(g.get(), pad_values));
+    conv->input(pad);
+    conv->filter(filter);
+    conv->bias(bias);
+    conv->padding(luci::Padding::VALID);
+    conv->fusedActivationFunction(luci::FusedActFunc::NONE);
+    output->from(conv);
+
+    auto graph_output = g->outputs()->create();
+    output->index(graph_output->index());
+    graph_output->dtype(loco::DataType::FLOAT32);
+    graph_output->shape({1, 4, 4, 1});
+  }
+
+public:
+  std::unique_ptr<loco::Graph> g = loco::make_graph();
+  luci::CircleInput *input = nullptr;
+  luci::CirclePad *pad = nullptr;
+  luci::CircleConv2D *conv = nullptr;
+  luci::CircleConst *filter = nullptr;
+  luci::CircleConst *bias = nullptr;
+  luci::CircleOutput *output = nullptr;
+};
+
+} // namespace
+
+TEST(FusePadWithConvPass, fuse_same_padding)
+{
+  PadConvGraph graph({0, 0, 1, 1, 1, 1, 0, 0});
+  luci::ShapeInferencePass().run(graph.g.get());
+  luci::FusePadWithConvPass pass;
+
+  ASSERT_TRUE(pass.apply(graph.conv));
+
+  ASSERT_EQ(graph.conv->input(), graph.input);
+  ASSERT_EQ(graph.conv->padding(), luci::Padding::SAME);
+}
+
+TEST(FusePadWithConvPass, pad_batch_NEG)
+{
+  PadConvGraph graph({1, 0, 1, 1, 1, 1, 0, 0});
+  luci::ShapeInferencePass().run(graph.g.get());
+  luci::FusePadWithConvPass pass;
+
+  ASSERT_FALSE(pass.apply(graph.conv));
+  ASSERT_EQ(graph.conv->input(), graph.pad);
+  ASSERT_EQ(graph.conv->padding(), luci::Padding::VALID);
+}
+
+TEST(FusePadWithConvPass, not_same_padding_NEG)
+{
+  PadConvGraph graph({0, 0, 2, 0, 1, 1, 0, 0});
+  luci::ShapeInferencePass().run(graph.g.get());
+  luci::FusePadWithConvPass pass;
+
+  ASSERT_FALSE(pass.apply(graph.conv));
+  ASSERT_EQ(graph.conv->input(), graph.pad);
+}
+
+TEST(FusePadWithConvPass, conv_same_padding_NEG)
+{
+  PadConvGraph graph({0, 0, 1, 1, 1, 1, 0, 0});
+  graph.conv->padding(luci::Padding::SAME);
+  luci::ShapeInferencePass().run(graph.g.get());
+  luci::FusePadWithConvPass pass;
+
+  ASSERT_FALSE(pass.apply(graph.conv));
+  ASSERT_EQ(graph.conv->input(), graph.pad);
+}
+
+TEST(FusePadWithConvPass, unknown_shape_NEG)
+{
+  PadConvGraph graph({0, 0, 1, 1, 1, 1, 0, 0});
+  luci::FusePadWithConvPass pass;
+
+  ASSERT_FALSE(pass.apply(graph.conv));
+  ASSERT_EQ(graph.conv->input(), graph.pad);
+}
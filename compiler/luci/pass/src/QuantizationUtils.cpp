@@ -18,8 +18,11 @@
 
 #include <luci/Log.h>
 
+#include <algorithm>
+#include <atomic>
 #include <iostream>
 #include <cmath>
+#include <thread>
 
 namespace luci
 {
@@ -183,4 +186,84 @@ uint32_t cal_offset(loco::TensorShape &dimension, uint32_t *indices)
          indices[2] * dimension.dim(3).value() + indices[3];
 }
 
+ChannelLayout get_channel_layout(loco::TensorShape &dimension, int channel_dim_index)
+{
+  ChannelLayout layout;
+  for (int i = 0; i < 4; ++i)
+  {
+    if (i < channel_dim_index)
+      layout.outer *= dimension.dim(i).value();
+    else if (i == channel_dim_index)
+      layout.channel = dimension.dim(i).value();
+    else
+      layout.inner *= dimension.dim(i).value();
+  }
+  return layout;
+}
+
+void split_work(std::vector<WorkRange> &ranges, uint32_t weight, uint32_t units,
+                uint32_t unit_size)
+{
+  // Each range has about this many elements, which amortizes scheduling
+  const uint32_t grain = 64 * 1024;
+  const uint32_t units_per_range = std::max<uint32_t>(1, grain / std::max<uint32_t>(1, unit_size));
+
+  for (uint32_t begin = 0; begin < units; begin += units_per_range)
+  {
+    ranges.push_back({weight, begin, std::min(units, begin + units_per_range)});
+  }
+}
+
+void parallel_for(const std::vector<WorkRange> &ranges, uint32_t num_threads,
+                  const std::function<void(const WorkRange &)> &func)
+{
+  if (num_threads == 0)
+    num_threads = std::thread::hardware_concurrency();
+  num_threads = std::max<uint32_t>(1, std::min<uint32_t>(num_threads, ranges.size()));
+
+  // Ranges are taken one by one, as weights may differ much in size
+  std::atomic<uint32_t> next{0};
+  auto worker = [&]() {
+    for (uint32_t n = next++; n < ranges.size(); n = next++)
+      func(ranges[n]);
+  };
+
+  // The calling thread is one of the workers
+  std::vector<std::thread> threads;
+  for (uint32_t t = 1; t < num_threads; ++t)
+    threads.emplace_back(worker);
+  worker();
+
+  for (auto &thread : threads)
+    thread.join();
+}
+
+loco::DataType LayerPrecision::of(const CircleNode *node) const
+{
+  auto it = _nodes.find(node);
+  if (it != _nodes.end())
+    return it->second;
+
+  switch (node->opcode())
+  {
+    case CircleOpcode::CIRCLECUSTOMOUT:
+    case CircleOpcode::CIRCLEIFOUT:
+    case CircleOpcode::CIRCLESPLITOUT:
+    case CircleOpcode::CIRCLESPLITVOUT:
+    case CircleOpcode::CIRCLETOPKV2OUT:
+    case CircleOpcode::CIRCLEUNIQUEOUT:
+    case CircleOpcode::CIRCLEUNPACKOUT:
+    case CircleOpcode::CIRCLEWHILEOUT:
+      return of(loco::must_cast<const CircleNode *>(node->arg(0)));
+    default:
+      break;
+  }
+
+  auto layer = _plan.find(node->name());
+  if (layer != _plan.end())
+    return layer->second;
+
+  return _default_dtype;
+}
+
 } // namespace luci
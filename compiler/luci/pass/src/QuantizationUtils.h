@@ -17,9 +17,14 @@
 #ifndef __LUCI_QUANTIZATION_UTILS_H__
 #define __LUCI_QUANTIZATION_UTILS_H__
 
+#include <luci/Pass/QuantizationParameters.h>
 #include <luci/IR/CircleNodes.h>
 #include <loco/IR/TensorShape.h>
 
+#include <functional>
+#include <map>
+#include <vector>
+
 namespace luci
 {
 
@@ -33,6 +38,72 @@ bool get_channel_dim_index(CircleConst *node, loco::TensorShape &dimension, int
 
 uint32_t cal_offset(loco::TensorShape &dimension, uint32_t *indices);
 
+/**
+ * @brief Weight seen as [outer][channel][inner] around its channel dimension
+ *
+ * Elements of a channel are visited in the same order as the loop over "dimension".
+ */
+struct ChannelLayout
+{
+  uint32_t outer = 1;
+  uint32_t channel = 1;
+  uint32_t inner = 1;
+};
+
+ChannelLayout get_channel_layout(loco::TensorShape &dimension, int channel_dim_index);
+
+/**
+ * @brief Range of work units (channels or elements) of a weight
+ */
+struct WorkRange
+{
+  uint32_t weight;
+  uint32_t begin;
+  uint32_t end;
+};
+
+/**
+ * @brief Split [0, units) of a weight into ranges of similar number of elements
+ *
+ * Small weights become a single range, so they run in parallel with other weights.
+ */
+void split_work(std::vector<WorkRange> &ranges, uint32_t weight, uint32_t units,
+                uint32_t unit_size);
+
+/**
+ * @brief Run func for every range on num_threads threads, or on all the cores if it is 0
+ *
+ * func SHOULD only write elements and statistics owned by a given range.
+ */
+void parallel_for(const std::vector<WorkRange> &ranges, uint32_t num_threads,
+                  const std::function<void(const WorkRange &)> &func);
+
+/**
+ * @brief Quantized type of each node, decided by a LayerPrecisionMap
+ *
+ * Virtual outputs of a multi-output layer (e.g. CircleSplitOut) follow the layer.
+ */
+class LayerPrecision
+{
+public:
+  LayerPrecision(const LayerPrecisionMap &plan, loco::DataType default_dtype)
+      : _plan(plan), _default_dtype(default_dtype)
+  {
+    // DO NOTHING
+  }
+
+public:
+  loco::DataType of(const CircleNode *node) const;
+
+  // Set the type of a node which is not in the plan (e.g. a node inserted by a pass)
+  void set(const CircleNode *node, loco::DataType dtype) { _nodes[node] = dtype; }
+
+private:
+  const LayerPrecisionMap &_plan;
+  const loco::DataType _default_dtype;
+  std::map<const CircleNode *, loco::DataType> _nodes;
+};
+
 } // namespace luci
 
 #endif // __LUCI_QUANTIZATION_UTILS_H__
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "QuantizationUtils.h"
+
+#include <gtest/gtest.h>
+
+TEST(QuantizationUtilsTest, channel_layout)
+{
+  loco::TensorShape dimension;
+  dimension.rank(4);
+  dimension.dim(0) = 2;
+  dimension.dim(1) = 3;
+  dimension.dim(2) = 4;
+  dimension.dim(3) = 5;
+
+  auto ohwi = luci::get_channel_layout(dimension, 0);
+  ASSERT_EQ(1, ohwi.outer);
+  ASSERT_EQ(2, ohwi.channel);
+  ASSERT_EQ(60, ohwi.inner);
+
+  auto ihwc = luci::get_channel_layout(dimension, 3);
+  ASSERT_EQ(24, ihwc.outer);
+  ASSERT_EQ(5, ihwc.channel);
+  ASSERT_EQ(1, ihwc.inner);
+}
+
+TEST(QuantizationUtilsTest, split_work)
+{
+  std::vector<luci::WorkRange> ranges;
+
+  // Small weights are not split
+  luci::split_work(ranges, 0, 16, 9);
+  ASSERT_EQ(1, ranges.size());
+  ASSERT_EQ(0, ranges.at(0).begin);
+  ASSERT_EQ(16, ranges.at(0).end);
+
+  // Large weights are split into contiguous ranges
+  luci::split_work(ranges, 1, 1000, 1024);
+  ASSERT_LT(2, ranges.size());
+  uint32_t next = 0;
+  for (uint32_t n = 1; n < ranges.size(); ++n)
+  {
+    ASSERT_EQ(1, ranges.at(n).weight);
+    ASSERT_EQ(next, ranges.at(n).begin);
+    next = ranges.at(n).end;
+  }
+  ASSERT_EQ(1000, next);
+
+  // Empty weights have no range
+  auto num_ranges = ranges.size();
+  luci::split_work(ranges, 2, 0, 1);
+  ASSERT_EQ(num_ranges, ranges.size());
+}
+
+TEST(QuantizationUtilsTest, parallel_for)
+{
+  std::vector<luci::WorkRange> ranges;
+  luci::split_work(ranges, 0, 1000000, 1);
+  luci::split_work(ranges, 1, 10, 1);
+
+  // 0 is the number of cores
+  for (uint32_t num_threads : {0, 1, 3})
+  {
+    std::vector<std::vector<int>> visits{std::vector<int>(1000000, 0), std::vector<int>(10, 0)};
+    luci::parallel_for(ranges, num_threads, [&](const luci::WorkRange &r) {
+      for (uint32_t i = r.begin; i < r.end; ++i)
+        visits[r.weight][i] += 1;
+    });
+
+    for (const auto &v : visits)
+      for (auto count : v)
+        ASSERT_EQ(1, count);
+  }
+}
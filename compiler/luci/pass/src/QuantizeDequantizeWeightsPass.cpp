@@ -22,8 +22,11 @@
 #include <luci/Log.h>
 #include <loco/IR/TensorShape.h>
 
+#include <algorithm>
 #include <iostream>
 #include <cmath>
+#include <limits>
+#include <set>
 
 namespace luci
 {
@@ -31,305 +34,306 @@ namespace luci
 namespace
 {
 
-void cal_minmax_per_channel(CircleConst *node, std::vector<float> &min, std::vector<float> &max)
+
+/**
+ * @brief Per-channel quantization parameters of a weight
+ */
+struct ChannelWiseParam
+{
+  bool valid = false;
+  loco::DataType dtype = loco::DataType::U8;
+  ChannelLayout layout;
+  std::vector<float> min;
+  std::vector<float> max;
+  std::vector<float> scaling_factor;
+  std::vector<int64_t> zp;
+  std::vector<float> nudged_min;
+  std::vector<float> nudged_max;
+};
+
+/**
+ * @brief Per-layer quantization parameters of a weight
+ */
+struct LayerWiseParam
+{
+  float min = std::numeric_limits<float>::max();
+  float max = std::numeric_limits<float>::lowest();
+  float scaling_factor = 0;
+  int64_t zp = 0;
+  float nudged_min = 0;
+  float nudged_max = 0;
+};
+
+// Find min/max of channels in [begin, end)
+void cal_minmax_per_channel(CircleConst *node, ChannelWiseParam &param, uint32_t begin,
+                            uint32_t end)
 {
-  loco::TensorShape dimension;
-  dimension.rank(4);
-  uint32_t indices[4] = {
-      0,
-  };
-  int channel_dim_index{0};
-  int size{0};
-
-  if (!get_channel_dim_index(node, dimension, channel_dim_index))
+  const auto &layout = param.layout;
+  const float *data = &node->at<loco::DataType::FLOAT32>(0);
+
+  for (uint32_t c = begin; c < end; ++c)
   {
-    assert(false);
-    return;
+    param.min[c] = data[c * layout.inner];
+    param.max[c] = data[c * layout.inner];
   }
-  size = dimension.dim(channel_dim_index).value();
 
-  std::vector<bool> has_min_max_value(size, false);
-  min.resize(size);
-  max.resize(size);
-  for (indices[0] = 0; indices[0] < dimension.dim(0).value(); indices[0]++)
+  for (uint32_t o = 0; o < layout.outer; ++o)
   {
-    for (indices[1] = 0; indices[1] < dimension.dim(1).value(); indices[1]++)
+    for (uint32_t c = begin; c < end; ++c)
     {
-      for (indices[2] = 0; indices[2] < dimension.dim(2).value(); indices[2]++)
+      const float *channel = data + (o * layout.channel + c) * layout.inner;
+      float min = param.min[c];
+      float max = param.max[c];
+      for (uint32_t i = 0; i < layout.inner; ++i)
       {
-        for (indices[3] = 0; indices[3] < dimension.dim(3).value(); indices[3]++)
-        {
-          int channel_idx = indices[channel_dim_index];
-          auto data = node->at<loco::DataType::FLOAT32>(cal_offset(dimension, indices));
-          if (has_min_max_value[channel_idx])
-          {
-            min[channel_idx] = data < min[channel_idx] ? data : min[channel_idx];
-            max[channel_idx] = data > max[channel_idx] ? data : max[channel_idx];
-          }
-          else
-          {
-            min[channel_idx] = data;
-            max[channel_idx] = data;
-            has_min_max_value[channel_idx] = true;
-          }
-        }
+        min = channel[i] < min ? channel[i] : min;
+        max = channel[i] > max ? channel[i] : max;
       }
+      param.min[c] = min;
+      param.max[c] = max;
     }
   }
 }
 
-void sym_wquant_per_channel(CircleConst *node, std::vector<float> &min, std::vector<float> &max,
-                            std::vector<float> &scaling_factor, std::vector<int64_t> &zp,
-                            std::vector<float> &nudged_min, std::vector<float> &nudged_max)
+// Quantize channels in [begin, end) to int16 and dequantize them back in place
+void sym_wquant_dequant_per_channel(CircleConst *node, const ChannelWiseParam &param,
+                                    uint32_t begin, uint32_t end)
 {
-  assert(node->dtype() == loco::DataType::FLOAT32);
   const int32_t kMaxScale = std::numeric_limits<int16_t>::max();
   const int32_t kMinScale = -kMaxScale;
 
-  uint32_t size = node->size<loco::DataType::FLOAT32>();
-  std::vector<int32_t> quantized_values(size);
-
-  for (size_t i = 0; i < min.size(); ++i)
-  {
-    compute_sym_scale_zp(min[i], max[i], scaling_factor[i], zp[i], nudged_min[i], nudged_max[i]);
-  }
-
-  loco::TensorShape dimension;
-  dimension.rank(4);
-  uint32_t indices[4] = {
-      0,
-  };
-  int channel_dim_index{0};
+  const auto &layout = param.layout;
+  float *data = &node->at<loco::DataType::FLOAT32>(0);
 
-  if (!get_channel_dim_index(node, dimension, channel_dim_index))
+  for (uint32_t o = 0; o < layout.outer; ++o)
   {
-    assert(false);
-    return;
-  }
-
-  for (indices[0] = 0; indices[0] < dimension.dim(0).value(); indices[0]++)
-  {
-    for (indices[1] = 0; indices[1] < dimension.dim(1).value(); indices[1]++)
+    for (uint32_t c = begin; c < end; ++c)
     {
-      for (indices[2] = 0; indices[2] < dimension.dim(2).value(); indices[2]++)
+      const float scaling_factor = param.scaling_factor[c];
+      const float scaling_factor_inv = 1.0 / scaling_factor;
+      const float nudged_min = param.nudged_min[c];
+      const float nudged_max = param.nudged_max[c];
+
+      float *channel = data + (o * layout.channel + c) * layout.inner;
+      for (uint32_t i = 0; i < layout.inner; ++i)
       {
-        for (indices[3] = 0; indices[3] < dimension.dim(3).value(); indices[3]++)
-        {
-          int channel_idx = indices[channel_dim_index];
-          const float scaling_factor_inv = 1.0 / scaling_factor[channel_idx];
-          auto data = node->at<loco::DataType::FLOAT32>(cal_offset(dimension, indices));
-          data = data < nudged_min[channel_idx] ? nudged_min[channel_idx] : data;
-          data = data > nudged_max[channel_idx] ? nudged_max[channel_idx] : data;
-          quantized_values[cal_offset(dimension, indices)] =
-              static_cast<int32_t>(std::round(data * scaling_factor_inv));
-        }
+        auto value = channel[i];
+        value = value < nudged_min ? nudged_min : value;
+        value = value > nudged_max ? nudged_max : value;
+        auto quantized = static_cast<int32_t>(std::round(value * scaling_factor_inv));
+        int16_t clamped = std::min(kMaxScale, std::max(kMinScale, quantized));
+        channel[i] = static_cast<float>(clamped) * scaling_factor;
       }
     }
   }
-
-  node->dtype(loco::DataType::S16);      // change the type of tensor
-  node->size<loco::DataType::S16>(size); // resize tensor
-  for (uint32_t i = 0; i < size; ++i)
-  {
-    node->at<loco::DataType::S16>(i) =
-        std::min(kMaxScale, std::max(kMinScale, quantized_values[i]));
-  }
 }
 
-void sym_wdequant_per_channel(CircleConst *node, std::vector<float> &scaling_factor)
+// Quantize channels in [begin, end) to uint8 and dequantize them back in place
+void asymmetric_wquant_dequant_per_channel(CircleConst *node, const ChannelWiseParam &param,
+                                           uint32_t begin, uint32_t end)
 {
-  assert(node->dtype() == loco::DataType::S16);
-  uint32_t size = node->size<loco::DataType::S16>();
-  std::vector<float> dequantized_values(size);
-
-  loco::TensorShape dimension;
-  dimension.rank(4);
-  uint32_t indices[4] = {
-      0,
-  };
-  int channel_dim_index{0};
-
-  if (!get_channel_dim_index(node, dimension, channel_dim_index))
-  {
-    assert(false);
-    return;
-  }
+  const int32_t kMinScale = 0;
+  const int32_t kMaxScale = 255;
+
+  const auto &layout = param.layout;
+  float *data = &node->at<loco::DataType::FLOAT32>(0);
 
-  for (indices[0] = 0; indices[0] < dimension.dim(0).value(); indices[0]++)
+  for (uint32_t o = 0; o < layout.outer; ++o)
   {
-    for (indices[1] = 0; indices[1] < dimension.dim(1).value(); indices[1]++)
+    for (uint32_t c = begin; c < end; ++c)
     {
-      for (indices[2] = 0; indices[2] < dimension.dim(2).value(); indices[2]++)
+      const float scaling_factor = param.scaling_factor[c];
+      const float scaling_factor_inv = 1.0 / scaling_factor;
+      const float nudged_min = param.nudged_min[c];
+      const float nudged_max = param.nudged_max[c];
+
+      float *channel = data + (o * layout.channel + c) * layout.inner;
+      for (uint32_t i = 0; i < layout.inner; ++i)
       {
-        for (indices[3] = 0; indices[3] < dimension.dim(3).value(); indices[3]++)
-        {
-          int channel_idx = indices[channel_dim_index];
-          auto data = node->at<loco::DataType::S16>(cal_offset(dimension, indices));
-          dequantized_values[cal_offset(dimension, indices)] =
-              static_cast<float>(data) * scaling_factor[channel_idx];
-        }
+        auto value = channel[i];
+        value = value < nudged_min ? nudged_min : value;
+        value = value > nudged_max ? nudged_max : value;
+        auto quantized =
+            static_cast<int32_t>(std::round((value - nudged_min) * scaling_factor_inv));
+        uint8_t clamped = std::min(kMaxScale, std::max(kMinScale, quantized));
+        channel[i] = static_cast<float>(clamped) * scaling_factor + nudged_min;
       }
     }
   }
+}
 
-  node->dtype(loco::DataType::FLOAT32);      // change the type of tensor
-  node->size<loco::DataType::FLOAT32>(size); // resize tensor
-  for (uint32_t i = 0; i < size; ++i)
+// Find min/max of elements in [begin, end)
+void cal_minmax_per_layer(CircleConst *node, LayerWiseParam &param, uint32_t begin,
+                          uint32_t end)
+{
+  const float *data = &node->at<loco::DataType::FLOAT32>(0);
+
+  float min = param.min;
+  float max = param.max;
+  for (uint32_t i = begin; i < end; ++i)
   {
-    node->at<loco::DataType::FLOAT32>(i) = dequantized_values[i];
+    min = data[i] < min ? data[i] : min;
+    max = data[i] > max ? data[i] : max;
   }
+  param.min = min;
+  param.max = max;
 }
 
-void asymmetric_wquant_per_channel(CircleConst *node, std::vector<float> &min,
-                                   std::vector<float> &max, std::vector<float> &scaling_factor,
-                                   std::vector<int64_t> &zp, std::vector<float> &nudged_min,
-                                   std::vector<float> &nudged_max)
+// Quantize elements in [begin, end) to uint8 and dequantize them back in place
+void asymmetric_wquant_dequant_per_layer(CircleConst *node, const LayerWiseParam &param,
+                                         uint32_t begin, uint32_t end)
 {
-  assert(node->dtype() == loco::DataType::FLOAT32);
-
   const int32_t kMinScale = 0;
   const int32_t kMaxScale = 255;
 
-  uint32_t size = node->size<loco::DataType::FLOAT32>();
-  std::vector<int32_t> quantized_values(size);
+  const float scaling_factor = param.scaling_factor;
+  const float scaling_factor_inv = 1.0 / scaling_factor;
+  const float nudged_min = param.nudged_min;
+  const float nudged_max = param.nudged_max;
 
-  for (size_t i = 0; i < min.size(); ++i)
+  float *data = &node->at<loco::DataType::FLOAT32>(0);
+  for (uint32_t i = begin; i < end; ++i)
   {
-    compute_asym_scale_zp(min[i], max[i], scaling_factor[i], zp[i], nudged_min[i], nudged_max[i]);
+    // clipping
+    auto value = data[i];
+    value = value < nudged_min ? nudged_min : value;
+    value = value > nudged_max ? nudged_max : value;
+    auto quantized = static_cast<int32_t>(std::round((value - nudged_min) * scaling_factor_inv));
+    uint8_t clamped = std::min(kMaxScale, std::max(kMinScale, quantized));
+    data[i] = static_cast<float>(clamped) * scaling_factor + nudged_min;
   }
+}
 
-  loco::TensorShape dimension;
-  dimension.rank(4);
-  uint32_t indices[4] = {
-      0,
-  };
-  int channel_dim_index{0};
+/**
+ * @brief Quantize and dequantize weights channel-wise
+ *
+ * Statistics and values of all the weights are computed in parallel across weights and channels.
+ * Each channel is visited in the same order as before, so results do not depend on the number of
+ * threads.
+ */
+void quant_dequant_per_channel(const std::vector<CircleConst *> &weights,
+                               const std::vector<loco::DataType> &dtypes, uint32_t num_threads)
+{
+  std::vector<ChannelWiseParam> params(weights.size());
+  std::vector<WorkRange> ranges;
 
-  if (!get_channel_dim_index(node, dimension, channel_dim_index))
+  for (uint32_t w = 0; w < weights.size(); ++w)
   {
-    assert(false);
-    return;
-  }
+    auto node = weights[w];
+    assert(node->dtype() == loco::DataType::FLOAT32);
 
-  for (indices[0] = 0; indices[0] < dimension.dim(0).value(); indices[0]++)
-  {
-    for (indices[1] = 0; indices[1] < dimension.dim(1).value(); indices[1]++)
+    loco::TensorShape dimension;
+    dimension.rank(4);
+    int channel_dim_index{0};
+
+    if (!get_channel_dim_index(node, dimension, channel_dim_index))
     {
-      for (indices[2] = 0; indices[2] < dimension.dim(2).value(); indices[2]++)
-      {
-        for (indices[3] = 0; indices[3] < dimension.dim(3).value(); indices[3]++)
-        {
-          int channel_idx = indices[channel_dim_index];
-          const float scaling_factor_inv = 1.0 / scaling_factor[channel_idx];
-          auto data = node->at<loco::DataType::FLOAT32>(cal_offset(dimension, indices));
-          data = data < nudged_min[channel_idx] ? nudged_min[channel_idx] : data;
-          data = data > nudged_max[channel_idx] ? nudged_max[channel_idx] : data;
-          quantized_values[cal_offset(dimension, indices)] = static_cast<int32_t>(
-              std::round((data - nudged_min[channel_idx]) * scaling_factor_inv));
-        }
-      }
+      assert(false);
+      continue;
     }
-  }
 
-  node->dtype(loco::DataType::U8);      // change the type of tensor
-  node->size<loco::DataType::U8>(size); // resize tensor
-  for (uint32_t i = 0; i < size; ++i)
-  {
-    node->at<loco::DataType::U8>(i) = std::min(kMaxScale, std::max(kMinScale, quantized_values[i]));
-  }
-}
+    auto &param = params[w];
+    param.valid = true;
+    param.dtype = dtypes[w];
+    param.layout = get_channel_layout(dimension, channel_dim_index);
 
-void asymmetric_wdequant_per_channel(CircleConst *node, std::vector<float> &scaling_factor,
-                                     std::vector<float> &nudged_min)
-{
-  assert(node->dtype() == loco::DataType::U8);
-  uint32_t size = node->size<loco::DataType::U8>();
-  std::vector<float> dequantized_values(size);
-
-  loco::TensorShape dimension;
-  dimension.rank(4);
-  uint32_t indices[4] = {
-      0,
-  };
-  int channel_dim_index{0};
-
-  if (!get_channel_dim_index(node, dimension, channel_dim_index))
-  {
-    assert(false);
-    return;
+    const auto size = param.layout.channel;
+    param.min.resize(size);
+    param.max.resize(size);
+    param.scaling_factor.resize(size);
+    param.zp.resize(size);
+    param.nudged_min.resize(size);
+    param.nudged_max.resize(size);
+
+    if (node->size<loco::DataType::FLOAT32>() > 0)
+    {
+      split_work(ranges, w, size, param.layout.outer * param.layout.inner);
+    }
   }
 
-  for (indices[0] = 0; indices[0] < dimension.dim(0).value(); indices[0]++)
+  parallel_for(ranges, num_threads, [&](const WorkRange &r) {
+    cal_minmax_per_channel(weights[r.weight], params[r.weight], r.begin, r.end);
+  });
+
+  // NOTE This runs on the calling thread as it may report warnings
+  for (auto &param : params)
   {
-    for (indices[1] = 0; indices[1] < dimension.dim(1).value(); indices[1]++)
+    for (size_t i = 0; i < param.min.size(); ++i)
     {
-      for (indices[2] = 0; indices[2] < dimension.dim(2).value(); indices[2]++)
-      {
-        for (indices[3] = 0; indices[3] < dimension.dim(3).value(); indices[3]++)
-        {
-          int channel_idx = indices[channel_dim_index];
-          auto data = node->at<loco::DataType::U8>(cal_offset(dimension, indices));
-          dequantized_values[cal_offset(dimension, indices)] =
-              static_cast<float>(data) * scaling_factor[channel_idx] + nudged_min[channel_idx];
-        }
-      }
+      if (param.dtype == loco::DataType::U8)
+        compute_asym_scale_zp(param.min[i], param.max[i], param.scaling_factor[i], param.zp[i],
+                              param.nudged_min[i], param.nudged_max[i]);
+      else
+        compute_sym_scale_zp(param.min[i], param.max[i], param.scaling_factor[i], param.zp[i],
+                             param.nudged_min[i], param.nudged_max[i]);
     }
   }
 
-  node->dtype(loco::DataType::FLOAT32);      // change the type of tensor
-  node->size<loco::DataType::FLOAT32>(size); // resize tensor
-  for (uint32_t i = 0; i < size; ++i)
+  parallel_for(ranges, num_threads, [&](const WorkRange &r) {
+    if (params[r.weight].dtype == loco::DataType::U8)
+      asymmetric_wquant_dequant_per_channel(weights[r.weight], params[r.weight], r.begin, r.end);
+    else
+      sym_wquant_dequant_per_channel(weights[r.weight], params[r.weight], r.begin, r.end);
+  });
+
+  for (uint32_t w = 0; w < weights.size(); ++w)
   {
-    node->at<loco::DataType::FLOAT32>(i) = dequantized_values[i];
+    auto &param = params[w];
+    auto quantparam = std::make_unique<CircleQuantParam>();
+    quantparam->min = param.nudged_min;
+    quantparam->max = param.nudged_max;
+    quantparam->scale = param.scaling_factor;
+    quantparam->zerop = param.zp;
+    weights[w]->quantparam(std::move(quantparam));
   }
 }
 
-void asymmetric_wquant_with_minmax_per_layer(CircleConst *node, float min, float max,
-                                             float &scaling_factor, int64_t &zp, float &nudged_min,
-                                             float &nudged_max)
+/**
+ * @brief Quantize and dequantize weights layer-wise
+ *
+ * Min/max of each range are merged in order, so results do not depend on the number of threads.
+ */
+void quant_dequant_per_layer(const std::vector<CircleConst *> &weights, uint32_t num_threads)
 {
+  std::vector<LayerWiseParam> params(weights.size());
+  std::vector<WorkRange> ranges;
 
-  const int32_t kMinScale = 0;
-  const int32_t kMaxScale = 255;
-
-  uint32_t size = node->size<loco::DataType::FLOAT32>();
-  compute_asym_scale_zp(min, max, scaling_factor, zp, nudged_min, nudged_max);
-  const float scaling_factor_inv = 1.0 / scaling_factor;
-  std::vector<int32_t> quantized_values(size);
-  for (uint32_t i = 0; i < size; ++i)
+  for (uint32_t w = 0; w < weights.size(); ++w)
   {
-    // clipping
-    auto data = node->at<loco::DataType::FLOAT32>(i);
-    data = data < nudged_min ? nudged_min : data;
-    data = data > nudged_max ? nudged_max : data;
-    quantized_values[i] =
-        static_cast<int32_t>(std::round((data - nudged_min) * scaling_factor_inv));
+    split_work(ranges, w, weights[w]->size<loco::DataType::FLOAT32>(), 1);
   }
 
-  node->dtype(loco::DataType::U8);      // change the type of tensor
-  node->size<loco::DataType::U8>(size); // resize tensor
-  for (uint32_t i = 0; i < size; ++i)
+  std::vector<LayerWiseParam> partials(ranges.size());
+  parallel_for(ranges, num_threads, [&](const WorkRange &r) {
+    cal_minmax_per_layer(weights[r.weight], partials[&r - ranges.data()], r.begin, r.end);
+  });
+
+  for (uint32_t n = 0; n < ranges.size(); ++n)
   {
-    node->at<loco::DataType::U8>(i) = std::min(kMaxScale, std::max(kMinScale, quantized_values[i]));
+    auto &param = params[ranges[n].weight];
+    param.min = partials[n].min < param.min ? partials[n].min : param.min;
+    param.max = partials[n].max > param.max ? partials[n].max : param.max;
   }
-}
 
-void asymmetric_wdequant_with_minmax_per_layer(CircleConst *node, float scaling_factor,
-                                               float nudged_min)
-{
-  uint32_t size = node->size<loco::DataType::U8>();
-  std::vector<float> dequantized_values(size);
-  for (uint32_t i = 0; i < size; ++i)
+  for (auto &param : params)
   {
-    auto data = node->at<loco::DataType::U8>(i);
-    dequantized_values[i] = static_cast<float>(data) * scaling_factor + nudged_min;
+    compute_asym_scale_zp(param.min, param.max, param.scaling_factor, param.zp, param.nudged_min,
+                          param.nudged_max);
   }
 
-  node->dtype(loco::DataType::FLOAT32);      // change the type of tensor
-  node->size<loco::DataType::FLOAT32>(size); // resize tensor
-  for (uint32_t i = 0; i < size; ++i)
+  parallel_for(ranges, num_threads, [&](const WorkRange &r) {
+    asymmetric_wquant_dequant_per_layer(weights[r.weight], params[r.weight], r.begin, r.end);
+  });
+
+  for (uint32_t w = 0; w < weights.size(); ++w)
   {
-    node->at<loco::DataType::FLOAT32>(i) = dequantized_values[i];
+    auto &param = params[w];
+    auto quantparam = std::make_unique<CircleQuantParam>();
+    quantparam->min.push_back(param.nudged_min);
+    quantparam->max.push_back(param.nudged_max);
+    quantparam->scale.push_back(param.scaling_factor);
+    quantparam->zerop.push_back(param.zp);
+    weights[w]->quantparam(std::move(quantparam));
   }
 }
 
@@ -373,25 +377,19 @@ bool is_weights(CircleNode *node)
 }
 
 /**
- * @brief QuantizeDequantizeWeights quantizes and dequantizes tensors for weights
- * @details Find min/max values on the fly, quantize the model, and dequantize the model
+ * @brief QuantizeDequantizeWeights collects tensors for weights
+ * @details Weights are quantized and dequantized together after all of them are collected
  */
 struct QuantizeDequantizeWeights final : public luci::CircleNodeMutableVisitor<bool>
 {
-  QuantizeDequantizeWeights(loco::DataType input, loco::DataType output,
-                            QuantizationGranularity granularity)
-      : input_type(input), output_type(output), granularity(granularity)
-  {
-  }
+  QuantizeDequantizeWeights(std::vector<CircleConst *> &weights) : weights(weights) {}
 
-  loco::DataType input_type;
-  loco::DataType output_type;
-  QuantizationGranularity granularity;
+  std::vector<CircleConst *> &weights;
+  std::set<CircleConst *> visited;
 
-  // Quantize and dequantize input tensors of each node
+  // Collect input tensors of each node
   bool visit(luci::CircleNode *node)
   {
-    assert(output_type == loco::DataType::U8 || output_type == loco::DataType::S16);
     LOGGER(l);
     INFO(l) << "QuantizeDequantizeWeights visit node: " << node->name() << std::endl;
     auto arity = node->arity();
@@ -408,65 +406,9 @@ struct QuantizeDequantizeWeights final : public luci::CircleNodeMutableVisitor<b
       {
         auto circle_const = loco::must_cast<luci::CircleConst *>(circle_node);
 
-        // Find min/max per channel-wise
-        if (granularity == QuantizationGranularity::ChannelWise)
-        {
-          std::vector<float> min;
-          std::vector<float> max;
-
-          cal_minmax_per_channel(circle_const, min, max);
-
-          std::vector<float> nudged_min(min.size());
-          std::vector<float> nudged_max(min.size());
-          std::vector<float> scaling_factor(min.size());
-          std::vector<int64_t> zp(min.size());
-
-          if (output_type == loco::DataType::U8)
-          {
-            asymmetric_wquant_per_channel(circle_const, min, max, scaling_factor, zp, nudged_min,
-                                          nudged_max);
-            asymmetric_wdequant_per_channel(circle_const, scaling_factor, nudged_min);
-          }
-          else
-          {
-            sym_wquant_per_channel(circle_const, min, max, scaling_factor, zp, nudged_min,
-                                   nudged_max);
-            sym_wdequant_per_channel(circle_const, scaling_factor);
-          }
-
-          auto quantparam = std::make_unique<CircleQuantParam>();
-          quantparam->min = nudged_min;
-          quantparam->max = nudged_max;
-          quantparam->scale = scaling_factor;
-          quantparam->zerop = zp;
-          circle_node->quantparam(std::move(quantparam));
-        }
-        // Find min/max per layer-wise
-        else
-        {
-          float min = std::numeric_limits<float>::max();
-          float max = std::numeric_limits<float>::lowest();
-          for (uint32_t i = 0; i < circle_const->size<loco::DataType::FLOAT32>(); i++)
-          {
-            auto data = circle_const->at<loco::DataType::FLOAT32>(i);
-            min = data < min ? data : min;
-            max = data > max ? data : max;
-          }
-          float scaling_factor{0};
-          int64_t zp{0};
-          float nudged_min{0};
-          float nudged_max{0};
-
-          asymmetric_wquant_with_minmax_per_layer(circle_const, min, max, scaling_factor, zp,
-                                                  nudged_min, nudged_max);
-          asymmetric_wdequant_with_minmax_per_layer(circle_const, scaling_factor, nudged_min);
-          auto quantparam = std::make_unique<CircleQuantParam>();
-          quantparam->min.push_back(nudged_min);
-          quantparam->max.push_back(nudged_max);
-          quantparam->scale.push_back(scaling_factor);
-          quantparam->zerop.push_back(zp);
-          circle_node->quantparam(std::move(quantparam));
-        }
+        // Each weight is transformed only once
+        if (visited.insert(circle_const).second)
+          weights.push_back(circle_const);
       }
     }
     return false;
@@ -480,14 +422,53 @@ bool QuantizeDequantizeWeightsPass::run(loco::Graph *g)
   LOGGER(l);
   INFO(l) << "QuantizeDequantizeWeightsPass Start" << std::endl;
 
-  // Quantize weights
+  assert(_output_dtype == loco::DataType::U8 || _output_dtype == loco::DataType::S16);
+
+  // Collect weights
+  std::vector<CircleConst *> candidates;
+  QuantizeDequantizeWeights qw(candidates);
   for (auto node : loco::active_nodes(loco::output_nodes(g)))
   {
-    QuantizeDequantizeWeights qw(_input_dtype, _output_dtype, _granularity);
     auto circle_node = loco::must_cast<luci::CircleNode *>(node);
     circle_node->accept(&qw);
   }
 
+  // Weights follow the type of their layer, and weights of float layers are left as they are
+  LayerPrecision precision(_layer_precision, _output_dtype);
+  std::vector<CircleConst *> weights;
+  std::vector<loco::DataType> dtypes;
+  for (auto weight : candidates)
+  {
+    auto layer = loco::must_cast<luci::CircleNode *>(*loco::succs(weight).begin());
+    auto dtype = precision.of(layer);
+    if (dtype == loco::DataType::FLOAT32)
+    {
+      INFO(l) << "QuantizeDequantizeWeights skip float layer: " << layer->name() << std::endl;
+      continue;
+    }
+    // Values of sparse weights are compressed, and do not match the shape
+    if (weight->sparsityparam() != nullptr)
+    {
+      INFO(l) << "QuantizeDequantizeWeights skip sparse weights: " << layer->name() << std::endl;
+      continue;
+    }
+
+    assert(dtype == loco::DataType::U8 || dtype == loco::DataType::S16);
+    weights.push_back(weight);
+    dtypes.push_back(dtype);
+  }
+
+  // Quantize weights
+  if (_granularity == QuantizationGranularity::ChannelWise)
+    quant_dequant_per_channel(weights, dtypes, _num_threads);
+  else
+  {
+    // only support uint8 for layer-wise quantization
+    assert(std::all_of(dtypes.begin(), dtypes.end(),
+                       [](loco::DataType dtype) { return dtype == loco::DataType::U8; }));
+    quant_dequant_per_layer(weights, _num_threads);
+  }
+
   INFO(l) << "QuantizeDequantizeWeightsPass End" << std::endl;
   return false; // one time run
 }
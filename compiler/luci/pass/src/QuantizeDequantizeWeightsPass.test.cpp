@@ -0,0 +1,209 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/Pass/QuantizeDequantizeWeightsPass.h"
+
+#include <luci/IR/CircleNodes.h>
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+namespace
+{
+
+void set_shape(luci::CircleNode *node, const std::vector<uint32_t> &shape)
+{
+  node->rank(shape.size());
+  for (uint32_t i = 0; i < shape.size(); ++i)
+    node->dim(i) = shape[i];
+  node->shape_status(luci::ShapeStatus::VALID);
+}
+
+luci::CircleConst *create_const(loco::Graph *g, const std::vector<uint32_t> &shape)
+{
+  auto node = g->nodes()->create<luci::CircleConst>();
+  node->dtype(loco::DataType::FLOAT32);
+  set_shape(node, shape);
+
+  uint32_t size = 1;
+  for (auto dim : shape)
+    size *= dim;
+  node->size<loco::DataType::FLOAT32>(size);
+  for (uint32_t i = 0; i < size; ++i)
+    node->at<loco::DataType::FLOAT32>(i) = (i % 2 == 0 ? 0.1f : -0.1f) * (i + 1);
+  return node;
+}
+
+luci::CircleFullyConnected *create_fc(loco::Graph *g, loco::Node *input, loco::Node *weights)
+{
+  auto node = g->nodes()->create<luci::CircleFullyConnected>();
+  node->input(input);
+  node->weights(weights);
+  node->bias(create_const(g, {3}));
+  node->fusedActivationFunction(luci::FusedActFunc::NONE);
+  node->dtype(loco::DataType::FLOAT32);
+  set_shape(node, {3, 3});
+
+  auto output = g->nodes()->create<luci::CircleOutput>();
+  output->from(node);
+  output->dtype(loco::DataType::FLOAT32);
+  output->index(g->outputs()->create()->index());
+  return node;
+}
+
+/**
+ *  [shared] -- [FullyConnected(fc)] -- [Output]
+ *      |            |
+ *      +------------+ (as both input and weights)
+ *
+ *  [Input] -- [FullyConnected(fc_copy)] -- [Output]
+ *                 |
+ *             [copy] (same values as shared)
+ */
+class SharedWeightGraph
+{
+public:
+  SharedWeightGraph()
+  {
+    shared = create_const(g.get(), {3, 3});
+    create_fc(g.get(), shared, shared);
+
+    auto input = g->nodes()->create<luci::CircleInput>();
+    input->dtype(loco::DataType::FLOAT32);
+    set_shape(input, {3, 3});
+    input->index(g->inputs()->create()->index());
+
+    copy = create_const(g.get(), {3, 3});
+    create_fc(g.get(), input, copy);
+  }
+
+public:
+  std::unique_ptr<loco::Graph> g = loco::make_graph();
+  luci::CircleConst *shared = nullptr;
+  luci::CircleConst *copy = nullptr;
+};
+
+void run_pass(loco::Graph *g, luci::QuantizationGranularity granularity, uint32_t num_threads)
+{
+  luci::QuantizeDequantizeWeightsPass pass(loco::DataType::FLOAT32, loco::DataType::U8,
+                                           granularity);
+  pass.num_threads(num_threads);
+  pass.run(g);
+}
+
+std::vector<float> values_of(const luci::CircleConst *node)
+{
+  std::vector<float> values;
+  for (uint32_t i = 0; i < node->size<loco::DataType::FLOAT32>(); ++i)
+    values.push_back(node->at<loco::DataType::FLOAT32>(i));
+  return values;
+}
+
+} // namespace
+
+// A weight used twice by its layer is fake-quantized once, as a weight used once
+TEST(QuantizeDequantizeWeightsPass, shared_weight_channel)
+{
+  SharedWeightGraph graph;
+  run_pass(graph.g.get(), luci::QuantizationGranularity::ChannelWise, 0);
+
+  ASSERT_NE(nullptr, graph.shared->quantparam());
+  ASSERT_EQ(values_of(graph.copy), values_of(graph.shared));
+  ASSERT_EQ(graph.copy->quantparam()->scale, graph.shared->quantparam()->scale);
+  ASSERT_EQ(graph.copy->quantparam()->zerop, graph.shared->quantparam()->zerop);
+
+  // Output of the serial pass, which fake-quantized the weight once per use
+  const std::vector<float> serial_values{0.100000009f,  -0.200000003f, 0.300000012f,
+                                         -0.401176512f, 0.500392139f,  -0.599607885f,
+                                         0.699999988f,  -0.800000012f, 0.900000036f};
+  const std::vector<float> serial_scale{0.00196078443f, 0.00431372551f, 0.00666666683f};
+  const std::vector<int64_t> serial_zerop{102, 139, 120};
+
+  auto values = values_of(graph.shared);
+  for (uint32_t i = 0; i < values.size(); ++i)
+    EXPECT_FLOAT_EQ(serial_values[i], values[i]);
+  for (uint32_t i = 0; i < serial_scale.size(); ++i)
+    EXPECT_FLOAT_EQ(serial_scale[i], graph.shared->quantparam()->scale[i]);
+  EXPECT_EQ(serial_zerop, graph.shared->quantparam()->zerop);
+}
+
+TEST(QuantizeDequantizeWeightsPass, shared_weight_layer)
+{
+  SharedWeightGraph graph;
+  run_pass(graph.g.get(), luci::QuantizationGranularity::LayerWise, 0);
+
+  ASSERT_NE(nullptr, graph.shared->quantparam());
+  ASSERT_EQ(values_of(graph.copy), values_of(graph.shared));
+
+  // Output of the serial pass, which fake-quantized the weight once per use
+  const std::vector<float> serial_values{0.100000024f,  -0.199999988f, 0.300000012f,
+                                         -0.400000006f, 0.50000006f,   -0.600000024f,
+                                         0.699999988f,  -0.800000012f, 0.900000036f};
+
+  auto values = values_of(graph.shared);
+  for (uint32_t i = 0; i < values.size(); ++i)
+    EXPECT_FLOAT_EQ(serial_values[i], values[i]);
+  EXPECT_FLOAT_EQ(0.00666666683f, graph.shared->quantparam()->scale.at(0));
+  EXPECT_EQ(120, graph.shared->quantparam()->zerop.at(0));
+}
+
+TEST(QuantizeDequantizeWeightsPass, num_threads)
+{
+  SharedWeightGraph graph_1;
+  SharedWeightGraph graph_3;
+  run_pass(graph_1.g.get(), luci::QuantizationGranularity::ChannelWise, 1);
+  run_pass(graph_3.g.get(), luci::QuantizationGranularity::ChannelWise, 3);
+
+  ASSERT_EQ(values_of(graph_1.shared), values_of(graph_3.shared));
+  ASSERT_EQ(values_of(graph_1.copy), values_of(graph_3.copy));
+}
+
+// Weights used by more than one layer are not quantized
+TEST(QuantizeDequantizeWeightsPass, weight_of_two_layers_NEG)
+{
+  auto g = loco::make_graph();
+
+  auto input = g->nodes()->create<luci::CircleInput>();
+  input->dtype(loco::DataType::FLOAT32);
+  set_shape(input, {3, 3});
+  input->index(g->inputs()->create()->index());
+
+  auto weights = create_const(g.get(), {3, 3});
+  auto before = values_of(weights);
+  create_fc(g.get(), input, weights);
+  create_fc(g.get(), input, weights);
+
+  run_pass(g.get(), luci::QuantizationGranularity::ChannelWise, 0);
+
+  ASSERT_EQ(nullptr, weights->quantparam());
+  ASSERT_EQ(before, values_of(weights));
+}
+
+TEST(QuantizeDequantizeWeightsPass, sparse_weights_NEG)
+{
+  SharedWeightGraph graph;
+  // Only non-zero values are stored
+  graph.copy->size<loco::DataType::FLOAT32>(4);
+  graph.copy->sparsityparam(std::make_unique<luci::SparsityParam>());
+  auto before = values_of(graph.copy);
+
+  run_pass(graph.g.get(), luci::QuantizationGranularity::ChannelWise, 0);
+
+  ASSERT_EQ(nullptr, graph.copy->quantparam());
+  ASSERT_EQ(before, values_of(graph.copy));
+  ASSERT_NE(nullptr, graph.shared->quantparam());
+}
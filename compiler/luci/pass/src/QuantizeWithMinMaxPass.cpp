@@ -25,6 +25,10 @@
 
 #include <iostream>
 #include <cmath>
+#include <cstring>
+#include <limits>
+#include <map>
+#include <set>
 
 namespace luci
 {
@@ -138,125 +142,207 @@ bool is_quantized(const CircleNode *node)
          node->dtype() == loco::DataType::S32;  // bias
 }
 
-void sym_wquant_per_channel(CircleConst *node, std::vector<float> &scaling_factor,
-                            int32_t &channel_dim_index)
+/**
+ * @brief Quantization parameters of a weight recorded by QuantizeDequantizeWeightsPass
+ */
+struct WeightParam
 {
-  assert(node->dtype() == loco::DataType::FLOAT32);
+  bool valid = false;
+  loco::DataType dtype = loco::DataType::U8;
+  ChannelLayout layout;
+  int32_t channel_dim_index = 0;
+  std::vector<float> min;
+  std::vector<float> scaling_factor;
+};
 
+// Quantize channels in [begin, end) to int16, written in place as float
+void sym_wquant_per_channel(CircleConst *node, const WeightParam &param, uint32_t begin,
+                            uint32_t end)
+{
   const int32_t kMaxScale = std::numeric_limits<int16_t>::max();
   const int32_t kMinScale = -kMaxScale;
 
-  uint32_t size = node->size<loco::DataType::FLOAT32>();
-  std::vector<int32_t> quantized_values(size);
-
-  loco::TensorShape dimension;
-  dimension.rank(4);
-  uint32_t indices[4] = {
-      0,
-  };
+  const auto &layout = param.layout;
+  float *data = &node->at<loco::DataType::FLOAT32>(0);
 
-  if (!get_channel_dim_index(node, dimension, channel_dim_index))
+  for (uint32_t o = 0; o < layout.outer; ++o)
   {
-    assert(false);
-    return;
-  }
-
-  for (indices[0] = 0; indices[0] < dimension.dim(0).value(); indices[0]++)
-  {
-    for (indices[1] = 0; indices[1] < dimension.dim(1).value(); indices[1]++)
+    for (uint32_t c = begin; c < end; ++c)
     {
-      for (indices[2] = 0; indices[2] < dimension.dim(2).value(); indices[2]++)
+      const float scaling_factor_inv = 1.0 / param.scaling_factor[c];
+
+      float *channel = data + (o * layout.channel + c) * layout.inner;
+      for (uint32_t i = 0; i < layout.inner; ++i)
       {
-        for (indices[3] = 0; indices[3] < dimension.dim(3).value(); indices[3]++)
-        {
-          int channel_idx = indices[channel_dim_index];
-          const float scaling_factor_inv = 1.0 / scaling_factor[channel_idx];
-          auto data = node->at<loco::DataType::FLOAT32>(cal_offset(dimension, indices));
-          quantized_values[cal_offset(dimension, indices)] =
-              static_cast<int32_t>(std::round(data * scaling_factor_inv));
-        }
+        auto quantized = static_cast<int32_t>(std::round(channel[i] * scaling_factor_inv));
+        channel[i] = static_cast<float>(std::min(kMaxScale, std::max(kMinScale, quantized)));
       }
     }
   }
+}
 
-  node->dtype(loco::DataType::S16);      // change the type of tensor
-  node->size<loco::DataType::S16>(size); // resize tensor
-  for (uint32_t i = 0; i < size; ++i)
+// Quantize channels in [begin, end) to uint8, written in place as float
+void asym_wquant_per_channel(CircleConst *node, const WeightParam &param, uint32_t begin,
+                             uint32_t end)
+{
+  const int32_t kMinScale = 0;
+  const int32_t kMaxScale = 255;
+
+  const auto &layout = param.layout;
+  float *data = &node->at<loco::DataType::FLOAT32>(0);
+
+  for (uint32_t o = 0; o < layout.outer; ++o)
   {
-    node->at<loco::DataType::S16>(i) =
-        std::min(kMaxScale, std::max(kMinScale, quantized_values[i]));
+    for (uint32_t c = begin; c < end; ++c)
+    {
+      const float min = param.min[c];
+      const float scaling_factor_inv = 1.0 / param.scaling_factor[c];
+
+      float *channel = data + (o * layout.channel + c) * layout.inner;
+      for (uint32_t i = 0; i < layout.inner; ++i)
+      {
+        auto quantized = static_cast<int32_t>(std::round((channel[i] - min) * scaling_factor_inv));
+        channel[i] = static_cast<float>(std::min(kMaxScale, std::max(kMinScale, quantized)));
+      }
+    }
   }
 }
 
-void asym_wquant_per_channel(CircleConst *node, std::vector<float> &min,
-                             std::vector<float> &scaling_factor, int32_t &channel_dim_index)
+// Quantize elements in [begin, end) to uint8, written in place as float
+void asym_wquant_per_layer(CircleConst *node, const WeightParam &param, uint32_t begin,
+                           uint32_t end)
 {
-  assert(node->dtype() == loco::DataType::FLOAT32);
-
   const int32_t kMinScale = 0;
   const int32_t kMaxScale = 255;
 
-  uint32_t size = node->size<loco::DataType::FLOAT32>();
-  std::vector<int32_t> quantized_values(size);
-
-  loco::TensorShape dimension;
-  dimension.rank(4);
-  uint32_t indices[4] = {
-      0,
-  };
+  const float min = param.min[0];
+  const float scaling_factor_inv = 1.0 / param.scaling_factor[0];
 
-  if (!get_channel_dim_index(node, dimension, channel_dim_index))
+  float *data = &node->at<loco::DataType::FLOAT32>(0);
+  for (uint32_t i = begin; i < end; ++i)
   {
-    assert(false);
-    return;
+    auto quantized = static_cast<int32_t>(std::round((data[i] - min) * scaling_factor_inv));
+    data[i] = static_cast<float>(std::min(kMaxScale, std::max(kMinScale, quantized)));
   }
+}
+
+/**
+ * @brief Change the type of a weight whose values are already quantized in place
+ *
+ * Values are narrowed front to back in the same buffer, so no temporary copy is needed.
+ */
+template <loco::DataType DT> void narrow_quantized(CircleConst *node)
+{
+  using T = typename loco::DataTypeImpl<DT>::Type;
 
-  for (indices[0] = 0; indices[0] < dimension.dim(0).value(); indices[0]++)
+  const uint32_t size = node->size<loco::DataType::FLOAT32>();
+  node->dtype(DT);
+  if (size == 0)
   {
-    for (indices[1] = 0; indices[1] < dimension.dim(1).value(); indices[1]++)
-    {
-      for (indices[2] = 0; indices[2] < dimension.dim(2).value(); indices[2]++)
-      {
-        for (indices[3] = 0; indices[3] < dimension.dim(3).value(); indices[3]++)
-        {
-          int channel_idx = indices[channel_dim_index];
-          const float scaling_factor_inv = 1.0 / scaling_factor[channel_idx];
-          auto data = node->at<loco::DataType::FLOAT32>(cal_offset(dimension, indices));
-          quantized_values[cal_offset(dimension, indices)] =
-              static_cast<int32_t>(std::round((data - min[channel_idx]) * scaling_factor_inv));
-        }
-      }
-    }
+    node->size<DT>(0);
+    return;
   }
 
-  node->dtype(loco::DataType::U8);      // change the type of tensor
-  node->size<loco::DataType::U8>(size); // resize tensor
+  auto bytes = reinterpret_cast<uint8_t *>(&node->at<DT>(0));
   for (uint32_t i = 0; i < size; ++i)
   {
-    node->at<loco::DataType::U8>(i) = std::min(kMaxScale, std::max(kMinScale, quantized_values[i]));
+    // NOTE i-th value never overwrites a value that is not read yet
+    float value;
+    std::memcpy(&value, bytes + i * sizeof(float), sizeof(float));
+    const T quantized = static_cast<T>(value);
+    std::memcpy(bytes + i * sizeof(T), &quantized, sizeof(T));
   }
+  node->size<DT>(size); // resize tensor
 }
 
-void asym_wquant_per_layer(CircleConst *node, float min, float scaling_factor)
+/**
+ * @brief Quantize weights with parameters recorded in their quantparam
+ *
+ * All the weights are quantized in parallel across weights and channels (or elements).
+ */
+void quantize_weights(const std::vector<CircleConst *> &weights,
+                      const std::vector<loco::DataType> &dtypes,
+                      QuantizationGranularity granularity, uint32_t num_threads)
 {
-  const int32_t kMinScale = 0;
-  const int32_t kMaxScale = 255;
-
-  uint32_t size = node->size<loco::DataType::FLOAT32>();
+  std::vector<WeightParam> params(weights.size());
+  std::vector<WorkRange> ranges;
 
-  const float scaling_factor_inv = 1.0 / scaling_factor;
-  std::vector<int32_t> quantized_values(size);
-  for (uint32_t i = 0; i < size; ++i)
+  for (uint32_t w = 0; w < weights.size(); ++w)
   {
-    auto data = node->at<loco::DataType::FLOAT32>(i);
-    quantized_values[i] = static_cast<int32_t>(std::round((data - min) * scaling_factor_inv));
+    auto node = weights[w];
+    assert(node->dtype() == loco::DataType::FLOAT32);
+
+    auto quantparam = node->quantparam();
+    assert(quantparam != nullptr);
+
+    auto &param = params[w];
+    param.dtype = dtypes[w];
+    const auto size = node->size<loco::DataType::FLOAT32>();
+
+    // Find min/max per channel-wise
+    if (granularity == QuantizationGranularity::ChannelWise)
+    {
+      loco::TensorShape dimension;
+      dimension.rank(4);
+
+      if (!get_channel_dim_index(node, dimension, param.channel_dim_index))
+      {
+        assert(false);
+        continue;
+      }
+
+      param.valid = true;
+      param.layout = get_channel_layout(dimension, param.channel_dim_index);
+      param.min = quantparam->min;
+      param.scaling_factor = quantparam->scale;
+
+      if (size > 0)
+        split_work(ranges, w, param.layout.channel, param.layout.outer * param.layout.inner);
+    }
+    // Find min/max per layer-wise
+    else
+    {
+      assert(quantparam->min.size() == 1);   // only support layer-wise quant
+      assert(quantparam->scale.size() == 1); // only support layer-wise quant
+      param.valid = true;
+      param.min = quantparam->min;
+      param.scaling_factor = quantparam->scale;
+
+      split_work(ranges, w, size, 1);
+    }
   }
 
-  node->dtype(loco::DataType::U8);      // change the type of tensor
-  node->size<loco::DataType::U8>(size); // resize tensor
-  for (uint32_t i = 0; i < size; ++i)
+  parallel_for(ranges, num_threads, [&](const WorkRange &r) {
+    auto node = weights[r.weight];
+    const auto &param = params[r.weight];
+
+    if (granularity != QuantizationGranularity::ChannelWise)
+      asym_wquant_per_layer(node, param, r.begin, r.end);
+    else if (param.dtype == loco::DataType::U8)
+      asym_wquant_per_channel(node, param, r.begin, r.end);
+    else
+      sym_wquant_per_channel(node, param, r.begin, r.end);
+  });
+
+  for (uint32_t w = 0; w < weights.size(); ++w)
   {
-    node->at<loco::DataType::U8>(i) = std::min(kMaxScale, std::max(kMinScale, quantized_values[i]));
+    auto node = weights[w];
+    const auto &param = params[w];
+
+    if (param.valid)
+    {
+      if (granularity == QuantizationGranularity::ChannelWise &&
+          param.dtype != loco::DataType::U8)
+        narrow_quantized<loco::DataType::S16>(node);
+      else
+        narrow_quantized<loco::DataType::U8>(node);
+    }
+
+    auto quantparam = node->quantparam();
+    quantparam->min.clear();
+    quantparam->max.clear();
+    if (granularity == QuantizationGranularity::ChannelWise)
+      quantparam->quantized_dimension = param.channel_dim_index;
   }
 }
 
@@ -294,13 +380,13 @@ bool is_weights(CircleNode *node)
  */
 struct QuantizeActivation final : public luci::CircleNodeMutableVisitor<bool>
 {
-  QuantizeActivation(loco::DataType input, loco::DataType output)
-      : input_type(input), output_type(output)
+  QuantizeActivation(loco::DataType input, const LayerPrecision &precision)
+      : input_type(input), precision(precision)
   {
   }
 
   loco::DataType input_type;
-  loco::DataType output_type;
+  const LayerPrecision &precision;
 
   // Quantize input tensors of each node
   bool visit(luci::CircleNode *node)
@@ -326,6 +412,11 @@ struct QuantizeActivation final : public luci::CircleNodeMutableVisitor<bool>
       // We assume min/max are recorded only for activations
       if (has_min_max(circle_node) && !is_weights(circle_node))
       {
+        // Activations of float layers are not quantized
+        const auto output_type = precision.of(circle_node);
+        if (output_type == loco::DataType::FLOAT32)
+          continue;
+
         // Quantize using recorded min/max
         auto quantparam = circle_node->quantparam();
         assert(quantparam->min.size() == 1); // only support layer-wise quant
@@ -361,13 +452,13 @@ struct QuantizeActivation final : public luci::CircleNodeMutableVisitor<bool>
 
 struct QuantizeBias final : public luci::CircleNodeMutableVisitor<bool>
 {
-  QuantizeBias(loco::DataType input, loco::DataType output, QuantizationGranularity gr)
-      : input_type(input), output_type(output), granularity(gr)
+  QuantizeBias(loco::DataType input, const LayerPrecision &precision, QuantizationGranularity gr)
+      : input_type(input), precision(precision), granularity(gr)
   {
   }
 
   loco::DataType input_type;
-  loco::DataType output_type;
+  const LayerPrecision &precision;
   QuantizationGranularity granularity;
 
   // Quantize bias node
@@ -382,6 +473,11 @@ struct QuantizeBias final : public luci::CircleNodeMutableVisitor<bool>
     if (iw.first == nullptr || iw.second == nullptr)
       return false;
 
+    // Bias of a float layer is not quantized
+    auto layer = loco::must_cast<luci::CircleNode *>(*loco::succs(node).begin());
+    if (precision.of(layer) == loco::DataType::FLOAT32)
+      return false;
+
     auto input = loco::must_cast<luci::CircleNode *>(iw.first);
     auto weight = loco::must_cast<luci::CircleNode *>(iw.second);
 
@@ -431,21 +527,17 @@ struct QuantizeBias final : public luci::CircleNodeMutableVisitor<bool>
 };
 
 /**
- * @brief QuantizeWeights quantizes tensors for weights
- * @details Find min/max values on the fly and then quantize
+ * @brief QuantizeWeights collects tensors for weights
+ * @details Weights are quantized together after all of them are collected
  */
 struct QuantizeWeights final : public luci::CircleNodeMutableVisitor<bool>
 {
-  QuantizeWeights(loco::DataType input, loco::DataType output, QuantizationGranularity gr)
-      : input_type(input), output_type(output), granularity(gr)
-  {
-  }
+  QuantizeWeights(std::vector<CircleConst *> &weights) : weights(weights) {}
 
-  loco::DataType input_type;
-  loco::DataType output_type;
-  QuantizationGranularity granularity;
+  std::vector<CircleConst *> &weights;
+  std::set<CircleConst *> visited;
 
-  // Quantize input tensors of each node
+  // Collect input tensors of each node
   bool visit(luci::CircleNode *node)
   {
     LOGGER(l);
@@ -464,47 +556,108 @@ struct QuantizeWeights final : public luci::CircleNodeMutableVisitor<bool>
       {
         auto circle_const = loco::must_cast<luci::CircleConst *>(circle_node);
 
-        // Find min/max per channel-wise
-        if (granularity == QuantizationGranularity::ChannelWise)
-        {
-          auto quantparam = circle_node->quantparam();
-          assert(quantparam != nullptr);
-          auto min = quantparam->min;
-          auto scaling_factor = quantparam->scale;
-          int32_t channel_dim_index = 0;
-
-          if (output_type == loco::DataType::U8)
-          {
-            asym_wquant_per_channel(circle_const, min, scaling_factor, channel_dim_index);
-          }
-          else
-          {
-            sym_wquant_per_channel(circle_const, scaling_factor, channel_dim_index);
-          }
-          quantparam->min.clear();
-          quantparam->max.clear();
-          quantparam->quantized_dimension = channel_dim_index;
-        }
-        // Find min/max per layer-wise
-        else
-        {
-          // Quantize using recorded quantparam
-          auto quantparam = circle_node->quantparam();
-          assert(quantparam != nullptr);
-          assert(quantparam->min.size() == 1);   // only support layer-wise quant
-          assert(quantparam->scale.size() == 1); // only support layer-wise quant
-          auto min = quantparam->min[0];
-          auto scaling_factor = quantparam->scale[0];
-          asym_wquant_per_layer(circle_const, min, scaling_factor);
-          quantparam->min.clear();
-          quantparam->max.clear();
-        }
+        // Each weight is quantized only once
+        if (visited.insert(circle_const).second)
+          weights.push_back(circle_const);
       }
     }
     return false;
   }
 };
 
+bool is_activation(CircleNode *node)
+{
+  if (node->dtype() != loco::DataType::FLOAT32 || !has_min_max(node) || is_weights(node))
+    return false;
+
+  auto iw = get_input_weight_of_bias(node);
+  return iw.first == nullptr || iw.second == nullptr;
+}
+
+/**
+ * @brief Create a node converting an activation to the given type
+ * @details CircleQuantize inherits min/max of the activation and is quantized with the others.
+ */
+CircleNode *create_boundary(CircleNode *node, loco::DataType dtype, LayerPrecision &precision)
+{
+  auto graph = node->graph();
+  CircleNode *boundary = nullptr;
+
+  if (dtype == loco::DataType::FLOAT32)
+  {
+    auto dequantize = graph->nodes()->create<luci::CircleDequantize>();
+    dequantize->input(node);
+    dequantize->name(node->name() + "/Dequantize");
+    boundary = dequantize;
+  }
+  else
+  {
+    auto quantize = graph->nodes()->create<luci::CircleQuantize>();
+    quantize->input(node);
+    quantize->name(node->name() + "/Quantize");
+
+    auto quantparam = std::make_unique<CircleQuantParam>();
+    quantparam->min = node->quantparam()->min;
+    quantparam->max = node->quantparam()->max;
+    quantize->quantparam(std::move(quantparam));
+    boundary = quantize;
+  }
+
+  boundary->dtype(loco::DataType::FLOAT32);
+  boundary->shape_status(node->shape_status());
+  boundary->rank(node->rank());
+  for (uint32_t i = 0; i < node->rank(); ++i)
+    boundary->dim(i) = node->dim(i);
+
+  precision.set(boundary, dtype);
+  return boundary;
+}
+
+/**
+ * @brief Insert CircleQuantize or CircleDequantize where a layer reads an activation of
+ *        another type
+ * @details One node is inserted per activation and type, and shared by the layers of that type.
+ *          Graph outputs take the type of the activation as it is.
+ */
+void insert_boundaries(loco::Graph *g, LayerPrecision &precision)
+{
+  std::vector<CircleNode *> activations;
+  for (auto node : loco::active_nodes(loco::output_nodes(g)))
+  {
+    auto circle_node = loco::must_cast<luci::CircleNode *>(node);
+    if (is_activation(circle_node))
+      activations.push_back(circle_node);
+  }
+
+  for (auto node : activations)
+  {
+    const auto node_dtype = precision.of(node);
+
+    // Redirecting an edge changes the use list, so edges are collected first
+    std::vector<loco::Use *> uses;
+    for (auto use = node->uses(); use != nullptr; use = use->next())
+      uses.push_back(use);
+
+    std::map<loco::DataType, CircleNode *> boundaries;
+    for (auto use : uses)
+    {
+      auto user = loco::must_cast<luci::CircleNode *>(use->user());
+      if (dynamic_cast<luci::CircleOutput *>(user) != nullptr)
+        continue;
+
+      const auto user_dtype = precision.of(user);
+      if (user_dtype == node_dtype)
+        continue;
+
+      auto &boundary = boundaries[user_dtype];
+      if (boundary == nullptr)
+        boundary = create_boundary(node, user_dtype, precision);
+
+      use->node(boundary);
+    }
+  }
+}
+
 } // namespace
 
 bool QuantizeWithMinMaxPass::run(loco::Graph *g)
@@ -512,40 +665,81 @@ bool QuantizeWithMinMaxPass::run(loco::Graph *g)
   LOGGER(l);
   INFO(l) << "QuantizeWithMinMaxPass Start" << std::endl;
 
+  LayerPrecision precision(_layer_precision, _output_dtype);
+
+  // Convert activations between layers of different types
+  if (!_layer_precision.empty())
+    insert_boundaries(g, precision);
+
   // Quantize activation
   for (auto node : loco::active_nodes(loco::output_nodes(g)))
   {
-    QuantizeActivation qa(_input_dtype, _output_dtype);
+    QuantizeActivation qa(_input_dtype, precision);
     auto circle_node = loco::must_cast<luci::CircleNode *>(node);
     circle_node->accept(&qa);
   }
 
   // Quantize weights
-  for (auto node : loco::active_nodes(loco::output_nodes(g)))
   {
-    QuantizeWeights qw(_input_dtype, _output_dtype, _granularity);
-    auto circle_node = loco::must_cast<luci::CircleNode *>(node);
-    circle_node->accept(&qw);
+    std::vector<CircleConst *> weights;
+    QuantizeWeights qw(weights);
+    for (auto node : loco::active_nodes(loco::output_nodes(g)))
+    {
+      auto circle_node = loco::must_cast<luci::CircleNode *>(node);
+      circle_node->accept(&qw);
+    }
+
+    // Weights follow the type of their layer, and weights of float layers are left as they are
+    std::vector<CircleConst *> quantized;
+    std::vector<loco::DataType> dtypes;
+    for (auto weight : weights)
+    {
+      auto layer = loco::must_cast<luci::CircleNode *>(*loco::succs(weight).begin());
+      auto dtype = precision.of(layer);
+      if (dtype == loco::DataType::FLOAT32)
+      {
+        weight->quantparam(nullptr);
+        continue;
+      }
+      // Values of sparse weights are compressed, so they cannot be quantized channel by channel
+      if (weight->sparsityparam() != nullptr)
+        throw oops::UserExn("Sparse weights cannot be quantized", layer->name());
+      quantized.push_back(weight);
+      dtypes.push_back(dtype);
+    }
+    quantize_weights(quantized, dtypes, _granularity, _num_threads);
   }
 
   // Quantize bias
   for (auto node : loco::active_nodes(loco::output_nodes(g)))
   {
-    QuantizeBias qb(_input_dtype, _output_dtype, _granularity);
+    QuantizeBias qb(_input_dtype, precision, _granularity);
     auto circle_node = loco::must_cast<luci::CircleNode *>(node);
     circle_node->accept(&qb);
   }
 
+  // Activations of float layers do not keep min/max
+  if (!_layer_precision.empty())
+  {
+    for (auto node : loco::active_nodes(loco::output_nodes(g)))
+    {
+      auto circle_node = loco::must_cast<luci::CircleNode *>(node);
+      if (is_activation(circle_node) && precision.of(circle_node) == loco::DataType::FLOAT32)
+        circle_node->quantparam(nullptr);
+    }
+  }
+
   // Update output dtype
   auto graph_outputs = g->outputs();
   for (auto node : loco::output_nodes(g))
   {
     auto circle_node = loco::must_cast<luci::CircleOutput *>(node);
-    if (static_cast<luci::CircleNode *>(circle_node->from())->dtype() == _output_dtype)
+    auto from_dtype = static_cast<luci::CircleNode *>(circle_node->from())->dtype();
+    if (from_dtype == loco::DataType::U8 || from_dtype == loco::DataType::S16)
     {
-      circle_node->dtype(_output_dtype);
+      circle_node->dtype(from_dtype);
       auto graph_output = graph_outputs->at(circle_node->index());
-      graph_output->dtype(_output_dtype);
+      graph_output->dtype(from_dtype);
     }
   }
 
@@ -0,0 +1,243 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/Pass/QuantizeWithMinMaxPass.h"
+#include "luci/Pass/QuantizeDequantizeWeightsPass.h"
+
+#include <luci/IR/CircleNodes.h>
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+namespace
+{
+
+void set_shape(luci::CircleNode *node, const std::vector<uint32_t> &shape)
+{
+  node->rank(shape.size());
+  for (uint32_t i = 0; i < shape.size(); ++i)
+    node->dim(i) = shape[i];
+  node->shape_status(luci::ShapeStatus::VALID);
+}
+
+void set_min_max(luci::CircleNode *node, float min, float max)
+{
+  auto quantparam = std::make_unique<luci::CircleQuantParam>();
+  quantparam->min.push_back(min);
+  quantparam->max.push_back(max);
+  node->quantparam(std::move(quantparam));
+}
+
+luci::CircleConst *create_const(loco::Graph *g, const std::vector<uint32_t> &shape)
+{
+  auto node = g->nodes()->create<luci::CircleConst>();
+  node->dtype(loco::DataType::FLOAT32);
+  set_shape(node, shape);
+
+  uint32_t size = 1;
+  for (auto dim : shape)
+    size *= dim;
+  node->size<loco::DataType::FLOAT32>(size);
+  for (uint32_t i = 0; i < size; ++i)
+    node->at<loco::DataType::FLOAT32>(i) = (i % 2 == 0 ? 0.1f : -0.1f) * (i + 1);
+  return node;
+}
+
+luci::CircleFullyConnected *create_fc(loco::Graph *g, loco::Node *input, uint32_t num_inputs,
+                                      uint32_t num_outputs, const std::string &name)
+{
+  auto node = g->nodes()->create<luci::CircleFullyConnected>();
+  node->input(input);
+  node->weights(create_const(g, {num_outputs, num_inputs}));
+  node->bias(create_const(g, {num_outputs}));
+  node->fusedActivationFunction(luci::FusedActFunc::NONE);
+  node->dtype(loco::DataType::FLOAT32);
+  node->name(name);
+  set_shape(node, {1, num_outputs});
+  return node;
+}
+
+/**
+ *  [Input] -- [FullyConnected(fc1)] -- [FullyConnected(fc2)] -- [Output]
+ *
+ *  min/max of activations are recorded as in a model from record-minmax
+ */
+class FCFCGraph
+{
+public:
+  FCFCGraph()
+  {
+    input = g->nodes()->create<luci::CircleInput>();
+    input->dtype(loco::DataType::FLOAT32);
+    input->name("input");
+    set_shape(input, {1, 4});
+    set_min_max(input, 0.0f, 2.55f);
+
+    fc1 = create_fc(g.get(), input, 4, 3, "fc1");
+    set_min_max(fc1, -3.2767f, 3.2767f);
+
+    fc2 = create_fc(g.get(), fc1, 3, 2, "fc2");
+    set_min_max(fc2, -1.0f, 1.0f);
+
+    output = g->nodes()->create<luci::CircleOutput>();
+    output->from(fc2);
+    output->dtype(loco::DataType::FLOAT32);
+
+    auto graph_input = g->inputs()->create();
+    input->index(graph_input->index());
+    auto graph_output = g->outputs()->create();
+    output->index(graph_output->index());
+  }
+
+public:
+  std::unique_ptr<loco::Graph> g = loco::make_graph();
+  luci::CircleInput *input = nullptr;
+  luci::CircleFullyConnected *fc1 = nullptr;
+  luci::CircleFullyConnected *fc2 = nullptr;
+  luci::CircleOutput *output = nullptr;
+};
+
+luci::CircleConst *weights_of(luci::CircleFullyConnected *fc)
+{
+  return dynamic_cast<luci::CircleConst *>(fc->weights());
+}
+
+// Quantize as CircleOptimizer does, from float32 to uint8 by default
+void quantize(loco::Graph *g, const luci::LayerPrecisionMap &layer_precision)
+{
+  luci::QuantizeDequantizeWeightsPass fake_quantizer(loco::DataType::FLOAT32, loco::DataType::U8,
+                                                     luci::QuantizationGranularity::ChannelWise,
+                                                     layer_precision);
+  fake_quantizer.run(g);
+
+  luci::QuantizeWithMinMaxPass quantizer(loco::DataType::FLOAT32, loco::DataType::U8,
+                                         luci::QuantizationGranularity::ChannelWise,
+                                         layer_precision);
+  quantizer.run(g);
+}
+
+} // namespace
+
+TEST(QuantizeWithMinMaxPass, single_type)
+{
+  FCFCGraph graph;
+
+  quantize(graph.g.get(), {});
+
+  // No boundary is inserted without a layer precision map
+  ASSERT_EQ(graph.input, graph.fc1->input());
+  ASSERT_EQ(graph.fc1, graph.fc2->input());
+
+  ASSERT_EQ(loco::DataType::U8, graph.input->dtype());
+  ASSERT_EQ(loco::DataType::U8, graph.fc1->dtype());
+  ASSERT_EQ(loco::DataType::U8, graph.fc2->dtype());
+  ASSERT_EQ(loco::DataType::U8, weights_of(graph.fc2)->dtype());
+  ASSERT_EQ(loco::DataType::U8, graph.output->dtype());
+}
+
+TEST(QuantizeWithMinMaxPass, mixed_precision)
+{
+  FCFCGraph graph;
+  luci::LayerPrecisionMap layer_precision{{"fc1", loco::DataType::S16},
+                                          {"fc2", loco::DataType::FLOAT32}};
+
+  quantize(graph.g.get(), layer_precision);
+
+  // Input is not in the map, and is quantized to the output type of the pass
+  ASSERT_EQ(loco::DataType::U8, graph.input->dtype());
+  ASSERT_FLOAT_EQ(0.01f, graph.input->quantparam()->scale.at(0));
+  ASSERT_EQ(0, graph.input->quantparam()->zerop.at(0));
+
+  // uint8 input is converted to int16 for fc1, with min/max of the input
+  auto quantize = dynamic_cast<luci::CircleQuantize *>(graph.fc1->input());
+  ASSERT_NE(nullptr, quantize);
+  ASSERT_EQ(graph.input, quantize->input());
+  ASSERT_EQ("input/Quantize", quantize->name());
+  ASSERT_EQ(loco::DataType::S16, quantize->dtype());
+  ASSERT_TRUE(quantize->quantparam()->min.empty());
+  ASSERT_TRUE(quantize->quantparam()->max.empty());
+  ASSERT_FLOAT_EQ(2.55f / 32767, quantize->quantparam()->scale.at(0));
+  ASSERT_EQ(0, quantize->quantparam()->zerop.at(0));
+  ASSERT_EQ(2, quantize->rank());
+  ASSERT_EQ(4, quantize->dim(1).value());
+
+  // fc1 is in int16
+  ASSERT_EQ(loco::DataType::S16, graph.fc1->dtype());
+  ASSERT_FLOAT_EQ(1e-4f, graph.fc1->quantparam()->scale.at(0));
+  ASSERT_EQ(loco::DataType::S16, weights_of(graph.fc1)->dtype());
+  ASSERT_EQ(loco::DataType::S32, dynamic_cast<luci::CircleConst *>(graph.fc1->bias())->dtype());
+
+  // int16 fc1 is converted to float for fc2
+  auto dequantize = dynamic_cast<luci::CircleDequantize *>(graph.fc2->input());
+  ASSERT_NE(nullptr, dequantize);
+  ASSERT_EQ(graph.fc1, dequantize->input());
+  ASSERT_EQ("fc1/Dequantize", dequantize->name());
+  ASSERT_EQ(loco::DataType::FLOAT32, dequantize->dtype());
+  ASSERT_EQ(nullptr, dequantize->quantparam());
+
+  // fc2 is left in float, without min/max
+  ASSERT_EQ(loco::DataType::FLOAT32, graph.fc2->dtype());
+  ASSERT_EQ(nullptr, graph.fc2->quantparam());
+  ASSERT_EQ(loco::DataType::FLOAT32, weights_of(graph.fc2)->dtype());
+  ASSERT_EQ(nullptr, weights_of(graph.fc2)->quantparam());
+  ASSERT_EQ(loco::DataType::FLOAT32, graph.output->dtype());
+}
+
+TEST(QuantizeWithMinMaxPass, mixed_precision_float_input)
+{
+  FCFCGraph graph;
+  luci::LayerPrecisionMap layer_precision{{"input", loco::DataType::FLOAT32}};
+
+  quantize(graph.g.get(), layer_precision);
+
+  // float input is quantized to uint8 for fc1
+  ASSERT_EQ(loco::DataType::FLOAT32, graph.input->dtype());
+  ASSERT_EQ(nullptr, graph.input->quantparam());
+
+  auto quantize = dynamic_cast<luci::CircleQuantize *>(graph.fc1->input());
+  ASSERT_NE(nullptr, quantize);
+  ASSERT_EQ(graph.input, quantize->input());
+  ASSERT_EQ(loco::DataType::U8, quantize->dtype());
+  ASSERT_FLOAT_EQ(0.01f, quantize->quantparam()->scale.at(0));
+  ASSERT_EQ(0, quantize->quantparam()->zerop.at(0));
+
+  // Layers of the same type are connected as they are
+  ASSERT_EQ(graph.fc1, graph.fc2->input());
+  ASSERT_EQ(loco::DataType::U8, graph.fc1->dtype());
+  ASSERT_EQ(loco::DataType::U8, graph.fc2->dtype());
+  ASSERT_EQ(loco::DataType::U8, graph.output->dtype());
+}
+
+TEST(QuantizeWithMinMaxPass, sparse_weights_NEG)
+{
+  FCFCGraph graph;
+  weights_of(graph.fc2)->sparsityparam(std::make_unique<luci::SparsityParam>());
+
+  EXPECT_ANY_THROW(quantize(graph.g.get(), {}));
+}
+
+TEST(QuantizeWithMinMaxPass, sparse_weights_float_layer)
+{
+  FCFCGraph graph;
+  weights_of(graph.fc2)->sparsityparam(std::make_unique<luci::SparsityParam>());
+
+  // Sparse weights of a float layer are left as they are
+  quantize(graph.g.get(), {{"fc2", loco::DataType::FLOAT32}});
+
+  ASSERT_EQ(loco::DataType::FLOAT32, weights_of(graph.fc2)->dtype());
+  ASSERT_NE(nullptr, weights_of(graph.fc2)->sparsityparam());
+}
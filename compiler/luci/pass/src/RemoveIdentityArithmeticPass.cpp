@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/Pass/RemoveIdentityArithmeticPass.h"
+
+#include <luci/IR/CircleNodes.h>
+
+#include <loco/Service/ShapeInference.h>
+
+namespace
+{
+
+bool is_filled_with(loco::Node *node, float value)
+{
+  auto constant = dynamic_cast<luci::CircleConst *>(node);
+  if (constant == nullptr || constant->dtype() != loco::DataType::FLOAT32)
+    return false;
+  // Zeros are not stored in a sparse constant
+  if (constant->sparsityparam() != nullptr)
+    return false;
+
+  for (uint32_t i = 0; i < constant->size<loco::DataType::FLOAT32>(); ++i)
+  {
+    if (constant->at<loco::DataType::FLOAT32>(i) != value)
+      return false;
+  }
+  return true;
+}
+
+/**
+ * @brief  Replace 'node' with 'input' when 'node' is an identity function of 'input'
+ */
+template <class BINARY> bool remove_identity(BINARY *node, loco::Node *input)
+{
+  if (node->fusedActivationFunction() != luci::FusedActFunc::NONE)
+    return false;
+
+  if (node->quantparam() != nullptr)
+    return false;
+
+  // Broadcasting with the constant should not change the shape
+  if (not(loco::shape_known(node) && loco::shape_known(input)))
+    return false;
+  loco::NodeShape node_shape = loco::shape_get(node);
+  loco::NodeShape input_shape = loco::shape_get(input);
+  if (node_shape.domain() != loco::Domain::Tensor ||
+      input_shape.domain() != loco::Domain::Tensor ||
+      !(node_shape.as<loco::TensorShape>() == input_shape.as<loco::TensorShape>()))
+    return false;
+
+  loco::replace(node).with(input);
+  return true;
+}
+
+} // namespace
+
+namespace luci
+{
+
+bool RemoveIdentityArithmeticPass::apply(loco::Node *node)
+{
+  if (auto add = dynamic_cast<luci::CircleAdd *>(node))
+  {
+    if (is_filled_with(add->y(), 0.0f))
+      return remove_identity(add, add->x());
+    if (is_filled_with(add->x(), 0.0f))
+      return remove_identity(add, add->y());
+  }
+
+  if (auto sub = dynamic_cast<luci::CircleSub *>(node))
+  {
+    if (is_filled_with(sub->y(), 0.0f))
+      return remove_identity(sub, sub->x());
+  }
+
+  if (auto mul = dynamic_cast<luci::CircleMul *>(node))
+  {
+    if (is_filled_with(mul->y(), 1.0f))
+      return remove_identity(mul, mul->x());
+    if (is_filled_with(mul->x(), 1.0f))
+      return remove_identity(mul, mul->y());
+  }
+
+  if (auto div = dynamic_cast<luci::CircleDiv *>(node))
+  {
+    if (is_filled_with(div->y(), 1.0f))
+      return remove_identity(div, div->x());
+  }
+
+  return false;
+}
+
+} // namespace luci
@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/Pass/RemoveIdentityArithmeticPass.h"
+#include "luci/Pass/ShapeInferencePass.h"
+
+#include <luci/IR/CircleNodes.h>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+
+luci::CircleConst *create_const(loco::Graph *g, const std::vector<uint32_t> &shape, float value)
+{
+  auto node = g->nodes()->create<luci::CircleConst>();
+  node->dtype(loco::DataType::FLOAT32);
+  node->rank(shape.size());
+  uint32_t size = 1;
+  for (uint32_t i = 0; i < shape.size(); ++i)
+  {
+    node->dim(i) = shape[i];
+    size *= shape[i];
+  }
+  node->size<loco::DataType::FLOAT32>(size);
+  for (uint32_t i = 0; i < size; ++i)
+    node->at<loco::DataType::FLOAT32>(i) = value;
+  return node;
+}
+
+/**
+ *  [Input] -- [BINARY(constant)] -- [Output]
+ */
+template <class BINARY> class BinaryGraph
+{
+public:
+  BinaryGraph(const std::vector<uint32_t> &const_shape, float value,
+              const std::vector<uint32_t> &output_shape = {2, 3})
+  {
+    input = g->nodes()->create<luci::CircleInput>();
+    binary = g->nodes()->create<BINARY>();
+    output = g->nodes()->create<luci::CircleOutput>();
+
+    auto graph_input = g->inputs()->create();
+    input->index(graph_input->index());
+    input->dtype(loco::DataType::FLOAT32);
+    input->shape({2, 3});
+
+    constant = create_const(g.get(), const_shape, value);
+
+    binary->x(input);
+    binary->y(constant);
+    binary->fusedActivationFunction(luci::FusedActFunc::NONE);
+    output->from(binary);
+
+    auto graph_output = g->outputs()->create();
+    output->index(graph_output->index());
+    graph_output->dtype(loco::DataType::FLOAT32);
+    auto shape = std::make_unique<loco::TensorShape>();
+    shape->rank(output_shape.size());
+    for (uint32_t i = 0; i < output_shape.size(); ++i)
+      shape->dim(i) = output_shape[i];
+    graph_output->shape(std::move(shape));
+  }
+
+public:
+  std::unique_ptr<loco::Graph> g = loco::make_graph();
+  luci::CircleInput *input = nullptr;
+  luci::CircleConst *constant = nullptr;
+  BINARY *binary = nullptr;
+  luci::CircleOutput *output = nullptr;
+};
+
+} // namespace
+
+TEST(RemoveIdentityArithmeticPass, add_zero)
+{
+  BinaryGraph<luci::CircleAdd> graph({3}, 0.0f);
+  luci::ShapeInferencePass().run(graph.g.get());
+  luci::RemoveIdentityArithmeticPass pass;
+
+  ASSERT_TRUE(pass.apply(graph.binary));
+  ASSERT_EQ(graph.output->from(), graph.input);
+}
+
+TEST(RemoveIdentityArithmeticPass, zero_add)
+{
+  BinaryGraph<luci::CircleAdd> graph({3}, 0.0f);
+  graph.binary->x(graph.constant);
+  graph.binary->y(graph.input);
+  luci::ShapeInferencePass().run(graph.g.get());
+  luci::RemoveIdentityArithmeticPass pass;
+
+  ASSERT_TRUE(pass.apply(graph.binary));
+  ASSERT_EQ(graph.output->from(), graph.input);
+}
+
+TEST(RemoveIdentityArithmeticPass, sub_zero)
+{
+  BinaryGraph<luci::CircleSub> graph({1}, 0.0f);
+  luci::ShapeInferencePass().run(graph.g.get());
+  luci::RemoveIdentityArithmeticPass pass;
+
+  ASSERT_TRUE(pass.apply(graph.binary));
+  ASSERT_EQ(graph.output->from(), graph.input);
+}
+
+TEST(RemoveIdentityArithmeticPass, mul_one)
+{
+  BinaryGraph<luci::CircleMul> graph({2, 3}, 1.0f);
+  luci::ShapeInferencePass().run(graph.g.get());
+  luci::RemoveIdentityArithmeticPass pass;
+
+  ASSERT_TRUE(pass.apply(graph.binary));
+  ASSERT_EQ(graph.output->from(), graph.input);
+}
+
+TEST(RemoveIdentityArithmeticPass, div_one)
+{
+  BinaryGraph<luci::CircleDiv> graph({1}, 1.0f);
+  luci::ShapeInferencePass().run(graph.g.get());
+  luci::RemoveIdentityArithmeticPass pass;
+
+  ASSERT_TRUE(pass.apply(graph.binary));
+  ASSERT_EQ(graph.output->from(), graph.input);
+}
+
+TEST(RemoveIdentityArithmeticPass, add_nonzero_NEG)
+{
+  BinaryGraph<luci::CircleAdd> graph({3}, 1.0f);
+  luci::ShapeInferencePass().run(graph.g.get());
+  luci::RemoveIdentityArithmeticPass pass;
+
+  ASSERT_FALSE(pass.apply(graph.binary));
+  ASSERT_EQ(graph.output->from(), graph.binary);
+}
+
+TEST(RemoveIdentityArithmeticPass, zero_sub_NEG)
+{
+  BinaryGraph<luci::CircleSub> graph({1}, 0.0f);
+  graph.binary->x(graph.constant);
+  graph.binary->y(graph.input);
+  luci::ShapeInferencePass().run(graph.g.get());
+  luci::RemoveIdentityArithmeticPass pass;
+
+  ASSERT_FALSE(pass.apply(graph.binary));
+  ASSERT_EQ(graph.output->from(), graph.binary);
+}
+
+TEST(RemoveIdentityArithmeticPass, broadcast_NEG)
+{
+  // Output is broadcasted to the shape of the constant
+  BinaryGraph<luci::CircleMul> graph({4, 2, 3}, 1.0f, {4, 2, 3});
+  luci::ShapeInferencePass().run(graph.g.get());
+  luci::RemoveIdentityArithmeticPass pass;
+
+  ASSERT_FALSE(pass.apply(graph.binary));
+  ASSERT_EQ(graph.output->from(), graph.binary);
+}
+
+TEST(RemoveIdentityArithmeticPass, fused_activation_NEG)
+{
+  BinaryGraph<luci::CircleAdd> graph({3}, 0.0f);
+  graph.binary->fusedActivationFunction(luci::FusedActFunc::RELU);
+  luci::ShapeInferencePass().run(graph.g.get());
+  luci::RemoveIdentityArithmeticPass pass;
+
+  ASSERT_FALSE(pass.apply(graph.binary));
+  ASSERT_EQ(graph.output->from(), graph.binary);
+}
+
+TEST(RemoveIdentityArithmeticPass, unknown_shape_NEG)
+{
+  BinaryGraph<luci::CircleAdd> graph({3}, 0.0f);
+  luci::RemoveIdentityArithmeticPass pass;
+
+  ASSERT_FALSE(pass.apply(graph.binary));
+  ASSERT_EQ(graph.output->from(), graph.binary);
+}
+
+TEST(RemoveIdentityArithmeticPass, sparse_constant_NEG)
+{
+  // Ones of a sparse constant may be surrounded by zeros which are not stored
+  BinaryGraph<luci::CircleMul> graph({2, 3}, 1.0f);
+  graph.constant->size<loco::DataType::FLOAT32>(2);
+  graph.constant->sparsityparam(std::make_unique<luci::SparsityParam>());
+  luci::ShapeInferencePass().run(graph.g.get());
+  luci::RemoveIdentityArithmeticPass pass;
+
+  ASSERT_FALSE(pass.apply(graph.binary));
+  ASSERT_EQ(graph.output->from(), graph.binary);
+}
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/Pass/RemoveRedundantReshapePass.h"
+
+#include <luci/IR/CircleNodes.h>
+
+#include <loco/Service/ShapeInference.h>
+
+namespace luci
+{
+
+/**
+ *  BEFORE
+ *        [X] -- [Reshape] -- [Reshape] -- [Y]
+ *        [X] -- [Reshape] -- [Y]              (X and Y have the same shape)
+ *
+ *  AFTER
+ *        [X] -- [Reshape] -- [Y]
+ *        [X] -- [Y]
+ */
+bool RemoveRedundantReshapePass::apply(loco::Node *node)
+{
+  auto reshape = dynamic_cast<luci::CircleReshape *>(node);
+  if (reshape == nullptr)
+    return false;
+
+  if (auto pred = dynamic_cast<luci::CircleReshape *>(reshape->tensor()))
+  {
+    reshape->tensor(pred->tensor());
+    return true;
+  }
+
+  auto input = reshape->tensor();
+  if (loco::shape_known(input) && loco::shape_known(reshape))
+  {
+    auto input_shape = loco::shape_get(input);
+    auto output_shape = loco::shape_get(reshape);
+    if (input_shape.domain() == loco::Domain::Tensor &&
+        output_shape.domain() == loco::Domain::Tensor &&
+        input_shape.as<loco::TensorShape>() == output_shape.as<loco::TensorShape>())
+    {
+      loco::replace(reshape).with(input);
+      return true;
+    }
+  }
+
+  return false;
+}
+
+} // namespace luci
@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/Pass/RemoveRedundantReshapePass.h"
+#include "luci/Pass/ShapeInferencePass.h"
+
+#include <luci/IR/CircleNodes.h>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+
+luci::CircleReshape *create_reshape(loco::Graph *g, loco::Node *tensor,
+                                    const std::vector<int32_t> &new_shape)
+{
+  auto shape = g->nodes()->create<luci::CircleConst>();
+  shape->dtype(loco::DataType::S32);
+  shape->rank(1);
+  shape->dim(0) = new_shape.size();
+  shape->size<loco::DataType::S32>(new_shape.size());
+  for (uint32_t i = 0; i < new_shape.size(); ++i)
+    shape->at<loco::DataType::S32>(i) = new_shape[i];
+
+  auto reshape = g->nodes()->create<luci::CircleReshape>();
+  reshape->tensor(tensor);
+  reshape->shape(shape);
+  reshape->newShape()->rank(new_shape.size());
+  for (uint32_t i = 0; i < new_shape.size(); ++i)
+    reshape->newShape()->dim(i) = new_shape[i];
+  return reshape;
+}
+
+/**
+ *  [Input(2x3)] -- [Reshape(first)] -- [Reshape(second)] -- [Output]
+ */
+class ReshapeReshapeGraph
+{
+public:
+  ReshapeReshapeGraph(const std::vector<int32_t> &first_shape,
+                      const std::vector<int32_t> &second_shape)
+  {
+    input = g->nodes()->create<luci::CircleInput>();
+    auto graph_input = g->inputs()->create();
+    input->index(graph_input->index());
+    input->dtype(loco::DataType::FLOAT32);
+    input->shape({2, 3});
+
+    first = create_reshape(g.get(), input, first_shape);
+    second = create_reshape(g.get(), first, second_shape);
+
+    output = g->nodes()->create<luci::CircleOutput>();
+    output->from(second);
+    auto graph_output = g->outputs()->create();
+    output->index(graph_output->index());
+    graph_output->dtype(loco::DataType::FLOAT32);
+    auto shape = std::make_unique<loco::TensorShape>();
+    shape->rank(second_shape.size());
+    for (uint32_t i = 0; i < second_shape.size(); ++i)
+      shape->dim(i) = second_shape[i];
+    graph_output->shape(std::move(shape));
+  }
+
+public:
+  std::unique_ptr<loco::Graph> g = loco::make_graph();
+  luci::CircleInput *input = nullptr;
+  luci::CircleReshape *first = nullptr;
+  luci::CircleReshape *second = nullptr;
+  luci::CircleOutput *output = nullptr;
+};
+
+} // namespace
+
+TEST(RemoveRedundantReshapePass, collapse_reshape_chain)
+{
+  ReshapeReshapeGraph graph({6}, {3, 2});
+  luci::RemoveRedundantReshapePass pass;
+
+  ASSERT_TRUE(pass.apply(graph.second));
+
+  ASSERT_EQ(graph.second->tensor(), graph.input);
+  ASSERT_EQ(graph.output->from(), graph.second);
+}
+
+TEST(RemoveRedundantReshapePass, remove_noop_reshape)
+{
+  ReshapeReshapeGraph graph({6}, {2, 3});
+  luci::ShapeInferencePass().run(graph.g.get());
+  luci::RemoveRedundantReshapePass pass;
+
+  ASSERT_TRUE(pass.apply(graph.second));
+  ASSERT_TRUE(pass.apply(graph.second));
+
+  ASSERT_EQ(graph.output->from(), graph.input);
+}
+
+TEST(RemoveRedundantReshapePass, run_over_graph)
+{
+  ReshapeReshapeGraph graph({6}, {2, 3});
+  luci::ShapeInferencePass().run(graph.g.get());
+  luci::RemoveRedundantReshapePass pass;
+
+  while (pass.run(graph.g.get()))
+    ;
+
+  ASSERT_EQ(graph.output->from(), graph.input);
+}
+
+TEST(RemoveRedundantReshapePass, reshape_to_other_shape_NEG)
+{
+  ReshapeReshapeGraph graph({6}, {3, 2});
+  luci::ShapeInferencePass().run(graph.g.get());
+  luci::RemoveRedundantReshapePass pass;
+
+  ASSERT_FALSE(pass.apply(graph.first));
+  ASSERT_EQ(graph.second->tensor(), graph.first);
+}
+
+TEST(RemoveRedundantReshapePass, unknown_shape_NEG)
+{
+  ReshapeReshapeGraph graph({2, 3}, {6});
+  luci::RemoveRedundantReshapePass pass;
+
+  ASSERT_FALSE(pass.apply(graph.first));
+  ASSERT_EQ(graph.second->tensor(), graph.first);
+}
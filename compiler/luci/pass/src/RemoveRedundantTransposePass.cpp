@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/Pass/RemoveRedundantTransposePass.h"
+
+#include <luci/IR/CircleNodes.h>
+
+#include <vector>
+
+namespace
+{
+
+bool read_perm(loco::Node *node, std::vector<int32_t> &perm)
+{
+  auto perm_const = dynamic_cast<luci::CircleConst *>(node);
+  if (perm_const == nullptr || perm_const->dtype() != loco::DataType::S32)
+    return false;
+  if (perm_const->sparsityparam() != nullptr)
+    return false;
+
+  for (uint32_t i = 0; i < perm_const->size<loco::DataType::S32>(); ++i)
+    perm.push_back(perm_const->at<loco::DataType::S32>(i));
+
+  return true;
+}
+
+bool is_identity(const std::vector<int32_t> &perm)
+{
+  for (uint32_t i = 0; i < perm.size(); ++i)
+  {
+    if (perm[i] != static_cast<int32_t>(i))
+      return false;
+  }
+  return true;
+}
+
+} // namespace
+
+namespace luci
+{
+
+/**
+ *  BEFORE
+ *        [X] -- [Transpose(perm1)] -- [Transpose(perm2)] -- [Y]
+ *
+ *  AFTER
+ *        [X] -- [Transpose(perm)] -- [Y]    where perm[i] = perm1[perm2[i]]
+ *    or  [X] -- [Y]                         when perm is identity
+ */
+bool RemoveRedundantTransposePass::apply(loco::Node *node)
+{
+  auto transpose = dynamic_cast<luci::CircleTranspose *>(node);
+  if (transpose == nullptr)
+    return false;
+
+  std::vector<int32_t> perm2;
+  if (!read_perm(transpose->perm(), perm2))
+    return false;
+
+  if (is_identity(perm2))
+  {
+    loco::replace(transpose).with(transpose->a());
+    return true;
+  }
+
+  auto pred = dynamic_cast<luci::CircleTranspose *>(transpose->a());
+  if (pred == nullptr)
+    return false;
+
+  std::vector<int32_t> perm1;
+  if (!read_perm(pred->perm(), perm1) || perm1.size() != perm2.size())
+    return false;
+
+  std::vector<int32_t> perm;
+  for (auto axis : perm2)
+  {
+    if (axis < 0 || axis >= static_cast<int32_t>(perm1.size()))
+      return false;
+    perm.push_back(perm1[axis]);
+  }
+
+  if (is_identity(perm))
+  {
+    loco::replace(transpose).with(pred->a());
+    return true;
+  }
+
+  auto perm_const = transpose->graph()->nodes()->create<luci::CircleConst>();
+  perm_const->dtype(loco::DataType::S32);
+  perm_const->size<loco::DataType::S32>(perm.size());
+  perm_const->rank(1);
+  perm_const->dim(0) = perm.size();
+  for (uint32_t i = 0; i < perm.size(); ++i)
+    perm_const->at<loco::DataType::S32>(i) = perm[i];
+  perm_const->shape_status(luci::ShapeStatus::VALID);
+
+  transpose->a(pred->a());
+  transpose->perm(perm_const);
+
+  return true;
+}
+
+} // namespace luci
@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/Pass/RemoveRedundantTransposePass.h"
+
+#include <luci/IR/CircleNodes.h>
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace
+{
+
+luci::CircleConst *create_perm(loco::Graph *g, const std::vector<int32_t> &perm)
+{
+  auto node = g->nodes()->create<luci::CircleConst>();
+  node->dtype(loco::DataType::S32);
+  node->rank(1);
+  node->dim(0) = perm.size();
+  node->size<loco::DataType::S32>(perm.size());
+  for (uint32_t i = 0; i < perm.size(); ++i)
+    node->at<loco::DataType::S32>(i) = perm[i];
+  return node;
+}
+
+std::vector<int32_t> read_perm(loco::Node *node)
+{
+  auto perm = dynamic_cast<luci::CircleConst *>(node);
+  std::vector<int32_t> values;
+  for (uint32_t i = 0; i < perm->size<loco::DataType::S32>(); ++i)
+    values.push_back(perm->at<loco::DataType::S32>(i));
+  return values;
+}
+
+/**
+ *  [Input] -- [Transpose(perm1)] -- [Transpose(perm2)] -- [Output]
+ */
+class TransposeTransposeGraph
+{
+public:
+  TransposeTransposeGraph(const std::vector<int32_t> &perm1, const std::vector<int32_t> &perm2)
+  {
+    input = g->nodes()->create<luci::CircleInput>();
+    first = g->nodes()->create<luci::CircleTranspose>();
+    second = g->nodes()->create<luci::CircleTranspose>();
+    output = g->nodes()->create<luci::CircleOutput>();
+
+    first->a(input);
+    first->perm(create_perm(g.get(), perm1));
+    second->a(first);
+    second->perm(create_perm(g.get(), perm2));
+    output->from(second);
+
+    auto graph_output = g->outputs()->create();
+    output->index(graph_output->index());
+  }
+
+public:
+  std::unique_ptr<loco::Graph> g = loco::make_graph();
+  luci::CircleInput *input = nullptr;
+  luci::CircleTranspose *first = nullptr;
+  luci::CircleTranspose *second = nullptr;
+  luci::CircleOutput *output = nullptr;
+};
+
+} // namespace
+
+TEST(RemoveRedundantTransposePass, remove_inverse_transpose)
+{
+  TransposeTransposeGraph graph({0, 2, 3, 1}, {0, 3, 1, 2});
+  luci::RemoveRedundantTransposePass pass;
+
+  ASSERT_TRUE(pass.apply(graph.second));
+  ASSERT_EQ(graph.output->from(), graph.input);
+}
+
+TEST(RemoveRedundantTransposePass, merge_transpose)
+{
+  TransposeTransposeGraph graph({1, 0, 2}, {0, 2, 1});
+  luci::RemoveRedundantTransposePass pass;
+
+  ASSERT_TRUE(pass.apply(graph.second));
+
+  ASSERT_EQ(graph.output->from(), graph.second);
+  ASSERT_EQ(graph.second->a(), graph.input);
+  ASSERT_EQ(read_perm(graph.second->perm()), (std::vector<int32_t>{1, 2, 0}));
+  // Original perm is kept as it may be shared
+  ASSERT_EQ(read_perm(graph.first->perm()), (std::vector<int32_t>{1, 0, 2}));
+}
+
+TEST(RemoveRedundantTransposePass, remove_identity_transpose)
+{
+  TransposeTransposeGraph graph({0, 1, 2}, {1, 0, 2});
+  luci::RemoveRedundantTransposePass pass;
+
+  ASSERT_TRUE(pass.apply(graph.first));
+  ASSERT_EQ(graph.second->a(), graph.input);
+}
+
+TEST(RemoveRedundantTransposePass, run_over_graph)
+{
+  TransposeTransposeGraph graph({1, 0}, {1, 0});
+  luci::RemoveRedundantTransposePass pass;
+
+  ASSERT_TRUE(pass.run(graph.g.get()));
+  ASSERT_EQ(graph.output->from(), graph.input);
+}
+
+TEST(RemoveRedundantTransposePass, perm_size_mismatch_NEG)
+{
+  TransposeTransposeGraph graph({1, 0}, {0, 2, 1});
+  luci::RemoveRedundantTransposePass pass;
+
+  ASSERT_FALSE(pass.apply(graph.second));
+  ASSERT_EQ(graph.second->a(), graph.first);
+}
+
+TEST(RemoveRedundantTransposePass, non_const_perm_NEG)
+{
+  TransposeTransposeGraph graph({1, 0}, {1, 0});
+  graph.second->perm(graph.input);
+  luci::RemoveRedundantTransposePass pass;
+
+  ASSERT_FALSE(pass.apply(graph.second));
+  ASSERT_EQ(graph.second->a(), graph.first);
+}
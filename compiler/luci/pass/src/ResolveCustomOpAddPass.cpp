@@ -105,20 +105,13 @@ bool resolve_custom_op(luci::CircleCustom *addv2)
 namespace luci
 {
 
-bool ResolveCustomOpAddPass::run(loco::Graph *g)
+bool ResolveCustomOpAddPass::apply(loco::Node *node)
 {
-  bool changed = false;
-
-  for (auto node : loco::active_nodes(loco::output_nodes(g)))
-  {
-    auto cop = dynamic_cast<luci::CircleCustom *>(node);
-    if (not cop)
-      continue;
-
-    changed |= resolve_custom_op(cop);
-  }
+  auto cop = dynamic_cast<luci::CircleCustom *>(node);
+  if (not cop)
+    return false;
 
-  return changed;
+  return resolve_custom_op(cop);
 }
 
 } // namespace luci
@@ -161,25 +161,16 @@ bool resolve_matmul(luci::CircleCustom *cop)
 namespace luci
 {
 
-bool ResolveCustomOpMatMulPass::run(loco::Graph *g)
+bool ResolveCustomOpMatMulPass::apply(loco::Node *node)
 {
-  bool changed = false;
-  for (auto node : loco::active_nodes(loco::output_nodes(g)))
-  {
-    auto cop = dynamic_cast<luci::CircleCustom *>(node);
-    if (not cop)
-      continue;
-
-    if (cop->custom_code() != "MatMul")
-      continue;
-
-    if (!resolve_matmul(cop))
-      continue;
+  auto cop = dynamic_cast<luci::CircleCustom *>(node);
+  if (not cop)
+    return false;
 
-    changed = true;
-  }
+  if (cop->custom_code() != "MatMul")
+    return false;
 
-  return changed;
+  return resolve_matmul(cop);
 }
 
 } // namespace luci
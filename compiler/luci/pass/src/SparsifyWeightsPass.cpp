@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/Pass/SparsifyWeightsPass.h"
+
+#include <luci/IR/CircleNodes.h>
+#include <luci/Log.h>
+
+#include <loco/IR/Algorithm.h>
+
+#include <cassert>
+#include <memory>
+#include <stdexcept>
+
+namespace
+{
+
+using namespace luci;
+
+// Weights of FullyConnected, or weights of Conv2D which works as FullyConnected on each pixel
+bool is_sparsifiable_use(loco::Node *node, luci::CircleConst *weights)
+{
+  if (auto fc = dynamic_cast<luci::CircleFullyConnected *>(node))
+    return fc->weights() == weights && weights->rank() == 2;
+
+  if (auto conv = dynamic_cast<luci::CircleConv2D *>(node))
+  {
+    return conv->filter() == weights && weights->rank() == 4 && weights->dim(1).value() == 1 &&
+           weights->dim(2).value() == 1 && conv->stride()->h() == 1 &&
+           conv->stride()->w() == 1 && conv->dilation()->h() == 1 && conv->dilation()->w() == 1;
+  }
+
+  return false;
+}
+
+bool is_sparsifiable(luci::CircleConst *weights)
+{
+  if (weights->dtype() != loco::DataType::FLOAT32 || weights->sparsityparam() != nullptr)
+    return false;
+
+  auto succs = loco::succs(weights);
+  if (succs.empty())
+    return false;
+
+  for (auto succ : succs)
+  {
+    if (!is_sparsifiable_use(succ, weights))
+      return false;
+  }
+  return true;
+}
+
+/**
+ * @brief Store weights of [d0, ..., dn-1] in block compressed sparse row format
+ *
+ * The matrix of [d0 * ... * dn-2, dn-1] is split into blocks of br x bc. Non-zero blocks are kept
+ * in row-major order of blocks, with values of each block in row-major order.
+ *
+ * @return false if the weights are not sparse enough
+ */
+bool sparsify(luci::CircleConst *weights, int32_t br, int32_t bc, float min_sparsity)
+{
+  const uint32_t rank = weights->rank();
+  const int32_t cols = weights->dim(rank - 1).value();
+  const int32_t rows = static_cast<int32_t>(weights->size<loco::DataType::FLOAT32>()) / cols;
+  if (rows % br != 0 || cols % bc != 0)
+    return false;
+
+  const int32_t block_rows = rows / br;
+  const int32_t block_cols = cols / bc;
+
+  auto is_zero_block = [&](int32_t r, int32_t c) {
+    for (int32_t i = 0; i < br; ++i)
+      for (int32_t j = 0; j < bc; ++j)
+        if (weights->at<loco::DataType::FLOAT32>((r * br + i) * cols + c * bc + j) != 0.0f)
+          return false;
+    return true;
+  };
+
+  std::vector<int32_t> segments{0};
+  std::vector<int32_t> indices;
+  for (int32_t r = 0; r < block_rows; ++r)
+  {
+    for (int32_t c = 0; c < block_cols; ++c)
+    {
+      if (!is_zero_block(r, c))
+        indices.push_back(c);
+    }
+    segments.push_back(static_cast<int32_t>(indices.size()));
+  }
+
+  const auto num_blocks = static_cast<float>(block_rows) * block_cols;
+  if (num_blocks - indices.size() < min_sparsity * num_blocks)
+    return false;
+
+  std::vector<float> values;
+  values.reserve(indices.size() * br * bc);
+  for (int32_t r = 0; r < block_rows; ++r)
+  {
+    for (int32_t k = segments[r]; k < segments[r + 1]; ++k)
+    {
+      const int32_t c = indices[k];
+      for (int32_t i = 0; i < br; ++i)
+        for (int32_t j = 0; j < bc; ++j)
+          values.push_back(weights->at<loco::DataType::FLOAT32>((r * br + i) * cols + c * bc + j));
+    }
+  }
+
+  const bool blocked = br > 1 || bc > 1;
+  auto sparsityparam = std::make_unique<luci::SparsityParam>();
+  for (uint32_t i = 0; i < rank + (blocked ? 2 : 0); ++i)
+    sparsityparam->traversal_order.push_back(static_cast<int32_t>(i));
+  if (blocked)
+    sparsityparam->block_map = {0, static_cast<int32_t>(rank - 1)};
+
+  for (uint32_t i = 0; i < rank - 1; ++i)
+  {
+    luci::DimMetaData dm;
+    dm.format = luci::DimensionType::DENSE;
+    dm.dense_size = static_cast<int32_t>(weights->dim(i).value()) / (i == 0 ? br : 1);
+    sparsityparam->dim_metadata.push_back(dm);
+  }
+  {
+    luci::DimMetaData dm;
+    dm.format = luci::DimensionType::SPARSE_CSR;
+    dm.array_segments = std::move(segments);
+    dm.array_indices = std::move(indices);
+    sparsityparam->dim_metadata.push_back(dm);
+  }
+  if (blocked)
+  {
+    for (auto size : {br, bc})
+    {
+      luci::DimMetaData dm;
+      dm.format = luci::DimensionType::DENSE;
+      dm.dense_size = size;
+      sparsityparam->dim_metadata.push_back(dm);
+    }
+  }
+
+  // Shape is kept dense, while values keep the non-zero blocks only
+  weights->size<loco::DataType::FLOAT32>(values.size());
+  for (uint32_t i = 0; i < values.size(); ++i)
+    weights->at<loco::DataType::FLOAT32>(i) = values[i];
+  weights->sparsityparam(std::move(sparsityparam));
+
+  return true;
+}
+
+} // namespace
+
+namespace luci
+{
+
+bool SparsifyWeightsPass::run(loco::Graph *g)
+{
+  LOGGER(l);
+
+  if (_block_size.size() != 2 || _block_size[0] <= 0 || _block_size[1] <= 0)
+    throw std::runtime_error("Block size of sparsity should be two positive numbers");
+
+  bool changed = false;
+  for (auto node : loco::active_nodes(loco::output_nodes(g)))
+  {
+    auto weights = dynamic_cast<luci::CircleConst *>(node);
+    if (weights == nullptr || !is_sparsifiable(weights))
+      continue;
+
+    if (sparsify(weights, _block_size[0], _block_size[1], _min_sparsity))
+    {
+      INFO(l) << "SparsifyWeightsPass: " << weights->name() << " is sparsified" << std::endl;
+      changed = true;
+    }
+  }
+
+  return changed;
+}
+
+} // namespace luci
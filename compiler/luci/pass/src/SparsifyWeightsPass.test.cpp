@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/Pass/SparsifyWeightsPass.h"
+
+#include <luci/IR/CircleNodes.h>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+
+luci::CircleConst *create_const(loco::Graph *g, const std::vector<uint32_t> &shape,
+                                const std::vector<float> &values)
+{
+  auto node = g->nodes()->create<luci::CircleConst>();
+  node->dtype(loco::DataType::FLOAT32);
+  node->rank(shape.size());
+  for (uint32_t i = 0; i < shape.size(); ++i)
+    node->dim(i) = shape[i];
+  node->size<loco::DataType::FLOAT32>(values.size());
+  for (uint32_t i = 0; i < values.size(); ++i)
+    node->at<loco::DataType::FLOAT32>(i) = values[i];
+  return node;
+}
+
+/**
+ *  [Input] -- [FullyConnected(weights)] -- [Output]
+ */
+class FullyConnectedGraph
+{
+public:
+  FullyConnectedGraph(const std::vector<uint32_t> &shape, const std::vector<float> &values)
+  {
+    input = g->nodes()->create<luci::CircleInput>();
+    fc = g->nodes()->create<luci::CircleFullyConnected>();
+    output = g->nodes()->create<luci::CircleOutput>();
+    weights = create_const(g.get(), shape, values);
+    bias = g->nodes()->create<luci::CircleOutputExclude>();
+
+    fc->input(input);
+    fc->weights(weights);
+    fc->bias(bias);
+    fc->fusedActivationFunction(luci::FusedActFunc::NONE);
+    output->from(fc);
+
+    auto graph_input = g->inputs()->create();
+    input->index(graph_input->index());
+    auto graph_output = g->outputs()->create();
+    output->index(graph_output->index());
+  }
+
+public:
+  std::unique_ptr<loco::Graph> g = loco::make_graph();
+  luci::CircleInput *input = nullptr;
+  luci::CircleFullyConnected *fc = nullptr;
+  luci::CircleConst *weights = nullptr;
+  luci::CircleOutputExclude *bias = nullptr;
+  luci::CircleOutput *output = nullptr;
+};
+
+// 4x8 weights where the blocks of 1x4 at (0, 1), (2, 0) and (3, 1) are non-zero
+const std::vector<float> pruned_weights{
+    0, 0, 0, 0, 1, 2, 3, 4, //
+    0, 0, 0, 0, 0, 0, 0, 0, //
+    5, 0, 6, 0, 0, 0, 0, 0, //
+    0, 0, 0, 0, 0, 0, 0, 7, //
+};
+
+} // namespace
+
+TEST(SparsifyWeightsPassTest, fully_connected_1x4)
+{
+  FullyConnectedGraph graph({4, 8}, pruned_weights);
+
+  luci::SparsifyWeightsPass pass({1, 4}, 0.5f);
+  ASSERT_TRUE(pass.run(graph.g.get()));
+
+  auto sparsity = graph.weights->sparsityparam();
+  ASSERT_NE(nullptr, sparsity);
+  EXPECT_EQ((std::vector<int32_t>{0, 1, 2, 3}), sparsity->traversal_order);
+  EXPECT_EQ((std::vector<int32_t>{0, 1}), sparsity->block_map);
+  ASSERT_EQ(4, sparsity->dim_metadata.size());
+  EXPECT_EQ(luci::DimensionType::DENSE, sparsity->dim_metadata[0].format);
+  EXPECT_EQ(4, sparsity->dim_metadata[0].dense_size);
+  EXPECT_EQ(luci::DimensionType::SPARSE_CSR, sparsity->dim_metadata[1].format);
+  EXPECT_EQ((std::vector<int32_t>{0, 1, 1, 2, 3}), sparsity->dim_metadata[1].array_segments);
+  EXPECT_EQ((std::vector<int32_t>{1, 0, 1}), sparsity->dim_metadata[1].array_indices);
+  EXPECT_EQ(1, sparsity->dim_metadata[2].dense_size);
+  EXPECT_EQ(4, sparsity->dim_metadata[3].dense_size);
+
+  // Shape is kept, while values are the non-zero blocks only
+  ASSERT_EQ(2, graph.weights->rank());
+  EXPECT_EQ(4, graph.weights->dim(0).value());
+  EXPECT_EQ(8, graph.weights->dim(1).value());
+  const std::vector<float> expected{1, 2, 3, 4, 5, 0, 6, 0, 0, 0, 0, 7};
+  ASSERT_EQ(expected.size(), graph.weights->size<loco::DataType::FLOAT32>());
+  for (uint32_t i = 0; i < expected.size(); ++i)
+    EXPECT_EQ(expected[i], graph.weights->at<loco::DataType::FLOAT32>(i));
+}
+
+TEST(SparsifyWeightsPassTest, fully_connected_without_block)
+{
+  FullyConnectedGraph graph({4, 8}, pruned_weights);
+
+  luci::SparsifyWeightsPass pass({1, 1}, 0.5f);
+  ASSERT_TRUE(pass.run(graph.g.get()));
+
+  auto sparsity = graph.weights->sparsityparam();
+  ASSERT_NE(nullptr, sparsity);
+  EXPECT_EQ((std::vector<int32_t>{0, 1}), sparsity->traversal_order);
+  EXPECT_TRUE(sparsity->block_map.empty());
+  ASSERT_EQ(2, sparsity->dim_metadata.size());
+  EXPECT_EQ((std::vector<int32_t>{0, 4, 4, 6, 7}), sparsity->dim_metadata[1].array_segments);
+  EXPECT_EQ(7, graph.weights->size<loco::DataType::FLOAT32>());
+}
+
+TEST(SparsifyWeightsPassTest, conv2d_1x1)
+{
+  FullyConnectedGraph graph({4, 8}, pruned_weights);
+
+  // Replace FullyConnected with 1x1 Conv2D of the same weights
+  auto conv = graph.g->nodes()->create<luci::CircleConv2D>();
+  auto filter = create_const(graph.g.get(), {4, 1, 1, 8}, pruned_weights);
+  conv->input(graph.input);
+  conv->filter(filter);
+  conv->bias(graph.bias);
+  conv->fusedActivationFunction(luci::FusedActFunc::NONE);
+  conv->stride()->h(1);
+  conv->stride()->w(1);
+  graph.output->from(conv);
+
+  luci::SparsifyWeightsPass pass({1, 4}, 0.5f);
+  ASSERT_TRUE(pass.run(graph.g.get()));
+
+  auto sparsity = filter->sparsityparam();
+  ASSERT_NE(nullptr, sparsity);
+  EXPECT_EQ((std::vector<int32_t>{0, 3}), sparsity->block_map);
+  ASSERT_EQ(6, sparsity->dim_metadata.size());
+  EXPECT_EQ(luci::DimensionType::SPARSE_CSR, sparsity->dim_metadata[3].format);
+  EXPECT_EQ((std::vector<int32_t>{1, 0, 1}), sparsity->dim_metadata[3].array_indices);
+  EXPECT_EQ(12, filter->size<loco::DataType::FLOAT32>());
+}
+
+TEST(SparsifyWeightsPassTest, dense_enough_NEG)
+{
+  FullyConnectedGraph graph({4, 8}, pruned_weights);
+
+  // 5 of 8 blocks are zero
+  luci::SparsifyWeightsPass pass({1, 4}, 0.7f);
+  ASSERT_FALSE(pass.run(graph.g.get()));
+  EXPECT_EQ(nullptr, graph.weights->sparsityparam());
+  EXPECT_EQ(32, graph.weights->size<loco::DataType::FLOAT32>());
+}
+
+TEST(SparsifyWeightsPassTest, indivisible_block_NEG)
+{
+  FullyConnectedGraph graph({4, 8}, pruned_weights);
+
+  luci::SparsifyWeightsPass pass({3, 1}, 0.5f);
+  ASSERT_FALSE(pass.run(graph.g.get()));
+  EXPECT_EQ(nullptr, graph.weights->sparsityparam());
+}
+
+TEST(SparsifyWeightsPassTest, invalid_block_size_NEG)
+{
+  FullyConnectedGraph graph({4, 8}, pruned_weights);
+
+  luci::SparsifyWeightsPass pass({4}, 0.5f);
+  EXPECT_THROW(pass.run(graph.g.get()), std::runtime_error);
+}
@@ -331,6 +331,12 @@ template <class CIRCLENODE> loco::NodeShape use_x(const CIRCLENODE *node)
   return loco::NodeShape{x_shape};
 }
 
+template <class CIRCLENODE> loco::NodeShape use_input(const CIRCLENODE *node)
+{
+  auto input_shape = loco::shape_get(node->input()).template as<loco::TensorShape>();
+  return loco::NodeShape{input_shape};
+}
+
 template <class CIRCLENODE> loco::NodeShape use_logits(const CIRCLENODE *node)
 {
   auto shape = loco::shape_get(node->logits()).template as<loco::TensorShape>();
@@ -684,6 +690,8 @@ public:
     return loco::NodeShape{ofm_shape};
   }
 
+  loco::NodeShape visit(const luci::CircleDequantize *node) final { return use_input(node); }
+
   loco::NodeShape visit(const luci::CircleDiv *node) final { return broadcast_xy(node); }
 
   loco::NodeShape visit(const luci::CircleElu *node) final
@@ -1133,6 +1141,8 @@ public:
     return loco::NodeShape{output_shape};
   }
 
+  loco::NodeShape visit(const luci::CircleQuantize *node) final { return use_input(node); }
+
   loco::NodeShape visit(const luci::CircleRange *node) final
   {
     loco::TensorShape output_shape;
@@ -111,6 +111,8 @@ struct TypeInferenceAlgorithm final : public luci::CircleNodeVisitor<loco::DataT
     return loco::dtype_get(node->input());
   }
 
+  loco::DataType visit(const luci::CircleDequantize *) final { return loco::DataType::FLOAT32; }
+
   loco::DataType visit(const luci::CircleDiv *node) final { return loco::dtype_get(node->x()); }
 
   loco::DataType visit(const luci::CircleElu *node) final
@@ -291,6 +293,9 @@ struct TypeInferenceAlgorithm final : public luci::CircleNodeVisitor<loco::DataT
     return input_type;
   }
 
+  // Output type of QUANTIZE is given by the output tensor
+  loco::DataType visit(const luci::CircleQuantize *node) final { return node->dtype(); }
+
   loco::DataType visit(const luci::CircleRange *node) final
   {
     return loco::dtype_get(node->start());
@@ -120,7 +120,8 @@ int entry(int argc, char **argv)
 
   // Import from input Circle file
   luci::Importer importer;
-  auto module = importer.importModule(circle_model);
+  auto module = importer.importModule(reinterpret_cast<const uint8_t *>(model_data.data()),
+                                      model_data.size());
   assert(module->size() > 0);
 
   for (size_t g = 0; g < module->size(); ++g)
@@ -20,6 +20,7 @@
 #include "mir/Visitor.h"
 #include "mir/Operation.h"
 #include "mir/TensorVariant.h"
+#include <cstdint>
 #include <unordered_map>
 #include <vector>
 
@@ -29,7 +30,8 @@ namespace mir_interpreter
 class MIRInterpreter : public mir::Visitor
 {
 public:
-  explicit MIRInterpreter() = default;
+  /// @param num_threads Number of threads used by heavy operations (convolutions, fully connected)
+  explicit MIRInterpreter(std::int32_t num_threads = 1) : _num_threads(num_threads) {}
 
   ~MIRInterpreter() override = default;
 
@@ -94,6 +96,8 @@ private:
 
   /// @brief Mapping of operation outputs to corresponding tensors.
   std::unordered_map<const mir::Operation::Output *, mir::TensorVariant> _tensors;
+
+  std::int32_t _num_threads;
 };
 
 } // namespace mir_interpreter
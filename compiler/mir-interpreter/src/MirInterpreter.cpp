@@ -148,7 +148,7 @@ void MIRInterpreter::visit(ops::Conv2DOp &op)
   {
     bias = &(inputs[2].get());
   }
-  Conv2D(inputs[0], inputs[1], op.getAttributes(), outputs[0], bias);
+  Conv2D(inputs[0], inputs[1], op.getAttributes(), outputs[0], bias, _num_threads);
 }
 
 void MIRInterpreter::visit(ops::MaxPool2DOp &op)
@@ -196,7 +196,7 @@ void MIRInterpreter::visit(ops::FullyConnectedOp &op)
   {
     bias = &(inputs[3].get());
   }
-  FullyConnected(inputs[0], inputs[1], op, outputs[0], bias);
+  FullyConnected(inputs[0], inputs[1], op, outputs[0], bias, _num_threads);
 }
 
 void MIRInterpreter::visit(ops::CappedReluOp &op)
@@ -215,7 +215,7 @@ void MIRInterpreter::visit(ops::DepthwiseConv2DOp &op)
   {
     bias = &inputs[3].get();
   }
-  DepthwiseConv2D(op, inputs[0], inputs[1], outputs[0], bias);
+  DepthwiseConv2D(op, inputs[0], inputs[1], outputs[0], bias, _num_threads);
 }
 
 void MIRInterpreter::visit(ops::SliceOp &op)
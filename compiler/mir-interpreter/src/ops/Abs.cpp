@@ -29,13 +29,7 @@ template <typename T> struct AbsImpl
 {
   static void run(const mir::TensorVariant &arg, mir::TensorVariant &result)
   {
-    mir::Tensor<T> arg_accessor(arg);
-    mir::Tensor<T> res_accessor(result);
-
-    for (const auto &index : mir::ShapeRange(result.getShape()))
-    {
-      res_accessor.at(index) = std::abs(arg_accessor.at(index));
-    }
+    applyUnary<T>(arg, result, [](T x) { return std::abs(x); });
   }
 };
 
@@ -35,13 +35,8 @@ template <typename T> struct CappedReLUImpl
 template <typename T>
 void CappedReLUImpl<T>::run(const mir::TensorVariant &arg, float cap, mir::TensorVariant &result)
 {
-  mir::Tensor<T> arg_accessor(arg);
-  mir::Tensor<T> res_accessor(result);
-
-  for (const auto &index : mir::ShapeRange(result.getShape()))
-  {
-    res_accessor.at(index) = std::min(std::max(arg_accessor.at(index), T(0)), static_cast<T>(cap));
-  }
+  applyUnary<T>(arg, result,
+                [cap](T x) { return std::min(std::max(x, T(0)), static_cast<T>(cap)); });
 }
 
 static float dequantize(uint8_t x, const mir::AffineQuantization &q)
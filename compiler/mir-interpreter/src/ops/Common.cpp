@@ -18,6 +18,10 @@
 
 #include "Common.h"
 
+#include <algorithm>
+#include <thread>
+#include <vector>
+
 namespace mir_interpreter
 {
 
@@ -34,4 +38,21 @@ Index shift(const Index &in_index, const Shape &shift_from)
   return index;
 }
 
+void parallelFor(std::int32_t num_threads, std::int32_t size,
+                 const std::function<void(std::int32_t, std::int32_t)> &func)
+{
+  const std::int32_t num_chunks = std::max(1, std::min(num_threads, size));
+  const std::int32_t chunk_size = (size + num_chunks - 1) / num_chunks;
+
+  // The last chunk runs on the calling thread
+  std::vector<std::thread> threads;
+  for (std::int32_t begin = 0; begin + chunk_size < size; begin += chunk_size)
+    threads.emplace_back(func, begin, begin + chunk_size);
+  const std::int32_t last = static_cast<std::int32_t>(threads.size()) * chunk_size;
+  func(last, size);
+
+  for (auto &thread : threads)
+    thread.join();
+}
+
 } // namespace mir_interpreter
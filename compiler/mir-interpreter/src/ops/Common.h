@@ -23,6 +23,10 @@
 #include "mir/Shape.h"
 #include "mir/Index.h"
 
+#include <cassert>
+#include <cstdint>
+#include <functional>
+
 namespace mir_interpreter
 {
 
@@ -60,6 +64,50 @@ template <typename T> void erase(mir::TensorVariant &tv)
 
 mir::Index shift(const mir::Index &in_index, const mir::Shape &shift_from);
 
+/**
+ * @brief Applies @p func to every element of @p arg and stores it to @p result of the same shape
+ *
+ * Tensors are accessed as flat arrays, the loop is simple enough to be vectorized by compiler.
+ */
+template <typename T, typename F>
+void applyUnary(const mir::TensorVariant &arg, mir::TensorVariant &result, F func)
+{
+  assert(arg.getShape() == result.getShape());
+  const auto *arg_data = reinterpret_cast<const T *>(arg.atOffset(0));
+  auto *res_data = reinterpret_cast<T *>(result.atOffset(0));
+  const std::int32_t num_elements = result.getShape().numElements();
+  for (std::int32_t i = 0; i < num_elements; ++i)
+    res_data[i] = func(arg_data[i]);
+}
+
+/**
+ * @brief Applies @p func to elements of @p lhs and @p rhs at the same positions, if both have
+ *        the shape of @p result
+ * @return false if arguments need broadcasting, nothing is computed in this case
+ */
+template <typename T, typename F>
+bool tryApplyBinary(const mir::TensorVariant &lhs, const mir::TensorVariant &rhs,
+                    mir::TensorVariant &result, F func)
+{
+  if (lhs.getShape() != result.getShape() || rhs.getShape() != result.getShape())
+    return false;
+
+  const auto *lhs_data = reinterpret_cast<const T *>(lhs.atOffset(0));
+  const auto *rhs_data = reinterpret_cast<const T *>(rhs.atOffset(0));
+  auto *res_data = reinterpret_cast<T *>(result.atOffset(0));
+  const std::int32_t num_elements = result.getShape().numElements();
+  for (std::int32_t i = 0; i < num_elements; ++i)
+    res_data[i] = func(lhs_data[i], rhs_data[i]);
+  return true;
+}
+
+/**
+ * @brief Splits range [0, @p size) into at most @p num_threads chunks and calls
+ *        @p func(begin, end) for each of them on its own thread
+ */
+void parallelFor(std::int32_t num_threads, std::int32_t size,
+                 const std::function<void(std::int32_t, std::int32_t)> &func);
+
 } // namespace mir_interpreter
 
 #endif // _NNC_CORE_BACKEND_INTERPRETER_COMMON_
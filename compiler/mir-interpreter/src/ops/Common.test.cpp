@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Common.h"
+#include "TestUtils.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <vector>
+
+using namespace mir;
+using namespace mir_interpreter::test;
+
+namespace
+{
+
+void checkParallelFor(std::int32_t num_threads, std::int32_t size)
+{
+  std::vector<std::atomic<int>> visits(size);
+  for (auto &visit : visits)
+    visit = 0;
+
+  mir_interpreter::parallelFor(num_threads, size, [&](std::int32_t begin, std::int32_t end) {
+    ASSERT_LE(0, begin);
+    ASSERT_LE(begin, end);
+    ASSERT_LE(end, size);
+    for (std::int32_t i = begin; i < end; ++i)
+      visits[i]++;
+  });
+
+  for (std::int32_t i = 0; i < size; ++i)
+    EXPECT_EQ(visits[i], 1) << "at " << i;
+}
+
+} // namespace
+
+TEST(CommonTest, parallelFor)
+{
+  checkParallelFor(1, 10);
+  checkParallelFor(3, 10);
+  checkParallelFor(3, 9);
+  checkParallelFor(4, 2);
+  checkParallelFor(3, 0);
+}
+
+TEST(CommonTest, applyUnary)
+{
+  const Shape shape{2, 3};
+  auto arg = makeTensor(DataType::FLOAT32, shape, makeData(shape.numElements()));
+  TensorVariant result(DataType::FLOAT32, shape);
+
+  mir_interpreter::applyUnary<float>(arg, result, [](float x) { return 2.0f * x; });
+
+  const auto *arg_data = reinterpret_cast<const float *>(arg.atOffset(0));
+  const auto *result_data = reinterpret_cast<const float *>(result.atOffset(0));
+  for (std::int32_t i = 0; i < shape.numElements(); ++i)
+    EXPECT_EQ(result_data[i], 2.0f * arg_data[i]);
+}
+
+TEST(CommonTest, tryApplyBinary)
+{
+  const Shape shape{2, 3};
+  auto lhs = makeTensor(DataType::FLOAT32, shape, makeData(shape.numElements(), 1));
+  auto rhs = makeTensor(DataType::FLOAT32, shape, makeData(shape.numElements(), 2));
+  TensorVariant result(DataType::FLOAT32, shape);
+
+  ASSERT_TRUE(mir_interpreter::tryApplyBinary<float>(lhs, rhs, result,
+                                                     [](float a, float b) { return a - b; }));
+
+  const auto *lhs_data = reinterpret_cast<const float *>(lhs.atOffset(0));
+  const auto *rhs_data = reinterpret_cast<const float *>(rhs.atOffset(0));
+  const auto *result_data = reinterpret_cast<const float *>(result.atOffset(0));
+  for (std::int32_t i = 0; i < shape.numElements(); ++i)
+    EXPECT_EQ(result_data[i], lhs_data[i] - rhs_data[i]);
+}
+
+TEST(CommonTest, tryApplyBinary_broadcast_NEG)
+{
+  const Shape shape{2, 3};
+  auto lhs = makeTensor(DataType::FLOAT32, shape, makeData(shape.numElements(), 1));
+  auto rhs = makeTensor(DataType::FLOAT32, Shape{1, 3}, makeData(3, 2));
+  TensorVariant result(DataType::FLOAT32, shape);
+
+  EXPECT_FALSE(mir_interpreter::tryApplyBinary<float>(lhs, rhs, result,
+                                                      [](float a, float b) { return a - b; }));
+}
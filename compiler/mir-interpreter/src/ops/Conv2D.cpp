@@ -18,10 +18,13 @@
 #include "Conv2D.h"
 #include "QuantizationHelpers.h"
 #include "Common.h"
+#include "Gemm.h"
 
 #include "mir/Tensor.h"
 
+#include <algorithm>
 #include <cmath>
+#include <vector>
 
 namespace mir_interpreter
 {
@@ -38,13 +41,13 @@ template <typename T> struct Conv2DImpl
 {
   static void run(const TensorVariant &input, const TensorVariant &kernel,
                   const Conv2DOpAttributes &attributes, TensorVariant &result,
-                  const TensorVariant *fused_bias);
+                  const TensorVariant *fused_bias, std::int32_t num_threads);
 };
 
 template <typename T>
 void Conv2DImpl<T>::run(const TensorVariant &input, const TensorVariant &kernel,
                         const Conv2DOpAttributes &attributes, TensorVariant &result,
-                        const TensorVariant *fused_bias)
+                        const TensorVariant *fused_bias, std::int32_t num_threads)
 {
   const auto *input_data = reinterpret_cast<const T *>(input.atOffset(0));
   const auto *kernel_data = reinterpret_cast<const T *>(kernel.atOffset(0));
@@ -130,16 +133,113 @@ void Conv2DImpl<T>::run(const TensorVariant &input, const TensorVariant &kernel,
   }
 }
 
+template <> struct Conv2DImpl<float>
+{
+  static void run(const TensorVariant &input, const TensorVariant &kernel,
+                  const Conv2DOpAttributes &attributes, TensorVariant &result,
+                  const TensorVariant *fused_bias, std::int32_t num_threads);
+};
+
+void Conv2DImpl<float>::run(const TensorVariant &input, const TensorVariant &kernel,
+                            const Conv2DOpAttributes &attributes, TensorVariant &result,
+                            const TensorVariant *fused_bias, std::int32_t num_threads)
+{
+  const auto *input_data = reinterpret_cast<const float *>(input.atOffset(0));
+  const auto *kernel_data = reinterpret_cast<const float *>(kernel.atOffset(0));
+  auto *result_data = reinterpret_cast<float *>(result.atOffset(0));
+
+  const Shape &input_shape = input.getShape();
+  const Shape &output_shape = result.getShape();
+  const Shape &kernel_shape = kernel.getShape();
+
+  const std::vector<std::int32_t> &strides = attributes.strides;
+  const std::vector<std::int32_t> &padding_before = attributes.padding_before;
+  const std::int32_t num_groups = attributes.num_groups;
+  assert(attributes.data_format == DataFormat::NHWC);
+
+  const std::int32_t output_height = output_shape.dim(1);
+  const std::int32_t output_width = output_shape.dim(2);
+  const std::int32_t kernel_height = kernel_shape.dim(1);
+  const std::int32_t kernel_width = kernel_shape.dim(2);
+  const std::int32_t input_height = input_shape.dim(1);
+  const std::int32_t input_width = input_shape.dim(2);
+
+  const std::int32_t num_in_channels = input_shape.dim(3);
+  const std::int32_t num_out_channels = output_shape.dim(3);
+
+  assert(num_in_channels % num_groups == 0);
+  assert(num_out_channels % num_groups == 0);
+
+  const std::int32_t out_group_size = num_out_channels / num_groups;
+  const std::int32_t in_group_size = num_in_channels / num_groups;
+
+  assert(kernel_shape.dim(3) == in_group_size);
+  assert(kernel_shape.dim(0) == num_out_channels);
+
+  // Every output pixel is a row of im2col matrix, multiplied by transposed kernel of its group
+  const std::int32_t num_rows = output_shape.dim(0) * output_height * output_width;
+  const std::int32_t patch_size = kernel_height * kernel_width * in_group_size;
+  // Rows are processed by blocks to bound the size of im2col buffer
+  const std::int32_t block_size = 256;
+
+  parallelFor(num_threads, num_rows, [&](std::int32_t begin, std::int32_t end) {
+    std::vector<float> patches(static_cast<size_t>(block_size) * patch_size);
+    for (std::int32_t block = begin; block < end; block += block_size)
+    {
+      const std::int32_t block_rows = std::min(block_size, end - block);
+      for (std::int32_t group = 0; group < num_groups; ++group)
+      {
+        const std::int32_t in_group_offset = group * in_group_size;
+        for (std::int32_t r = 0; r < block_rows; ++r)
+        {
+          const std::int32_t row = block + r;
+          const std::int32_t out_x = row % output_width;
+          const std::int32_t out_y = row / output_width % output_height;
+          const std::int32_t batch = row / output_width / output_height;
+          const std::int32_t in_y_origin = (out_y * strides[0]) - padding_before[0];
+          const std::int32_t in_x_origin = (out_x * strides[1]) - padding_before[1];
+
+          float *patch = patches.data() + r * patch_size;
+          for (std::int32_t kernel_y = 0; kernel_y < kernel_height; ++kernel_y)
+          {
+            for (std::int32_t kernel_x = 0; kernel_x < kernel_width; ++kernel_x)
+            {
+              const std::int32_t in_y = in_y_origin + kernel_y;
+              const std::int32_t in_x = in_x_origin + kernel_x;
+              float *dst = patch + (kernel_y * kernel_width + kernel_x) * in_group_size;
+              if ((in_y >= 0 && in_y < input_height) && (in_x >= 0 && in_x < input_width))
+              {
+                const float *src = input_data + calcOffset(input_shape, batch, in_y, in_x,
+                                                           in_group_offset);
+                std::copy(src, src + in_group_size, dst);
+              }
+              else
+              {
+                std::fill(dst, dst + in_group_size, 0.0f);
+              }
+            }
+          }
+        }
+
+        const std::int32_t out_group_offset = group * out_group_size;
+        gemm(block_rows, out_group_size, patch_size, patches.data(), patch_size,
+             kernel_data + out_group_offset * patch_size, patch_size, true,
+             result_data + block * num_out_channels + out_group_offset, num_out_channels);
+      }
+    }
+  });
+}
+
 template <> struct Conv2DImpl<uint8_t>
 {
   static void run(const TensorVariant &input, const TensorVariant &kernel,
                   const Conv2DOpAttributes &attributes, TensorVariant &result,
-                  const TensorVariant *fused_bias);
+                  const TensorVariant *fused_bias, std::int32_t num_threads);
 };
 
 void Conv2DImpl<uint8_t>::run(const TensorVariant &input, const TensorVariant &kernel,
                               const Conv2DOpAttributes &attributes, TensorVariant &result,
-                              const TensorVariant *fused_bias)
+                              const TensorVariant *fused_bias, std::int32_t num_threads)
 {
   if (!fused_bias)
   {
@@ -253,9 +353,10 @@ void Conv2DImpl<uint8_t>::run(const TensorVariant &input, const TensorVariant &k
 
 void Conv2D(const mir::TensorVariant &input, const mir::TensorVariant &kernel,
             const mir::Conv2DOpAttributes &attributes, mir::TensorVariant &result,
-            const mir::TensorVariant *fused_bias)
+            const mir::TensorVariant *fused_bias, std::int32_t num_threads)
 {
-  dispatch<Conv2DImpl>(result.getElementType(), input, kernel, attributes, result, fused_bias);
+  dispatch<Conv2DImpl>(result.getElementType(), input, kernel, attributes, result, fused_bias,
+                       num_threads);
 }
 
 } // namespace mir_interpreter
@@ -25,7 +25,7 @@ namespace mir_interpreter
 
 void Conv2D(const mir::TensorVariant &input, const mir::TensorVariant &kernel,
             const mir::Conv2DOpAttributes &attributes, mir::TensorVariant &result,
-            const mir::TensorVariant *fused_bias);
+            const mir::TensorVariant *fused_bias, std::int32_t num_threads);
 
 } // namespace mir_interpreter
 
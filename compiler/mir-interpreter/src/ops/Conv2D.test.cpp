@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Conv2D.h"
+#include "TestUtils.h"
+
+#include "mir/Graph.h"
+#include "mir/ops/InputOp.h"
+
+#include <gtest/gtest.h>
+
+using namespace mir;
+using namespace mir_interpreter::test;
+
+namespace
+{
+
+/**
+ * @brief Runs float Conv2D with @p num_threads and compares it with the double reference loops
+ */
+void checkConv2D(const Shape &input_shape, const Shape &kernel_shape,
+                 const Conv2DOpAttributes &attributes, std::int32_t num_threads)
+{
+  // Output shape is inferred by the op
+  Graph g;
+  auto input = g.create<ops::InputOp>(TensorType{DataType::FLOAT32, input_shape})->getOutput(0);
+  auto kernel = g.create<ops::InputOp>(TensorType{DataType::FLOAT32, kernel_shape})->getOutput(0);
+  auto conv = g.create<ops::Conv2DOp>(input, kernel, attributes);
+  const Shape &output_shape = conv->getOutputShape(0);
+
+  const auto input_data = makeData(input_shape.numElements(), 1);
+  const auto kernel_data = makeData(kernel_shape.numElements(), 2);
+
+  auto input_f = makeTensor(DataType::FLOAT32, input_shape, input_data);
+  auto kernel_f = makeTensor(DataType::FLOAT32, kernel_shape, kernel_data);
+  TensorVariant result_f(DataType::FLOAT32, output_shape);
+  mir_interpreter::Conv2D(input_f, kernel_f, attributes, result_f, nullptr, num_threads);
+
+  auto input_d = makeTensor(DataType::FLOAT64, input_shape, input_data);
+  auto kernel_d = makeTensor(DataType::FLOAT64, kernel_shape, kernel_data);
+  TensorVariant result_d(DataType::FLOAT64, output_shape);
+  mir_interpreter::Conv2D(input_d, kernel_d, attributes, result_d, nullptr, 1);
+
+  expectNear(result_f, result_d);
+}
+
+} // namespace
+
+TEST(Conv2DTest, float_same_padding)
+{
+  Conv2DOpAttributes attributes;
+  attributes.padding_before = {1, 1};
+  attributes.padding_after = {1, 1};
+
+  checkConv2D(Shape{1, 5, 5, 3}, Shape{4, 3, 3, 3}, attributes, 1);
+}
+
+TEST(Conv2DTest, float_grouped_strided)
+{
+  Conv2DOpAttributes attributes;
+  attributes.strides = {2, 2};
+  attributes.padding_before = {1, 0};
+  attributes.padding_after = {1, 1};
+  attributes.num_groups = 2;
+
+  checkConv2D(Shape{2, 7, 6, 4}, Shape{6, 3, 3, 2}, attributes, 1);
+}
+
+TEST(Conv2DTest, float_multi_threads)
+{
+  // 2 x 20 x 20 output pixels span several im2col blocks, split among threads
+  Conv2DOpAttributes attributes;
+  attributes.padding_before = {1, 1};
+  attributes.padding_after = {1, 1};
+  attributes.num_groups = 3;
+
+  checkConv2D(Shape{2, 20, 20, 6}, Shape{9, 3, 3, 2}, attributes, 3);
+}
+
+TEST(Conv2DTest, float_threads_more_than_rows)
+{
+  Conv2DOpAttributes attributes;
+
+  checkConv2D(Shape{1, 2, 1, 2}, Shape{3, 1, 1, 2}, attributes, 4);
+}
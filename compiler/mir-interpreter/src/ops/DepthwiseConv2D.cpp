@@ -22,6 +22,7 @@
 #include "mir/ShapeRange.h"
 #include "mir/Tensor.h"
 
+#include <algorithm>
 #include <cmath>
 
 namespace mir_interpreter
@@ -33,14 +34,14 @@ template <typename T> struct DepthwiseConv2DImpl
 {
   static void run(const mir::ops::DepthwiseConv2DOp &op, const mir::TensorVariant &inputv,
                   const mir::TensorVariant &kernelv, const mir::TensorVariant *biasv,
-                  mir::TensorVariant &output);
+                  mir::TensorVariant &output, std::int32_t num_threads);
 };
 
 template <typename T>
 void DepthwiseConv2DImpl<T>::run(const mir::ops::DepthwiseConv2DOp &op,
                                  const mir::TensorVariant &inputv,
                                  const mir::TensorVariant &kernelv, const mir::TensorVariant *biasv,
-                                 mir::TensorVariant &output)
+                                 mir::TensorVariant &output, std::int32_t num_threads)
 {
   const Shape &in_shape = op.getInputShape(0);
   const Shape &kernel_shape = op.getInputShape(1);
@@ -90,17 +91,102 @@ void DepthwiseConv2DImpl<T>::run(const mir::ops::DepthwiseConv2DOp &op,
   }
 }
 
+template <> struct DepthwiseConv2DImpl<float>
+{
+  static void run(const mir::ops::DepthwiseConv2DOp &op, const mir::TensorVariant &inputv,
+                  const mir::TensorVariant &kernelv, const mir::TensorVariant *biasv,
+                  mir::TensorVariant &output, std::int32_t num_threads);
+};
+
+void DepthwiseConv2DImpl<float>::run(const mir::ops::DepthwiseConv2DOp &op,
+                                     const mir::TensorVariant &inputv,
+                                     const mir::TensorVariant &kernelv,
+                                     const mir::TensorVariant *biasv, mir::TensorVariant &output,
+                                     std::int32_t num_threads)
+{
+  const Shape &in_shape = op.getInputShape(0);
+  const Shape &kernel_shape = op.getInputShape(1);
+  const Shape &out_shape = op.getOutputShape(0);
+  const auto &strides = op.getStrides();
+  const std::vector<int32_t> &pads = op.getPaddingBefore();
+
+  assert(in_shape.rank() == 4);
+  assert(kernel_shape.rank() == 4);
+  assert(kernel_shape.dim(2) == in_shape.dim(3));
+  assert(in_shape.dim(3) * kernel_shape.dim(3) == out_shape.dim(3));
+  assert(strides.size() == 2);
+  assert(pads.size() == 2);
+
+  const auto *input_data = reinterpret_cast<const float *>(inputv.atOffset(0));
+  const auto *kernel_data = reinterpret_cast<const float *>(kernelv.atOffset(0));
+  auto *output_data = reinterpret_cast<float *>(output.atOffset(0));
+
+  const int32_t input_height = in_shape.dim(1);
+  const int32_t input_width = in_shape.dim(2);
+  const int32_t num_in_channels = in_shape.dim(3);
+  const int32_t output_height = out_shape.dim(1);
+  const int32_t output_width = out_shape.dim(2);
+  const int32_t num_out_channels = out_shape.dim(3);
+  const int32_t kernel_height = kernel_shape.dim(0);
+  const int32_t kernel_width = kernel_shape.dim(1);
+  const int32_t channel_multiplier = kernel_shape.dim(3);
+
+  // Output rows are computed independently, each output pixel accumulates kernel taps over
+  // contiguous channels
+  const int32_t num_rows = out_shape.dim(0) * output_height;
+  parallelFor(num_threads, num_rows, [&](int32_t begin, int32_t end) {
+    for (int32_t row = begin; row < end; ++row)
+    {
+      const int32_t batch = row / output_height;
+      const int32_t out_y = row % output_height;
+      for (int32_t out_x = 0; out_x < output_width; ++out_x)
+      {
+        float *out = output_data + (row * output_width + out_x) * num_out_channels;
+        std::fill(out, out + num_out_channels, 0.0f);
+        for (int32_t kernel_y = 0; kernel_y < kernel_height; ++kernel_y)
+        {
+          const int32_t in_y = out_y * strides[0] + kernel_y - pads[0];
+          if (in_y < 0 || in_y >= input_height)
+            continue;
+          for (int32_t kernel_x = 0; kernel_x < kernel_width; ++kernel_x)
+          {
+            const int32_t in_x = out_x * strides[1] + kernel_x - pads[1];
+            if (in_x < 0 || in_x >= input_width)
+              continue;
+            const float *in =
+                input_data + ((batch * input_height + in_y) * input_width + in_x) * num_in_channels;
+            const float *k = kernel_data + (kernel_y * kernel_width + kernel_x) * num_out_channels;
+            if (channel_multiplier == 1)
+            {
+              for (int32_t c = 0; c < num_out_channels; ++c)
+                out[c] += in[c] * k[c];
+            }
+            else
+            {
+              for (int32_t in_c = 0; in_c < num_in_channels; ++in_c)
+                for (int32_t m = 0; m < channel_multiplier; ++m)
+                  out[in_c * channel_multiplier + m] +=
+                      in[in_c] * k[in_c * channel_multiplier + m];
+            }
+          }
+        }
+      }
+    }
+  });
+}
+
 template <> struct DepthwiseConv2DImpl<uint8_t>
 {
   static void run(const mir::ops::DepthwiseConv2DOp &op, const mir::TensorVariant &inputv,
                   const mir::TensorVariant &kernelv, const mir::TensorVariant *biasv,
-                  mir::TensorVariant &output);
+                  mir::TensorVariant &output, std::int32_t num_threads);
 };
 
 void DepthwiseConv2DImpl<uint8_t>::run(const mir::ops::DepthwiseConv2DOp &op,
                                        const mir::TensorVariant &inputv,
                                        const mir::TensorVariant &kernelv,
-                                       const mir::TensorVariant *biasv, mir::TensorVariant &output)
+                                       const mir::TensorVariant *biasv, mir::TensorVariant &output,
+                                       std::int32_t num_threads)
 {
   if (!biasv)
   {
@@ -217,9 +303,10 @@ void DepthwiseConv2DImpl<uint8_t>::run(const mir::ops::DepthwiseConv2DOp &op,
 
 void DepthwiseConv2D(const mir::ops::DepthwiseConv2DOp &op, const mir::TensorVariant &input,
                      const mir::TensorVariant &kernel, mir::TensorVariant &output,
-                     const mir::TensorVariant *bias)
+                     const mir::TensorVariant *bias, std::int32_t num_threads)
 {
-  dispatch<DepthwiseConv2DImpl>(output.getElementType(), op, input, kernel, bias, output);
+  dispatch<DepthwiseConv2DImpl>(output.getElementType(), op, input, kernel, bias, output,
+                                num_threads);
 }
 
 } // namespace mir_interpreter
@@ -25,7 +25,7 @@ namespace mir_interpreter
 
 void DepthwiseConv2D(const mir::ops::DepthwiseConv2DOp &op, const mir::TensorVariant &input,
                      const mir::TensorVariant &kernel, mir::TensorVariant &output,
-                     const mir::TensorVariant *bias);
+                     const mir::TensorVariant *bias, std::int32_t num_threads);
 
 } // namespace mir_interpreter
 
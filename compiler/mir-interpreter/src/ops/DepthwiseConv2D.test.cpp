@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "DepthwiseConv2D.h"
+#include "TestUtils.h"
+
+#include "mir/Graph.h"
+#include "mir/ops/InputOp.h"
+
+#include <gtest/gtest.h>
+
+using namespace mir;
+using namespace mir_interpreter::test;
+
+namespace
+{
+
+/**
+ * @brief Runs float DepthwiseConv2D with @p num_threads and compares it with the double
+ *        reference loops
+ */
+void checkDepthwiseConv2D(const Shape &input_shape, const Shape &kernel_shape,
+                          const Conv2DOpAttributes &attributes, std::int32_t num_threads)
+{
+  Graph g;
+  auto input = g.create<ops::InputOp>(TensorType{DataType::FLOAT32, input_shape})->getOutput(0);
+  auto kernel = g.create<ops::InputOp>(TensorType{DataType::FLOAT32, kernel_shape})->getOutput(0);
+  auto op = dynamic_cast<ops::DepthwiseConv2DOp *>(
+      g.create<ops::DepthwiseConv2DOp>(input, kernel, attributes));
+  const Shape &output_shape = op->getOutputShape(0);
+
+  const auto input_data = makeData(input_shape.numElements(), 1);
+  const auto kernel_data = makeData(kernel_shape.numElements(), 2);
+
+  auto input_f = makeTensor(DataType::FLOAT32, input_shape, input_data);
+  auto kernel_f = makeTensor(DataType::FLOAT32, kernel_shape, kernel_data);
+  TensorVariant result_f(DataType::FLOAT32, output_shape);
+  mir_interpreter::DepthwiseConv2D(*op, input_f, kernel_f, result_f, nullptr, num_threads);
+
+  // Reference loops do not read bias, but take its accessor
+  auto input_d = makeTensor(DataType::FLOAT64, input_shape, input_data);
+  auto kernel_d = makeTensor(DataType::FLOAT64, kernel_shape, kernel_data);
+  TensorVariant bias_d(DataType::FLOAT64, Shape{output_shape.dim(3)});
+  TensorVariant result_d(DataType::FLOAT64, output_shape);
+  mir_interpreter::DepthwiseConv2D(*op, input_d, kernel_d, result_d, &bias_d, 1);
+
+  expectNear(result_f, result_d);
+}
+
+} // namespace
+
+TEST(DepthwiseConv2DTest, float_same_padding)
+{
+  Conv2DOpAttributes attributes;
+  attributes.padding_before = {1, 1};
+  attributes.padding_after = {1, 1};
+
+  checkDepthwiseConv2D(Shape{1, 5, 5, 3}, Shape{3, 3, 3, 1}, attributes, 1);
+}
+
+TEST(DepthwiseConv2DTest, float_multiplier_strided)
+{
+  Conv2DOpAttributes attributes;
+  attributes.strides = {2, 1};
+  attributes.padding_before = {0, 1};
+  attributes.padding_after = {1, 1};
+
+  checkDepthwiseConv2D(Shape{2, 7, 6, 3}, Shape{3, 2, 3, 2}, attributes, 1);
+}
+
+TEST(DepthwiseConv2DTest, float_multi_threads)
+{
+  Conv2DOpAttributes attributes;
+  attributes.padding_before = {1, 1};
+  attributes.padding_after = {1, 1};
+
+  checkDepthwiseConv2D(Shape{2, 9, 8, 4}, Shape{3, 3, 4, 3}, attributes, 3);
+}
@@ -33,14 +33,7 @@ template <typename T> struct ELUImpl
 template <typename T>
 void ELUImpl<T>::run(const mir::TensorVariant &arg, float alpha, mir::TensorVariant &result)
 {
-  mir::Tensor<T> arg_accessor(arg);
-  mir::Tensor<T> res_accessor(result);
-
-  for (const auto &index : mir::ShapeRange(result.getShape()))
-  {
-    const T x = arg_accessor.at(index);
-    res_accessor.at(index) = x < 0 ? alpha * (std::exp(x) - 1) : x;
-  }
+  applyUnary<T>(arg, result, [alpha](T x) { return x < 0 ? alpha * (std::exp(x) - 1) : x; });
 }
 
 void ELU(const mir::TensorVariant &arg, float alpha, mir::TensorVariant &result)
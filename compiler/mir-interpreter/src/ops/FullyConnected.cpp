@@ -19,6 +19,7 @@
 #include "Common.h"
 
 #include "QuantizationHelpers.h"
+#include "Gemm.h"
 
 #include "mir/Tensor.h"
 
@@ -27,7 +28,7 @@ namespace mir_interpreter
 
 template <typename T>
 static void fullyConnected2D(const mir::TensorVariant &input, const mir::TensorVariant &weights,
-                             mir::TensorVariant &output)
+                             mir::TensorVariant &output, std::int32_t num_threads)
 {
   assert(input.getShape().rank() == 2);
   assert(weights.getShape().rank() == 2);
@@ -56,18 +57,52 @@ static void fullyConnected2D(const mir::TensorVariant &input, const mir::TensorV
   }
 }
 
+template <>
+void fullyConnected2D<float>(const mir::TensorVariant &input, const mir::TensorVariant &weights,
+                             mir::TensorVariant &output, std::int32_t num_threads)
+{
+  assert(input.getShape().rank() == 2);
+  assert(weights.getShape().rank() == 2);
+  assert(input.getShape().dim(1) == weights.getShape().dim(0));
+
+  auto in_raw = reinterpret_cast<const float *>(input.atOffset(0));
+  auto weight_raw = reinterpret_cast<const float *>(weights.atOffset(0));
+  auto output_raw = reinterpret_cast<float *>(output.atOffset(0));
+
+  auto rows = output.getShape().dim(0);
+  auto cols = output.getShape().dim(1);
+  auto N = input.getShape().dim(1);
+  auto wcols = weights.getShape().dim(1);
+
+  // Rows of output are independent, a batch of one is split by columns instead
+  if (rows >= num_threads)
+  {
+    parallelFor(num_threads, rows, [&](std::int32_t begin, std::int32_t end) {
+      gemm(end - begin, cols, N, in_raw + begin * N, N, weight_raw, wcols, false,
+           output_raw + begin * cols, cols);
+    });
+  }
+  else
+  {
+    parallelFor(num_threads, cols, [&](std::int32_t begin, std::int32_t end) {
+      gemm(rows, end - begin, N, in_raw, N, weight_raw + begin, wcols, false, output_raw + begin,
+           cols);
+    });
+  }
+}
+
 template <typename T> struct FullyConnectedImpl
 {
   static void run(const mir::TensorVariant &inputv, const mir::TensorVariant &weightsv,
                   const mir::ops::FullyConnectedOp &op, mir::TensorVariant &res,
-                  const mir::TensorVariant *biasv);
+                  const mir::TensorVariant *biasv, std::int32_t num_threads);
 };
 
 template <typename T>
 void FullyConnectedImpl<T>::run(const mir::TensorVariant &inputv,
                                 const mir::TensorVariant &weightsv,
                                 const mir::ops::FullyConnectedOp &op, mir::TensorVariant &res,
-                                const mir::TensorVariant *biasv)
+                                const mir::TensorVariant *biasv, std::int32_t num_threads)
 {
   if (biasv)
   {
@@ -82,7 +117,7 @@ void FullyConnectedImpl<T>::run(const mir::TensorVariant &inputv,
   if (input.getShape().rank() == 2 && weights.getShape().rank() == 2 && res.getShape().rank() == 2)
   {
     // optimized case for 2d matrix multiplication
-    fullyConnected2D<T>(inputv, weightsv, res);
+    fullyConnected2D<T>(inputv, weightsv, res, num_threads);
     return;
   }
 
@@ -124,13 +159,13 @@ template <> struct FullyConnectedImpl<uint8_t>
 {
   static void run(const mir::TensorVariant &inputv, const mir::TensorVariant &weightsv,
                   const mir::ops::FullyConnectedOp &op, mir::TensorVariant &res,
-                  const mir::TensorVariant *biasv);
+                  const mir::TensorVariant *biasv, std::int32_t num_threads);
 };
 
 void FullyConnectedImpl<uint8_t>::run(const mir::TensorVariant &inputv,
                                       const mir::TensorVariant &weightsv,
                                       const mir::ops::FullyConnectedOp &op, mir::TensorVariant &res,
-                                      const mir::TensorVariant *biasv)
+                                      const mir::TensorVariant *biasv, std::int32_t num_threads)
 {
   if (!biasv)
   {
@@ -207,8 +242,8 @@ void FullyConnectedImpl<uint8_t>::run(const mir::TensorVariant &inputv,
 
 void FullyConnected(const mir::TensorVariant &input, const mir::TensorVariant &weights,
                     const mir::ops::FullyConnectedOp &op, mir::TensorVariant &res,
-                    const mir::TensorVariant *bias)
+                    const mir::TensorVariant *bias, std::int32_t num_threads)
 {
-  dispatch<FullyConnectedImpl>(res.getElementType(), input, weights, op, res, bias);
+  dispatch<FullyConnectedImpl>(res.getElementType(), input, weights, op, res, bias, num_threads);
 }
 } // namespace mir_interpreter
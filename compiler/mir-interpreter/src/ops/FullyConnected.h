@@ -25,7 +25,7 @@ namespace mir_interpreter
 
 void FullyConnected(const mir::TensorVariant &input, const mir::TensorVariant &weights,
                     const mir::ops::FullyConnectedOp &op, mir::TensorVariant &res,
-                    const mir::TensorVariant *bias);
+                    const mir::TensorVariant *bias, std::int32_t num_threads);
 
 } // namespace mir_interpreter
 
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "FullyConnected.h"
+#include "TestUtils.h"
+
+#include "mir/Graph.h"
+#include "mir/ops/InputOp.h"
+
+#include <gtest/gtest.h>
+
+using namespace mir;
+using namespace mir_interpreter::test;
+
+namespace
+{
+
+/**
+ * @brief Runs float FullyConnected with @p num_threads and compares it with the double
+ *        reference loops
+ */
+void checkFullyConnected(const Shape &input_shape, const Shape &weights_shape,
+                         std::int32_t num_threads)
+{
+  Graph g;
+  auto input = g.create<ops::InputOp>(TensorType{DataType::FLOAT32, input_shape})->getOutput(0);
+  auto weights =
+      g.create<ops::InputOp>(TensorType{DataType::FLOAT32, weights_shape})->getOutput(0);
+  auto op =
+      dynamic_cast<ops::FullyConnectedOp *>(g.create<ops::FullyConnectedOp>(input, weights));
+  const Shape &output_shape = op->getOutputShape(0);
+
+  const auto input_data = makeData(input_shape.numElements(), 1);
+  const auto weights_data = makeData(weights_shape.numElements(), 2);
+
+  auto input_f = makeTensor(DataType::FLOAT32, input_shape, input_data);
+  auto weights_f = makeTensor(DataType::FLOAT32, weights_shape, weights_data);
+  TensorVariant result_f(DataType::FLOAT32, output_shape);
+  mir_interpreter::FullyConnected(input_f, weights_f, *op, result_f, nullptr, num_threads);
+
+  auto input_d = makeTensor(DataType::FLOAT64, input_shape, input_data);
+  auto weights_d = makeTensor(DataType::FLOAT64, weights_shape, weights_data);
+  TensorVariant result_d(DataType::FLOAT64, output_shape);
+  mir_interpreter::FullyConnected(input_d, weights_d, *op, result_d, nullptr, 1);
+
+  expectNear(result_f, result_d);
+}
+
+} // namespace
+
+TEST(FullyConnectedTest, float_2d)
+{
+  checkFullyConnected(Shape{4, 8}, Shape{8, 5}, 1);
+}
+
+TEST(FullyConnectedTest, float_rows_multi_threads)
+{
+  // Rows are split among threads
+  checkFullyConnected(Shape{7, 16}, Shape{16, 10}, 3);
+}
+
+TEST(FullyConnectedTest, float_columns_multi_threads)
+{
+  // A batch of one is split by columns
+  checkFullyConnected(Shape{1, 16}, Shape{16, 10}, 3);
+}
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Gemm.h"
+
+#ifdef MIR_INTERPRETER_USE_EIGEN
+#include <Eigen/Core>
+#endif
+
+namespace mir_interpreter
+{
+
+#ifdef MIR_INTERPRETER_USE_EIGEN
+
+void gemm(std::int32_t m, std::int32_t n, std::int32_t k, const float *a, std::int32_t lda,
+          const float *b, std::int32_t ldb, bool transpose_b, float *c, std::int32_t ldc)
+{
+  using Matrix = Eigen::Matrix<float, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+  using ConstMap = Eigen::Map<const Matrix, Eigen::Unaligned, Eigen::OuterStride<>>;
+  using Map = Eigen::Map<Matrix, Eigen::Unaligned, Eigen::OuterStride<>>;
+
+  ConstMap a_map(a, m, k, Eigen::OuterStride<>(lda));
+  Map c_map(c, m, n, Eigen::OuterStride<>(ldc));
+  if (transpose_b)
+    c_map.noalias() = a_map * ConstMap(b, n, k, Eigen::OuterStride<>(ldb)).transpose();
+  else
+    c_map.noalias() = a_map * ConstMap(b, k, n, Eigen::OuterStride<>(ldb));
+}
+
+#else
+
+void gemm(std::int32_t m, std::int32_t n, std::int32_t k, const float *a, std::int32_t lda,
+          const float *b, std::int32_t ldb, bool transpose_b, float *c, std::int32_t ldc)
+{
+  for (std::int32_t i = 0; i < m; ++i)
+  {
+    const float *a_row = a + i * lda;
+    float *c_row = c + i * ldc;
+    if (transpose_b)
+    {
+      for (std::int32_t j = 0; j < n; ++j)
+      {
+        const float *b_row = b + j * ldb;
+        float sum = 0.0f;
+        for (std::int32_t p = 0; p < k; ++p)
+          sum += a_row[p] * b_row[p];
+        c_row[j] = sum;
+      }
+    }
+    else
+    {
+      // Rows of B are accumulated into a row of C, the inner loop is contiguous in both
+      for (std::int32_t j = 0; j < n; ++j)
+        c_row[j] = 0.0f;
+      for (std::int32_t p = 0; p < k; ++p)
+      {
+        const float a_val = a_row[p];
+        const float *b_row = b + p * ldb;
+        for (std::int32_t j = 0; j < n; ++j)
+          c_row[j] += a_val * b_row[j];
+      }
+    }
+  }
+}
+
+#endif // MIR_INTERPRETER_USE_EIGEN
+
+} // namespace mir_interpreter
@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _NNC_CORE_BACKEND_INTERPRETER_GEMM_
+#define _NNC_CORE_BACKEND_INTERPRETER_GEMM_
+
+#include <cstdint>
+
+namespace mir_interpreter
+{
+
+/**
+ * @brief Computes C = A * B, or C = A * B^T if @p transpose_b is set
+ *
+ * All matrices are row-major: A is m x k, C is m x n, B is k x n or n x k (transposed).
+ * ld* are distances between rows, in elements. Uses Eigen if it was found on build.
+ */
+void gemm(std::int32_t m, std::int32_t n, std::int32_t k, const float *a, std::int32_t lda,
+          const float *b, std::int32_t ldb, bool transpose_b, float *c, std::int32_t ldc);
+
+} // namespace mir_interpreter
+
+#endif //_NNC_CORE_BACKEND_INTERPRETER_GEMM_
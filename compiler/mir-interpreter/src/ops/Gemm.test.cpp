@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Gemm.h"
+#include "TestUtils.h"
+
+#include <gtest/gtest.h>
+
+using namespace mir_interpreter::test;
+
+namespace
+{
+
+/**
+ * @brief Checks gemm on sub-matrices, whose rows are @p pad elements longer than used
+ */
+void checkGemm(std::int32_t m, std::int32_t n, std::int32_t k, bool transpose_b, std::int32_t pad)
+{
+  const std::int32_t lda = k + pad;
+  const std::int32_t ldb = (transpose_b ? k : n) + pad;
+  const std::int32_t ldc = n + pad;
+  const auto a = makeData(m * lda, 1);
+  const auto b = makeData((transpose_b ? n : k) * ldb, 2);
+  std::vector<float> c(m * ldc, 42.0f);
+
+  mir_interpreter::gemm(m, n, k, a.data(), lda, b.data(), ldb, transpose_b, c.data(), ldc);
+
+  for (std::int32_t i = 0; i < m; ++i)
+  {
+    for (std::int32_t j = 0; j < n; ++j)
+    {
+      double expected = 0.0;
+      for (std::int32_t p = 0; p < k; ++p)
+        expected += a[i * lda + p] * (transpose_b ? b[j * ldb + p] : b[p * ldb + j]);
+      EXPECT_NEAR(c[i * ldc + j], expected, 1e-4);
+    }
+    // Padding of C is not touched
+    for (std::int32_t j = n; j < ldc; ++j)
+      EXPECT_EQ(c[i * ldc + j], 42.0f);
+  }
+}
+
+} // namespace
+
+TEST(GemmTest, simple)
+{
+  checkGemm(5, 7, 9, false, 0);
+}
+
+TEST(GemmTest, transpose_b)
+{
+  checkGemm(5, 7, 9, true, 0);
+}
+
+TEST(GemmTest, strided)
+{
+  checkGemm(6, 4, 11, false, 3);
+  checkGemm(6, 4, 11, true, 3);
+}
+
+TEST(GemmTest, overwrites_c)
+{
+  // C is not accumulated into, even with k of zero
+  checkGemm(3, 2, 0, false, 1);
+  checkGemm(3, 2, 0, true, 1);
+}
@@ -31,14 +31,7 @@ template <typename T> struct LeakyReLUImpl
 template <typename T>
 void LeakyReLUImpl<T>::run(const mir::TensorVariant &arg, float alpha, mir::TensorVariant &result)
 {
-  mir::Tensor<T> arg_accessor(arg);
-  mir::Tensor<T> res_accessor(result);
-
-  for (const auto &index : mir::ShapeRange(result.getShape()))
-  {
-    auto x = arg_accessor.at(index);
-    res_accessor.at(index) = x < 0 ? x * alpha : x;
-  }
+  applyUnary<T>(arg, result, [alpha](T x) { return x < 0 ? x * alpha : x; });
 }
 
 void LeakyReLU(const mir::TensorVariant &arg, float alpha, mir::TensorVariant &result)
@@ -35,6 +35,9 @@ template <typename T> struct MaxImpl
 template <typename T>
 void MaxImpl<T>::run(const TensorVariant &lhs, const TensorVariant &rhs, TensorVariant &res)
 {
+  if (tryApplyBinary<T>(lhs, rhs, res, [](T a, T b) { return std::max(a, b); }))
+    return;
+
   TensorVariant broadcasted_lhs(lhs, res.getShape());
   TensorVariant broadcasted_rhs(rhs, res.getShape());
   Tensor<T> lhs_accessor(broadcasted_lhs);
@@ -33,13 +33,7 @@ template <typename T> struct ReLUImpl
 template <typename T>
 void ReLUImpl<T>::run(const mir::TensorVariant &arg, mir::TensorVariant &result)
 {
-  mir::Tensor<T> arg_accessor(arg);
-  mir::Tensor<T> res_accessor(result);
-
-  for (const auto &index : mir::ShapeRange(result.getShape()))
-  {
-    res_accessor.at(index) = std::max(arg_accessor.at(index), static_cast<T>(0));
-  }
+  applyUnary<T>(arg, result, [](T x) { return std::max(x, static_cast<T>(0)); });
 }
 
 template <> struct ReLUImpl<uint8_t>
@@ -33,13 +33,7 @@ template <typename T> struct SigmoidImpl
 template <typename T>
 void SigmoidImpl<T>::run(const mir::TensorVariant &arg, mir::TensorVariant &result)
 {
-  mir::Tensor<T> arg_accessor(arg);
-  mir::Tensor<T> res_accessor(result);
-
-  for (const auto &index : mir::ShapeRange(result.getShape()))
-  {
-    res_accessor.at(index) = 1.0f / (1.0f + std::exp(-arg_accessor.at(index)));
-  }
+  applyUnary<T>(arg, result, [](T x) { return 1.0f / (1.0f + std::exp(-x)); });
 }
 
 template <> struct SigmoidImpl<uint8_t>
@@ -33,13 +33,7 @@ template <typename T> struct SqrtImpl
 template <typename T>
 void SqrtImpl<T>::run(const mir::TensorVariant &arg, mir::TensorVariant &result)
 {
-  mir::Tensor<T> arg_accessor(arg);
-  mir::Tensor<T> res_accessor(result);
-
-  for (const auto &index : mir::ShapeRange(result.getShape()))
-  {
-    res_accessor.at(index) = std::sqrt(arg_accessor.at(index));
-  }
+  applyUnary<T>(arg, result, [](T x) { return std::sqrt(x); });
 }
 
 template <> struct SqrtImpl<uint8_t>
@@ -33,6 +33,9 @@ template <typename T> struct SubImpl
 template <typename T>
 void SubImpl<T>::run(const TensorVariant &lhs, const TensorVariant &rhs, TensorVariant &res)
 {
+  if (tryApplyBinary<T>(lhs, rhs, res, [](T a, T b) { return a - b; }))
+    return;
+
   TensorVariant broadcasted_lhs(lhs, res.getShape());
   TensorVariant broadcasted_rhs(rhs, res.getShape());
   Tensor<T> lhs_accessor(broadcasted_lhs);
@@ -33,13 +33,7 @@ template <typename T> struct TanhImpl
 template <typename T>
 void TanhImpl<T>::run(const mir::TensorVariant &arg, mir::TensorVariant &result)
 {
-  mir::Tensor<T> arg_accessor(arg);
-  mir::Tensor<T> res_accessor(result);
-
-  for (const auto &index : mir::ShapeRange(result.getShape()))
-  {
-    res_accessor.at(index) = std::tanh(arg_accessor.at(index));
-  }
+  applyUnary<T>(arg, result, [](T x) { return std::tanh(x); });
 }
 
 template <> struct TanhImpl<uint8_t>
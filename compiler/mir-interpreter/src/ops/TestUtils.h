@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _NNC_CORE_BACKEND_INTERPRETER_TEST_UTILS_
+#define _NNC_CORE_BACKEND_INTERPRETER_TEST_UTILS_
+
+#include "mir/DataType.h"
+#include "mir/Shape.h"
+#include "mir/TensorVariant.h"
+
+#include <gtest/gtest.h>
+
+#include <cassert>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace mir_interpreter
+{
+namespace test
+{
+
+/**
+ * @brief Returns @p size reproducible values in [-1, 1)
+ */
+inline std::vector<float> makeData(std::int32_t size, std::uint32_t seed = 1)
+{
+  std::minstd_rand gen(seed);
+  std::vector<float> data(size);
+  for (auto &value : data)
+    value = static_cast<float>(gen() % 2048) / 1024.0f - 1.0f;
+  return data;
+}
+
+/**
+ * @brief Creates a FLOAT32 or FLOAT64 tensor of @p data
+ *
+ * Float ops have fast paths, while double ones run the reference loops. Both are fed with the
+ * same values to compare results.
+ */
+inline mir::TensorVariant makeTensor(mir::DataType type, const mir::Shape &shape,
+                                     const std::vector<float> &data)
+{
+  assert(shape.numElements() == static_cast<std::int32_t>(data.size()));
+  if (type == mir::DataType::FLOAT64)
+  {
+    std::vector<double> double_data(data.begin(), data.end());
+    return mir::TensorVariant(type, shape, double_data.data());
+  }
+  assert(type == mir::DataType::FLOAT32);
+  return mir::TensorVariant(type, shape, data.data());
+}
+
+/**
+ * @brief Checks FLOAT32 @p actual is close to FLOAT64 @p expected
+ */
+inline void expectNear(const mir::TensorVariant &actual, const mir::TensorVariant &expected,
+                       float tolerance = 1e-4f)
+{
+  ASSERT_EQ(actual.getShape(), expected.getShape());
+  const auto *actual_data = reinterpret_cast<const float *>(actual.atOffset(0));
+  const auto *expected_data = reinterpret_cast<const double *>(expected.atOffset(0));
+  for (std::int32_t i = 0; i < actual.getShape().numElements(); ++i)
+    EXPECT_NEAR(actual_data[i], expected_data[i], tolerance) << "at offset " << i;
+}
+
+} // namespace test
+} // namespace mir_interpreter
+
+#endif // _NNC_CORE_BACKEND_INTERPRETER_TEST_UTILS_
@@ -38,6 +38,8 @@ const char *to_str(logo::PhaseStrategy s)
       return "Saturate";
     case logo::PhaseStrategy::Restart:
       return "Restart";
+    case logo::PhaseStrategy::Worklist:
+      return "Worklist";
   }
   assert(false);
   return "";
@@ -80,7 +82,8 @@ void ProgressReporter::notify(const logo::PhaseEventInfo<logo::PhaseEvent::PassE
   LOGGER(prime);
 
   INFO(prime) << "After " << logo::pass_name(info->pass())
-              << " (changed: " << to_char(info->changed()) << ")";
+              << " (changed: " << to_char(info->changed()) << ", changes: " << info->changes()
+              << ", elapsed: " << info->elapsed().count() << "us)";
   INFO(prime) << moco::tf::fmt(graph());
 }
 
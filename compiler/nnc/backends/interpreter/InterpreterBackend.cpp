@@ -129,8 +129,10 @@ static TensorVariant readTensorFromFile(const std::string &filename, const Tenso
   return TensorVariant(type, data.get());
 }
 
-InterpreterBackend::InterpreterBackend(std::string input_dir, std::string output_dir)
-    : _input_dir(std::move(input_dir)), _output_dir(std::move(output_dir))
+InterpreterBackend::InterpreterBackend(std::string input_dir, std::string output_dir,
+                                       int32_t num_threads)
+    : _input_dir(std::move(input_dir)), _output_dir(std::move(output_dir)),
+      _num_threads(num_threads)
 {
 }
 
@@ -138,7 +140,7 @@ void InterpreterBackend::run(mir::Graph *graph)
 {
   assert(graph);
 
-  mir_interpreter::MIRInterpreter interpreter;
+  mir_interpreter::MIRInterpreter interpreter(_num_threads);
 
   for (const auto *input_op : graph->getInputs())
   {
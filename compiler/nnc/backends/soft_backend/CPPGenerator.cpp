@@ -79,8 +79,10 @@ static unique_ptr<ofstream> getStream(const string &path)
   return ofs;
 }
 
-CPPCodeGenerator::CPPCodeGenerator(std::string output_dir, std::string artifact_name)
-    : _output_dir(std::move(output_dir)), _artifact_name(std::move(artifact_name))
+CPPCodeGenerator::CPPCodeGenerator(std::string output_dir, std::string artifact_name,
+                                   bool specialize)
+    : _output_dir(std::move(output_dir)), _artifact_name(std::move(artifact_name)),
+      _specialize(specialize)
 {
 }
 
@@ -107,6 +109,46 @@ void CPPCodeGenerator::materializeModelParams(ostream &out, const Serializer &s)
     throw runtime_error("Failed to write model Parameters");
 }
 
+bool CPPCodeGenerator::isSpecialized(const sir::CallFunction *call) const
+{
+  // Weights are too large to be compiled in, so constants are always read from parameters file
+  return _specialize && call->paramSize > 0 &&
+         call->mirOp->getType() != mir::Operation::Type::constant;
+}
+
+string CPPCodeGenerator::getParamsArgument(const sir::CallFunction *call) const
+{
+  if (isSpecialized(call))
+    return "_op_params_" + to_string(call->paramStartOffset);
+  return "_parameters + " + to_string(params::HEADER_LEN + call->paramStartOffset);
+}
+
+void CPPCodeGenerator::materializeOperationParams(ostream &out, const ModelAnalyzer &ma,
+                                                  const Serializer &s)
+{
+  static const char hex_digits[] = "0123456789abcdef";
+
+  const auto &params = s.getBuffer();
+  for (const unique_ptr<Action> &action : ma.getInferenceSequence())
+  {
+    if (action->type != Action::Type::callFunction)
+      continue;
+    const auto *call = dynamic_cast<const sir::CallFunction *>(action.get());
+    if (!isSpecialized(call))
+      continue;
+
+    // Parameters are binary, so every byte is escaped
+    out << "static const char " << getParamsArgument(call) << "[] = \"";
+    for (size_t i = 0; i < call->paramSize; ++i)
+    {
+      const auto byte = static_cast<unsigned char>(params[call->paramStartOffset + i]);
+      out << "\\x" << hex_digits[byte >> 4] << hex_digits[byte & 0xf];
+    }
+    out << "\";\n";
+  }
+  out << "\n";
+}
+
 void CPPCodeGenerator::run(mir::Graph *graph)
 {
   assert(graph);
@@ -231,6 +273,13 @@ void CPPCodeGenerator::materializeHeader(ostream &out, const ModelAnalyzer &ma)
     const string &tName = _formattedTensors[out_tensor_id];
     out << "  std::shared_ptr<Tensor> " << tName << ";\n";
   }
+  if (_specialize)
+  {
+    // temporary(im2col) tensor shared by operations
+    out << "  Tensor " << _formattedTensors[ma.getTempTID()] << ";\n";
+    // buffer holding all temporary tensors with known shapes
+    out << "  Tensor _temporaries;\n";
+  }
   // pointer to NN parameters
   out << "  char* _parameters;\n";
   out << "  size_t _paramSize;\n";
@@ -317,8 +366,8 @@ void CPPCodeGenerator::materializeCall(ostream &out, const ModelAnalyzer &ma,
   args.reserve(prev_nodes.size() + out_tensors.size() + 1);
   // gather output arguments
   gatherOperationArguments(ma, call->outputs, args);
-  // parameters offset
-  args.push_back("_parameters + " + to_string(params::HEADER_LEN + call->paramStartOffset));
+  // parameters of operation
+  args.push_back(getParamsArgument(call));
   // gather input arguments
   gatherOperationArguments(ma, call->inputs, args);
   // put arguments into stream
@@ -344,7 +393,23 @@ void CPPCodeGenerator::materializeConstructor(ostream &out, const ModelAnalyzer
   assert(td.type == sir::TensorDescriptor::Type::temporary);
   (void)td;
   const string &t_name = _formattedTensors[constructor->tensorId];
-  out << "  Tensor " << t_name << ";\n";
+  out << "  Tensor " << t_name;
+  // Allocate with the final shape, so that operation does not reallocate it on reshape
+  const int rank = td.shape.rank();
+  if (_specialize && rank > 0)
+  {
+    out << "(Shape{";
+    for (int i = 0; i < rank; ++i)
+      out << (i == 0 ? "" : ", ") << td.shape.dim(i);
+    out << "}";
+    // Tensor placed in shared buffer references its part instead of allocating
+    const auto &offsets = ma.getTemporaryOffsets();
+    const auto offset = offsets.find(constructor->tensorId);
+    if (offset != offsets.end())
+      out << ", _temporaries.getData() + " << offset->second;
+    out << ")";
+  }
+  out << ";\n";
 }
 
 void CPPCodeGenerator::materializeDestructor(ostream &out, const ModelAnalyzer &ma,
@@ -354,6 +419,12 @@ void CPPCodeGenerator::materializeDestructor(ostream &out, const ModelAnalyzer &
   const TensorDescriptor &td = ma.getTensors()[destructor->tensorId];
   assert(td.type == sir::TensorDescriptor::Type::temporary);
   (void)td;
+  // Temporary(im2col) tensor is a member of artifact in specialized mode
+  if (_specialize && destructor->tensorId == ma.getTempTID())
+    return;
+  // Tensor placed in shared buffer does not own memory
+  if (_specialize && ma.getTemporaryOffsets().count(destructor->tensorId))
+    return;
   const string &t_name = _formattedTensors[destructor->tensorId];
   out << "  " << t_name << ".clean();\n";
 }
@@ -361,9 +432,10 @@ void CPPCodeGenerator::materializeDestructor(ostream &out, const ModelAnalyzer &
 void CPPCodeGenerator::materializeInferenceSequence(ostream &out, const ModelAnalyzer &ma)
 {
 
-  // Allocate temporary(im2col) tensor
-  out << "  Tensor " << _formattedTensors[ma.getTempTID()] << "(Shape{" << ma.getMaxTemporarySize()
-      << "});\n";
+  // Allocate temporary(im2col) tensor, it is allocated once in constructor in specialized mode
+  if (!_specialize)
+    out << "  Tensor " << _formattedTensors[ma.getTempTID()] << "(Shape{"
+        << ma.getMaxTemporarySize() << "});\n";
 
   for (const unique_ptr<Action> &action : ma.getInferenceSequence())
   {
@@ -430,13 +502,22 @@ void CPPCodeGenerator::materializeCode(ostream &out, const ModelAnalyzer &ma, co
   // Below call into operations
   out.write(cpp_leaky_relu, sizeof(cpp_leaky_relu));
 
+  if (_specialize)
+    materializeOperationParams(out, ma, s);
+
   // gen NN constructor
   out << class_name << "::" << class_name
       << "(const string& parametersPath)\n"
          "{\n"
          "  readParameters(_parameters, _paramSize, parametersPath, "
-      << s.getFormatVersion() << ", " << s.getModelHash() << ");\n"
-                                                             "}\n\n";
+      << s.getFormatVersion() << ", " << s.getModelHash() << ");\n";
+  if (_specialize)
+  {
+    out << "  " << _formattedTensors[ma.getTempTID()] << ".reshape(Shape{"
+        << ma.getMaxTemporarySize() << "});\n";
+    out << "  _temporaries.reshape(Shape{" << ma.getTemporaryBufferSize() << "});\n";
+  }
+  out << "}\n\n";
   // gen NN destructor
   out << class_name << "::~" << class_name << "()\n"
                                               "{\n"
@@ -61,8 +61,8 @@ void ModelAnalyzer::appendOperationToInference(Operation *op, const string &func
     for (const auto &output : op->getOutputs())
     {
       const auto &tensor_name = output.getName();
-      const auto tensor_id =
-          tensor_name.empty() ? declareTemporaryTensor() : declarePersistentTensor(tensor_name);
+      const auto tensor_id = tensor_name.empty() ? declareTemporaryTensor(output.getShape())
+                                                 : declarePersistentTensor(tensor_name);
       node_output_tensors.push_back(tensor_id);
     }
   }
@@ -110,10 +110,10 @@ size_t ModelAnalyzer::declarePersistentTensor(const std::string &name)
   return id;
 }
 
-size_t ModelAnalyzer::declareTemporaryTensor()
+size_t ModelAnalyzer::declareTemporaryTensor(const mir::Shape &shape)
 {
   size_t id = _allocatedTensors++;
-  _tensors.push_back({id, TensorDescriptor::Type::temporary, "", {}});
+  _tensors.push_back({id, TensorDescriptor::Type::temporary, "", shape});
   return id;
 }
 
@@ -150,6 +150,107 @@ void ModelAnalyzer::gatherDefUseInfo(const vector<unique_ptr<Action>> &post_orde
   }
 }
 
+/**
+ * @brief Checks if operation output can be written over its input
+ *
+ * These operations compute every element of output from elements of inputs at the same position,
+ * so they can be done in place if input has the same shape as output.
+ */
+static bool isElementwise(const Operation *op)
+{
+  switch (op->getType())
+  {
+    case Operation::Type::abs:
+    case Operation::Type::add:
+    case Operation::Type::cappedReLU:
+    case Operation::Type::div:
+    case Operation::Type::ELU:
+    case Operation::Type::leakyReLU:
+    case Operation::Type::max:
+    case Operation::Type::mul:
+    case Operation::Type::ReLU:
+    case Operation::Type::sigmoid:
+    case Operation::Type::sqrt:
+    case Operation::Type::sub:
+    case Operation::Type::tanh:
+      return true;
+    default:
+      return false;
+  }
+}
+
+void ModelAnalyzer::planTemporaryBuffer(const vector<unique_ptr<Action>> &post_order,
+                                        const map<size_t, size_t> &last_use)
+{
+  // Offsets are aligned to 16 elements, i.e. 64 bytes of float
+  const size_t alignment = 16;
+  auto aligned_size = [alignment](const mir::Shape &shape) {
+    const auto size = static_cast<size_t>(shape.numElements());
+    return (size + alignment - 1) / alignment * alignment;
+  };
+
+  // Tensors placed in buffer and alive at current position, ordered by offset
+  map<size_t, size_t> live_offset_to_tid;
+
+  for (size_t pos = 0; pos < post_order.size(); ++pos)
+  {
+    const auto *call = dynamic_cast<const CallFunction *>(post_order[pos].get());
+    assert(call);
+    const Operation *op = call->mirOp;
+
+    for (size_t output_tensor_id : call->outputs)
+    {
+      const TensorDescriptor &td = _tensors[output_tensor_id];
+      // Operations that fill output by copy(reshape) need an owned buffer
+      if (td.type != TensorDescriptor::Type::temporary || td.shape.rank() == 0 ||
+          op->getType() == Operation::Type::reshape || op->getType() == Operation::Type::squeeze)
+        continue;
+
+      // Take over the buffer of an input that is not used after this operation
+      bool in_place = false;
+      if (isElementwise(op))
+      {
+        for (size_t input_tensor_id : call->inputs)
+        {
+          auto offset = _temp_offsets.find(input_tensor_id);
+          if (offset == _temp_offsets.end() || last_use.at(input_tensor_id) != pos ||
+              _tensors[input_tensor_id].shape != td.shape)
+            continue;
+          _temp_offsets[output_tensor_id] = offset->second;
+          live_offset_to_tid[offset->second] = output_tensor_id;
+          in_place = true;
+          break;
+        }
+      }
+      if (in_place)
+        continue;
+
+      // Otherwise take the first gap large enough among tensors alive now
+      const size_t size = aligned_size(td.shape);
+      size_t offset = 0;
+      for (const auto &live : live_offset_to_tid)
+      {
+        if (live.first >= offset + size)
+          break;
+        offset = std::max(offset, live.first + aligned_size(_tensors[live.second].shape));
+      }
+      _temp_offsets[output_tensor_id] = offset;
+      live_offset_to_tid[offset] = output_tensor_id;
+      _temp_buffer_size = std::max(_temp_buffer_size, offset + size);
+    }
+
+    // Release buffers of tensors that are not used after this operation, or never used
+    for (auto it = live_offset_to_tid.begin(); it != live_offset_to_tid.end();)
+    {
+      const auto use = last_use.find(it->second);
+      if (use == last_use.end() || use->second == pos)
+        it = live_offset_to_tid.erase(it);
+      else
+        ++it;
+    }
+  }
+}
+
 void ModelAnalyzer::constructInferenceSequence(const vector<Operation *> &post_order)
 {
   // Run inference sequence construction over constructed list of operations
@@ -167,6 +268,9 @@ void ModelAnalyzer::constructInferenceSequence(const vector<Operation *> &post_o
   // prepare use-def info
   gatherDefUseInfo(_inferenceSequence, first_def, last_use);
 
+  // place temporary tensors with known shapes in shared buffer
+  planTemporaryBuffer(_inferenceSequence, last_use);
+
   // insert memory operations
   // Every iteration of loop contains three steps:
   // 1) insert constructors of temporary tensors used in current operations
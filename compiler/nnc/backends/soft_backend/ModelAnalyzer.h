@@ -123,6 +123,19 @@ public:
 
   size_t getTempTID() const { return _temp_tensor_id; }
 
+  /**
+   * @return Offsets of temporary tensors placed in shared buffer, in elements
+   *
+   * Temporary tensors with shapes known on compilation share one buffer. Tensors alive at the same
+   * time in inference sequence never overlap, elementwise operations reuse buffer of their input.
+   */
+  const std::map<size_t, size_t> &getTemporaryOffsets() const { return _temp_offsets; }
+
+  /**
+   * @return Size of buffer shared by temporary tensors, in elements
+   */
+  size_t getTemporaryBufferSize() const { return _temp_buffer_size; }
+
 protected:
   void visit_fallback(mir::Operation &op) override;
 
@@ -163,9 +176,10 @@ private:
 
   /**
    * @brief Declares temporary tensor in artifact
+   * @param shape Shape of tensor if known on compilation, otherwise empty
    * @return Id of created tensor
    */
-  size_t declareTemporaryTensor();
+  size_t declareTemporaryTensor(const mir::Shape &shape = {});
 
   /**
    * @brief Gathers info where tensors were defined and used in inference sequence
@@ -176,6 +190,14 @@ private:
   void gatherDefUseInfo(const std::vector<std::unique_ptr<sir::Action>> &post_order,
                         std::map<size_t, size_t> &first_def, std::map<size_t, size_t> &last_use);
 
+  /**
+   * @brief Places temporary tensors with known shapes in shared buffer
+   * @param post_order Sequence of operations in inference
+   * @param last_use Maps tensor id to position in inf sequence where it was used last time.
+   */
+  void planTemporaryBuffer(const std::vector<std::unique_ptr<sir::Action>> &post_order,
+                           const std::map<size_t, size_t> &last_use);
+
   /**
    * @brief constructs inference sequence from vector of mir::Operations, constructed
    * @param post_order vector representing layout of operations in inference
@@ -198,6 +220,9 @@ private:
   std::vector<size_t> _outputs;
   size_t _max_temp_size = 0;
   size_t _temp_tensor_id = 0;
+  /// @brief offsets of temporary tensors in shared buffer
+  std::map<size_t, size_t> _temp_offsets;
+  size_t _temp_buffer_size = 0;
   std::vector<sir::TensorDescriptor> _tensors;
   std::map<const mir::Operation *, const sir::Action *> _opToDescr;
 };
@@ -359,7 +359,10 @@ void Serializer::serialize(vector<unique_ptr<sir::Action>> &inference_sequence)
     if (action->type != sir::Action::Type::callFunction)
       continue;
     _curOp = dynamic_cast<sir::CallFunction *>(action.get());
+    // operations without parameters may not set offset
+    _curOp->paramStartOffset = _buffer.size();
     _curOp->mirOp->accept(this);
+    _curOp->paramSize = _buffer.size() - _curOp->paramStartOffset;
   }
 }
 
@@ -122,11 +122,13 @@ struct CallFunction : public Action
   CallFunction(mir::Operation *op, std::string func_name, std::vector<size_t> &&inputs,
                std::vector<size_t> &&outputs)
       : Action(Type::callFunction), mirOp(op), funcName(std::move(func_name)), inputs(inputs),
-        outputs(outputs), paramStartOffset(0)
+        outputs(outputs), paramStartOffset(0), paramSize(0)
   {
   }
 
-  CallFunction() : Action(Type::callFunction), mirOp(nullptr), paramStartOffset(0) {}
+  CallFunction() : Action(Type::callFunction), mirOp(nullptr), paramStartOffset(0), paramSize(0)
+  {
+  }
 
   mir::Operation *mirOp;
   std::string funcName;
@@ -135,6 +137,8 @@ struct CallFunction : public Action
   // list of output tensors
   std::vector<size_t> outputs;
   size_t paramStartOffset;
+  // size of serialized parameters, starting from paramStartOffset
+  size_t paramSize;
 };
 
 } // namespace sir
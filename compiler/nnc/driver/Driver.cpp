@@ -117,7 +117,7 @@ static void backend(mir::Graph *graph)
 {
   if (cli::target == NNC_TARGET_ARM_CPP || cli::target == NNC_TARGET_X86_CPP)
   {
-    CPPCodeGenerator(cli::artifactDir, cli::artifactName).run(graph);
+    CPPCodeGenerator(cli::artifactDir, cli::artifactName, cli::specializeCode).run(graph);
   }
   else if (cli::target == NNC_TARGET_ARM_GPU_CPP)
   {
@@ -125,7 +125,7 @@ static void backend(mir::Graph *graph)
   }
   else if (cli::target == NNC_TARGET_INTERPRETER)
   {
-    InterpreterBackend(cli::interInputDataDir, cli::artifactDir).run(graph);
+    InterpreterBackend(cli::interInputDataDir, cli::artifactDir, cli::interNumThreads).run(graph);
   }
   else
   {
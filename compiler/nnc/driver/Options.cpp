@@ -122,6 +122,11 @@ Option<std::string> artifactDir(optname("--output-dir, -d"),
                                 overview("specify directory for output files"),
                                 ".", // default is current directory
                                 optional(true), optvalues(""), checkOutDir, separators("="));
+Option<bool> specializeCode(optname("--specialize"),
+                            overview("emit shapes and parameters of operations as constants "
+                                     "in generated code"),
+                            false, optional(true), optvalues(""), nullptr, separators(""),
+                            showopt(true));
 
 /**
  * Options for *interpreter*
@@ -132,6 +137,10 @@ Option<std::string> interInputDataDir(optname("--input-data-dir"),
                                                "(one file for each input with the same name)"),
                                       ".", // default is current directory
                                       optional(true), optvalues(""), checkInDir);
+Option<int32_t> interNumThreads(optname("--interpreter-threads"),
+                                overview("number of threads used by convolutions "
+                                         "and fully connected operations in interpreter"),
+                                1, optional(true), optvalues(""), nullptr, separators("="));
 
 } // namespace cli
 } // namespace nnc
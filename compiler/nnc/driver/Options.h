@@ -56,11 +56,13 @@ extern Option<std::string> inputFile; // files contains model of specific AI fra
  */
 extern Option<std::string> artifactDir;  // output directory for artifact
 extern Option<std::string> artifactName; // name of artifact
+extern Option<bool> specializeCode;      // emit parameters of operations into generated code
 
 /**
  * Options for interpreter
  */
 extern Option<std::string> interInputDataDir; // directory with input data files
+extern Option<int32_t> interNumThreads;        // number of threads of interpreter
 
 } // namespace cli
 } // namespace nnc
@@ -19,6 +19,7 @@
 
 #include "mir/Graph.h"
 
+#include <cstdint>
 #include <string>
 
 namespace nnc
@@ -27,13 +28,14 @@ namespace nnc
 class InterpreterBackend final
 {
 public:
-  InterpreterBackend(std::string input_dir, std::string output_dir);
+  InterpreterBackend(std::string input_dir, std::string output_dir, int32_t num_threads = 1);
 
   void run(mir::Graph *data);
 
 private:
   std::string _input_dir;
   std::string _output_dir;
+  int32_t _num_threads;
 };
 
 } // namespace nnc
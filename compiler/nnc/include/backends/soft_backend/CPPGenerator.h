@@ -47,7 +47,13 @@ struct DestroyTmp;
 class CPPCodeGenerator final
 {
 public:
-  CPPCodeGenerator(std::string output_dir, std::string artifact_name);
+  /**
+   * @param output_dir Directory to write artifact into
+   * @param artifact_name Base name of artifact files
+   * @param specialize Whether to emit parameters of operations as constants in generated code,
+   * instead of reading them from parameters file at runtime
+   */
+  CPPCodeGenerator(std::string output_dir, std::string artifact_name, bool specialize = false);
 
   /**
    * @brief Method represents base generation sequence: analysis, serialization, header/code
@@ -151,9 +157,29 @@ private:
    * + array of serialized network parameters
    */
   void materializeModelParams(std::ostream &out, const Serializer &s);
+  /**
+   * @brief Writes parameters of operations as constant arrays into generated code
+   * @param out Stream to write program text
+   * @param ma Intermediate model representation
+   * @param s Serializer holds parameters of network
+   *
+   * Used in specialized mode only. Weights of constant operations stay in parameters file.
+   */
+  void materializeOperationParams(std::ostream &out, const ModelAnalyzer &ma, const Serializer &s);
+  /**
+   * @brief Returns expression that points parameters of operation in generated code
+   * @param call Operation call
+   */
+  std::string getParamsArgument(const sir::CallFunction *call) const;
+  /**
+   * @brief Checks parameters of operation are emitted in generated code
+   * @param call Operation call
+   */
+  bool isSpecialized(const sir::CallFunction *call) const;
 
   std::string _output_dir;
   std::string _artifact_name;
+  bool _specialize;
   std::vector<std::string> _formattedTensors;
 };
 
@@ -15,11 +15,13 @@
  */
 
 #include "backends/soft_backend/CPPGenerator.h"
+#include "mir/ops/MaxPool2DOp.h"
 #include "mir/ops/ReluOp.h"
 
 #include <gtest/gtest.h>
 
 #include <fstream>
+#include <sstream>
 #include <sys/stat.h>
 #include <unistd.h>
 #include <cstdio>
@@ -110,3 +112,36 @@ TEST(Generator, check_generator_call)
 
   deleteDir(TEST_DIR);
 }
+
+TEST(Generator, check_specialized_generator_call)
+{
+#define SPEC_TEST_DIR "spec_output_dir"
+#define SPEC_BASE_NAME SPEC_TEST_DIR "/" TEST_NAME
+
+  mir::Graph g;
+  mir::TensorType input_type{mir::DataType::FLOAT32, Shape{1, 4, 4, 2}};
+  Operation::Output *input = g.create<ops::InputOp>(input_type)->getOutput(0);
+  input->setName("input");
+  MaxPool2DOpAttributes attributes;
+  attributes.window = {2, 2};
+  attributes.strides = {2, 2};
+  Operation *pool = g.create<ops::MaxPool2DOp>(input, attributes);
+  g.create<ops::ReluOp>(pool->getOutput(0));
+
+  if (isFileExists(SPEC_TEST_DIR))
+    deleteDir(SPEC_TEST_DIR);
+  CPPCodeGenerator cpp_code_generator(SPEC_TEST_DIR, TEST_NAME, true);
+  cpp_code_generator.run(&g);
+  checkOutputExists(SPEC_BASE_NAME);
+
+  ifstream code(SPEC_BASE_NAME ".cpp");
+  stringstream ss;
+  ss << code.rdbuf();
+  // Parameters of pooling are compiled in, and its output is placed in buffer of temporaries
+  ASSERT_NE(ss.str().find("maxPool(Tensor_1, _op_params_"), string::npos);
+  ASSERT_NE(ss.str().find("Tensor Tensor_1(Shape{1, 2, 2, 2}, _temporaries.getData() + 0);"),
+            string::npos);
+  ASSERT_NE(ss.str().find("_temporaries.reshape(Shape{16});"), string::npos);
+
+  deleteDir(SPEC_TEST_DIR);
+}
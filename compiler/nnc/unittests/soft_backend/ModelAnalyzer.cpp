@@ -81,3 +81,52 @@ TEST(ModelAnalyzer, linearization)
   vector<Operation *> valid_seq2{input, head2, tail2, head1, tail1, join};
   ASSERT_TRUE(op_seq == valid_seq1 || op_seq == valid_seq2);
 }
+
+/*
+ * This test checks placement of temporary tensors in shared buffer
+ */
+TEST(ModelAnalyzer, temporary_buffer)
+{
+  mir::Graph g;
+  /*
+   * Create graph:
+   *      [input]
+   *     /       \
+   *    V         V
+   * [relu1]   [relu3]
+   *    |         |
+   *    V         |
+   * [relu2]      |
+   *     \       /
+   *      [join]
+   */
+  mir::TensorType input_type{mir::DataType::FLOAT32, Shape{1, 2, 3}};
+  Operation *input = g.create<ops::InputOp>(input_type);
+  Operation *relu1 = g.create<ops::ReluOp>(input->getOutput(0));
+  Operation *relu2 = g.create<ops::ReluOp>(relu1->getOutput(0));
+  Operation *relu3 = g.create<ops::ReluOp>(input->getOutput(0));
+  vector<mir::Operation::Output *> concat_inputs{relu2->getOutput(0), relu3->getOutput(0)};
+  Operation *join = g.create<ops::ConcatOp>(concat_inputs, 0);
+  input->getOutput(0)->setName("input");
+  join->getOutput(0)->setName("join");
+
+  ModelAnalyzer ma;
+  ma.analyze(&g);
+
+  map<const Operation *, size_t> op_to_tensor;
+  for (const auto &action : ma.getInferenceSequence())
+  {
+    const CallFunction *call = getCall(action);
+    if (call && !call->outputs.empty())
+      op_to_tensor[call->mirOp] = call->outputs[0];
+  }
+
+  const auto &offsets = ma.getTemporaryOffsets();
+  ASSERT_EQ(offsets.size(), 3u);
+  // relu2 is done in place of relu1, relu3 is alive at the same time
+  ASSERT_EQ(offsets.at(op_to_tensor[relu1]), offsets.at(op_to_tensor[relu2]));
+  ASSERT_NE(offsets.at(op_to_tensor[relu2]), offsets.at(op_to_tensor[relu3]));
+  ASSERT_EQ(offsets.count(op_to_tensor[join]), 0u);
+  // Two tensors of 6 elements, each aligned to 16
+  ASSERT_EQ(ma.getTemporaryBufferSize(), 32u);
+}
@@ -72,6 +72,22 @@ int entry(const int argc, char **argv)
       .type(arser::DataType::STR)
       .help("Record mode. percentile (default) or moving_average");
 
+  arser.add_argument("--num_threads")
+      .nargs(1)
+      .type(arser::DataType::INT32)
+      .help("Number of threads used by the interpreter (default: 1)");
+
+  arser.add_argument("--mixed_precision_budget")
+      .nargs(1)
+      .type(arser::DataType::FLOAT)
+      .help("Plan the type of each layer within this error (relative mean squared error of "
+            "outputs). --mixed_precision_plan is also required");
+
+  arser.add_argument("--mixed_precision_plan")
+      .nargs(1)
+      .type(arser::DataType::STR)
+      .help("Path to write the type of each layer for circle-quantizer");
+
   try
   {
     arser.parse(argc, argv);
@@ -91,6 +107,7 @@ int entry(const int argc, char **argv)
   std::string mode("percentile");
   float min_percentile = 1.0;
   float max_percentile = 99.0;
+  int num_threads = 1;
 
   if (arser["--min_percentile"])
     min_percentile = arser.get<float>("--min_percentile");
@@ -101,17 +118,40 @@ int entry(const int argc, char **argv)
   if (arser["--mode"])
     mode = arser.get<std::string>("--mode");
 
+  if (arser["--num_threads"])
+    num_threads = arser.get<int>("--num_threads");
+
   if (mode != "percentile" && mode != "moving_average")
     throw std::runtime_error("Unsupported mode");
 
+  if (num_threads < 1)
+    throw std::runtime_error("Number of threads should be positive");
+
+  if (arser["--mixed_precision_budget"] != arser["--mixed_precision_plan"])
+    throw std::runtime_error("Both --mixed_precision_budget and --mixed_precision_plan are needed");
+
+  float error_budget = 0;
+  std::string plan_path;
+  if (arser["--mixed_precision_budget"])
+  {
+    error_budget = arser.get<float>("--mixed_precision_budget");
+    plan_path = arser.get<std::string>("--mixed_precision_plan");
+    if (error_budget < 0)
+      throw std::runtime_error("Error budget should not be negative");
+  }
+
   RecordMinMax rmm;
 
   // Initialize interpreter and observer
-  rmm.initialize(input_model_path);
+  rmm.initialize(input_model_path, num_threads);
 
   // Profile min/max while executing the given input data
   rmm.profileData(mode, input_data_path, min_percentile, max_percentile);
 
+  // Choose the type of each layer with profiled values
+  if (!plan_path.empty())
+    rmm.planMixedPrecision(input_data_path, error_budget, plan_path);
+
   // Save profiled values to the model
   rmm.saveModel(output_model_path);
 
@@ -34,17 +34,26 @@ public:
 
   ~RecordMinMax() = default;
 
-  void initialize(const std::string &input_model_path);
+  void initialize(const std::string &input_model_path, int32_t num_threads);
 
   void profileData(const std::string &mode, const std::string &input_data_path,
                    float min_percentile, float max_percentile);
 
+  /**
+   * @brief Choose the type of each layer so that the quantization error is within the budget,
+   *        and write the plan to be used by circle-quantizer
+   * @note  profileData SHOULD be called before this
+   */
+  void planMixedPrecision(const std::string &input_data_path, float error_budget,
+                          const std::string &plan_path);
+
   void saveModel(const std::string &output_model_path);
 
 private:
   std::unique_ptr<luci::Module> _module;
   std::unique_ptr<luci_interpreter::Interpreter> _interpreter;
   std::unique_ptr<MinMaxObserver> _observer;
+  int32_t _num_threads = 1;
 };
 
 } // namespace record_minmax
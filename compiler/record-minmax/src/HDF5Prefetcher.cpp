@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "HDF5Prefetcher.h"
+
+#include <loco/IR/DataTypeTraits.h>
+
+#include <cassert>
+#include <stdexcept>
+
+using Shape = luci_interpreter::Shape;
+using DataType = luci_interpreter::DataType;
+
+namespace
+{
+
+/**
+ * @brief  getTensorSize will return size in bytes
+ */
+template <typename NodeT> size_t getTensorSize(const NodeT *node)
+{
+  uint32_t tensor_size = loco::size(node->dtype());
+  for (uint32_t i = 0; i < node->rank(); ++i)
+    tensor_size *= node->dim(i).value();
+  return tensor_size;
+}
+
+/**
+ * @brief  verifyTypeShape checks the type and the shape of CircleInput
+ *         This throws an exception if type or shape does not match
+ */
+void verifyTypeShape(const luci::CircleInput *input_node, const DataType &dtype, const Shape &shape)
+{
+  // Type check
+  if (dtype != input_node->dtype())
+    throw std::runtime_error("Wrong input type.");
+
+  if (shape.num_dims() != input_node->rank())
+    throw std::runtime_error("Input rank mismatch.");
+
+  for (uint32_t i = 0; i < shape.num_dims(); i++)
+  {
+    if (shape.dim(i) != input_node->dim(i).value())
+      throw std::runtime_error("Input shape mismatch.");
+  }
+}
+
+} // namespace
+
+namespace record_minmax
+{
+
+HDF5Prefetcher::HDF5Prefetcher(HDF5Importer &importer,
+                               const std::vector<const luci::CircleInput *> &inputs,
+                               int32_t num_records)
+    : _importer(importer), _inputs(inputs), _num_records(num_records)
+{
+  _is_raw_data = _importer.isRawData();
+
+  for (auto &slot : _slots)
+  {
+    slot.resize(_inputs.size());
+    for (size_t input_idx = 0; input_idx < _inputs.size(); ++input_idx)
+      slot[input_idx].resize(getTensorSize(_inputs[input_idx]));
+  }
+
+  _thread = std::thread(&HDF5Prefetcher::run, this);
+}
+
+HDF5Prefetcher::~HDF5Prefetcher()
+{
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _stop = true;
+  }
+  _cond.notify_all();
+  _thread.join();
+}
+
+const Record *HDF5Prefetcher::next()
+{
+  std::unique_lock<std::mutex> lock(_mutex);
+
+  // Give the slot of the previous record back to the reader
+  if (_current >= 0)
+  {
+    _filled[_current % kNumSlots] = false;
+    _cond.notify_all();
+  }
+
+  if (_current + 1 >= _num_records)
+    return nullptr;
+  ++_current;
+
+  const int32_t slot = _current % kNumSlots;
+  _cond.wait(lock, [&]() { return _filled[slot] || _error != nullptr; });
+  if (!_filled[slot])
+    std::rethrow_exception(_error);
+
+  return &_slots[slot];
+}
+
+void HDF5Prefetcher::readRecord(int32_t record_idx, Record &record)
+{
+  if (_inputs.size() != static_cast<size_t>(_importer.numInputs(record_idx)))
+    throw std::runtime_error("Wrong number of inputs.");
+
+  for (size_t input_idx = 0; input_idx < _inputs.size(); input_idx++)
+  {
+    const auto *input_node = _inputs[input_idx];
+    assert(input_node->index() == static_cast<int32_t>(input_idx));
+
+    if (!_is_raw_data)
+    {
+      DataType dtype;
+      Shape shape(input_node->rank());
+      _importer.readTensor(record_idx, input_idx, &dtype, &shape, record[input_idx].data());
+
+      // Check the type and the shape of the input data is valid
+      verifyTypeShape(input_node, dtype, shape);
+    }
+    else
+    {
+      // Skip type/shape check for raw data
+      _importer.readTensor(record_idx, input_idx, record[input_idx].data());
+    }
+  }
+}
+
+void HDF5Prefetcher::run()
+{
+  try
+  {
+    for (int32_t record_idx = 0; record_idx < _num_records; ++record_idx)
+    {
+      const int32_t slot = record_idx % kNumSlots;
+      {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _cond.wait(lock, [&]() { return _stop || !_filled[slot]; });
+        if (_stop)
+          return;
+      }
+
+      // The slot is owned by this thread until it is marked as filled
+      readRecord(record_idx, _slots[slot]);
+
+      {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _filled[slot] = true;
+      }
+      _cond.notify_all();
+    }
+  }
+  catch (...)
+  {
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _error = std::current_exception();
+    }
+    _cond.notify_all();
+  }
+}
+
+} // namespace record_minmax
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __RECORD_MINMAX_HDF5PREFETCHER_H__
+#define __RECORD_MINMAX_HDF5PREFETCHER_H__
+
+#include "HDF5Importer.h"
+
+#include <luci/IR/Nodes/CircleInput.h>
+
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace record_minmax
+{
+
+// Input data of one record (one buffer per model input)
+using Record = std::vector<std::vector<char>>;
+
+// HDF5Prefetcher reads records from the hdf5 file in a background thread, so that reading
+// the next record overlaps with the inference of the current one.
+// Two record buffers are used in turn and allocated only once.
+//
+// NOTE All accesses to the importer are done from the background thread while the prefetcher
+//      is alive, because HDF5 library is not guaranteed to be thread-safe.
+class HDF5Prefetcher
+{
+public:
+  HDF5Prefetcher(HDF5Importer &importer, const std::vector<const luci::CircleInput *> &inputs,
+                 int32_t num_records);
+
+  HDF5Prefetcher(const HDF5Prefetcher &) = delete;
+  HDF5Prefetcher &operator=(const HDF5Prefetcher &) = delete;
+
+  ~HDF5Prefetcher();
+
+public:
+  /**
+   * @brief Return the next record, or nullptr if there is no more record
+   * @note  The returned record is valid until the next call of this method
+   * @throw std::runtime_error if the record cannot be read or does not match the model inputs
+   */
+  const Record *next();
+
+private:
+  void readRecord(int32_t record_idx, Record &record);
+  void run();
+
+private:
+  static constexpr int32_t kNumSlots = 2;
+
+  HDF5Importer &_importer;
+  const std::vector<const luci::CircleInput *> _inputs;
+  const int32_t _num_records;
+  bool _is_raw_data = false;
+
+  Record _slots[kNumSlots];
+  bool _filled[kNumSlots] = {false, false};
+  int32_t _current = -1;
+
+  std::mutex _mutex;
+  std::condition_variable _cond;
+  std::exception_ptr _error;
+  bool _stop = false;
+
+  std::thread _thread;
+};
+
+} // namespace record_minmax
+
+#endif // __RECORD_MINMAX_HDF5PREFETCHER_H__
@@ -0,0 +1,490 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "MixedPrecisionPlanner.h"
+
+#include <luci/IR/CircleOpcode.h>
+#include <loco.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <stdexcept>
+
+namespace
+{
+
+using namespace record_minmax;
+
+const char *to_string(DataType dtype)
+{
+  switch (dtype)
+  {
+    case DataType::U8:
+      return "uint8";
+    case DataType::S16:
+      return "int16";
+    case DataType::FLOAT32:
+      return "float32";
+    default:
+      throw std::runtime_error("Unsupported type for mixed-precision");
+  }
+}
+
+// Quantize values with the range [min, max] and dequantize them back in place
+// NOTE This follows the asymmetric uint8 and symmetric int16 quantization of luci
+void fake_quantize(float *data, uint32_t size, float min, float max, DataType dtype)
+{
+  if (dtype == DataType::U8)
+  {
+    const double rmin = std::min(0.0f, min);
+    const double rmax = std::max(0.0f, max);
+    const double scale = (rmax - rmin) / 255.0;
+    if (scale == 0)
+      return;
+
+    const double zp = std::min(255.0, std::max(0.0, std::round(-rmin / scale)));
+    for (uint32_t i = 0; i < size; ++i)
+    {
+      const double q = std::min(255.0, std::max(0.0, std::round(data[i] / scale) + zp));
+      data[i] = static_cast<float>((q - zp) * scale);
+    }
+  }
+  else if (dtype == DataType::S16)
+  {
+    const double scale = std::max(std::fabs(min), std::fabs(max)) / 32767.0;
+    if (scale == 0)
+      return;
+
+    for (uint32_t i = 0; i < size; ++i)
+    {
+      const double q = std::min(32767.0, std::max(-32767.0, std::round(data[i] / scale)));
+      data[i] = static_cast<float>(q * scale);
+    }
+  }
+}
+
+// Quantize a weight channel-wise around channel_dim and dequantize it back in place
+void fake_quantize_per_channel(float *data, const luci_interpreter::Shape &shape,
+                               int32_t channel_dim, DataType dtype)
+{
+  uint32_t outer = 1;
+  uint32_t inner = 1;
+  for (int32_t i = 0; i < channel_dim; ++i)
+    outer *= shape.dim(i);
+  for (int32_t i = channel_dim + 1; i < shape.num_dims(); ++i)
+    inner *= shape.dim(i);
+  const uint32_t channels = shape.dim(channel_dim);
+
+  std::vector<float> channel;
+  for (uint32_t c = 0; c < channels; ++c)
+  {
+    channel.clear();
+    for (uint32_t o = 0; o < outer; ++o)
+    {
+      const float *src = data + (o * channels + c) * inner;
+      channel.insert(channel.end(), src, src + inner);
+    }
+    if (channel.empty())
+      continue;
+
+    auto minmax = std::minmax_element(channel.begin(), channel.end());
+    fake_quantize(channel.data(), channel.size(), *minmax.first, *minmax.second, dtype);
+
+    for (uint32_t o = 0; o < outer; ++o)
+      std::copy_n(channel.data() + o * inner, inner, data + (o * channels + c) * inner);
+  }
+}
+
+bool has_min_max(const luci::CircleNode *node)
+{
+  auto quantparam = node->quantparam();
+  return quantparam != nullptr && !quantparam->min.empty() && !quantparam->max.empty();
+}
+
+// Node which decides the type of an activation (virtual outputs follow their operator)
+const luci::CircleNode *layer_of(const luci::CircleNode *node)
+{
+  switch (node->opcode())
+  {
+    case luci::CircleOpcode::CIRCLECUSTOMOUT:
+    case luci::CircleOpcode::CIRCLEIFOUT:
+    case luci::CircleOpcode::CIRCLESPLITOUT:
+    case luci::CircleOpcode::CIRCLESPLITVOUT:
+    case luci::CircleOpcode::CIRCLETOPKV2OUT:
+    case luci::CircleOpcode::CIRCLEUNIQUEOUT:
+    case luci::CircleOpcode::CIRCLEUNPACKOUT:
+    case luci::CircleOpcode::CIRCLEWHILEOUT:
+      return loco::must_cast<const luci::CircleNode *>(node->arg(0));
+    default:
+      return node;
+  }
+}
+
+// Weights quantized by luci with the channel dimension, or nullptr if the node has no weights
+const luci::CircleConst *weights_of(const luci::CircleNode *node, int32_t &channel_dim)
+{
+  if (auto conv = dynamic_cast<const luci::CircleConv2D *>(node))
+  {
+    channel_dim = 0; // OHWI
+    return dynamic_cast<const luci::CircleConst *>(conv->filter());
+  }
+  if (auto dw_conv = dynamic_cast<const luci::CircleDepthwiseConv2D *>(node))
+  {
+    channel_dim = 3; // 1HWC
+    return dynamic_cast<const luci::CircleConst *>(dw_conv->filter());
+  }
+  if (auto fc = dynamic_cast<const luci::CircleFullyConnected *>(node))
+  {
+    channel_dim = 0; // OI
+    return dynamic_cast<const luci::CircleConst *>(fc->weights());
+  }
+  return nullptr;
+}
+
+int32_t channel_dim_of(const luci::CircleConst *weight)
+{
+  int32_t channel_dim = 0;
+  for (auto succ : loco::succs(weight))
+  {
+    weights_of(loco::must_cast<const luci::CircleNode *>(succ), channel_dim);
+  }
+  return channel_dim;
+}
+
+} // namespace
+
+namespace record_minmax
+{
+
+/**
+ * @brief FakeQuantObserver quantizes and dequantizes activations as soon as they are written
+ */
+class FakeQuantObserver final : public luci_interpreter::ExecutionObserver
+{
+public:
+  void dtype(const luci::CircleNode *node, DataType dtype) { _dtypes[node] = dtype; }
+
+  void clear() { _dtypes.clear(); }
+
+  void postTensorWrite(const luci::CircleNode *node,
+                       const luci_interpreter::Tensor *tensor) override
+  {
+    auto it = _dtypes.find(node);
+    if (it == _dtypes.end() || tensor->element_type() != DataType::FLOAT32)
+      return;
+
+    auto quantparam = node->quantparam();
+    assert(quantparam != nullptr);
+
+    // NOTE The tensor is changed in place, so that the following operators read the
+    //      quantization error as they would with the quantized model
+    auto data = const_cast<luci_interpreter::Tensor *>(tensor)->data<float>();
+    fake_quantize(data, tensor->shape().num_elements(), quantparam->min[0], quantparam->max[0],
+                  it->second);
+  }
+
+private:
+  std::unordered_map<const luci::CircleNode *, DataType> _dtypes;
+};
+
+const std::vector<DataType> &MixedPrecisionPlanner::candidates()
+{
+  static const std::vector<DataType> types{DataType::U8, DataType::S16, DataType::FLOAT32};
+  return types;
+}
+
+MixedPrecisionPlanner::MixedPrecisionPlanner(const luci::Module *module, int32_t num_threads)
+    : _module(module)
+{
+  _interpreter = std::make_unique<luci_interpreter::Interpreter>(module, num_threads);
+  _observer = std::make_unique<FakeQuantObserver>();
+  _interpreter->attachObserver(_observer.get());
+
+  for (auto node : loco::input_nodes(module->graph()))
+    _inputs.push_back(loco::must_cast<const luci::CircleInput *>(node));
+  for (auto node : loco::output_nodes(module->graph()))
+    _outputs.push_back(loco::must_cast<const luci::CircleOutput *>(node));
+
+  collectLayers();
+}
+
+MixedPrecisionPlanner::~MixedPrecisionPlanner() = default;
+
+void MixedPrecisionPlanner::collectLayers()
+{
+  // Layers are identified by name, as the plan is applied by name
+  std::map<std::string, size_t> layer_index;
+
+  for (size_t g = 0; g < _module->size(); ++g)
+  {
+    for (auto node : loco::postorder_traversal(loco::output_nodes(_module->graph(g))))
+    {
+      auto circle_node = loco::must_cast<const luci::CircleNode *>(node);
+
+      // min/max are recorded only for activations
+      if (!has_min_max(circle_node) || dynamic_cast<const luci::CircleConst *>(node) != nullptr)
+        continue;
+
+      auto layer_node = layer_of(circle_node);
+      if (layer_node->name().empty())
+      {
+        _unnamed.push_back(circle_node);
+        continue;
+      }
+
+      auto inserted = layer_index.emplace(layer_node->name(), _layers.size());
+      if (inserted.second)
+      {
+        _layers.emplace_back();
+        _layers.back().name = layer_node->name();
+      }
+      auto &layer = _layers.at(inserted.first->second);
+      layer.nodes.push_back(circle_node);
+
+      int32_t channel_dim = 0;
+      auto weight = weights_of(layer_node, channel_dim);
+      if (weight != nullptr && weight->dtype() == loco::DataType::FLOAT32 &&
+          std::find(layer.weights.begin(), layer.weights.end(), weight) == layer.weights.end())
+        layer.weights.push_back(weight);
+    }
+  }
+}
+
+void MixedPrecisionPlanner::computeReference(const std::vector<Record> &records)
+{
+  _observer->clear();
+
+  _reference.clear();
+  for (const auto &record : records)
+  {
+    for (size_t i = 0; i < _inputs.size(); ++i)
+      _interpreter->writeInputTensor(_inputs[i], record.at(i).data(), record.at(i).size());
+
+    _interpreter->interpret();
+
+    _reference.emplace_back();
+    for (auto output : _outputs)
+    {
+      auto tensor = _interpreter->getTensor(output->from());
+      if (tensor->element_type() != DataType::FLOAT32)
+      {
+        // Only float outputs are compared
+        _reference.back().emplace_back();
+        continue;
+      }
+
+      auto data = tensor->data<float>();
+      _reference.back().emplace_back(data, data + tensor->shape().num_elements());
+    }
+  }
+}
+
+double MixedPrecisionPlanner::measure(const std::vector<Record> &records,
+                                      const std::unordered_map<const LayerPlan *, DataType> &dtypes)
+{
+  // Original values of weights changed for this measurement
+  std::vector<std::pair<float *, std::vector<float>>> saved;
+
+  _observer->clear();
+  for (const auto &item : dtypes)
+  {
+    auto layer = item.first;
+    auto dtype = item.second;
+    if (dtype == DataType::FLOAT32)
+      continue;
+
+    for (auto node : layer->nodes)
+      _observer->dtype(node, dtype);
+
+    for (auto weight : layer->weights)
+    {
+      // NOTE Weights are changed in the interpreter only, and restored below
+      auto tensor = const_cast<luci_interpreter::Tensor *>(_interpreter->getTensor(weight));
+      auto data = tensor->data<float>();
+      saved.emplace_back(data, std::vector<float>(data, data + tensor->shape().num_elements()));
+      fake_quantize_per_channel(data, tensor->shape(), channel_dim_of(weight), dtype);
+    }
+  }
+
+  double error = 0;
+  double norm = 0;
+  for (size_t r = 0; r < records.size(); ++r)
+  {
+    const auto &record = records[r];
+    for (size_t i = 0; i < _inputs.size(); ++i)
+      _interpreter->writeInputTensor(_inputs[i], record.at(i).data(), record.at(i).size());
+
+    _interpreter->interpret();
+
+    for (size_t o = 0; o < _outputs.size(); ++o)
+    {
+      const auto &expected = _reference[r][o];
+      if (expected.empty())
+        continue;
+
+      auto actual = _interpreter->getTensor(_outputs[o]->from())->data<float>();
+      for (size_t i = 0; i < expected.size(); ++i)
+      {
+        const double diff = static_cast<double>(actual[i]) - expected[i];
+        error += diff * diff;
+        norm += static_cast<double>(expected[i]) * expected[i];
+      }
+    }
+  }
+
+  for (auto it = saved.rbegin(); it != saved.rend(); ++it)
+    std::copy(it->second.begin(), it->second.end(), it->first);
+
+  return norm > 0 ? error / norm : error;
+}
+
+void MixedPrecisionPlanner::plan(const std::vector<Record> &records, double error_budget)
+{
+  if (records.empty())
+    throw std::runtime_error("No record to plan mixed-precision quantization.");
+
+  const auto &types = candidates();
+  computeReference(records);
+
+  // Activations without a name cannot be planned, and are quantized to the fastest type
+  LayerPlan unnamed;
+  unnamed.nodes = _unnamed;
+
+  // Sensitivity of each layer quantized alone
+  for (auto &layer : _layers)
+  {
+    layer.errors.assign(types.size(), 0);
+    for (size_t t = 0; t < types.size(); ++t)
+    {
+      if (types[t] != DataType::FLOAT32)
+        layer.errors[t] = measure(records, {{&layer, types[t]}});
+    }
+  }
+
+  std::vector<size_t> chosen(_layers.size(), 0);
+  auto current = [&]() {
+    std::unordered_map<const LayerPlan *, DataType> dtypes{{&unnamed, types.front()}};
+    for (size_t l = 0; l < _layers.size(); ++l)
+      dtypes[&_layers[l]] = types[chosen[l]];
+    return dtypes;
+  };
+
+  // Errors of layers are assumed to add up until the whole model is measured
+  double estimate = 0;
+  for (const auto &layer : _layers)
+    estimate += layer.errors.front();
+
+  while (true)
+  {
+    bool measured = false;
+    if (estimate <= error_budget)
+    {
+      _error = measure(records, current());
+      measured = true;
+      if (_error <= error_budget)
+        break;
+    }
+
+    // Promote the layer whose error is reduced the most for the cost, to any slower type as a
+    // slower type is not always more accurate (e.g. with a narrow min/max). The cost of a type
+    // is its size, which is what memory-bound kernels are bound by.
+    size_t best = _layers.size();
+    size_t best_type = 0;
+    double best_gain = 0;
+    for (size_t l = 0; l < _layers.size(); ++l)
+    {
+      const auto &errors = _layers[l].errors;
+      for (size_t t = chosen[l] + 1; t < types.size(); ++t)
+      {
+        const double cost = loco::size(types[t]) - loco::size(types[chosen[l]]);
+        const double gain = (errors[chosen[l]] - errors[t]) / cost;
+        if (best == _layers.size() || gain > best_gain)
+        {
+          best = l;
+          best_type = t;
+          best_gain = gain;
+        }
+      }
+    }
+
+    if (best == _layers.size())
+    {
+      // Every layer is in float
+      if (!measured)
+        _error = measure(records, current());
+      break;
+    }
+
+    const auto &errors = _layers[best].errors;
+    estimate += errors[best_type] - errors[chosen[best]];
+    chosen[best] = best_type;
+  }
+
+  for (size_t l = 0; l < _layers.size(); ++l)
+    _layers[l].dtype = types[chosen[l]];
+}
+
+void MixedPrecisionPlanner::report(std::ostream &os, double error_budget) const
+{
+  const auto &types = candidates();
+
+  std::map<DataType, uint32_t> counts;
+  for (const auto &layer : _layers)
+    counts[layer.dtype]++;
+
+  os << "Mixed-precision plan: error " << _error << " (budget " << error_budget << ")"
+     << std::endl;
+  for (auto dtype : types)
+    os << "  " << std::setw(8) << std::left << to_string(dtype) << ": " << counts[dtype]
+       << " layers" << std::endl;
+
+  os << "Layer errors (relative MSE of outputs when quantized alone)" << std::endl;
+  for (const auto &layer : _layers)
+  {
+    os << "  " << std::setw(8) << std::left << to_string(layer.dtype) << layer.name;
+    for (size_t t = 0; t < types.size(); ++t)
+    {
+      if (types[t] != DataType::FLOAT32)
+        os << "  " << to_string(types[t]) << " " << layer.errors[t];
+    }
+    os << std::endl;
+  }
+
+  if (_error > error_budget)
+    os << "WARNING: error is over the budget even with every named layer in float" << std::endl;
+}
+
+void MixedPrecisionPlanner::writePlan(const std::string &path, double error_budget) const
+{
+  std::ofstream fs(path);
+  if (fs.fail())
+    throw std::runtime_error("Cannot open plan file \"" + path + "\".\n");
+
+  fs << "# Mixed-precision plan by record-minmax" << std::endl;
+  fs << "# error " << _error << " (budget " << error_budget << ")" << std::endl;
+  fs << "# <layer name> <type>" << std::endl;
+  for (const auto &layer : _layers)
+    fs << layer.name << " " << to_string(layer.dtype) << std::endl;
+
+  if (fs.fail())
+    throw std::runtime_error("Failed to write plan file \"" + path + "\".\n");
+}
+
+} // namespace record_minmax
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __RECORD_MINMAX_MIXEDPRECISIONPLANNER_H__
+#define __RECORD_MINMAX_MIXEDPRECISIONPLANNER_H__
+
+#include "HDF5Prefetcher.h"
+
+#include <luci/IR/Module.h>
+#include <luci/IR/CircleNodes.h>
+#include <luci_interpreter/Interpreter.h>
+
+#include <memory>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace record_minmax
+{
+
+/**
+ * @brief Type chosen for a layer, with the error of the layer alone for each candidate type
+ */
+struct LayerPlan
+{
+  std::string name;
+  DataType dtype = DataType::FLOAT32;
+  std::vector<double> errors;
+
+  // Activations of the layer (more than one for a multi-output layer or duplicated names)
+  std::vector<const luci::CircleNode *> nodes;
+  // Weights of Conv2D, DepthwiseConv2D and FullyConnected in the layer
+  std::vector<const luci::CircleConst *> weights;
+};
+
+/**
+ * @brief MixedPrecisionPlanner chooses the type of each layer within an error budget
+ *
+ * Quantization of a layer is simulated by quantizing and dequantizing its weights (channel-wise)
+ * and its activations (with min/max recorded in quantparam) while the float model is running.
+ * The error is the relative mean squared error of the model outputs against the float model.
+ *
+ * The sensitivity of each layer is measured alone for each candidate type. Starting from the
+ * fastest type for every layer, the layer whose promotion to a slower type reduces its error
+ * the most per byte is promoted, until the error of the whole model, measured with all the chosen
+ * types, fits in the budget.
+ */
+class MixedPrecisionPlanner
+{
+public:
+  // Candidate types from the fastest to the most accurate
+  static const std::vector<DataType> &candidates();
+
+public:
+  MixedPrecisionPlanner(const luci::Module *module, int32_t num_threads);
+
+  ~MixedPrecisionPlanner();
+
+public:
+  /**
+   * @brief Choose the type of each layer
+   * @note  min/max of activations SHOULD be recorded in quantparam before this is called
+   */
+  void plan(const std::vector<Record> &records, double error_budget);
+
+  const std::vector<LayerPlan> &layers() const { return _layers; }
+
+  // Error of the whole model with the chosen types
+  double error() const { return _error; }
+
+  void report(std::ostream &os, double error_budget) const;
+
+  void writePlan(const std::string &path, double error_budget) const;
+
+private:
+  void collectLayers();
+  void computeReference(const std::vector<Record> &records);
+  double measure(const std::vector<Record> &records,
+                 const std::unordered_map<const LayerPlan *, DataType> &dtypes);
+
+private:
+  const luci::Module *_module;
+  std::unique_ptr<luci_interpreter::Interpreter> _interpreter;
+  std::unique_ptr<class FakeQuantObserver> _observer;
+
+  std::vector<const luci::CircleInput *> _inputs;
+  std::vector<const luci::CircleOutput *> _outputs;
+
+  // Outputs of the float model, per record and output
+  std::vector<std::vector<std::vector<float>>> _reference;
+
+  std::vector<LayerPlan> _layers;
+  // Activations without a name, always quantized to the fastest type
+  std::vector<const luci::CircleNode *> _unnamed;
+
+  double _error = 0;
+};
+
+} // namespace record_minmax
+
+#endif // __RECORD_MINMAX_MIXEDPRECISIONPLANNER_H__
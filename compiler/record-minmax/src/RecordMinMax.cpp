@@ -19,6 +19,8 @@
 #include "CircleExpContract.h"
 #include "MinMaxObserver.h"
 #include "HDF5Importer.h"
+#include "HDF5Prefetcher.h"
+#include "MixedPrecisionPlanner.h"
 
 #include <luci/Importer.h>
 #include <luci/CircleExporter.h>
@@ -31,49 +33,10 @@
 #include <stdexcept>
 #include <iostream>
 
-using Shape = luci_interpreter::Shape;
-using DataType = luci_interpreter::DataType;
-
-namespace
-{
-
-/**
- * @brief  getTensorSize will return size in bytes
- */
-template <typename NodeT> size_t getTensorSize(const NodeT *node)
-{
-  uint32_t tensor_size = loco::size(node->dtype());
-  for (uint32_t i = 0; i < node->rank(); ++i)
-    tensor_size *= node->dim(i).value();
-  return tensor_size;
-}
-
-/**
- * @brief  verifyTypeShape checks the type and the shape of CircleInput
- *         This throws an exception if type or shape does not match
- */
-void verifyTypeShape(const luci::CircleInput *input_node, const DataType &dtype, const Shape &shape)
-{
-  // Type check
-  if (dtype != input_node->dtype())
-    throw std::runtime_error("Wrong input type.");
-
-  if (shape.num_dims() != input_node->rank())
-    throw std::runtime_error("Input rank mismatch.");
-
-  for (uint32_t i = 0; i < shape.num_dims(); i++)
-  {
-    if (shape.dim(i) != input_node->dim(i).value())
-      throw std::runtime_error("Input shape mismatch.");
-  }
-}
-
-} // namespace
-
 namespace record_minmax
 {
 
-void RecordMinMax::initialize(const std::string &input_model_path)
+void RecordMinMax::initialize(const std::string &input_model_path, int32_t num_threads)
 {
   // Load model from the file
   std::ifstream fs(input_model_path, std::ifstream::binary);
@@ -83,7 +46,8 @@ void RecordMinMax::initialize(const std::string &input_model_path)
   }
   std::vector<char> model_data((std::istreambuf_iterator<char>(fs)),
                                std::istreambuf_iterator<char>());
-  _module = luci::Importer().importModule(circle::GetModel(model_data.data()));
+  _module = luci::Importer().importModule(reinterpret_cast<const uint8_t *>(model_data.data()),
+                                          model_data.size());
 
   if (_module == nullptr)
   {
@@ -91,7 +55,8 @@ void RecordMinMax::initialize(const std::string &input_model_path)
   }
 
   // Initialize interpreter
-  _interpreter = std::make_unique<luci_interpreter::Interpreter>(_module.get());
+  _num_threads = num_threads;
+  _interpreter = std::make_unique<luci_interpreter::Interpreter>(_module.get(), num_threads);
 
   _observer = std::make_unique<MinMaxObserver>();
 
@@ -104,50 +69,34 @@ void RecordMinMax::profileData(const std::string &mode, const std::string &input
   HDF5Importer importer(input_data_path);
   importer.importGroup();
 
-  bool is_raw_data = importer.isRawData();
-
   const auto num_records = importer.numRecords();
   if (num_records == 0)
     throw std::runtime_error("The input data file does not contain any record.");
 
-  const auto input_nodes = loco::input_nodes(_module->graph());
-  const auto num_inputs = input_nodes.size();
+  std::vector<const luci::CircleInput *> input_nodes;
+  for (auto node : loco::input_nodes(_module->graph()))
+    input_nodes.push_back(loco::must_cast<const luci::CircleInput *>(node));
 
-  for (int32_t record_idx = 0; record_idx < num_records; record_idx++)
-  {
-    if (num_inputs != importer.numInputs(record_idx))
-      throw std::runtime_error("Wrong number of inputs.");
+  // Records are read in the background while the interpreter is running
+  HDF5Prefetcher prefetcher(importer, input_nodes, num_records);
 
+  int32_t record_idx = 0;
+  while (const Record *record = prefetcher.next())
+  {
     if (record_idx % 100 == 0)
       std::cout << "Recording " << record_idx << "'th data" << std::endl;
 
-    for (int32_t input_idx = 0; input_idx < num_inputs; input_idx++)
+    for (size_t input_idx = 0; input_idx < input_nodes.size(); input_idx++)
     {
-      const auto *input_node = loco::must_cast<const luci::CircleInput *>(input_nodes[input_idx]);
-      assert(input_node->index() == input_idx);
-      std::vector<char> input_data(getTensorSize(input_node));
-
-      if (!is_raw_data)
-      {
-        DataType dtype;
-        Shape shape(input_node->rank());
-        importer.readTensor(record_idx, input_idx, &dtype, &shape, input_data.data());
-
-        // Check the type and the shape of the input data is valid
-        verifyTypeShape(input_node, dtype, shape);
-      }
-      else
-      {
-        // Skip type/shape check for raw data
-        importer.readTensor(record_idx, input_idx, input_data.data());
-      }
-
-      // TODO: Input data is copied twice (file -> buffer (input_data) -> interpreter inputs)
-      //       We can redcue the copy by directly writing data from file to interpreter inputs
-      _interpreter->writeInputTensor(input_node, input_data.data(), input_data.size());
+      // TODO: Input data is still copied twice (file -> prefetched record -> interpreter inputs)
+      //       Reading directly into interpreter inputs needs the interpreter to double-buffer
+      //       them, as they are in use while the next record is read
+      const auto &input_data = record->at(input_idx);
+      _interpreter->writeInputTensor(input_nodes[input_idx], input_data.data(), input_data.size());
     }
 
     _interpreter->interpret();
+    record_idx++;
   }
 
   std::cout << "Recording finished. Number of recorded data: " << num_records << std::endl;
@@ -181,6 +130,38 @@ void RecordMinMax::profileData(const std::string &mode, const std::string &input
   }
 }
 
+void RecordMinMax::planMixedPrecision(const std::string &input_data_path, float error_budget,
+                                      const std::string &plan_path)
+{
+  // Each layer and type is tried with all these records, so only the first ones are used
+  const int32_t kMaxRecords = 32;
+
+  HDF5Importer importer(input_data_path);
+  importer.importGroup();
+
+  const auto num_records = std::min(importer.numRecords(), kMaxRecords);
+  if (num_records == 0)
+    throw std::runtime_error("The input data file does not contain any record.");
+
+  std::vector<const luci::CircleInput *> input_nodes;
+  for (auto node : loco::input_nodes(_module->graph()))
+    input_nodes.push_back(loco::must_cast<const luci::CircleInput *>(node));
+
+  std::vector<Record> records;
+  {
+    HDF5Prefetcher prefetcher(importer, input_nodes, num_records);
+    while (const Record *record = prefetcher.next())
+      records.push_back(*record);
+  }
+
+  std::cout << "Planning mixed-precision with " << num_records << " records" << std::endl;
+
+  MixedPrecisionPlanner planner(_module.get(), _num_threads);
+  planner.plan(records, error_budget);
+  planner.report(std::cout, error_budget);
+  planner.writePlan(plan_path, error_budget);
+}
+
 void RecordMinMax::saveModel(const std::string &output_model_path)
 {
   // Export to output Circle file
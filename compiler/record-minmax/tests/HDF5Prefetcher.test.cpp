@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "HDF5Prefetcher.h"
+
+#include <luci/IR/CircleNodes.h>
+
+#include <H5Cpp.h>
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace record_minmax
+{
+namespace
+{
+
+/**
+ * @brief Write records of float data with the given shape
+ *        Data of the i'th record and the j'th input is filled with (i * 10 + j)
+ */
+void writeRecords(const std::string &path, int32_t num_records, int32_t num_inputs,
+                  const std::vector<hsize_t> &dims)
+{
+  H5::H5File file{path, H5F_ACC_TRUNC};
+  H5::Group value_group = file.createGroup("value");
+
+  hsize_t num_elements = 1;
+  for (auto dim : dims)
+    num_elements *= dim;
+
+  for (int32_t record_idx = 0; record_idx < num_records; ++record_idx)
+  {
+    H5::Group record_group = value_group.createGroup(std::to_string(record_idx));
+    for (int32_t input_idx = 0; input_idx < num_inputs; ++input_idx)
+    {
+      H5::DataSpace dataspace(dims.size(), dims.data());
+      H5::DataSet dataset = record_group.createDataSet(
+          std::to_string(input_idx), H5::PredType::IEEE_F32LE, dataspace);
+
+      std::vector<float> data(num_elements, static_cast<float>(record_idx * 10 + input_idx));
+      dataset.write(data.data(), H5::PredType::NATIVE_FLOAT);
+    }
+  }
+}
+
+std::vector<const luci::CircleInput *> createInputs(loco::Graph *g, int32_t num_inputs,
+                                                    const std::vector<uint32_t> &dims)
+{
+  std::vector<const luci::CircleInput *> inputs;
+  for (int32_t input_idx = 0; input_idx < num_inputs; ++input_idx)
+  {
+    auto input = g->nodes()->create<luci::CircleInput>();
+    input->index(input_idx);
+    input->dtype(loco::DataType::FLOAT32);
+    input->rank(dims.size());
+    for (uint32_t i = 0; i < dims.size(); ++i)
+      input->dim(i) = dims[i];
+    inputs.push_back(input);
+  }
+  return inputs;
+}
+
+float firstValue(const std::vector<char> &data)
+{
+  float value;
+  std::memcpy(&value, data.data(), sizeof(float));
+  return value;
+}
+
+class HDF5PrefetcherTest : public ::testing::Test
+{
+protected:
+  void SetUp() override { _path = ::testing::TempDir() + "record_minmax_prefetcher.h5"; }
+  void TearDown() override { std::remove(_path.c_str()); }
+
+  std::string _path;
+};
+
+TEST_F(HDF5PrefetcherTest, read_all_records)
+{
+  const int32_t num_records = 5;
+  const int32_t num_inputs = 2;
+  writeRecords(_path, num_records, num_inputs, {1, 3});
+
+  auto g = loco::make_graph();
+  auto inputs = createInputs(g.get(), num_inputs, {1, 3});
+
+  HDF5Importer importer(_path);
+  importer.importGroup();
+  HDF5Prefetcher prefetcher(importer, inputs, num_records);
+
+  int32_t record_idx = 0;
+  while (const Record *record = prefetcher.next())
+  {
+    ASSERT_EQ(record->size(), static_cast<size_t>(num_inputs));
+    for (int32_t input_idx = 0; input_idx < num_inputs; ++input_idx)
+    {
+      const auto &input_data = record->at(input_idx);
+      ASSERT_EQ(input_data.size(), 3 * sizeof(float));
+      ASSERT_EQ(firstValue(input_data), static_cast<float>(record_idx * 10 + input_idx));
+    }
+    record_idx++;
+  }
+  ASSERT_EQ(record_idx, num_records);
+
+  // No more record after the end
+  ASSERT_EQ(prefetcher.next(), nullptr);
+}
+
+TEST_F(HDF5PrefetcherTest, stop_before_end)
+{
+  const int32_t num_records = 8;
+  writeRecords(_path, num_records, 1, {4});
+
+  auto g = loco::make_graph();
+  auto inputs = createInputs(g.get(), 1, {4});
+
+  HDF5Importer importer(_path);
+  importer.importGroup();
+
+  // Destructor should stop the reader which waits for a free slot
+  HDF5Prefetcher prefetcher(importer, inputs, num_records);
+  const Record *record = prefetcher.next();
+  ASSERT_NE(record, nullptr);
+  ASSERT_EQ(firstValue(record->at(0)), 0.0f);
+}
+
+TEST_F(HDF5PrefetcherTest, shape_mismatch_NEG)
+{
+  const int32_t num_records = 3;
+  writeRecords(_path, num_records, 1, {2, 2});
+
+  auto g = loco::make_graph();
+  auto inputs = createInputs(g.get(), 1, {1, 4});
+
+  HDF5Importer importer(_path);
+  importer.importGroup();
+  HDF5Prefetcher prefetcher(importer, inputs, num_records);
+
+  EXPECT_ANY_THROW(prefetcher.next());
+}
+
+TEST_F(HDF5PrefetcherTest, num_inputs_mismatch_NEG)
+{
+  const int32_t num_records = 3;
+  writeRecords(_path, num_records, 1, {4});
+
+  auto g = loco::make_graph();
+  auto inputs = createInputs(g.get(), 2, {4});
+
+  HDF5Importer importer(_path);
+  importer.importGroup();
+  HDF5Prefetcher prefetcher(importer, inputs, num_records);
+
+  EXPECT_ANY_THROW(prefetcher.next());
+}
+
+} // namespace
+} // namespace record_minmax
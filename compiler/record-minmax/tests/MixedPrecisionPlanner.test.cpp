@@ -0,0 +1,229 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "MixedPrecisionPlanner.h"
+
+#include <luci/IR/CircleNodes.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace record_minmax
+{
+namespace
+{
+
+void setShape(luci::CircleNode *node, const std::vector<uint32_t> &dims)
+{
+  node->rank(dims.size());
+  for (uint32_t i = 0; i < dims.size(); ++i)
+    node->dim(i) = dims[i];
+  node->shape_status(luci::ShapeStatus::VALID);
+}
+
+void setMinMax(luci::CircleNode *node, float min, float max)
+{
+  auto quantparam = std::make_unique<luci::CircleQuantParam>();
+  quantparam->min.push_back(min);
+  quantparam->max.push_back(max);
+  node->quantparam(std::move(quantparam));
+}
+
+luci::CircleConst *createConst(loco::Graph *g, const std::vector<uint32_t> &dims)
+{
+  auto node = g->nodes()->create<luci::CircleConst>();
+  node->dtype(loco::DataType::FLOAT32);
+  setShape(node, dims);
+
+  uint32_t size = 1;
+  for (auto dim : dims)
+    size *= dim;
+  node->size<loco::DataType::FLOAT32>(size);
+  for (uint32_t i = 0; i < size; ++i)
+    node->at<loco::DataType::FLOAT32>(i) = (i % 2 == 0 ? 0.1f : -0.1f) * (i + 1);
+  return node;
+}
+
+/**
+ * @brief Create [Input] -- [FullyConnected] -- [Output] with min/max of activations recorded
+ */
+std::unique_ptr<luci::Module> createModule()
+{
+  auto g = loco::make_graph();
+
+  auto input = g->nodes()->create<luci::CircleInput>();
+  input->dtype(loco::DataType::FLOAT32);
+  input->name("input");
+  setShape(input, {1, 4});
+  setMinMax(input, -1.0f, 1.0f);
+
+  auto fc = g->nodes()->create<luci::CircleFullyConnected>();
+  fc->input(input);
+  fc->weights(createConst(g.get(), {3, 4}));
+  fc->bias(createConst(g.get(), {3}));
+  fc->fusedActivationFunction(luci::FusedActFunc::NONE);
+  fc->dtype(loco::DataType::FLOAT32);
+  fc->name("fc");
+  setShape(fc, {1, 3});
+  setMinMax(fc, -6.0f, 6.0f);
+
+  auto output = g->nodes()->create<luci::CircleOutput>();
+  output->from(fc);
+  output->dtype(loco::DataType::FLOAT32);
+  setShape(output, {1, 3});
+
+  auto graph_input = g->inputs()->create();
+  input->index(graph_input->index());
+  auto graph_output = g->outputs()->create();
+  output->index(graph_output->index());
+
+  auto module = luci::make_module();
+  module->add(std::move(g));
+  return module;
+}
+
+/**
+ * @brief Create records of one input, with values in [-1, 1]
+ */
+std::vector<Record> createRecords(int32_t num_records)
+{
+  std::vector<Record> records;
+  for (int32_t r = 0; r < num_records; ++r)
+  {
+    std::vector<float> data{0.9f, -0.35f, 0.1f * r, -1.0f + 0.2f * r};
+    std::vector<char> bytes(data.size() * sizeof(float));
+    std::memcpy(bytes.data(), data.data(), bytes.size());
+    records.push_back(Record{bytes});
+  }
+  return records;
+}
+
+const LayerPlan &layerOf(const MixedPrecisionPlanner &planner, const std::string &name)
+{
+  for (const auto &layer : planner.layers())
+  {
+    if (layer.name == name)
+      return layer;
+  }
+  throw std::runtime_error("No layer " + name);
+}
+
+} // namespace
+
+TEST(MixedPrecisionPlannerTest, collect_layers)
+{
+  auto module = createModule();
+  MixedPrecisionPlanner planner(module.get(), 1);
+
+  ASSERT_EQ(2, planner.layers().size());
+  ASSERT_EQ(0, layerOf(planner, "input").weights.size());
+  ASSERT_EQ(1, layerOf(planner, "input").nodes.size());
+  ASSERT_EQ(1, layerOf(planner, "fc").weights.size());
+  ASSERT_EQ(1, layerOf(planner, "fc").nodes.size());
+}
+
+TEST(MixedPrecisionPlannerTest, large_budget)
+{
+  auto module = createModule();
+  MixedPrecisionPlanner planner(module.get(), 1);
+
+  planner.plan(createRecords(5), 1.0);
+
+  // Every layer takes the fastest type
+  for (const auto &layer : planner.layers())
+  {
+    ASSERT_EQ(DataType::U8, layer.dtype);
+    ASSERT_EQ(MixedPrecisionPlanner::candidates().size(), layer.errors.size());
+    ASSERT_LT(0, layer.errors.front());
+    ASSERT_EQ(0, layer.errors.back()); // float32
+  }
+  ASSERT_LT(0, planner.error());
+  ASSERT_GE(1.0, planner.error());
+}
+
+TEST(MixedPrecisionPlannerTest, zero_budget)
+{
+  auto module = createModule();
+  MixedPrecisionPlanner planner(module.get(), 1);
+
+  planner.plan(createRecords(5), 0.0);
+
+  // Only float32 has no error
+  for (const auto &layer : planner.layers())
+    ASSERT_EQ(DataType::FLOAT32, layer.dtype);
+  ASSERT_EQ(0, planner.error());
+}
+
+TEST(MixedPrecisionPlannerTest, budget_between_types)
+{
+  auto module = createModule();
+  MixedPrecisionPlanner planner(module.get(), 1);
+
+  auto records = createRecords(5);
+  planner.plan(records, 1.0);
+  const double u8_error = planner.error();
+
+  // Budget under the error with uint8 only promotes some layer to a slower type
+  planner.plan(records, u8_error / 2);
+  ASSERT_GE(u8_error / 2, planner.error());
+
+  bool promoted = false;
+  for (const auto &layer : planner.layers())
+    promoted = promoted || layer.dtype != DataType::U8;
+  ASSERT_TRUE(promoted);
+}
+
+TEST(MixedPrecisionPlannerTest, write_plan)
+{
+  auto module = createModule();
+  MixedPrecisionPlanner planner(module.get(), 1);
+  planner.plan(createRecords(2), 0.0);
+
+  const std::string path = ::testing::TempDir() + "record_minmax_plan.txt";
+  planner.writePlan(path, 0.0);
+
+  // Plan is read by circle-quantizer as "<layer name> <type>" per line
+  std::ifstream fs(path);
+  std::vector<std::string> lines;
+  std::string line;
+  while (std::getline(fs, line))
+  {
+    if (!line.empty() && line[0] != '#')
+      lines.push_back(line);
+  }
+  std::remove(path.c_str());
+
+  ASSERT_EQ(2, lines.size());
+  ASSERT_NE(lines.end(), std::find(lines.begin(), lines.end(), "input float32"));
+  ASSERT_NE(lines.end(), std::find(lines.begin(), lines.end(), "fc float32"));
+}
+
+TEST(MixedPrecisionPlannerTest, no_record_NEG)
+{
+  auto module = createModule();
+  MixedPrecisionPlanner planner(module.get(), 1);
+
+  EXPECT_ANY_THROW(planner.plan({}, 1.0));
+}
+
+} // namespace record_minmax
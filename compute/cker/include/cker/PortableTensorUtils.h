@@ -25,6 +25,10 @@
 #include <cstring>
 #include <cmath>
 
+#ifdef __F16C__
+#include <immintrin.h>
+#endif
+
 namespace nnfw
 {
 namespace cker
@@ -55,8 +59,8 @@ private:
   FusedActivationFunctionType act_;
 };
 
-void PortableVectorBatchVectorAssign(const float *vector, int v_size, int n_batch,
-                                     float *batch_vector)
+inline void PortableVectorBatchVectorAssign(const float *vector, int v_size, int n_batch,
+                                            float *batch_vector)
 {
   for (int b = 0; b < n_batch; b++)
   {
@@ -64,7 +68,7 @@ void PortableVectorBatchVectorAssign(const float *vector, int v_size, int n_batc
   }
 }
 
-bool PortableIsZeroVector(const float *vector, int v_size)
+inline bool PortableIsZeroVector(const float *vector, int v_size)
 {
   for (int i = 0; i < v_size; ++i)
   {
@@ -74,8 +78,8 @@ bool PortableIsZeroVector(const float *vector, int v_size)
   return true;
 }
 
-void PortableApplyActivationToVector(const float *vector, int v_size,
-                                     FusedActivationFunctionType activation, float *result)
+inline void PortableApplyActivationToVector(const float *vector, int v_size,
+                                            FusedActivationFunctionType activation, float *result)
 {
   auto activation_func = ActivationFunctor(activation);
   for (int v = 0; v < v_size; v++)
@@ -84,8 +88,9 @@ void PortableApplyActivationToVector(const float *vector, int v_size,
   }
 }
 
-void PortableSymmetricQuantizeFloats(const float *values, const int size, int8_t *quantized_values,
-                                     float *min_value, float *max_value, float *scaling_factor)
+inline void PortableSymmetricQuantizeFloats(const float *values, const int size,
+                                            int8_t *quantized_values, float *min_value,
+                                            float *max_value, float *scaling_factor)
 {
   auto minmax = std::minmax_element(values, values + size);
   *min_value = *minmax.first;
@@ -109,11 +114,12 @@ void PortableSymmetricQuantizeFloats(const float *values, const int size, int8_t
   }
 }
 
-void PortableMatrixBatchVectorMultiplyAccumulate(const int8_t *__restrict__ matrix,
-                                                 const int m_rows, const int m_cols,
-                                                 const int8_t *__restrict__ vectors,
-                                                 const float *scaling_factors, int n_batch,
-                                                 float *__restrict__ result, int result_stride)
+inline void PortableMatrixBatchVectorMultiplyAccumulate(const int8_t *__restrict__ matrix,
+                                                        const int m_rows, const int m_cols,
+                                                        const int8_t *__restrict__ vectors,
+                                                        const float *scaling_factors, int n_batch,
+                                                        float *__restrict__ result,
+                                                        int result_stride)
 {
   int batch, row, col;
   for (batch = 0; batch < n_batch; ++batch, vectors += m_cols)
@@ -138,20 +144,20 @@ void PortableMatrixBatchVectorMultiplyAccumulate(const int8_t *__restrict__ matr
   }   // for batch
 }
 
-void PortableMatrixBatchVectorMultiplyAccumulate(const int8_t *__restrict__ matrix,
-                                                 const int m_rows, const int m_cols,
-                                                 const int8_t *__restrict__ vector,
-                                                 const float *scaling_factors, int n_batch,
-                                                 int32_t *, float *__restrict__ result,
-                                                 int result_stride, ruy::Context *)
+inline void PortableMatrixBatchVectorMultiplyAccumulate(const int8_t *__restrict__ matrix,
+                                                        const int m_rows, const int m_cols,
+                                                        const int8_t *__restrict__ vector,
+                                                        const float *scaling_factors, int n_batch,
+                                                        int32_t *, float *__restrict__ result,
+                                                        int result_stride, ruy::Context *)
 {
   PortableMatrixBatchVectorMultiplyAccumulate(matrix, m_rows, m_cols, vector, scaling_factors,
                                               n_batch, result, result_stride);
 }
 
-void PortableMatrixBatchVectorMultiplyAccumulate(const float *matrix, int m_rows, int m_cols,
-                                                 const float *vector, int n_batch, float *result,
-                                                 int result_stride)
+inline void PortableMatrixBatchVectorMultiplyAccumulate(const float *matrix, int m_rows, int m_cols,
+                                                        const float *vector, int n_batch,
+                                                        float *result, int result_stride)
 {
   float *result_in_batch = result;
   for (int b = 0; b < n_batch; b++)
@@ -171,7 +177,46 @@ void PortableMatrixBatchVectorMultiplyAccumulate(const float *matrix, int m_rows
   }
 }
 
-void PortableZeroVector(float *vector, int v_size) { std::fill_n(vector, v_size, 0); }
+inline void PortableZeroVector(float *vector, int v_size) { std::fill_n(vector, v_size, 0); }
+
+// Widens IEEE 754 half precision values(bit patterns) to float
+inline void PortableFloat16ToFloat(const uint16_t *input, int size, float *output)
+{
+  int i = 0;
+#ifdef __F16C__
+  for (; i <= size - 8; i += 8)
+  {
+    const __m128i half_x8 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(input + i));
+    _mm256_storeu_ps(output + i, _mm256_cvtph_ps(half_x8));
+  }
+#endif
+  // Exponent and mantissa are shifted into place and the exponent is rebiased(15 -> 127).
+  // Subnormals are normalized by the float subtraction of the magic number.
+  constexpr uint32_t shifted_exp = 0x7c00u << 13;
+  const float magic = 6.103515625e-05f; // 2^-14, whose bit pattern is 113 << 23
+  for (; i < size; ++i)
+  {
+    uint32_t bits = static_cast<uint32_t>(input[i] & 0x7fffu) << 13;
+    const uint32_t exp = bits & shifted_exp;
+    bits += (127 - 15) << 23;
+    if (exp == shifted_exp)
+    {
+      // Inf or NaN
+      bits += (128 - 16) << 23;
+    }
+    else if (exp == 0)
+    {
+      // Zero or subnormal
+      bits += 1 << 23;
+      float value;
+      std::memcpy(&value, &bits, sizeof(value));
+      value -= magic;
+      std::memcpy(&bits, &value, sizeof(bits));
+    }
+    bits |= static_cast<uint32_t>(input[i] & 0x8000u) << 16;
+    std::memcpy(output + i, &bits, sizeof(bits));
+  }
+}
 
 } // namespace cker
 } // namespace nnfw
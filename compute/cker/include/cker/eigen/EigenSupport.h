@@ -22,6 +22,7 @@
 
 #include <Eigen/Core>
 #include <thread>
+#include <vector>
 #include "cker/eigen/eigen_spatial_convolutions.h"
 
 #ifdef EIGEN_USE_THREADS
@@ -87,6 +88,8 @@ struct EigenContext
   constexpr static int default_num_threadpool_threads = 4;
   std::unique_ptr<Eigen::ThreadPoolInterface> thread_pool_wrapper;
   std::unique_ptr<Eigen::ThreadPoolDevice> device;
+  // limited_devices[n - 1] splits work into n threads only, on the same thread pool
+  std::vector<std::unique_ptr<Eigen::ThreadPoolDevice>> limited_devices;
 
   EigenContext()
   {
@@ -98,6 +101,10 @@ struct EigenContext
     device.reset(); // destroy before we invalidate the thread pool
     thread_pool_wrapper.reset(new EigenThreadPoolWrapper(new Eigen::ThreadPool(num_threads)));
     device.reset(new Eigen::ThreadPoolDevice(thread_pool_wrapper.get(), num_threads));
+    for (int n = 1; n < num_threads; ++n)
+    {
+      limited_devices.emplace_back(new Eigen::ThreadPoolDevice(thread_pool_wrapper.get(), n));
+    }
   }
 
   static inline EigenContext &GetEigenContext()
@@ -113,6 +120,19 @@ inline const Eigen::ThreadPoolDevice *GetThreadPoolDevice()
   return ctx.device.get();
 }
 
+/**
+ * @brief Return the device which uses up to @c num_threads threads of the global thread pool
+ *
+ * @note  All the threads are used if @c num_threads is 0 or not less than the pool size
+ */
+inline const Eigen::ThreadPoolDevice *GetThreadPoolDevice(int num_threads)
+{
+  auto &ctx = EigenContext::GetEigenContext();
+  if (num_threads <= 0 || num_threads > static_cast<int>(ctx.limited_devices.size()))
+    return ctx.device.get();
+  return ctx.limited_devices.at(num_threads - 1).get();
+}
+
 } // namespace eigen_support
 } // namespace cker
 } // namespace nnfw
@@ -23,6 +23,7 @@
 #include "cker/Types.h"
 #include "cker/Shape.h"
 #include "cker/Utils.h"
+#include "cker/TensorUtils.h"
 #include "cker/operation/reference/BatchMatMul.h"
 
 #include <vector>
@@ -88,15 +89,69 @@ public:
       transposeRowsCols(rhs_shape, rhs_data, _temp_rhs_shape, _temp_rhs.data());
     }
 
+    Shape new_rhs_shape = adj_y ? rhs_shape : swapRowColDims(rhs_shape);
+    const float *new_rhs_data = adj_y ? rhs_data : _temp_rhs.data();
+
+    multiply(lhs_shape, lhs_data, new_rhs_shape, new_rhs_data, adj_x, output_shape, output_data);
+  }
+
+  /**
+   * @brief BatchMatMul with float16 rhs(bit patterns of IEEE 754 half precision)
+   *
+   * @note  rhs is widened into the temporary area where float rhs is transposed if adj_y is false,
+   *        so it needs no more memory than float rhs in that case
+   */
+  void operator()(const Shape &lhs_shape, const float *lhs_data, const Shape &rhs_shape,
+                  const uint16_t *rhs_data, bool adj_x, bool adj_y, const Shape &output_shape,
+                  float *output_data)
+  {
+    const int32_t rank = rhs_shape.DimensionsCount();
+    const int rows = rhs_shape.Dims(rank - 2);
+    const int cols = rhs_shape.Dims(rank - 1);
+    const int batches = rhs_shape.FlatSize() / (rows * cols);
+
+    _temp_rhs.resize(rhs_shape.FlatSize());
+    if (adj_y)
+    {
+      Float16ToFloat(rhs_data, rhs_shape.FlatSize(), _temp_rhs.data());
+    }
+    else
+    {
+      // Widen a row at a time and transpose it into a column
+      _temp_row.resize(cols);
+      for (int b = 0; b < batches; ++b)
+      {
+        float *temp_rhs = _temp_rhs.data() + b * rows * cols;
+        for (int r = 0; r < rows; ++r)
+        {
+          Float16ToFloat(rhs_data + (b * rows + r) * cols, cols, _temp_row.data());
+          for (int c = 0; c < cols; ++c)
+          {
+            temp_rhs[c * rows + r] = _temp_row[c];
+          }
+        }
+      }
+    }
+
+    Shape new_rhs_shape = adj_y ? rhs_shape : swapRowColDims(rhs_shape);
+
+    multiply(lhs_shape, lhs_data, new_rhs_shape, _temp_rhs.data(), adj_x, output_shape,
+             output_data);
+  }
+
+private:
+  // rhs SHOULD be transposed already
+  void multiply(const Shape &lhs_shape, const float *lhs_data, const Shape &new_rhs_shape,
+                const float *new_rhs_data, bool adj_x, const Shape &output_shape,
+                float *output_data)
+  {
     if (adj_x)
     {
       transposeRowsCols(lhs_shape, lhs_data, _temp_lhs_shape, _temp_lhs.data());
     }
 
     Shape new_lhs_shape = adj_x ? lhs_shape : swapRowColDims(lhs_shape);
-    Shape new_rhs_shape = adj_y ? rhs_shape : swapRowColDims(rhs_shape);
     const float *new_lhs_data = adj_x ? _temp_lhs.data() : lhs_data;
-    const float *new_rhs_data = adj_y ? rhs_data : _temp_rhs.data();
 
     // Note we pass RHS args first, LHS args second
     // Check accumulative dimensions of lhs and rhs of are equal
@@ -106,7 +161,6 @@ public:
                            output_data);
   }
 
-private:
   Shape swapRowColDims(const Shape &shape)
   {
     Shape swapped_shape(shape);
@@ -138,6 +192,7 @@ private:
   Shape _temp_lhs_shape;
   std::vector<float> _temp_rhs;
   Shape _temp_rhs_shape;
+  std::vector<float> _temp_row;
 };
 
 } // namespace cker
@@ -56,10 +56,36 @@ class Conv
 public:
   Conv()
       : _modified_filter_data(), _im2col_data(), _im2col_shape(4), _need_im2col(false),
-        _prepared(false)
+        _prepared(false), _use_reference_float(false), _num_threads_float(0)
   {
   }
 
+  /**
+   * @brief Run float convolution with the reference kernel even if the multithreaded one is
+   *        usable, e.g. when the reference kernel turns out to be faster for this shape
+   */
+  void useReferenceFloat(bool use_reference) { _use_reference_float = use_reference; }
+
+  /**
+   * @brief Limit the threads of the multithreaded float kernel, 0 for all the threads
+   */
+  void numThreadsFloat(int num_threads) { _num_threads_float = num_threads; }
+
+  /**
+   * @brief Release the filter transposed by prepare() and run float convolution with the
+   *        reference kernel from now on
+   */
+  void releaseTransposedFilter()
+  {
+    std::vector<float>().swap(_modified_filter_data);
+    _use_reference_float = true;
+  }
+
+  bool usableMultiThreaded(PaddingType padding_type) const
+  {
+    return padding_type != PaddingType::kNone && std::thread::hardware_concurrency() > 1;
+  }
+
   void prepare(const Shape &filter_shape, const float *filter_data, PaddingType padding_type,
                bool &is_replaced_weights)
   {
@@ -87,7 +113,7 @@ public:
                   const Shape &filter_shape, const float *filter_data, const Shape &bias_shape,
                   const float *bias_data, const Shape &output_shape, float *output_data)
   {
-    if (usableMultiThreaded(params.padding_type))
+    if (!_use_reference_float && usableMultiThreaded(params.padding_type))
     {
       bool transposed_in_execution = false;
       if (!_prepared)
@@ -98,7 +124,7 @@ public:
         transposeFilter(filter_shape, filter_data, transposed_in_execution);
       }
       multithreaded::Conv(params, input_shape, input_data, filter_shape, &_modified_filter_data[0],
-                          bias_shape, bias_data, output_shape, output_data);
+                          bias_shape, bias_data, output_shape, output_data, _num_threads_float);
     }
     else
     {
@@ -125,11 +151,6 @@ public:
   }
 
 private:
-  bool usableMultiThreaded(PaddingType padding_type)
-  {
-    return padding_type != PaddingType::kNone && std::thread::hardware_concurrency() > 1;
-  }
-
   void transposeFilter(const Shape &filter_shape, const float *filter_data,
                        bool &is_replaced_weights)
   {
@@ -161,6 +182,8 @@ private:
   Shape _im2col_shape;
   bool _need_im2col;
   bool _prepared;
+  bool _use_reference_float;
+  int _num_threads_float;
 };
 } // namespace cker
 } // namespace nnfw
@@ -24,6 +24,8 @@
 #include "cker/Utils.h"
 #include "cker/TensorUtils.h"
 
+#include <algorithm>
+
 namespace nnfw
 {
 namespace cker
@@ -53,6 +55,7 @@ public:
   std::vector<int8_t> input_quantized;
   std::vector<float> scaling_factors;
   std::vector<int32_t> accum_scratch;
+  std::vector<float> widened_weights;
 };
 
 inline void FullyConnected(const FullyConnectedParams &params, const Shape &input_shape,
@@ -86,6 +89,139 @@ inline void FullyConnected(const FullyConnectedParams &params, const Shape &inpu
   }
 }
 
+/**
+ * @brief FullyConnected with float16 weights, which are widened to float block by block
+ *
+ * @note  weights_data has the bit patterns of IEEE 754 half precision values. Only a block of rows
+ *        is widened at a time into temp_arena, so float weights are never kept as a whole.
+ */
+inline void FullyConnectedFloat16Weight(const FullyConnectedParams &params,
+                                        const Shape &input_shape, const float *input_data,
+                                        const Shape &weights_shape, const uint16_t *weights_data,
+                                        const Shape &, const float *bias_data, const Shape &,
+                                        float *output_data, FCTempArena &temp_arena)
+{
+  const int input_size = weights_shape.Dims(weights_shape.DimensionsCount() - 1);
+  const int num_units = weights_shape.FlatSize() / input_size;
+  const int batch_size = input_shape.FlatSize() / input_size;
+
+  // Output = bias if bias tensor exists.
+  if (bias_data)
+  {
+    VectorBatchVectorAssign(bias_data, num_units, batch_size, output_data);
+  }
+  else
+  {
+    ZeroVector(output_data, batch_size * num_units);
+  }
+
+  // Rows of a block are widened once and used for all batches while they stay in cache
+  constexpr int kBlockElements = 8192;
+  const int block_rows = std::max(1, std::min(num_units, kBlockElements / input_size));
+  auto &widened = temp_arena.widened_weights;
+  widened.resize(block_rows * input_size);
+
+  for (int row = 0; row < num_units; row += block_rows)
+  {
+    const int rows = std::min(block_rows, num_units - row);
+    Float16ToFloat(weights_data + row * input_size, rows * input_size, widened.data());
+
+    // Compute output += weight * input
+    for (int b = 0; b < batch_size; ++b)
+    {
+      MatrixBatchVectorMultiplyAccumulate(widened.data(), rows, input_size,
+                                          input_data + b * input_size, /*n_batch=*/1,
+                                          output_data + b * num_units + row, /*result_stride=*/1);
+    }
+  }
+
+  if (params.activation != FusedActivationFunctionType::kNone)
+  {
+    // Apply activation function
+    ApplyActivationToVector(output_data, batch_size * num_units, params.activation, output_data);
+  }
+}
+
+/**
+ * @brief FullyConnected with weights in block compressed sparse row format
+ *
+ * @param w1_segments Offsets of each block row of weights in w1_indices
+ * @param w1_indices  Block column of each non-zero block
+ * @param block_size  Size of a block, {rows, cols}
+ * @note  weights_data has the values of non-zero blocks only, each block in row-major order, and
+ *        weights_shape is the shape of dense weights
+ */
+inline void FullyConnectedSparseWeight(const FullyConnectedParams &params, const Shape &input_shape,
+                                       const float *input_data, const Shape &weights_shape,
+                                       const float *weights_data, const Shape &,
+                                       const float *bias_data, const Shape &, float *output_data,
+                                       const int32_t *w1_segments, const int32_t *w1_indices,
+                                       const int32_t *block_size)
+{
+  const int input_size = weights_shape.Dims(weights_shape.DimensionsCount() - 1);
+  const int num_units = weights_shape.FlatSize() / input_size;
+  const int batch_size = input_shape.FlatSize() / input_size;
+  const int block_rows = block_size[0];
+  const int block_cols = block_size[1];
+
+  // Output = bias if bias tensor exists.
+  if (bias_data)
+  {
+    VectorBatchVectorAssign(bias_data, num_units, batch_size, output_data);
+  }
+  else
+  {
+    ZeroVector(output_data, batch_size * num_units);
+  }
+
+  // Compute output += weight * input for non-zero blocks only
+  for (int b = 0; b < batch_size; ++b)
+  {
+    const float *input = input_data + b * input_size;
+    float *output = output_data + b * num_units;
+
+    if (block_rows == 1 && block_cols == 4)
+    {
+      // Dot product of 4 contiguous elements for each block
+      for (int r = 0; r < num_units; ++r)
+      {
+        float acc = 0;
+        for (int k = w1_segments[r]; k < w1_segments[r + 1]; ++k)
+        {
+          const float *w = weights_data + k * 4;
+          const float *in = input + w1_indices[k] * 4;
+          acc += w[0] * in[0] + w[1] * in[1] + w[2] * in[2] + w[3] * in[3];
+        }
+        output[r] += acc;
+      }
+      continue;
+    }
+
+    for (int br = 0; br < num_units / block_rows; ++br)
+    {
+      float *out = output + br * block_rows;
+      for (int k = w1_segments[br]; k < w1_segments[br + 1]; ++k)
+      {
+        const float *w = weights_data + k * block_rows * block_cols;
+        const float *in = input + w1_indices[k] * block_cols;
+        for (int i = 0; i < block_rows; ++i)
+        {
+          float acc = 0;
+          for (int j = 0; j < block_cols; ++j)
+            acc += w[i * block_cols + j] * in[j];
+          out[i] += acc;
+        }
+      }
+    }
+  }
+
+  if (params.activation != FusedActivationFunctionType::kNone)
+  {
+    // Apply activation function
+    ApplyActivationToVector(output_data, batch_size * num_units, params.activation, output_data);
+  }
+}
+
 inline void FullyConnected(const FullyConnectedParams &params, const Shape &input_shape,
                            const uint8_t *input_data, const Shape &filter_shape,
                            const uint8_t *filter_data, const Shape &bias_shape,
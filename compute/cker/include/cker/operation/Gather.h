@@ -21,6 +21,7 @@
 #include "cker/Shape.h"
 #include "cker/Types.h"
 #include "cker/Utils.h"
+#include "cker/TensorUtils.h"
 
 namespace nnfw
 {
@@ -67,6 +68,50 @@ inline void Gather(const GatherParams &op_params, const Shape &input_shape, cons
   }
 }
 
+/**
+ * @brief Gather of float16 input(bit patterns of IEEE 754 half precision) into float output
+ *
+ * @note  Only the gathered slices are widened, e.g. the looked-up rows of an embedding table
+ */
+template <typename CoordsT = int32_t>
+inline void GatherFloat16(const GatherParams &op_params, const Shape &input_shape,
+                          const uint16_t *input_data, const Shape &coords_shape,
+                          const CoordsT *coords_data, const Shape &, float *output_data)
+{
+  int axis = op_params.axis;
+  if (axis < 0)
+  {
+    axis += input_shape.DimensionsCount();
+  }
+  assert(axis >= 0);
+  assert(axis < input_shape.DimensionsCount());
+  const int axis_size = input_shape.Dims(axis);
+  const int coords_count = coords_shape.FlatSize();
+
+  int outer_size = 1;
+  for (int i = 0; i < axis; ++i)
+  {
+    outer_size *= input_shape.Dims(i);
+  }
+
+  int inner_size = 1;
+  for (int i = axis + 1; i < input_shape.DimensionsCount(); ++i)
+  {
+    inner_size *= input_shape.Dims(i);
+  }
+
+  for (int outer = 0; outer < outer_size; ++outer)
+  {
+    for (int i = 0; i < coords_count; ++i)
+    {
+      assert(coords_data[i] >= 0);
+      assert(coords_data[i] < axis_size);
+      Float16ToFloat(input_data + (outer * axis_size + coords_data[i]) * inner_size, inner_size,
+                     output_data + (outer * coords_count + i) * inner_size);
+    }
+  }
+}
+
 } // namespace cker
 } // namespace nnfw
 
@@ -247,11 +247,13 @@ public:
 };
 } // namespace
 
+// num_threads limits the threads used, and 0 means all the threads of the global thread pool
 inline void Conv(const ConvParams &params, const Shape &input_shape, const float *input_data,
                  const Shape &filter_shape, const float *filter_data, const Shape &bias_shape,
-                 const float *bias_data, const Shape &output_shape, float *output_data)
+                 const float *bias_data, const Shape &output_shape, float *output_data,
+                 int num_threads = 0)
 {
-  const Eigen::ThreadPoolDevice &device = *eigen_support::GetThreadPoolDevice();
+  const Eigen::ThreadPoolDevice &device = *eigen_support::GetThreadPoolDevice(num_threads);
 
   const int stride_width = params.stride_width;
   const int stride_height = params.stride_height;
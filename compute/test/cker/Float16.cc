@@ -0,0 +1,231 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/TensorUtils.h>
+#include <cker/operation/BatchMatMul.h>
+#include <cker/operation/FullyConnected.h>
+#include <cker/operation/Gather.h>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+namespace
+{
+
+// Rounds to the nearest even, only for zero and normal numbers in the range of float16
+uint16_t toFloat16(float value)
+{
+  uint32_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  const uint32_t sign = (bits >> 16) & 0x8000u;
+  const uint32_t abs = bits & 0x7fffffffu;
+  if (abs == 0)
+    return sign;
+
+  uint32_t half = (abs >> 13) - ((127 - 15) << 10);
+  const uint32_t rest = abs & 0x1fffu;
+  if (rest > 0x1000u || (rest == 0x1000u && (half & 1)))
+    ++half;
+  return static_cast<uint16_t>(sign | half);
+}
+
+std::vector<uint16_t> toFloat16(const std::vector<float> &values)
+{
+  std::vector<uint16_t> halves;
+  for (auto value : values)
+    halves.push_back(toFloat16(value));
+  return halves;
+}
+
+std::vector<float> toFloat(const std::vector<uint16_t> &halves)
+{
+  std::vector<float> values(halves.size());
+  nnfw::cker::Float16ToFloat(halves.data(), halves.size(), values.data());
+  return values;
+}
+
+// Values between -1 and 1 which are not exact in float16, without subnormals of float16
+std::vector<float> makeValues(size_t size, int seed)
+{
+  std::vector<float> values(size);
+  for (size_t i = 0; i < size; ++i)
+  {
+    const float value = std::sin(0.37f * (i + seed)) * 0.999f;
+    values[i] = std::fabs(value) < 1e-3f ? 0.f : value;
+  }
+  return values;
+}
+
+} // namespace
+
+TEST(CKer_Utils, Float16ToFloat)
+{
+  // Normals, subnormals, zeros, infinities and NaN
+  const std::vector<uint16_t> halves = {0x3c00, 0xc000, 0x7bff, 0x3555, 0x0400, 0x0001,
+                                        0x83ff, 0x0000, 0x8000, 0x7c00, 0xfc00, 0x7e00,
+                                        0x3c01, 0x4248, 0xbc00, 0x5640, 0x0200, 0x3800,
+                                        0x2e66};
+  const std::vector<float> expected = {1.f,
+                                       -2.f,
+                                       65504.f,
+                                       0.333251953125f,
+                                       std::ldexp(1.f, -14),
+                                       std::ldexp(1.f, -24),
+                                       -std::ldexp(1023.f, -24),
+                                       0.f,
+                                       -0.f,
+                                       std::numeric_limits<float>::infinity(),
+                                       -std::numeric_limits<float>::infinity(),
+                                       std::numeric_limits<float>::quiet_NaN(),
+                                       1.0009765625f,
+                                       3.140625f,
+                                       -1.f,
+                                       100.f,
+                                       std::ldexp(1.f, -15),
+                                       0.5f,
+                                       0.0999755859375f};
+
+  // 19 values run both of vectorized and scalar loops
+  const auto actual = toFloat(halves);
+  for (size_t i = 0; i < expected.size(); ++i)
+  {
+    if (std::isnan(expected[i]))
+    {
+      ASSERT_TRUE(std::isnan(actual[i]));
+      continue;
+    }
+    ASSERT_EQ(actual[i], expected[i]);
+    ASSERT_EQ(std::signbit(actual[i]), std::signbit(expected[i]));
+  }
+}
+
+TEST(CKer_Operation, FullyConnectedFloat16Weight)
+{
+  const int batch = 3;
+  // Weights are widened by several blocks of rows with a remainder
+  const int num_units = 64;
+  const int input_size = 300;
+
+  const auto weights = makeValues(num_units * input_size, 0);
+  const auto half_weights = toFloat16(weights);
+  const auto widened_weights = toFloat(half_weights);
+  const auto input = makeValues(batch * input_size, 7);
+  const auto bias = makeValues(num_units, 3);
+
+  const nnfw::cker::Shape input_shape{batch, input_size};
+  const nnfw::cker::Shape weights_shape{num_units, input_size};
+  const nnfw::cker::Shape bias_shape{num_units};
+  const nnfw::cker::Shape output_shape{batch, num_units};
+
+  using nnfw::cker::FusedActivationFunctionType;
+  for (auto activation : {FusedActivationFunctionType::kNone, FusedActivationFunctionType::kRelu})
+  {
+    nnfw::cker::FullyConnectedParams params;
+    params.activation = activation;
+
+    std::vector<float> expected(batch * num_units);
+    nnfw::cker::FullyConnected(params, input_shape, input.data(), weights_shape, weights.data(),
+                               bias_shape, bias.data(), output_shape, expected.data());
+    std::vector<float> expected_widened(batch * num_units);
+    nnfw::cker::FullyConnected(params, input_shape, input.data(), weights_shape,
+                               widened_weights.data(), bias_shape, bias.data(), output_shape,
+                               expected_widened.data());
+
+    nnfw::cker::FCTempArena temp_arena;
+    std::vector<float> actual(batch * num_units);
+    nnfw::cker::FullyConnectedFloat16Weight(params, input_shape, input.data(), weights_shape,
+                                            half_weights.data(), bias_shape, bias.data(),
+                                            output_shape, actual.data(), temp_arena);
+
+    for (size_t i = 0; i < expected.size(); ++i)
+    {
+      // The same as float weights rounded to float16
+      ASSERT_FLOAT_EQ(actual[i], expected_widened[i]);
+      // Error of float16 weights is less than 2^-11 of each product
+      ASSERT_NEAR(actual[i], expected[i], input_size * std::ldexp(1.f, -11));
+    }
+  }
+}
+
+TEST(CKer_Operation, GatherFloat16)
+{
+  const int rows = 10;
+  const int cols = 5;
+  const auto table = makeValues(rows * cols, 0);
+  const auto half_table = toFloat16(table);
+  const auto widened_table = toFloat(half_table);
+  const std::vector<int32_t> indices = {3, 0, 9, 3};
+
+  const nnfw::cker::Shape input_shape{rows, cols};
+  const nnfw::cker::Shape indices_shape{static_cast<int>(indices.size())};
+  const nnfw::cker::Shape output_shape{static_cast<int>(indices.size()), cols};
+
+  nnfw::cker::GatherParams params;
+  params.axis = 0;
+
+  std::vector<float> expected(indices.size() * cols);
+  nnfw::cker::Gather<float>(params, input_shape, widened_table.data(), indices_shape,
+                            indices.data(), output_shape, expected.data());
+  std::vector<float> actual(indices.size() * cols);
+  nnfw::cker::GatherFloat16(params, input_shape, half_table.data(), indices_shape, indices.data(),
+                            output_shape, actual.data());
+
+  for (size_t i = 0; i < expected.size(); ++i)
+  {
+    ASSERT_EQ(actual[i], expected[i]);
+    ASSERT_NEAR(actual[i], table[indices[i / cols] * cols + i % cols], std::ldexp(1.f, -11));
+  }
+}
+
+TEST(CKer_Operation, BatchMatMulFloat16Rhs)
+{
+  const int batch = 2;
+  const int m = 3;
+  const int k = 4;
+  const int n = 5;
+  const auto lhs = makeValues(batch * m * k, 0);
+  const auto rhs = makeValues(k * n, 11);
+  const auto half_rhs = toFloat16(rhs);
+  const auto widened_rhs = toFloat(half_rhs);
+
+  const nnfw::cker::Shape lhs_shape{batch, m, k};
+  const nnfw::cker::Shape output_shape{batch, m, n};
+
+  for (bool adj_y : {false, true})
+  {
+    // The same values are used for rhs of [k, n] and its adjoint of [n, k]
+    const nnfw::cker::Shape rhs_shape = adj_y ? nnfw::cker::Shape{n, k} : nnfw::cker::Shape{k, n};
+
+    nnfw::cker::BatchMatMul expected_kernel;
+    expected_kernel.prepare(lhs_shape, rhs_shape, false, adj_y);
+    std::vector<float> expected(batch * m * n);
+    expected_kernel(lhs_shape, lhs.data(), rhs_shape, widened_rhs.data(), false, adj_y,
+                    output_shape, expected.data());
+
+    nnfw::cker::BatchMatMul actual_kernel;
+    actual_kernel.prepare(lhs_shape, rhs_shape, false, adj_y);
+    std::vector<float> actual(batch * m * n);
+    actual_kernel(lhs_shape, lhs.data(), rhs_shape, half_rhs.data(), false, adj_y, output_shape,
+                  actual.data());
+
+    for (size_t i = 0; i < expected.size(); ++i)
+      ASSERT_FLOAT_EQ(actual[i], expected[i]);
+  }
+}
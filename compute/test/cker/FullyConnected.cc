@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/FullyConnected.h>
+
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace
+{
+
+// Block compressed sparse row format of dense weights
+struct SparseWeights
+{
+  std::vector<int32_t> segments;
+  std::vector<int32_t> indices;
+  std::vector<float> values;
+};
+
+SparseWeights sparsify(const std::vector<float> &dense, int rows, int cols, int block_rows,
+                       int block_cols)
+{
+  SparseWeights sparse;
+  sparse.segments.push_back(0);
+  for (int br = 0; br < rows / block_rows; ++br)
+  {
+    for (int bc = 0; bc < cols / block_cols; ++bc)
+    {
+      std::vector<float> block;
+      bool is_zero = true;
+      for (int i = 0; i < block_rows; ++i)
+      {
+        for (int j = 0; j < block_cols; ++j)
+        {
+          const float value = dense[(br * block_rows + i) * cols + bc * block_cols + j];
+          is_zero = is_zero && value == 0;
+          block.push_back(value);
+        }
+      }
+      if (is_zero)
+        continue;
+      sparse.indices.push_back(bc);
+      sparse.values.insert(sparse.values.end(), block.begin(), block.end());
+    }
+    sparse.segments.push_back(sparse.indices.size());
+  }
+  return sparse;
+}
+
+} // namespace
+
+TEST(CKer_Operation, FullyConnectedSparseWeight)
+{
+  const int batch = 2;
+  const int num_units = 8;
+  const int input_size = 8;
+
+  // Zero blocks of 1x4 and 2x2 at different places
+  std::vector<float> weights(num_units * input_size);
+  for (int r = 0; r < num_units; ++r)
+  {
+    for (int c = 0; c < input_size; ++c)
+    {
+      const bool zero = (r % 3 == 0 && c < 4) || (r >= 4 && c >= 6);
+      weights[r * input_size + c] = zero ? 0.f : static_cast<float>((r * 7 + c * 3) % 11) - 5;
+    }
+  }
+  std::vector<float> input(batch * input_size);
+  for (size_t i = 0; i < input.size(); ++i)
+    input[i] = static_cast<float>(i % 5) - 2;
+  std::vector<float> bias(num_units);
+  for (int i = 0; i < num_units; ++i)
+    bias[i] = 0.5f * i;
+
+  const nnfw::cker::Shape input_shape{batch, input_size};
+  const nnfw::cker::Shape weights_shape{num_units, input_size};
+  const nnfw::cker::Shape bias_shape{num_units};
+  const nnfw::cker::Shape output_shape{batch, num_units};
+
+  using nnfw::cker::FusedActivationFunctionType;
+  for (auto activation : {FusedActivationFunctionType::kNone, FusedActivationFunctionType::kRelu})
+  {
+    nnfw::cker::FullyConnectedParams params;
+    params.activation = activation;
+
+    std::vector<float> expected(batch * num_units);
+    nnfw::cker::FullyConnected(params, input_shape, input.data(), weights_shape, weights.data(),
+                               bias_shape, bias.data(), output_shape, expected.data());
+
+    for (auto block : std::vector<std::vector<int32_t>>{{1, 4}, {2, 2}, {1, 1}})
+    {
+      auto sparse = sparsify(weights, num_units, input_size, block[0], block[1]);
+      ASSERT_LT(sparse.values.size(), weights.size());
+
+      std::vector<float> actual(batch * num_units);
+      nnfw::cker::FullyConnectedSparseWeight(
+          params, input_shape, input.data(), weights_shape, sparse.values.data(), bias_shape,
+          bias.data(), output_shape, actual.data(), sparse.segments.data(), sparse.indices.data(),
+          block.data());
+
+      for (size_t i = 0; i < expected.size(); ++i)
+        ASSERT_FLOAT_EQ(actual[i], expected[i]);
+    }
+  }
+}
@@ -68,9 +68,16 @@ if(FlatBuffers_FOUND)
   endfunction(FlatBuffers_Generate)
 
   function(FlatBuffers_Target TGT)
+    set(options GEN_MUTABLE)
     set(oneValueArgs OUTPUT_DIR SCHEMA_DIR INCLUDE_DIR)
     set(multiValueArgs SCHEMA_FILES)
-    cmake_parse_arguments(ARG "" "${oneValueArgs}" "${multiValueArgs}" ${ARGN})
+    cmake_parse_arguments(ARG "${options}" "${oneValueArgs}" "${multiValueArgs}" ${ARGN})
+
+    # Generate mutable accessors (mutate_XXX) only if requested
+    unset(EXTRA_FLATC_OPTIONS)
+    if(ARG_GEN_MUTABLE)
+      list(APPEND EXTRA_FLATC_OPTIONS --gen-mutable)
+    endif(ARG_GEN_MUTABLE)
 
     # Use OUTPUT_DIR as INCLUDE_DIR if INCLUDE_DIR is not specified
     if(NOT ARG_INCLUDE_DIR)
@@ -101,7 +108,7 @@ if(FlatBuffers_FOUND)
                        COMMAND ${CMAKE_COMMAND} -E make_directory "${abs_output_dir}"
                        COMMAND "$<TARGET_FILE:flatbuffers::flatc>" -c --no-includes
                                --no-union-value-namespacing
-                               --gen-object-api -o "${abs_output_dir}"
+                               --gen-object-api ${EXTRA_FLATC_OPTIONS} -o "${abs_output_dir}"
                                ${SCHEMA_FILES}
                        DEPENDS ${SCHEMA_FILES}
                        COMMENT "Generate '${TGT}' headers")
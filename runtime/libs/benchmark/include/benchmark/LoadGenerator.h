@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_BENCHMARK_LOAD_GENERATOR_H__
+#define __NNFW_BENCHMARK_LOAD_GENERATOR_H__
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace benchmark
+{
+
+struct LoadOption
+{
+  uint32_t sessions = 1;    // the number of sessions(instances) to run on
+  uint32_t concurrency = 0; // closed loop: requests in flight, 0 means the number of sessions
+  double qps = 0;           // open loop: target requests per second, closed loop if 0
+  uint32_t duration = 10;   // s
+  bool memory = false;      // poll RSS while running
+  int memory_interval = 5;  // ms
+};
+
+struct LoadResult
+{
+  std::vector<uint64_t> latency; // us, sorted
+  uint64_t backlog = 0;          // open loop: requests waiting when arrivals stopped
+  double elapsed = 0;            // s
+  uint32_t peak_rss = 0;         // kB
+
+  double throughput() const { return elapsed > 0 ? latency.size() / elapsed : 0; }
+  double meanMs() const;
+  double percentileMs(double p) const;
+};
+
+/**
+ * @brief Generate load on several sessions and measure latency distribution and throughput
+ *
+ * - Closed loop : @c concurrency workers issue a next request as soon as the previous one is
+ *                 done. Latency is the time to run a request.
+ * - Open loop   : Requests arrive at @c qps regardless of completion and wait for a free
+ *                 session. Latency is measured from the arrival, so it includes queueing delay.
+ *                 Requests arrive for @c duration, and those still waiting then are run
+ *                 afterwards, so the run may take longer than @c duration when overloaded.
+ *
+ * A session runs one request at a time. @c RunFunc is called with the index of a session that is
+ * not used by others.
+ */
+class LoadGenerator
+{
+public:
+  using RunFunc = std::function<void(uint32_t session)>;
+
+public:
+  LoadGenerator(const LoadOption &option);
+
+  LoadResult run(const RunFunc &func);
+
+private:
+  void runClosedLoop(const RunFunc &func, LoadResult &result);
+  void runOpenLoop(const RunFunc &func, LoadResult &result);
+
+private:
+  const LoadOption _option;
+};
+
+void printLoadResult(const LoadOption &option, const LoadResult &result);
+
+void writeLoadResult(const LoadOption &option, const LoadResult &result, const std::string &exec,
+                     const std::string &model, const std::string &backend);
+
+} // namespace benchmark
+
+#endif // __NNFW_BENCHMARK_LOAD_GENERATOR_H__
@@ -0,0 +1,313 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "benchmark/LoadGenerator.h"
+#include "benchmark/CsvWriter.h"
+#include "benchmark/MemoryPoller.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <deque>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+
+namespace
+{
+
+using Clock = std::chrono::steady_clock;
+
+uint64_t elapsedMicros(Clock::time_point from, Clock::time_point to)
+{
+  return std::chrono::duration_cast<std::chrono::microseconds>(to - from).count();
+}
+
+// Sessions which are not running a request
+class SessionPool
+{
+public:
+  SessionPool(uint32_t sessions)
+  {
+    for (uint32_t i = 0; i < sessions; ++i)
+      _free.emplace_back(i);
+  }
+
+  uint32_t acquire()
+  {
+    std::unique_lock<std::mutex> lock(_mutex);
+    _cond_var.wait(lock, [&]() { return !_free.empty(); });
+    auto session = _free.front();
+    _free.pop_front();
+    return session;
+  }
+
+  void release(uint32_t session)
+  {
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _free.emplace_back(session);
+    }
+    _cond_var.notify_one();
+  }
+
+private:
+  std::deque<uint32_t> _free;
+  std::mutex _mutex;
+  std::condition_variable _cond_var;
+};
+
+const std::vector<std::string> load_csv_header{
+    "Model",        "Backend",     "Mode",        "Sessions",    "Concurrency",  "Target_QPS",
+    "Duration",     "Requests",    "Backlog",     "Throughput",  "Latency_Mean", "Latency_P50",
+    "Latency_P90",  "Latency_P99", "Latency_P999", "Latency_Max", "Peak_RSS"};
+
+} // namespace
+
+namespace benchmark
+{
+
+double LoadResult::meanMs() const
+{
+  if (latency.empty())
+    return 0;
+  return std::accumulate(latency.begin(), latency.end(), 0.0) / latency.size() / 1e3;
+}
+
+double LoadResult::percentileMs(double p) const
+{
+  if (latency.empty())
+    return 0;
+  // nearest-rank method
+  auto rank = static_cast<size_t>(std::ceil(p / 100.0 * latency.size()));
+  rank = std::min(std::max<size_t>(rank, 1), latency.size());
+  return latency[rank - 1] / 1e3;
+}
+
+LoadGenerator::LoadGenerator(const LoadOption &option) : _option(option)
+{
+  if (_option.sessions == 0)
+    throw std::runtime_error("LoadGenerator: the number of sessions must be positive");
+}
+
+LoadResult LoadGenerator::run(const RunFunc &func)
+{
+  LoadResult result;
+
+  std::unique_ptr<MemoryPoller> mem_poll;
+  if (_option.memory)
+  {
+    mem_poll.reset(new MemoryPoller(std::chrono::milliseconds(_option.memory_interval)));
+    mem_poll->start(PhaseEnum::EXECUTE);
+  }
+
+  const auto begin = Clock::now();
+  if (_option.qps > 0)
+    runOpenLoop(func, result);
+  else
+    runClosedLoop(func, result);
+  result.elapsed = std::chrono::duration<double>(Clock::now() - begin).count();
+
+  if (mem_poll)
+  {
+    mem_poll->end(PhaseEnum::EXECUTE);
+    result.peak_rss = mem_poll->getRssMap().at(PhaseEnum::EXECUTE);
+  }
+
+  std::sort(result.latency.begin(), result.latency.end());
+  return result;
+}
+
+void LoadGenerator::runClosedLoop(const RunFunc &func, LoadResult &result)
+{
+  const auto concurrency = _option.concurrency > 0 ? _option.concurrency : _option.sessions;
+  const auto deadline = Clock::now() + std::chrono::seconds(_option.duration);
+
+  SessionPool pool{_option.sessions};
+  // Each worker records to its own vector, no lock while running
+  std::vector<std::vector<uint64_t>> latencies(concurrency);
+  std::vector<std::thread> workers;
+  for (uint32_t w = 0; w < concurrency; ++w)
+  {
+    workers.emplace_back([&, w]() {
+      while (Clock::now() < deadline)
+      {
+        // Waiting for a free session is a part of latency if concurrency > sessions
+        const auto issued = Clock::now();
+        const auto session = pool.acquire();
+        func(session);
+        pool.release(session);
+        latencies[w].emplace_back(elapsedMicros(issued, Clock::now()));
+      }
+    });
+  }
+
+  for (auto &worker : workers)
+    worker.join();
+
+  for (const auto &l : latencies)
+    result.latency.insert(result.latency.end(), l.begin(), l.end());
+}
+
+void LoadGenerator::runOpenLoop(const RunFunc &func, LoadResult &result)
+{
+  std::mutex mutex;
+  std::condition_variable cond_var;
+  std::deque<Clock::time_point> arrivals;
+  bool closed = false;
+
+  // A worker per session, so session i is used by worker i only
+  std::vector<std::vector<uint64_t>> latencies(_option.sessions);
+  std::vector<std::thread> workers;
+  for (uint32_t session = 0; session < _option.sessions; ++session)
+  {
+    workers.emplace_back([&, session]() {
+      while (true)
+      {
+        Clock::time_point arrival;
+        {
+          std::unique_lock<std::mutex> lock(mutex);
+          cond_var.wait(lock, [&]() { return closed || !arrivals.empty(); });
+          if (arrivals.empty())
+            break;
+          arrival = arrivals.front();
+          arrivals.pop_front();
+        }
+
+        func(session);
+        latencies[session].emplace_back(elapsedMicros(arrival, Clock::now()));
+      }
+    });
+  }
+
+  // Requests arrive at fixed intervals, regardless of how fast they are served
+  const auto begin = Clock::now();
+  const auto deadline = begin + std::chrono::seconds(_option.duration);
+  const std::chrono::duration<double> interval(1.0 / _option.qps);
+  for (uint64_t n = 0;; ++n)
+  {
+    const auto arrival = begin + std::chrono::duration_cast<Clock::duration>(interval * n);
+    if (arrival >= deadline)
+      break;
+
+    std::this_thread::sleep_until(arrival);
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      arrivals.emplace_back(arrival);
+    }
+    cond_var.notify_one();
+  }
+
+  // Requests still waiting at the end are run too. Dropping them would leave out the requests
+  // which have waited longest, and make latency look better the more the sessions are overloaded.
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    result.backlog = arrivals.size();
+    closed = true;
+  }
+  cond_var.notify_all();
+
+  for (auto &worker : workers)
+    worker.join();
+
+  for (const auto &l : latencies)
+    result.latency.insert(result.latency.end(), l.begin(), l.end());
+}
+
+void printLoadResult(const LoadOption &option, const LoadResult &result)
+{
+  std::cout << "===================================" << std::endl;
+
+  std::streamsize ss_precision = std::cout.precision();
+  std::cout << std::setprecision(3);
+  std::cout << std::fixed;
+
+  if (option.qps > 0)
+    std::cout << "LOAD (open loop, " << option.qps << " qps";
+  else
+    std::cout << "LOAD (closed loop, concurrency "
+              << (option.concurrency > 0 ? option.concurrency : option.sessions);
+  std::cout << ", " << option.sessions << " sessions, " << option.duration << " s)" << std::endl;
+
+  std::cout << "- " << std::setw(11) << std::left << "REQUESTS"
+            << ":  " << result.latency.size() << std::endl;
+  if (option.qps > 0)
+    std::cout << "- " << std::setw(11) << std::left << "BACKLOG"
+              << ":  " << result.backlog << std::endl;
+  std::cout << "- " << std::setw(11) << std::left << "THROUGHPUT"
+            << ":  " << result.throughput() << " qps" << std::endl;
+  std::cout << "- " << std::setw(11) << std::left << "MEAN"
+            << ":  " << result.meanMs() << " ms" << std::endl;
+  for (auto p : {50.0, 90.0, 99.0, 99.9})
+  {
+    std::stringstream ss;
+    ss << "P" << p;
+    std::cout << "- " << std::setw(11) << std::left << ss.str() << ":  " << result.percentileMs(p)
+              << " ms" << std::endl;
+  }
+  std::cout << "- " << std::setw(11) << std::left << "MAX"
+            << ":  " << result.percentileMs(100) << " ms" << std::endl;
+
+  std::cout << std::setprecision(ss_precision);
+  std::cout << std::defaultfloat;
+
+  if (option.memory)
+    std::cout << "- " << std::setw(11) << std::left << "PEAK RSS"
+              << ":  " << result.peak_rss << " kb" << std::endl;
+
+  std::cout << "===================================" << std::endl;
+}
+
+void writeLoadResult(const LoadOption &option, const LoadResult &result, const std::string &exec,
+                     const std::string &model, const std::string &backend)
+{
+  std::string csv_filename = exec + "-" + model + "-" + backend + "-load.csv";
+
+  // write to csv
+  CsvWriter writer(csv_filename, load_csv_header);
+  writer << model << backend;
+
+  // option
+  writer << std::string(option.qps > 0 ? "open" : "closed") << option.sessions
+         << (option.concurrency > 0 ? option.concurrency : option.sessions) << option.qps
+         << option.duration;
+
+  // throughput
+  writer << static_cast<uint32_t>(result.latency.size()) << static_cast<uint32_t>(result.backlog)
+         << result.throughput();
+
+  // latency in ms
+  writer << result.meanMs() << result.percentileMs(50) << result.percentileMs(90)
+         << result.percentileMs(99) << result.percentileMs(99.9) << result.percentileMs(100);
+
+  // memory in kB
+  writer << result.peak_rss;
+
+  bool done = writer.done();
+
+  if (!done)
+  {
+    std::cerr << "Writing to " << csv_filename << " is failed" << std::endl;
+  }
+}
+
+} // namespace benchmark
@@ -273,7 +273,8 @@ NNFW_STATUS nnfw_run(nnfw_session *session);
  * session is prepared for inference by {@link nnfw_prepare}, set input and output buffers
  * by {@link nnfw_set_input} and {@link nnfw_set_output}.</p>
  *
- * <p>This function returns immediately after starting a thread to run the inference.
+ * <p>This function returns immediately after queuing the inference on a worker pool shared by
+ * all the sessions in the process.
  * To get the result of it or to do the next inference with {@link nnfw_run} or
  * {@link nnfw_run_async}, {@link nnfw_await} must be called to ensure the current asynchronous
  * inference has finished. Only one asynchronous inference is allowed at a time for a session.
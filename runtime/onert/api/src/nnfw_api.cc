@@ -15,6 +15,7 @@
  */
 
 #include "nnfw_api_internal.h"
+#include "nnfw_pipeline.h"
 #include "nnfw_version.h"
 
 // Double-check enum value changes
@@ -273,6 +274,21 @@ NNFW_STATUS nnfw_register_custom_op_info(nnfw_session *session, const char *id,
   return session->register_custom_operation(id, info->eval_function);
 }
 
+/*
+ * Get runtime metrics as a JSON string
+ * @param session session to get metrics from
+ * @param buffer buffer to store null-terminated JSON string, may be NULL to get length
+ * @param buffer_size size of buffer
+ * @param length length of JSON string including null terminator
+ * @return NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_get_metrics(nnfw_session *session, char *buffer, size_t buffer_size,
+                             size_t *length)
+{
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return session->get_metrics(buffer, buffer_size, length);
+}
+
 NNFW_STATUS nnfw_apply_tensorinfo(nnfw_session *session, uint32_t index,
                                   nnfw_tensorinfo tensor_info)
 {
@@ -341,3 +357,85 @@ NNFW_STATUS nnfw_query_info_u32(nnfw_session *session, NNFW_INFO_ID id, uint32_t
   // It should not be reached.
   return NNFW_STATUS_ERROR;
 }
+
+NNFW_STATUS nnfw_submit(nnfw_session *session, nnfw_completion_callback callback, void *user_data,
+                        uint64_t *request_id)
+{
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return session->submit(callback, user_data, request_id);
+}
+
+NNFW_STATUS nnfw_cancel(nnfw_session *session, uint64_t request_id)
+{
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return session->cancel(request_id);
+}
+
+NNFW_STATUS nnfw_completion_fd(nnfw_session *session, int *fd)
+{
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return session->completion_fd(fd);
+}
+
+NNFW_STATUS nnfw_poll_completion(nnfw_session *session, uint64_t *request_id,
+                                 NNFW_REQUEST_RESULT *result)
+{
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return session->poll_completion(request_id, result);
+}
+
+NNFW_STATUS nnfw_pipeline_create(nnfw_pipeline **pipeline, uint32_t depth)
+{
+  NNFW_RETURN_ERROR_IF_NULL(pipeline);
+
+  if (depth == 0)
+    return NNFW_STATUS_ERROR;
+
+  *pipeline = new (std::nothrow) nnfw_pipeline(depth);
+  if (*pipeline == nullptr)
+    return NNFW_STATUS_OUT_OF_MEMORY;
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_pipeline_destroy(nnfw_pipeline *pipeline)
+{
+  delete pipeline;
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_pipeline_add_stage(nnfw_pipeline *pipeline, nnfw_session *session)
+{
+  NNFW_RETURN_ERROR_IF_NULL(pipeline);
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return pipeline->add_stage(session);
+}
+
+NNFW_STATUS nnfw_pipeline_connect(nnfw_pipeline *pipeline, uint32_t stage, uint32_t input_index,
+                                  uint32_t output_index)
+{
+  NNFW_RETURN_ERROR_IF_NULL(pipeline);
+  return pipeline->connect(stage, input_index, output_index);
+}
+
+NNFW_STATUS nnfw_pipeline_start(nnfw_pipeline *pipeline)
+{
+  NNFW_RETURN_ERROR_IF_NULL(pipeline);
+  return pipeline->start();
+}
+
+NNFW_STATUS nnfw_pipeline_push(nnfw_pipeline *pipeline, const void *const *buffers,
+                               const size_t *lengths)
+{
+  NNFW_RETURN_ERROR_IF_NULL(pipeline);
+  NNFW_RETURN_ERROR_IF_NULL(buffers);
+  NNFW_RETURN_ERROR_IF_NULL(lengths);
+  return pipeline->push(buffers, lengths);
+}
+
+NNFW_STATUS nnfw_pipeline_pop(nnfw_pipeline *pipeline, void *const *buffers, const size_t *lengths)
+{
+  NNFW_RETURN_ERROR_IF_NULL(pipeline);
+  NNFW_RETURN_ERROR_IF_NULL(buffers);
+  NNFW_RETURN_ERROR_IF_NULL(lengths);
+  return pipeline->pop(buffers, lengths);
+}
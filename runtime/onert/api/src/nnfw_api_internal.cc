@@ -19,6 +19,7 @@
 #include "compiler/Compiler.h"
 #include "util/ConfigSource.h"
 #include "exec/Execution.h"
+#include "exec/Metrics.h"
 #include "circle_loader.h"
 #include "tflite_loader.h"
 #include "json/json.h"
@@ -28,6 +29,8 @@
 #include <string>
 #include <vector>
 #include <dirent.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
 #include <util/ConfigSource.h>
 #include <misc/string_helpers.h>
 
@@ -71,7 +74,14 @@ nnfw_session::nnfw_session()
   // DO NOTHING
 }
 
-nnfw_session::~nnfw_session() = default;
+nnfw_session::~nnfw_session()
+{
+  // Cancel queued requests and wait for a running one, while completions can still be queued
+  _execution.reset();
+
+  if (_completion_fd >= 0)
+    close(_completion_fd);
+}
 
 NNFW_STATUS nnfw_session::load_model_from_file(const char *package_dir)
 {
@@ -191,6 +201,13 @@ NNFW_STATUS nnfw_session::run()
     return NNFW_STATUS_INVALID_STATE;
   }
 
+  if (_execution->hasAsyncRequests())
+  {
+    std::cerr << "Error during nnfw_session::run : "
+              << "submitted requests are not completed" << std::endl;
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
   try
   {
     _execution->execute();
@@ -214,6 +231,13 @@ NNFW_STATUS nnfw_session::run_async()
     return NNFW_STATUS_INVALID_STATE;
   }
 
+  if (_execution->hasAsyncRequests())
+  {
+    std::cerr << "Error during nnfw_session::run_async : "
+              << "submitted requests are not completed" << std::endl;
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
   _execution->startExecute();
 
   _state = State::RUNNING;
@@ -229,7 +253,16 @@ NNFW_STATUS nnfw_session::await()
     return NNFW_STATUS_ERROR;
   }
 
-  _execution->waitFinish();
+  try
+  {
+    _execution->waitFinish();
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "Error during nnfw_session::await : " << e.what() << std::endl;
+    _state = State::FINISHED_RUN;
+    return NNFW_STATUS_ERROR;
+  }
 
   _state = State::FINISHED_RUN;
   return NNFW_STATUS_NO_ERROR;
@@ -645,6 +678,10 @@ NNFW_STATUS nnfw_session::set_config(const char *key, const char *value)
   {
     options.trace_filepath = value;
   }
+  else if (skey == config::TRACE_FORMAT)
+  {
+    options.trace_format = value;
+  }
   else if (skey == config::GRAPH_DOT_DUMP)
   {
     options.graph_dump_level = toInt(value);
@@ -673,6 +710,10 @@ NNFW_STATUS nnfw_session::set_config(const char *key, const char *value)
   {
     options.disable_compile = toBool(value);
   }
+  else if (skey == config::METRICS_SAMPLING)
+  {
+    options.metrics_sampling = toInt(value);
+  }
   else
   {
     return NNFW_STATUS_ERROR;
@@ -680,6 +721,110 @@ NNFW_STATUS nnfw_session::set_config(const char *key, const char *value)
   return NNFW_STATUS_NO_ERROR;
 }
 
+NNFW_STATUS nnfw_session::submit(nnfw_completion_callback callback, void *user_data,
+                                 uint64_t *request_id)
+{
+  if (!isStatePreparedOrFinishedRun())
+  {
+    std::cerr << "Error during nnfw_session::submit : "
+              << "submit should be run after prepare" << std::endl;
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
+  if (!request_id)
+    return NNFW_STATUS_UNEXPECTED_NULL;
+
+  auto completion = [this, callback, user_data](uint64_t id,
+                                                onert::exec::Execution::RequestResult result) {
+    using RequestResult = onert::exec::Execution::RequestResult;
+    NNFW_REQUEST_RESULT nnfw_result = NNFW_REQUEST_DONE;
+    if (result == RequestResult::FAILED)
+      nnfw_result = NNFW_REQUEST_FAILED;
+    else if (result == RequestResult::CANCELLED)
+      nnfw_result = NNFW_REQUEST_CANCELLED;
+
+    if (callback)
+    {
+      callback(id, nnfw_result, user_data);
+      return;
+    }
+
+    std::lock_guard<std::mutex> lock(_completion_mutex);
+    _completions.emplace_back(id, nnfw_result);
+    if (_completion_fd >= 0)
+    {
+      const uint64_t count = 1;
+      auto ret = write(_completion_fd, &count, sizeof(count));
+      (void)ret;
+    }
+  };
+
+  try
+  {
+    *request_id = _execution->submit(completion);
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "Error during nnfw_session::submit : " << e.what() << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_session::cancel(uint64_t request_id)
+{
+  if (!isStatePreparedOrFinishedRun())
+    return NNFW_STATUS_INVALID_STATE;
+
+  return _execution->cancel(request_id) ? NNFW_STATUS_NO_ERROR : NNFW_STATUS_ERROR;
+}
+
+NNFW_STATUS nnfw_session::completion_fd(int *fd)
+{
+  if (!fd)
+    return NNFW_STATUS_UNEXPECTED_NULL;
+
+  std::lock_guard<std::mutex> lock(_completion_mutex);
+  if (_completion_fd < 0)
+  {
+    _completion_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (_completion_fd < 0)
+    {
+      std::cerr << "Error during nnfw_session::completion_fd : eventfd failed" << std::endl;
+      return NNFW_STATUS_ERROR;
+    }
+
+    // For completions queued before
+    if (!_completions.empty())
+    {
+      const uint64_t count = _completions.size();
+      auto ret = write(_completion_fd, &count, sizeof(count));
+      (void)ret;
+    }
+  }
+
+  *fd = _completion_fd;
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_session::poll_completion(uint64_t *request_id, NNFW_REQUEST_RESULT *result)
+{
+  if (!request_id || !result)
+    return NNFW_STATUS_UNEXPECTED_NULL;
+
+  std::lock_guard<std::mutex> lock(_completion_mutex);
+  if (_completions.empty())
+  {
+    *request_id = 0;
+    return NNFW_STATUS_NO_ERROR;
+  }
+
+  *request_id = _completions.front().first;
+  *result = _completions.front().second;
+  _completions.pop_front();
+  return NNFW_STATUS_NO_ERROR;
+}
+
 onert::ir::Graph *nnfw_session::primary_subgraph()
 {
   if (_subgraphs)
@@ -742,6 +887,43 @@ NNFW_STATUS nnfw_session::get_config(const char *key, char *value, size_t value_
   return NNFW_STATUS_NO_ERROR;
 }
 
+NNFW_STATUS nnfw_session::get_metrics(char *buffer, size_t buffer_size, size_t *length)
+{
+  if (!isStatePreparedOrFinishedRun())
+  {
+    std::cerr << "Error during nnfw_session::get_metrics : "
+              << "get_metrics should be run after prepare" << std::endl;
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
+  if (!length)
+    return NNFW_STATUS_UNEXPECTED_NULL;
+
+  auto metrics = _execution->metrics();
+  if (!metrics)
+  {
+    std::cerr << "Error during nnfw_session::get_metrics : "
+              << "metrics are not collected, set " << onert::util::config::METRICS_SAMPLING
+              << " config before prepare" << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
+  const auto json = metrics->toJSON();
+  *length = json.length() + 1 /* for '\0' */;
+
+  if (!buffer)
+    return NNFW_STATUS_NO_ERROR;
+
+  if (buffer_size < *length)
+  {
+    std::cerr << "buffer is small to copy metrics." << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
+  strncpy(buffer, json.c_str(), buffer_size);
+  return NNFW_STATUS_NO_ERROR;
+}
+
 bool nnfw_session::isStateInitialized()
 {
   if (_state == State::INITIALIZED)
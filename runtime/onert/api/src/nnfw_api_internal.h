@@ -22,8 +22,11 @@
 
 #include <util/GeneralConfigSource.h>
 
-#include <string>
+#include <deque>
 #include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
 
 namespace onert
 {
@@ -130,6 +133,13 @@ public:
   NNFW_STATUS set_config(const char *key, const char *value);
   NNFW_STATUS get_config(const char *key, char *value, size_t value_size);
 
+  NNFW_STATUS get_metrics(char *buffer, size_t buffer_size, size_t *length);
+
+  NNFW_STATUS submit(nnfw_completion_callback callback, void *user_data, uint64_t *request_id);
+  NNFW_STATUS cancel(uint64_t request_id);
+  NNFW_STATUS completion_fd(int *fd);
+  NNFW_STATUS poll_completion(uint64_t *request_id, NNFW_REQUEST_RESULT *result);
+
 private:
   onert::ir::Graph *primary_subgraph();
   bool isStateInitialized();
@@ -145,6 +155,11 @@ private:
   std::unique_ptr<onert::compiler::Compiler> _compiler;
   std::shared_ptr<onert::exec::Execution> _execution;
   std::shared_ptr<onert::frontend::custom::KernelRegistry> _kernel_registry;
+
+  // Completions of requests submitted without callback
+  std::mutex _completion_mutex;
+  std::deque<std::pair<uint64_t, NNFW_REQUEST_RESULT>> _completions;
+  int _completion_fd{-1};
 };
 
 #endif // __API_NNFW_API_INTERNAL_H__
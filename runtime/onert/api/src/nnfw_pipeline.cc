@@ -0,0 +1,341 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "nnfw_pipeline.h"
+#include "nnfw_api_internal.h"
+
+#include <cstring>
+#include <iostream>
+
+namespace
+{
+
+size_t bufsize_of(const nnfw_tensorinfo &ti)
+{
+  size_t elem_size = 1;
+  switch (ti.dtype)
+  {
+    case NNFW_TYPE_TENSOR_FLOAT32:
+    case NNFW_TYPE_TENSOR_INT32:
+      elem_size = 4;
+      break;
+    case NNFW_TYPE_TENSOR_QUANT8_ASYMM:
+    case NNFW_TYPE_TENSOR_BOOL:
+    case NNFW_TYPE_TENSOR_UINT8:
+      elem_size = 1;
+      break;
+    case NNFW_TYPE_TENSOR_INT64:
+      elem_size = 8;
+      break;
+  }
+
+  size_t size = elem_size;
+  for (int32_t i = 0; i < ti.rank; ++i)
+    size *= ti.dims[i];
+  return size;
+}
+
+std::vector<size_t> bufsizes_of(const std::vector<nnfw_tensorinfo> &tis)
+{
+  std::vector<size_t> sizes;
+  for (const auto &ti : tis)
+    sizes.emplace_back(bufsize_of(ti));
+  return sizes;
+}
+
+} // namespace
+
+nnfw_pipeline::Ring::Ring(uint32_t depth, const std::vector<size_t> &lengths) : _frames(depth)
+{
+  for (auto &frame : _frames)
+    for (auto length : lengths)
+      frame.emplace_back(length);
+}
+
+nnfw_pipeline::Frame *nnfw_pipeline::Ring::acquireWrite()
+{
+  std::unique_lock<std::mutex> lock(_mutex);
+  _cond_var.wait(lock, [&]() { return _closed || _written - _read < _frames.size(); });
+  if (_closed)
+    return nullptr;
+  return &_frames[_written % _frames.size()];
+}
+
+void nnfw_pipeline::Ring::commitWrite()
+{
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    ++_written;
+  }
+  _cond_var.notify_all();
+}
+
+nnfw_pipeline::Frame *nnfw_pipeline::Ring::acquireRead()
+{
+  std::unique_lock<std::mutex> lock(_mutex);
+  _cond_var.wait(lock, [&]() { return _closed || _read < _written; });
+  if (_closed)
+    return nullptr;
+  return &_frames[_read % _frames.size()];
+}
+
+void nnfw_pipeline::Ring::releaseRead()
+{
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    ++_read;
+  }
+  _cond_var.notify_all();
+}
+
+void nnfw_pipeline::Ring::close()
+{
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _closed = true;
+  }
+  _cond_var.notify_all();
+}
+
+nnfw_pipeline::nnfw_pipeline(uint32_t depth) : _depth{depth}
+{
+  // DO NOTHING
+}
+
+nnfw_pipeline::~nnfw_pipeline() { stop(); }
+
+NNFW_STATUS nnfw_pipeline::add_stage(nnfw_session *session)
+{
+  if (_started)
+  {
+    std::cerr << "Error during nnfw_pipeline::add_stage : pipeline is already started"
+              << std::endl;
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
+  Stage stage;
+  stage.session = session;
+
+  uint32_t num_inputs = 0;
+  uint32_t num_outputs = 0;
+  if (session->input_size(&num_inputs) != NNFW_STATUS_NO_ERROR ||
+      session->output_size(&num_outputs) != NNFW_STATUS_NO_ERROR)
+    return NNFW_STATUS_INVALID_STATE;
+
+  stage.inputs.resize(num_inputs);
+  for (uint32_t i = 0; i < num_inputs; ++i)
+  {
+    if (session->input_tensorinfo(i, &stage.inputs[i]) != NNFW_STATUS_NO_ERROR)
+      return NNFW_STATUS_ERROR;
+  }
+  stage.outputs.resize(num_outputs);
+  for (uint32_t i = 0; i < num_outputs; ++i)
+  {
+    if (session->output_tensorinfo(i, &stage.outputs[i]) != NNFW_STATUS_NO_ERROR)
+      return NNFW_STATUS_ERROR;
+  }
+  stage.connections.assign(num_inputs, -1);
+
+  _stages.emplace_back(stage);
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_pipeline::connect(uint32_t stage, uint32_t input_index, uint32_t output_index)
+{
+  if (_started)
+  {
+    std::cerr << "Error during nnfw_pipeline::connect : pipeline is already started" << std::endl;
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
+  if (stage == 0 || stage >= _stages.size())
+  {
+    std::cerr << "Error during nnfw_pipeline::connect : invalid stage " << stage << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
+  auto &to = _stages[stage];
+  const auto &from = _stages[stage - 1];
+  if (input_index >= to.inputs.size() || output_index >= from.outputs.size())
+  {
+    std::cerr << "Error during nnfw_pipeline::connect : invalid tensor index" << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
+  to.connections[input_index] = static_cast<int32_t>(output_index);
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_pipeline::start()
+{
+  if (_started || _stages.empty())
+  {
+    std::cerr << "Error during nnfw_pipeline::start : "
+              << "pipeline is already started or has no stage" << std::endl;
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
+  // Inputs not connected explicitly take the output at the same index
+  for (uint32_t s = 1; s < _stages.size(); ++s)
+  {
+    auto &stage = _stages[s];
+    const auto &prev = _stages[s - 1];
+    for (uint32_t i = 0; i < stage.inputs.size(); ++i)
+    {
+      auto &conn = stage.connections[i];
+      if (conn < 0)
+      {
+        if (i >= prev.outputs.size())
+        {
+          std::cerr << "Error during nnfw_pipeline::start : input " << i << " of stage " << s
+                    << " is not connected" << std::endl;
+          return NNFW_STATUS_ERROR;
+        }
+        conn = static_cast<int32_t>(i);
+      }
+
+      const auto &in = stage.inputs[i];
+      const auto &out = prev.outputs[conn];
+      if (in.dtype != out.dtype || bufsize_of(in) != bufsize_of(out))
+      {
+        std::cerr << "Error during nnfw_pipeline::start : input " << i << " of stage " << s
+                  << " does not match output " << conn << " of stage " << s - 1 << std::endl;
+        return NNFW_STATUS_ERROR;
+      }
+    }
+  }
+
+  _rings.emplace_back(new Ring(_depth, bufsizes_of(_stages.front().inputs)));
+  for (const auto &stage : _stages)
+    _rings.emplace_back(new Ring(_depth, bufsizes_of(stage.outputs)));
+
+  _started = true;
+  for (uint32_t s = 0; s < _stages.size(); ++s)
+    _threads.emplace_back([this, s]() { runStage(s); });
+
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_pipeline::push(const void *const *buffers, const size_t *lengths)
+{
+  if (!_started)
+    return NNFW_STATUS_INVALID_STATE;
+
+  const auto &inputs = _stages.front().inputs;
+  for (uint32_t i = 0; i < inputs.size(); ++i)
+  {
+    if (buffers[i] == nullptr || lengths[i] != bufsize_of(inputs[i]))
+    {
+      std::cerr << "Error during nnfw_pipeline::push : invalid buffer for input " << i
+                << std::endl;
+      return NNFW_STATUS_ERROR;
+    }
+  }
+
+  // Blocks while the first stage is behind by as many frames as the depth
+  auto &ring = *_rings.front();
+  auto frame = ring.acquireWrite();
+  if (frame == nullptr)
+    return NNFW_STATUS_ERROR;
+
+  for (uint32_t i = 0; i < inputs.size(); ++i)
+    std::memcpy((*frame)[i].data(), buffers[i], lengths[i]);
+  ring.commitWrite();
+
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_pipeline::pop(void *const *buffers, const size_t *lengths)
+{
+  if (!_started)
+    return NNFW_STATUS_INVALID_STATE;
+
+  const auto &outputs = _stages.back().outputs;
+  for (uint32_t i = 0; i < outputs.size(); ++i)
+  {
+    if (buffers[i] == nullptr || lengths[i] < bufsize_of(outputs[i]))
+    {
+      std::cerr << "Error during nnfw_pipeline::pop : invalid buffer for output " << i
+                << std::endl;
+      return NNFW_STATUS_ERROR;
+    }
+  }
+
+  auto &ring = *_rings.back();
+  auto frame = ring.acquireRead();
+  if (frame == nullptr)
+    return NNFW_STATUS_ERROR;
+
+  for (uint32_t i = 0; i < outputs.size(); ++i)
+    std::memcpy(buffers[i], (*frame)[i].data(), (*frame)[i].size());
+  ring.releaseRead();
+
+  return NNFW_STATUS_NO_ERROR;
+}
+
+void nnfw_pipeline::runStage(uint32_t index)
+{
+  auto &stage = _stages[index];
+  auto &in_ring = *_rings[index];
+  auto &out_ring = *_rings[index + 1];
+
+  while (true)
+  {
+    auto in_frame = in_ring.acquireRead();
+    if (in_frame == nullptr)
+      break;
+    auto out_frame = out_ring.acquireWrite();
+    if (out_frame == nullptr)
+      break;
+
+    bool ok = true;
+    for (uint32_t i = 0; i < stage.inputs.size() && ok; ++i)
+    {
+      // The first stage takes its inputs in order, others take the connected outputs
+      auto &buf = (*in_frame)[index == 0 ? i : stage.connections[i]];
+      ok = stage.session->set_input(i, stage.inputs[i].dtype, buf.data(), buf.size()) ==
+           NNFW_STATUS_NO_ERROR;
+    }
+    for (uint32_t i = 0; i < stage.outputs.size() && ok; ++i)
+    {
+      auto &buf = (*out_frame)[i];
+      ok = stage.session->set_output(i, stage.outputs[i].dtype, buf.data(), buf.size()) ==
+           NNFW_STATUS_NO_ERROR;
+    }
+    ok = ok && stage.session->run() == NNFW_STATUS_NO_ERROR;
+
+    if (!ok)
+    {
+      std::cerr << "Error during nnfw_pipeline : stage " << index << " failed" << std::endl;
+      // Wake up all the others including push and pop
+      for (auto &ring : _rings)
+        ring->close();
+      break;
+    }
+
+    in_ring.releaseRead();
+    out_ring.commitWrite();
+  }
+}
+
+void nnfw_pipeline::stop()
+{
+  for (auto &ring : _rings)
+    ring->close();
+  for (auto &thread : _threads)
+    thread.join();
+  _threads.clear();
+}
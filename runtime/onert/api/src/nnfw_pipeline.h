@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __API_NNFW_PIPELINE_H__
+#define __API_NNFW_PIPELINE_H__
+
+#include "nnfw.h"
+#include "nnfw_experimental.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Sessions chained stage by stage, each running on its own thread
+ *
+ * Stages are connected with bounded ring buffers of frames:
+ *
+ *   push -> [ring 0] -> stage 0 -> [ring 1] -> stage 1 -> ... -> stage N-1 -> [ring N] -> pop
+ *
+ * Ring 0 holds input tensors of stage 0, and ring k(> 0) holds output tensors of stage k-1.
+ * A stage writes its outputs into a free frame of the next ring and the next stage reads its
+ * inputs from that frame in place, so there is no copy between stages. A stage blocks while the
+ * next ring is full, which throttles the stages before a slow one.
+ */
+struct nnfw_pipeline
+{
+private:
+  using Frame = std::vector<std::vector<uint8_t>>;
+
+  // Ring buffer with a single producer and a single consumer
+  class Ring
+  {
+  public:
+    Ring(uint32_t depth, const std::vector<size_t> &lengths);
+
+    Frame *acquireWrite();
+    void commitWrite();
+    Frame *acquireRead();
+    void releaseRead();
+    void close();
+
+  private:
+    std::vector<Frame> _frames;
+    uint64_t _written{0};
+    uint64_t _read{0};
+    bool _closed{false};
+    std::mutex _mutex;
+    std::condition_variable _cond_var;
+  };
+
+  struct Stage
+  {
+    nnfw_session *session;
+    std::vector<nnfw_tensorinfo> inputs;
+    std::vector<nnfw_tensorinfo> outputs;
+    // Index of the previous stage's output for each input, -1 if not connected
+    std::vector<int32_t> connections;
+  };
+
+public:
+  nnfw_pipeline(uint32_t depth);
+  ~nnfw_pipeline();
+
+  NNFW_STATUS add_stage(nnfw_session *session);
+  NNFW_STATUS connect(uint32_t stage, uint32_t input_index, uint32_t output_index);
+  NNFW_STATUS start();
+  NNFW_STATUS push(const void *const *buffers, const size_t *lengths);
+  NNFW_STATUS pop(void *const *buffers, const size_t *lengths);
+
+private:
+  void runStage(uint32_t index);
+  void stop();
+
+private:
+  const uint32_t _depth;
+  std::vector<Stage> _stages;
+  std::vector<std::unique_ptr<Ring>> _rings;
+  std::vector<std::thread> _threads;
+  bool _started{false};
+};
+
+#endif // __API_NNFW_PIPELINE_H__
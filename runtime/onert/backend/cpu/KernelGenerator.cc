@@ -26,6 +26,7 @@
 #include "ops/ConvolutionLayer.h"
 #include "ops/CosLayer.h"
 #include "ops/DepthwiseConvolutionLayer.h"
+#include "ops/DequantizeLayer.h"
 #include "ops/DivLayer.h"
 #include "ops/EinsumLayer.h"
 #include "ops/ExpLayer.h"
@@ -1413,6 +1414,21 @@ void KernelGenerator::visit(const ir::operation::Quantize &node)
   _return_fn = std::move(fn);
 }
 
+void KernelGenerator::visit(const ir::operation::Dequantize &node)
+{
+  const auto input_index{node.getInputs().at(ir::operation::Dequantize::Input::INPUT)};
+  const auto output_index{node.getOutputs().at(0)};
+
+  auto input_tensor = _tensor_builder->portableAt(input_index).get();
+  auto output_tensor = _tensor_builder->portableAt(output_index).get();
+
+  auto fn = std::make_unique<ops::DequantizeLayer>();
+
+  fn->configure(input_tensor, output_tensor);
+
+  _return_fn = std::move(fn);
+}
+
 void KernelGenerator::visit(const ir::operation::SpaceToDepth &node)
 {
   const auto input_index{node.getInputs().at(ir::operation::SpaceToDepth::Input::INPUT)};
@@ -46,9 +46,19 @@ void BatchMatMulLayer::batchMatMulFloat32()
   // TODO implement for constant input
 
   batchmatmul_kernel.prepare(lhs_shape, rhs_shape, _adj_x, _adj_y);
-  batchmatmul_kernel(lhs_shape, reinterpret_cast<const float *>(_lhs->buffer()), rhs_shape,
-                     reinterpret_cast<const float *>(_rhs->buffer()), _adj_x, _adj_y, output_shape,
-                     reinterpret_cast<float *>(_output->buffer()));
+  if (_rhs->data_type() == OperandType::FLOAT16)
+  {
+    // Constant rhs kept in fp16 is widened by the kernel
+    batchmatmul_kernel(lhs_shape, reinterpret_cast<const float *>(_lhs->buffer()), rhs_shape,
+                       reinterpret_cast<const uint16_t *>(_rhs->buffer()), _adj_x, _adj_y,
+                       output_shape, reinterpret_cast<float *>(_output->buffer()));
+  }
+  else
+  {
+    batchmatmul_kernel(lhs_shape, reinterpret_cast<const float *>(_lhs->buffer()), rhs_shape,
+                       reinterpret_cast<const float *>(_rhs->buffer()), _adj_x, _adj_y,
+                       output_shape, reinterpret_cast<float *>(_output->buffer()));
+  }
 }
 
 void BatchMatMulLayer::configure(const IPortableTensor *lhs, const IPortableTensor *rhs, bool adj_x,
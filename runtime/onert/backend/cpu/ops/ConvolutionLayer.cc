@@ -18,7 +18,48 @@
 
 #include "../Tensor.h"
 #include "ir/Padding.h"
+#include "util/TuningCache.h"
 #include <cker/operation/Conv.h>
+#include <cker/operation/FullyConnected.h>
+
+#include <sstream>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+std::string toString(const nnfw::cker::Shape &shape)
+{
+  std::string str;
+  for (int i = 0; i < shape.DimensionsCount(); ++i)
+  {
+    if (i > 0)
+      str += "x";
+    str += std::to_string(shape.Dims(i));
+  }
+  return str;
+}
+
+// Multithreaded kernel variants are "multithreaded" for all the threads and "multithreaded_<n>"
+// for n threads
+const char *kMultiThreaded = "multithreaded";
+
+std::string multiThreadedVariant(int num_threads)
+{
+  return num_threads == 0 ? kMultiThreaded
+                          : std::string{kMultiThreaded} + "_" + std::to_string(num_threads);
+}
+
+int numThreadsOf(const std::string &variant)
+{
+  const std::string prefix = std::string{kMultiThreaded} + "_";
+  if (variant.compare(0, prefix.size(), prefix) != 0)
+    return 0;
+  return std::stoi(variant.substr(prefix.size()));
+}
+
+} // namespace
 
 namespace onert
 {
@@ -32,7 +73,8 @@ ConvolutionLayer::ConvolutionLayer()
     : _input(nullptr), _kernel(nullptr), _bias(nullptr), _output(nullptr),
       _paddingType(ir::PaddingType::EXPLICIT), _paddingLeft(0), _paddingTop(0), _paddingRight(0),
       _paddingBottom(0), _strideWidth(0), _strideHeight(0), _activation(ir::Activation::NONE),
-      _conv_kernel(new nnfw::cker::Conv()), _prepare(false)
+      _conv_kernel(new nnfw::cker::Conv()), _temp_arena(new nnfw::cker::FCTempArena()),
+      _prepare(false)
 {
   // DO NOTHING
 }
@@ -40,6 +82,14 @@ ConvolutionLayer::ConvolutionLayer()
 ConvolutionLayer::~ConvolutionLayer() = default;
 
 void ConvolutionLayer::convFloat32()
+{
+  convFloat32(reinterpret_cast<const float *>(_input->buffer()),
+              reinterpret_cast<const float *>(_bias->buffer()),
+              reinterpret_cast<float *>(_output->buffer()));
+}
+
+void ConvolutionLayer::convFloat32(const float *input_data, const float *bias_data,
+                                   float *output_data)
 {
   float output_activation_min = 0, output_activation_max = 0;
   CalculateActivationRange(_activation, &output_activation_min, &output_activation_max);
@@ -56,10 +106,9 @@ void ConvolutionLayer::convFloat32()
   op_params.float_activation_max = output_activation_max;
 
   nnfw::cker::Conv &kernel = *_conv_kernel;
-  kernel(op_params, getTensorShape(_input), reinterpret_cast<const float *>(_input->buffer()),
-         getTensorShape(_kernel), reinterpret_cast<const float *>(_kernel->buffer()),
-         getTensorShape(_bias), reinterpret_cast<const float *>(_bias->buffer()),
-         getTensorShape(_output), reinterpret_cast<float *>(_output->buffer()));
+  kernel(op_params, getTensorShape(_input), input_data, getTensorShape(_kernel),
+         reinterpret_cast<const float *>(_kernel->buffer()), getTensorShape(_bias), bias_data,
+         getTensorShape(_output), output_data);
 }
 
 void ConvolutionLayer::convQuant8()
@@ -99,6 +148,33 @@ void ConvolutionLayer::convQuant8()
          getTensorShape(_output), reinterpret_cast<uint8_t *>(_output->buffer()));
 }
 
+void ConvolutionLayer::convSparseWeight()
+{
+  // 1x1 convolution with stride 1 is FullyConnected of each pixel
+  nnfw::cker::FullyConnectedParams op_params;
+  op_params.activation = convertActivationType(_activation);
+
+  const auto *sparsity = _kernel->sparsity();
+  nnfw::cker::FullyConnectedSparseWeight(
+      op_params, getTensorShape(_input), reinterpret_cast<const float *>(_input->buffer()),
+      getTensorShape(_kernel), reinterpret_cast<const float *>(_kernel->buffer()),
+      getTensorShape(_bias), reinterpret_cast<const float *>(_bias->buffer()),
+      getTensorShape(_output), reinterpret_cast<float *>(_output->buffer()),
+      sparsity->segments().data(), sparsity->indices().data(), sparsity->block_size().data());
+}
+
+void ConvolutionLayer::convFloat16Weight()
+{
+  nnfw::cker::FullyConnectedParams op_params;
+  op_params.activation = convertActivationType(_activation);
+
+  nnfw::cker::FullyConnectedFloat16Weight(
+      op_params, getTensorShape(_input), reinterpret_cast<const float *>(_input->buffer()),
+      getTensorShape(_kernel), reinterpret_cast<const uint16_t *>(_kernel->buffer()),
+      getTensorShape(_bias), reinterpret_cast<const float *>(_bias->buffer()),
+      getTensorShape(_output), reinterpret_cast<float *>(_output->buffer()), *_temp_arena);
+}
+
 void ConvolutionLayer::configure(const IPortableTensor *input, const IPortableTensor *kernel,
                                  const IPortableTensor *bias, const ir::PaddingType paddingType,
                                  const uint32_t paddingLeft, const uint32_t paddingRight,
@@ -118,6 +194,17 @@ void ConvolutionLayer::configure(const IPortableTensor *input, const IPortableTe
   _strideHeight = strideHeight;
   _activation = activation;
   _output = output;
+
+  // Sparse or fp16 kernel runs as FullyConnected of each pixel
+  if (_kernel->is_sparse() || _kernel->data_type() == OperandType::FLOAT16)
+  {
+    const auto ker_shape = _kernel->getShape();
+    if (_input->data_type() != OperandType::FLOAT32 || ker_shape.dim(1) != 1 ||
+        ker_shape.dim(2) != 1 || _strideWidth != 1 || _strideHeight != 1 || _paddingLeft != 0 ||
+        _paddingRight != 0 || _paddingTop != 0 || _paddingBottom != 0)
+      throw std::runtime_error{"Conv: sparse or fp16 kernel is supported only for float 1x1 "
+                               "kernel with stride 1 and no padding"};
+  }
 }
 
 void ConvolutionLayer::run()
@@ -152,7 +239,15 @@ void ConvolutionLayer::run()
     _paddingTop = padding.top;
     _paddingBottom = padding.bottom;
   }
-  if (_input->data_type() == OperandType::FLOAT32)
+  if (_kernel->is_sparse())
+  {
+    convSparseWeight();
+  }
+  else if (_kernel->data_type() == OperandType::FLOAT16)
+  {
+    convFloat16Weight();
+  }
+  else if (_input->data_type() == OperandType::FLOAT32)
   {
     convFloat32();
   }
@@ -172,14 +267,27 @@ void ConvolutionLayer::prepare()
     return;
 
   nnfw::cker::Conv &kernel = *_conv_kernel;
-  if (_input->data_type() == OperandType::FLOAT32 && _kernel->is_constant())
+  if (_kernel->is_sparse() || _kernel->data_type() == OperandType::FLOAT16)
+  {
+    // Sparse or fp16 kernel is used as it is
+  }
+  else if (_input->data_type() == OperandType::FLOAT32 && _kernel->is_constant())
   {
     bool is_transposed = false;
     kernel.prepare(getTensorShape(_kernel), reinterpret_cast<const float *>(_kernel->buffer()),
                    getPaddingType(_paddingType), is_transposed);
 
+    const auto variant = tuneFloat32();
+    const bool use_reference = (variant == "reference");
+    kernel.useReferenceFloat(use_reference);
+    kernel.numThreadsFloat(numThreadsOf(variant));
+
+    // Reference kernel runs with the original weights, so the transposed ones are not needed
+    if (is_transposed && use_reference)
+      kernel.releaseTransposedFilter();
+
     // Decrease reference of _kernel(weights) only when _kernel is constant
-    if (is_transposed)
+    if (is_transposed && !use_reference)
     {
       auto kernel_tensor = dynamic_cast<const Tensor *>(_kernel);
       if (kernel_tensor)
@@ -196,6 +304,55 @@ void ConvolutionLayer::prepare()
   _prepare = true;
 }
 
+std::string ConvolutionLayer::tuneFloat32()
+{
+  nnfw::cker::Conv &kernel = *_conv_kernel;
+
+  // There is nothing to choose if the multithreaded kernel cannot run
+  if (!kernel.usableMultiThreaded(getPaddingType(_paddingType)))
+    return "";
+
+  if (_input->is_dynamic() || _output->is_dynamic())
+    return "";
+
+  std::stringstream key;
+  key << "Conv2D/FLOAT32/in=" << toString(getTensorShape(_input))
+      << "/ker=" << toString(getTensorShape(_kernel))
+      << "/out=" << toString(getTensorShape(_output)) << "/stride=" << _strideWidth << "x"
+      << _strideHeight << "/pad=" << _paddingLeft << "," << _paddingRight << "," << _paddingTop
+      << "," << _paddingBottom;
+
+  // Kernels are benchmarked on zeroed scratch buffers, as tensor buffers may not be allocated
+  // or initialized yet (e.g. model inputs and outputs are given just before execution)
+  std::vector<float> input_data, bias_data, output_data;
+  auto run = [&](bool use_reference, int num_threads) {
+    if (input_data.empty())
+    {
+      input_data.assign(getTensorShape(_input).FlatSize(), 0.f);
+      bias_data.assign(getTensorShape(_bias).FlatSize(), 0.f);
+      output_data.assign(getTensorShape(_output).FlatSize(), 0.f);
+    }
+    kernel.useReferenceFloat(use_reference);
+    kernel.numThreadsFloat(num_threads);
+    convFloat32(input_data.data(), bias_data.data(), output_data.data());
+  };
+
+  // Small layers may run faster with fewer threads, so the multithreaded kernel is also tried
+  // with 1, 2, 4, ... threads below the thread count of this machine
+  std::vector<util::TuningCache::Candidate> candidates;
+  candidates.emplace_back(multiThreadedVariant(0), [&]() { run(false, 0); });
+  const int max_threads = std::thread::hardware_concurrency();
+  for (int num_threads = 1; num_threads < max_threads; num_threads *= 2)
+  {
+    candidates.emplace_back(multiThreadedVariant(num_threads),
+                            [&run, num_threads]() { run(false, num_threads); });
+  }
+  candidates.emplace_back("reference", [&]() { run(true, 0); });
+
+  auto &cache = util::TuningCache::get();
+  return cache.select(key.str(), candidates);
+}
+
 #undef ANDROID_NN_CONV_PARAMETERS
 
 } // namespace ops
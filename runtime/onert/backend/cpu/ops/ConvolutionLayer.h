@@ -23,12 +23,14 @@
 #include <exec/IFunction.h>
 #include <functional>
 #include <memory>
+#include <string>
 
 namespace nnfw
 {
 namespace cker
 {
 class Conv;
+class FCTempArena;
 }
 } // namespace nnfw
 
@@ -52,6 +54,10 @@ public:
 
   void convQuant8();
 
+  void convSparseWeight();
+
+  void convFloat16Weight();
+
   void configure(const IPortableTensor *input, const IPortableTensor *kernel,
                  const IPortableTensor *bias, ir::PaddingType _paddingType,
                  const uint32_t paddingLeft, const uint32_t paddingRight, const uint32_t paddingTop,
@@ -63,6 +69,19 @@ public:
 
   void prepare() override;
 
+private:
+  /**
+   * @brief Select float kernel variant from the tuning cache, autotuning it if enabled
+   *
+   * Variants are the multithreaded (Eigen) kernel with all or fewer threads, and the reference
+   * kernel.
+   *
+   * @return Variant name, or empty string to keep the default
+   */
+  std::string tuneFloat32();
+
+  void convFloat32(const float *input_data, const float *bias_data, float *output_data);
+
 private:
   const IPortableTensor *_input;
   const IPortableTensor *_kernel;
@@ -81,6 +100,7 @@ private:
   ir::Activation _activation;
 
   std::unique_ptr<nnfw::cker::Conv> _conv_kernel;
+  std::unique_ptr<nnfw::cker::FCTempArena> _temp_arena;
 
   bool _prepare;
 };
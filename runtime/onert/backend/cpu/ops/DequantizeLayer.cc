@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "DequantizeLayer.h"
+
+#include <cker/operation/Dequantize.h>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace ops
+{
+
+DequantizeLayer::DequantizeLayer() : _input(nullptr), _output(nullptr)
+{
+  // DO NOTHING
+}
+
+template <typename InputT, typename OutputT> void DequantizeLayer::affineDequantize()
+{
+  nnfw::cker::Dequantize(getTensorShape(_input), reinterpret_cast<const InputT *>(_input->buffer()),
+                         getTensorShape(_output), reinterpret_cast<OutputT *>(_output->buffer()),
+                         _input->data_scale(), _input->data_offset());
+}
+
+void DequantizeLayer::configure(const IPortableTensor *input, IPortableTensor *output)
+{
+  _input = input;
+  _output = output;
+}
+
+void DequantizeLayer::run()
+{
+  if (_input->data_type() == OperandType::QUANT_UINT8_ASYMM &&
+      _output->data_type() == OperandType::FLOAT32)
+  {
+    affineDequantize<uint8_t, float>();
+  }
+  else
+  {
+    throw std::runtime_error{"Dequantize: unsupported data type"};
+  }
+}
+
+} // namespace ops
+} // namespace cpu
+} // namespace backend
+} // namespace onert
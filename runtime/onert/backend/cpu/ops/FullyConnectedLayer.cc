@@ -152,6 +152,32 @@ void FullyConnectedLayer::fullyConnectedHybrid()
 #endif
 }
 
+void FullyConnectedLayer::fullyConnectedSparseWeight()
+{
+  nnfw::cker::FullyConnectedParams op_params;
+  op_params.activation = convertActivationType(_activation);
+
+  const auto *sparsity = _weights->sparsity();
+  nnfw::cker::FullyConnectedSparseWeight(
+      op_params, getTensorShape(_input), reinterpret_cast<const float *>(_input->buffer()),
+      getTensorShape(_weights), reinterpret_cast<const float *>(_weights->buffer()),
+      getTensorShape(_bias), reinterpret_cast<const float *>(_bias ? _bias->buffer() : nullptr),
+      getTensorShape(_output), reinterpret_cast<float *>(_output->buffer()),
+      sparsity->segments().data(), sparsity->indices().data(), sparsity->block_size().data());
+}
+
+void FullyConnectedLayer::fullyConnectedFloat16Weight()
+{
+  nnfw::cker::FullyConnectedParams op_params;
+  op_params.activation = convertActivationType(_activation);
+
+  nnfw::cker::FullyConnectedFloat16Weight(
+      op_params, getTensorShape(_input), reinterpret_cast<const float *>(_input->buffer()),
+      getTensorShape(_weights), reinterpret_cast<const uint16_t *>(_weights->buffer()),
+      getTensorShape(_bias), reinterpret_cast<const float *>(_bias ? _bias->buffer() : nullptr),
+      getTensorShape(_output), reinterpret_cast<float *>(_output->buffer()), *_temp_arena);
+}
+
 void FullyConnectedLayer::configure(const IPortableTensor *input, const IPortableTensor *weights,
                                     const IPortableTensor *bias, ir::Activation activation,
                                     IPortableTensor *output,
@@ -165,6 +191,11 @@ void FullyConnectedLayer::configure(const IPortableTensor *input, const IPortabl
   _is_hybrid = input->data_type() == OperandType::FLOAT32 &&
                weights->data_type() == OperandType::QUANT_INT8_SYMM;
   _external_context = external_context;
+
+  if (weights->is_sparse() && input->data_type() != OperandType::FLOAT32)
+    throw std::runtime_error{"FullyConnected: sparse weights are supported only for float"};
+  if (weights->data_type() == OperandType::FLOAT16 && input->data_type() != OperandType::FLOAT32)
+    throw std::runtime_error{"FullyConnected: fp16 weights are supported only for float input"};
 }
 
 void FullyConnectedLayer::run()
@@ -173,6 +204,14 @@ void FullyConnectedLayer::run()
   {
     fullyConnectedHybrid();
   }
+  else if (_weights->is_sparse())
+  {
+    fullyConnectedSparseWeight();
+  }
+  else if (_weights->data_type() == OperandType::FLOAT16)
+  {
+    fullyConnectedFloat16Weight();
+  }
   else if (_input->data_type() == OperandType::FLOAT32)
   {
     fullyConnectedFloat32();
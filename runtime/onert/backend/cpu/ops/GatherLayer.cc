@@ -71,6 +71,39 @@ template <typename InputType> void GatherLayer::runByInputType()
   }
 }
 
+// Constant input kept in fp16 gives float output
+void GatherLayer::runFloat16Input()
+{
+  nnfw::cker::GatherParams op_params;
+  op_params.axis = _axis;
+
+  switch (_indices->data_type())
+  {
+    case OperandType::INT32:
+    {
+      using IndicesType = int32_t;
+
+      nnfw::cker::GatherFloat16<IndicesType>(
+          op_params, getTensorShape(_input), reinterpret_cast<const uint16_t *>(_input->buffer()),
+          getTensorShape(_indices), reinterpret_cast<const IndicesType *>(_indices->buffer()),
+          getTensorShape(_output), reinterpret_cast<float *>(_output->buffer()));
+      break;
+    }
+    case OperandType::INT64:
+    {
+      using IndicesType = int64_t;
+
+      nnfw::cker::GatherFloat16<IndicesType>(
+          op_params, getTensorShape(_input), reinterpret_cast<const uint16_t *>(_input->buffer()),
+          getTensorShape(_indices), reinterpret_cast<const IndicesType *>(_indices->buffer()),
+          getTensorShape(_output), reinterpret_cast<float *>(_output->buffer()));
+      break;
+    }
+    default:
+      throw std::runtime_error("Gather: unsupported indices data type");
+  }
+}
+
 void GatherLayer::run()
 {
   switch (_input->data_type())
@@ -84,6 +117,9 @@ void GatherLayer::run()
     case OperandType::INT32:
       runByInputType<int32_t>();
       break;
+    case OperandType::FLOAT16:
+      runFloat16Input();
+      break;
     default:
       throw std::runtime_error("Gather: unsupported input data type");
   }
@@ -46,6 +46,7 @@ public:
 
 private:
   template <typename OpType> void runByInputType();
+  void runFloat16Input();
 
 private:
   const IPortableTensor *_input;
@@ -69,6 +69,13 @@ struct IConfig
   virtual bool supportPermutation() = 0;
   virtual bool supportDynamicTensor() = 0;
   virtual bool supportFP16() = 0;
+  /**
+   * @brief Returns whether kernels take constant float32 weights stored in fp16
+   *
+   * @return true  Kernels widen fp16 weights to float32 while running
+   * @return false Constant weights SHOULD be kept in float32
+   */
+  virtual bool supportFP16Weights() { return false; }
 };
 
 } // namespace backend
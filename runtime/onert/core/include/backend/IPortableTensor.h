@@ -18,6 +18,7 @@
 #define __ONERT_BACKEND_I_PORTABLE_TENSOR_H__
 
 #include "backend/ITensor.h"
+#include "ir/Sparsity.h"
 
 namespace onert
 {
@@ -41,6 +42,10 @@ public:
 public:
   bool has_padding() const final { return false; }
   void access(const std::function<void(ITensor &tensor)> &fn) final { fn(*this); }
+
+  // Sparse format of buffer, or nullptr if it is dense
+  virtual const ir::Sparsity *sparsity() const { return nullptr; }
+  bool is_sparse() const { return sparsity() != nullptr; }
 };
 
 } // namespace backend
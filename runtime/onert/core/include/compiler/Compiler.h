@@ -52,6 +52,8 @@ struct CompilerOptions
 
   // OPTIONS ONLY FOR DEBUGGING/PROFILING
   std::string trace_filepath; //< File path to save trace records
+  std::string trace_format;   //< Format of trace records, "snpe" or "chrome"
+  int metrics_sampling;       //< Record runtime metrics every N runs, 0 to disable
   int graph_dump_level;       //< Graph dump level, values between 0 and 2 are valid
   int op_seq_max_node;        //< Number of nodes that can be
   std::string executor;       //< Executor name to use
@@ -60,6 +62,9 @@ struct CompilerOptions
   bool he_profiling_mode; //< Whether HEScheduler profiling mode ON/OFF
   bool disable_compile;   //< Run with Interpreter if true, try compilation otherwise
   bool fp16_enable;       //< Whether fp16 mode ON/OFF
+  bool constant_folding;  //< Whether compile-time constant folding ON/OFF
+  bool op_fusion;         //< Whether graph-level operation fusion ON/OFF
+  bool fp16_weights;      //< Whether constant weights are stored in fp16 ON/OFF
 };
 
 CompilerOptions fetchCompilerOptionsFromGlobalConfig(const ir::Subgraphs &subgs);
@@ -25,7 +25,12 @@
 #include "exec/IExecutor.h"
 #include "IODescription.h"
 
-#include <thread>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
 
 namespace onert
 {
@@ -38,6 +43,21 @@ namespace exec
  */
 class Execution
 {
+public:
+  enum class RequestResult
+  {
+    DONE,
+    FAILED,
+    CANCELLED
+  };
+
+  /**
+   * @brief Function called when a request submitted by @c submit is completed
+   * @note  It is called on a thread of the async pool, or on the caller's thread when cancelled.
+   *        It may submit requests, destroy the execution, or call @c waitFinish as long as no
+   *        other request is queued.
+   */
+  using Completion = std::function<void(uint64_t id, RequestResult result)>;
 
 public:
   /**
@@ -45,6 +65,11 @@ public:
    * @param[in] executor  Model executor
    */
   Execution(const std::shared_ptr<ExecutorMap> &executors);
+  /**
+   * @brief Destroy Execution object, cancelling queued requests and waiting for a running one
+   * @note  It does not wait when called by a completion, as the request has already run
+   */
+  ~Execution();
 
 public:
   /**
@@ -122,17 +147,44 @@ public:
 
   /**
    * @brief Start asynchronous execution
-   * @note  It returns after execution thread is started
+   * @note  It returns after execution is queued on the async pool
    *        It should be called after setting input and output buffer
    */
   void startExecute(void);
 
   /**
    * @brief Return when execution is finished
-   * @note  It waits until execution is finished
+   * @note  It waits until all the queued requests are finished, and rethrows an exception thrown
+   *        by the execution started by @c startExecute. Output shapes of the execution started by
+   *        @c startExecute are updated on return. In a completion, it throws if other requests
+   *        are queued, as they could not run until the completion returns.
    */
   void waitFinish(void);
 
+  /**
+   * @brief     Queue a request with the current input and output buffers
+   * @note      Requests of an execution run one at a time in the order of submission, on a thread
+   *            pool shared by all the executions in the process. Buffers can be set again for
+   *            the next request right after return, but buffers of a request must be kept valid
+   *            until it is completed. Output shapes of requests are not kept.
+   * @param[in] completion  Function called when the request is completed
+   * @return    Request id, starting from 1
+   */
+  uint64_t submit(const Completion &completion);
+
+  /**
+   * @brief     Cancel a request not started yet
+   * @param[in] id  Request id returned by @c submit
+   * @return    @c true if cancelled, @c false if it has been started or does not exist
+   */
+  bool cancel(uint64_t id);
+
+  /**
+   * @brief   Check any request is queued or running
+   * @return  @c true if there is a request not completed yet, otherwise @c false
+   */
+  bool hasAsyncRequests(void);
+
   /**
    * @brief   Check execution is finished
    * @return  @c true if execution is finished, otherwise @c false
@@ -142,6 +194,12 @@ public:
   ir::Shape getInputShape(ir::IOIndex ind) const;
   ir::Shape getOutputShape(ir::IOIndex ind) const;
 
+  /**
+   * @brief   Returns runtime metrics of primary graph
+   * @return  Metrics object, or @c nullptr if metrics are not collected
+   */
+  std::shared_ptr<const Metrics> metrics() const { return primary_executor()->metrics(); }
+
 private:
   const std::unique_ptr<IExecutor> &primary_executor() const
   {
@@ -149,11 +207,29 @@ private:
   };
   std::unique_ptr<IExecutor> &primary_executor() { return _executors->at(ir::SubgraphIndex{0}); };
 
+  struct Request
+  {
+    uint64_t id;
+    IODescription io_desc;
+    Completion completion;
+    bool keep_error; // for startExecute
+  };
+
+  uint64_t enqueue(const Completion &completion, bool keep_error);
+  void runNextRequest(void);
+
 private:
   const std::shared_ptr<ExecutorMap> _executors;
   IODescription _io_desc;
-  std::unique_ptr<std::thread> _exec_thread;
-  bool finished{false};
+  std::atomic<bool> finished{false};
+
+  std::mutex _async_mutex;
+  std::condition_variable _async_cv;
+  std::deque<std::unique_ptr<Request>> _requests;
+  bool _async_active{false}; // a request is queued on the async pool or running
+  uint64_t _last_request_id{0};
+  std::exception_ptr _async_error;
+  std::vector<ir::Shape> _async_output_shapes; // of the last execution by startExecute
 };
 
 } // namespace exec
@@ -32,6 +32,7 @@ namespace onert
 namespace exec
 {
 class IExecutionObserver;
+class Metrics;
 /**
  * @brief Struct to define interface of Executor
  */
@@ -65,6 +66,12 @@ struct IExecutor
    * @note      This method should be thread-safe
    */
   virtual void execute(const IODescription &desc) = 0;
+
+  /**
+   * @brief  Returns runtime metrics
+   * @return Metrics object, or @c nullptr if metrics are not collected
+   */
+  virtual std::shared_ptr<const Metrics> metrics() const { return nullptr; }
 };
 
 using ExecutorMap = std::unordered_map<ir::SubgraphIndex, std::unique_ptr<IExecutor>>;
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file  Metrics.h
+ * @brief This file contains Metrics class to collect runtime metrics of an executor
+ */
+#ifndef __ONERT_EXEC_METRICS_H__
+#define __ONERT_EXEC_METRICS_H__
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <string>
+
+namespace onert
+{
+namespace exec
+{
+
+/**
+ * @brief Histogram of durations with log-linear buckets
+ *
+ * Each power of two range is split into 8 buckets, so a percentile is within 12.5% of the
+ * actual value. Recording is lock-free.
+ */
+class LatencyHistogram
+{
+public:
+  static constexpr uint32_t kSubBucketBits = 3;
+  static constexpr uint32_t kSubBuckets = 1u << kSubBucketBits;
+  static constexpr uint32_t kNumBuckets = kSubBuckets * (64 - kSubBucketBits + 1);
+
+public:
+  LatencyHistogram();
+
+public:
+  void record(uint64_t value);
+
+  uint64_t count() const { return _count.load(std::memory_order_relaxed); }
+  uint64_t sum() const { return _sum.load(std::memory_order_relaxed); }
+  uint64_t max() const { return _max.load(std::memory_order_relaxed); }
+
+  /**
+   * @brief Return lower bound of the bucket containing @c p percentile
+   * @param p Percentile, in range of [0, 100]
+   */
+  uint64_t percentile(double p) const;
+
+public:
+  static uint32_t bucketOf(uint64_t value);
+  static uint64_t lowerBoundOf(uint32_t bucket);
+
+private:
+  std::array<std::atomic<uint64_t>, kNumBuckets> _buckets;
+  std::atomic<uint64_t> _count;
+  std::atomic<uint64_t> _sum;
+  std::atomic<uint64_t> _max;
+};
+
+/**
+ * @brief Runtime metrics of an executor, recorded every N-th run
+ *
+ * Operations and memory entries are added before execution, then recorded from any thread
+ * without locks.
+ */
+class Metrics
+{
+public:
+  /**
+   * @param sampling_period Record every @c sampling_period -th run
+   */
+  explicit Metrics(uint32_t sampling_period);
+
+public:
+  uint32_t addOperation(const std::string &name, const std::string &backend);
+  uint32_t addMemory(const std::string &name);
+
+public:
+  /**
+   * @brief Count a run
+   * @return @c true if the run is to be recorded
+   */
+  bool beginRun();
+
+  void recordLatency(uint64_t us) { _latency.record(us); }
+  void recordOperation(uint32_t id, uint64_t us);
+  void recordMemory(uint32_t id, uint64_t bytes);
+
+public:
+  /**
+   * @brief Export metrics as a JSON string
+   */
+  std::string toJSON() const;
+
+private:
+  struct Operation
+  {
+    Operation(const std::string &name, const std::string &backend)
+        : name{name}, backend{backend}, count{0}, total_us{0}, max_us{0}
+    {
+    }
+
+    const std::string name;
+    const std::string backend;
+    std::atomic<uint64_t> count;
+    std::atomic<uint64_t> total_us;
+    std::atomic<uint64_t> max_us;
+  };
+
+  struct Memory
+  {
+    explicit Memory(const std::string &name) : name{name}, peak{0} {}
+
+    const std::string name;
+    std::atomic<uint64_t> peak; // High-water mark in bytes
+  };
+
+private:
+  const uint32_t _sampling_period;
+  std::atomic<uint64_t> _runs;
+  LatencyHistogram _latency;
+  // std::deque does not move elements on growth, which std::atomic requires
+  std::deque<Operation> _operations;
+  std::deque<Memory> _memories;
+};
+
+} // namespace exec
+} // namespace onert
+
+#endif // __ONERT_EXEC_METRICS_H__
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_IR_SPARSITY_H__
+#define __ONERT_IR_SPARSITY_H__
+
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+namespace onert
+{
+namespace ir
+{
+
+/**
+ * @brief Block compressed sparse row (BCSR) format of a constant operand
+ *
+ * The operand is viewed as a matrix of [product of all dims but the last, the last dim], which is
+ * split into blocks of [block_size[0], block_size[1]]. Data of the operand has the values of
+ * non-zero blocks only, each block in row-major order, and the blocks in row-major order.
+ *
+ * For example, with block_size {1, 2}
+ *
+ *   [[1 2 0 0 0 0]       segments {0, 1, 2, 3}
+ *    [0 0 0 0 5 6]   =>  indices  {0, 2, 0}
+ *    [3 0 0 0 0 0]]      data     {1, 2, 5, 6, 3, 0}
+ */
+class Sparsity
+{
+public:
+  Sparsity() = delete;
+  Sparsity(std::vector<int32_t> &&segments, std::vector<int32_t> &&indices,
+           std::vector<int32_t> &&block_size)
+      : _segments{std::move(segments)}, _indices{std::move(indices)},
+        _block_size{std::move(block_size)}
+  {
+    assert(_block_size.size() == 2);
+  }
+
+  /**
+   * @brief Offsets of each block row in indices, of (number of block rows + 1) size
+   */
+  const std::vector<int32_t> &segments() const { return _segments; }
+  /**
+   * @brief Block column of each non-zero block
+   */
+  const std::vector<int32_t> &indices() const { return _indices; }
+  /**
+   * @brief Size of a block, {rows, cols}. {1, 1} is for the sparse format without blocks.
+   */
+  const std::vector<int32_t> &block_size() const { return _block_size; }
+
+private:
+  std::vector<int32_t> _segments;
+  std::vector<int32_t> _indices;
+  std::vector<int32_t> _block_size;
+};
+
+} // namespace ir
+} // namespace onert
+
+#endif // __ONERT_IR_SPARSITY_H__
@@ -18,8 +18,10 @@
 #define __ONERT_IR_TYPEINFO_H__
 
 #include <cstdint>
+#include <memory>
 
 #include "ir/DataType.h"
+#include "ir/Sparsity.h"
 
 namespace onert
 {
@@ -40,14 +42,18 @@ public:
   DataType type() const { return _type; }
   float scale() const { return _scale; }
   int32_t offset() const { return _offset; }
+  const Sparsity *sparsity() const { return _sparsity.get(); }
 
 public:
   void type(const DataType type) { _type = type; }
+  void sparsity(std::shared_ptr<Sparsity> sparsity) { _sparsity = sparsity; }
 
 private:
   DataType _type;
   float _scale;
   int32_t _offset;
+  // Sparse format of a constant, nullptr if dense
+  std::shared_ptr<Sparsity> _sparsity;
 };
 
 bool operator==(const TypeInfo &lhs, const TypeInfo &rhs);
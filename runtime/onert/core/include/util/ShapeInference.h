@@ -133,6 +133,11 @@ StridedSliceParams buildStridedSliceParams(const T *begin, const T *end, const T
                                            const uint32_t begin_mask, const uint32_t end_mask,
                                            const uint32_t shrink_axis_mask, const uint8_t rank);
 
+int StartForAxis(const StridedSliceParams &params, const ir::Shape &input_shape, int axis);
+
+int StopForAxis(const StridedSliceParams &params, const ir::Shape &input_shape, int axis,
+                int start_for_axis);
+
 ir::Shape inferStridedSliceShape(const ir::Shape &input_shape, const StridedSliceParams &op_params,
                                  uint32_t rank);
 
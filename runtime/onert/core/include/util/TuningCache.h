@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_UTIL_TUNING_CACHE_H__
+#define __ONERT_UTIL_TUNING_CACHE_H__
+
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace onert
+{
+namespace util
+{
+
+/**
+ * @brief Persistent table of the fastest kernel variant for each workload
+ *
+ * A workload key describes an operation instance (operation, data type, shapes, params) and
+ * maps to the name of the kernel variant that ran fastest for it. Entries are grouped by CPU
+ * model, so one cache file can be shared by different machines.
+ *
+ * File format is one entry per line: "<cpu model>\t<workload key>\t<variant>"
+ */
+class TuningCache
+{
+public:
+  using Candidate = std::pair<std::string, std::function<void()>>;
+
+public:
+  /**
+   * @brief Process-wide cache configured by CPU_TUNING_CACHE and CPU_AUTOTUNE
+   *
+   * @note  The cache file is loaded only if CPU_TUNING_CACHE is set or CPU_AUTOTUNE is on,
+   *        and "tuning_cache.txt" is used when CPU_AUTOTUNE is on without CPU_TUNING_CACHE
+   */
+  static TuningCache &get();
+
+  /**
+   * @brief Return the description of the CPU this process runs on
+   */
+  static std::string currentCPUModel();
+
+public:
+  /**
+   * @param filepath  Cache file to load from and save to, no persistence if empty
+   * @param autotune  Benchmark candidates of workloads not found in the cache
+   * @param cpu_model CPU model whose entries are used
+   */
+  TuningCache(const std::string &filepath, bool autotune,
+              const std::string &cpu_model = currentCPUModel());
+
+public:
+  bool autotune() const { return _autotune; }
+  const std::string &cpuModel() const { return _cpu_model; }
+
+  /**
+   * @brief Find the variant recorded for @c key
+   * @return Variant name, or empty string if not found
+   */
+  std::string find(const std::string &key) const;
+
+  /**
+   * @brief Record @c variant for @c key and save the cache file
+   */
+  void update(const std::string &key, const std::string &variant);
+
+  /**
+   * @brief Select a variant among @c candidates for @c key
+   *
+   * Returns the recorded variant if it is one of @c candidates. Otherwise, if autotuning is
+   * enabled, runs every candidate @c repeat times, records and returns the fastest one.
+   * Returns empty string when no decision can be made, and the caller keeps its default.
+   */
+  std::string select(const std::string &key, const std::vector<Candidate> &candidates,
+                     uint32_t repeat = 3);
+
+  /**
+   * @brief Save entries to the cache file
+   *
+   * @note Entries of other CPU models in the file are preserved
+   * @note The file is replaced at once by renaming a temporary file written next to it
+   * @note Only a warning is printed if the file cannot be written
+   */
+  void save() const;
+
+private:
+  void load();
+
+private:
+  const std::string _filepath;
+  const bool _autotune;
+  const std::string _cpu_model;
+  // Entries of the CPU model this process runs on
+  std::map<std::string, std::string> _entries;
+  // Lines of other CPU models, kept as they are
+  std::vector<std::string> _foreign_lines;
+  mutable std::mutex _mutex;
+};
+
+} // namespace util
+} // namespace onert
+
+#endif // __ONERT_UTIL_TUNING_CACHE_H__
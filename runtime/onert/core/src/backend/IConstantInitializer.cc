@@ -33,6 +33,10 @@ void IConstantInitializer::registerCopyInitializer(const ir::OperandIndex &index
   if (!obj.isConstant())
     return;
 
+  // Sparse constants are supported only by the backends sharing the data as it is
+  if (obj.typeInfo().sparsity() != nullptr)
+    throw std::runtime_error("Sparse constant is not supported by this backend");
+
   const auto type = obj.typeInfo().type();
   using ir::DataType;
 
@@ -74,6 +78,10 @@ void IConstantInitializer::registerPermuteInitializer(const ir::OperandIndex &in
   if (!obj.isConstant())
     return;
 
+  // Sparse constants are supported only by the backends sharing the data as it is
+  if (obj.typeInfo().sparsity() != nullptr)
+    throw std::runtime_error("Sparse constant is not supported by this backend");
+
   const auto type = obj.typeInfo().type();
   using ir::DataType;
   using namespace std::placeholders;
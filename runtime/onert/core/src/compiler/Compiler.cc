@@ -19,7 +19,10 @@
 #include "ParamChecker.h"
 #include "ExecutorFactory.h"
 #include "OperationValidator.h"
+#include "ConstantFolder.h"
 #include "Fp32ToFp16Converter.h"
+#include "Fp16WeightsConverter.h"
+#include "OperationFuser.h"
 
 #include <backend/controlflow/Config.h>
 #include "compiler/BackendManager.h"
@@ -49,6 +52,8 @@ CompilerOptions fetchCompilerOptionsFromGlobalConfig(const ir::Subgraphs &subgs)
   options.backend_list = nnfw::misc::split(util::getConfigString(util::config::BACKENDS), ';');
   options.is_primary_subgraph = false;
   options.trace_filepath = util::getConfigString(util::config::TRACE_FILEPATH);
+  options.trace_format = util::getConfigString(util::config::TRACE_FORMAT);
+  options.metrics_sampling = util::getConfigInt(util::config::METRICS_SAMPLING);
   options.graph_dump_level = util::getConfigInt(util::config::GRAPH_DOT_DUMP);
   options.op_seq_max_node = util::getConfigInt(util::config::OP_SEQ_MAX_NODE);
   options.executor = util::getConfigString(util::config::EXECUTOR);
@@ -56,6 +61,9 @@ CompilerOptions fetchCompilerOptionsFromGlobalConfig(const ir::Subgraphs &subgs)
   options.he_profiling_mode = util::getConfigBool(util::config::PROFILING_MODE);
   options.disable_compile = util::getConfigBool(util::config::DISABLE_COMPILE);
   options.fp16_enable = util::getConfigBool(util::config::FP16_ENABLE);
+  options.constant_folding = util::getConfigBool(util::config::CONSTANT_FOLDING);
+  options.op_fusion = util::getConfigBool(util::config::OP_FUSION);
+  options.fp16_weights = util::getConfigBool(util::config::FP16_WEIGHTS);
 #ifdef RUY_PROFILER
   options.op_seq_max_node = 1;
 #endif
@@ -150,6 +158,9 @@ std::shared_ptr<exec::ExecutorMap> Compiler::compile(void)
     VERBOSE(Compiler) << "he_profiling_mode        : " << _options.he_profiling_mode << std::endl;
     VERBOSE(Compiler) << "disable_compile          : " << _options.disable_compile << std::endl;
     VERBOSE(Compiler) << "fp16_enable              : " << _options.fp16_enable << std::endl;
+    VERBOSE(Compiler) << "constant_folding         : " << _options.constant_folding << std::endl;
+    VERBOSE(Compiler) << "op_fusion                : " << _options.op_fusion << std::endl;
+    VERBOSE(Compiler) << "fp16_weights             : " << _options.fp16_weights << std::endl;
     VERBOSE(Compiler) << std::noboolalpha;
   }
 
@@ -187,6 +198,18 @@ std::shared_ptr<exec::ExecutorMap> Compiler::compile(void)
     onert::dumper::dot::DotDumper dot_dumper(subg, dump_level);
     dot_dumper.dump(nnfw::misc::str("before_lower_subg-", index.value()));
 
+    // Evaluate constant operations once instead of on every execution
+    if (_options.constant_folding)
+    {
+      ConstantFolder{subg}.run();
+    }
+
+    // Fuse operations before backends are assigned
+    if (_options.op_fusion)
+    {
+      OperationFuser{subg}.run();
+    }
+
     // Lower: Assign backend
     lowered_subgs[index] = std::make_unique<ir::LoweredGraph>(subg, _options);
 
@@ -206,6 +229,17 @@ std::shared_ptr<exec::ExecutorMap> Compiler::compile(void)
       Fp32ToFp16Converter(*lowered_subgs[index]).run();
     }
 
+    // Keep constant weights in fp16 for backends which widen them in kernels
+    if (_options.fp16_weights)
+    {
+      auto &lowered_subg = *lowered_subgs[index];
+      auto supports_fp16_weights = [&](const ir::OperationIndex &op_ind) {
+        const auto op_seq_ind = lowered_subg.op_seqs().getOperation(op_ind);
+        return lowered_subg.getLowerInfo(op_seq_ind)->backend()->config()->supportFP16Weights();
+      };
+      Fp16WeightsConverter{lowered_subg.graph(), supports_fp16_weights}.run();
+    }
+
     subg.setSubgraphs(nullptr);
   });
 
@@ -0,0 +1,483 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ConstantFolder.h"
+
+#include "ir/operation/Cast.h"
+#include "ir/operation/Concat.h"
+#include "ir/operation/ExpandDims.h"
+#include "ir/operation/Pack.h"
+#include "ir/operation/Reshape.h"
+#include "ir/operation/Squeeze.h"
+#include "ir/operation/StridedSlice.h"
+#include "ir/operation/Transpose.h"
+#include "util/ShapeInference.h"
+#include "util/logging.h"
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+#include <vector>
+
+namespace
+{
+
+using namespace onert;
+
+using Buffer = std::vector<uint8_t>;
+
+// Result of folding an operation which has one output
+struct FoldedValue
+{
+  ir::Shape shape;
+  Buffer data;
+};
+
+std::vector<int32_t> getCoordinates(const ir::Shape &shape, uint64_t offset)
+{
+  std::vector<int32_t> coords(shape.rank());
+  for (int axis = shape.rank() - 1; axis >= 0; --axis)
+  {
+    coords[axis] = offset % shape.dim(axis);
+    offset /= shape.dim(axis);
+  }
+  return coords;
+}
+
+uint64_t getOffset(const ir::Shape &shape, const std::vector<int32_t> &coords)
+{
+  uint64_t offset = 0;
+  for (int axis = 0; axis < shape.rank(); ++axis)
+    offset = offset * shape.dim(axis) + coords[axis];
+  return offset;
+}
+
+// Copy elements of the constant operand in the given order
+Buffer gatherElements(const ir::Operand &input, const std::vector<uint64_t> &offsets)
+{
+  const auto elem_size = ir::sizeOfDataType(input.typeInfo().type());
+  const auto base = input.data()->base();
+
+  Buffer data(offsets.size() * elem_size);
+  for (size_t i = 0; i < offsets.size(); ++i)
+    std::memcpy(data.data() + i * elem_size, base + offsets[i] * elem_size, elem_size);
+  return data;
+}
+
+Buffer copyElements(const ir::Operand &input)
+{
+  return Buffer(input.data()->base(), input.data()->base() + input.data()->size());
+}
+
+template <typename To, typename From> void castElements(const From *in, To *out, uint64_t size)
+{
+  for (uint64_t i = 0; i < size; ++i)
+    out[i] = static_cast<To>(in[i]);
+}
+
+template <typename To> bool castFrom(const ir::Operand &input, To *out)
+{
+  const auto size = input.shape().num_elements();
+  const auto base = input.data()->base();
+  switch (input.typeInfo().type())
+  {
+    case ir::DataType::FLOAT32:
+      castElements(reinterpret_cast<const float *>(base), out, size);
+      return true;
+    case ir::DataType::INT32:
+      castElements(reinterpret_cast<const int32_t *>(base), out, size);
+      return true;
+    case ir::DataType::UINT32:
+      castElements(reinterpret_cast<const uint32_t *>(base), out, size);
+      return true;
+    case ir::DataType::INT64:
+      castElements(reinterpret_cast<const int64_t *>(base), out, size);
+      return true;
+    case ir::DataType::UINT8:
+    case ir::DataType::BOOL8:
+      castElements(reinterpret_cast<const uint8_t *>(base), out, size);
+      return true;
+    default:
+      return false;
+  }
+}
+
+bool foldCast(const ir::Operand &input, const ir::Operand &output, FoldedValue &result)
+{
+  const auto size = input.shape().num_elements();
+  result.shape = input.shape();
+  result.data.resize(size * ir::sizeOfDataType(output.typeInfo().type()));
+
+  auto out = result.data.data();
+  switch (output.typeInfo().type())
+  {
+    case ir::DataType::FLOAT32:
+      return castFrom(input, reinterpret_cast<float *>(out));
+    case ir::DataType::INT32:
+      return castFrom(input, reinterpret_cast<int32_t *>(out));
+    case ir::DataType::UINT32:
+      return castFrom(input, reinterpret_cast<uint32_t *>(out));
+    case ir::DataType::INT64:
+      return castFrom(input, reinterpret_cast<int64_t *>(out));
+    case ir::DataType::UINT8:
+      return castFrom(input, reinterpret_cast<uint8_t *>(out));
+    case ir::DataType::BOOL8:
+      return castFrom(input, reinterpret_cast<bool *>(out));
+    default:
+      return false;
+  }
+}
+
+bool foldShape(const ir::Operand &input, const ir::Operand &output, FoldedValue &result)
+{
+  const auto rank = input.shape().rank();
+  result.shape = ir::Shape{rank};
+  if (output.typeInfo().type() == ir::DataType::INT32)
+  {
+    const auto &dims = input.shape().dims();
+    result.data.resize(rank * sizeof(int32_t));
+    std::memcpy(result.data.data(), dims.data(), result.data.size());
+    return true;
+  }
+  if (output.typeInfo().type() == ir::DataType::INT64)
+  {
+    std::vector<int64_t> dims{input.shape().dims().begin(), input.shape().dims().end()};
+    result.data.resize(rank * sizeof(int64_t));
+    std::memcpy(result.data.data(), dims.data(), result.data.size());
+    return true;
+  }
+  return false;
+}
+
+bool foldTranspose(const ir::Operand &input, const std::vector<int> &param_perm,
+                   FoldedValue &result)
+{
+  const auto &in_shape = input.shape();
+  const auto rank = in_shape.rank();
+
+  // Empty permutation means reversing the axes
+  std::vector<int> perm = param_perm;
+  if (perm.empty())
+  {
+    perm.resize(rank);
+    std::iota(perm.rbegin(), perm.rend(), 0);
+  }
+  if (static_cast<int>(perm.size()) != rank)
+    return false;
+
+  result.shape = shape_inference::inferTransposeShape(in_shape, perm);
+
+  std::vector<uint64_t> offsets(in_shape.num_elements());
+  std::vector<int32_t> in_coords(rank);
+  for (uint64_t i = 0; i < offsets.size(); ++i)
+  {
+    const auto out_coords = getCoordinates(result.shape, i);
+    for (int axis = 0; axis < rank; ++axis)
+      in_coords[perm[axis]] = out_coords[axis];
+    offsets[i] = getOffset(in_shape, in_coords);
+  }
+  result.data = gatherElements(input, offsets);
+  return true;
+}
+
+bool foldStridedSlice(const ir::Graph &graph, const ir::operation::StridedSlice &op,
+                      FoldedValue &result)
+{
+  const auto &input = graph.operands().at(op.getInputs().at(ir::operation::StridedSlice::INPUT));
+  const auto &starts = graph.operands().at(op.getInputs().at(ir::operation::StridedSlice::STARTS));
+  const auto &ends = graph.operands().at(op.getInputs().at(ir::operation::StridedSlice::ENDS));
+  const auto &strides =
+      graph.operands().at(op.getInputs().at(ir::operation::StridedSlice::STRIDES));
+  const auto &in_shape = input.shape();
+  const auto rank = in_shape.rank();
+  if (rank > 4 || starts.typeInfo().type() != ir::DataType::INT32 ||
+      ends.typeInfo().type() != ir::DataType::INT32 ||
+      strides.typeInfo().type() != ir::DataType::INT32)
+    return false;
+
+  const auto &param = op.param();
+  auto op_params = shape_inference::buildStridedSliceParams(
+      reinterpret_cast<const uint32_t *>(starts.data()->base()),
+      reinterpret_cast<const uint32_t *>(ends.data()->base()),
+      reinterpret_cast<const uint32_t *>(strides.data()->base()), param.begin_mask,
+      param.end_mask, param.shrink_axis_mask, rank);
+  result.shape = shape_inference::inferStridedSliceShape(in_shape, op_params, rank);
+
+  // Slice shape keeping the shrunk axes
+  std::vector<int32_t> begins(rank);
+  ir::Shape slice_shape(rank);
+  for (int axis = 0; axis < rank; ++axis)
+  {
+    const int32_t stride = op_params.strides[axis];
+    if (stride == 0)
+      return false;
+    begins[axis] = shape_inference::StartForAxis(op_params, in_shape, axis);
+    int32_t end = shape_inference::StopForAxis(op_params, in_shape, axis, begins[axis]);
+    if (op_params.shrink_axis_mask & (1 << axis))
+      end = begins[axis] + 1;
+    const int32_t dim = (end - begins[axis] + stride + (stride > 0 ? -1 : 1)) / stride;
+    slice_shape.dim(axis) = std::max(dim, 0);
+  }
+
+  std::vector<uint64_t> offsets(slice_shape.num_elements());
+  std::vector<int32_t> in_coords(rank);
+  for (uint64_t i = 0; i < offsets.size(); ++i)
+  {
+    const auto coords = getCoordinates(slice_shape, i);
+    for (int axis = 0; axis < rank; ++axis)
+      in_coords[axis] = begins[axis] + coords[axis] * op_params.strides[axis];
+    offsets[i] = getOffset(in_shape, in_coords);
+  }
+  result.data = gatherElements(input, offsets);
+  return true;
+}
+
+// Concatenate inputs along the axis. Inputs of Pack are handled as if they had an extra axis
+// of size 1.
+// Bytes are copied as they are, so quantization parameters of all inputs and the output must be
+// the same.
+bool foldConcat(const std::vector<const ir::Operand *> &inputs, const ir::Operand &output,
+                int32_t axis, bool is_pack, FoldedValue &result)
+{
+  const auto &first_shape = inputs.front()->shape();
+  const auto rank = first_shape.rank() + (is_pack ? 1 : 0);
+  if (axis < 0)
+    axis += rank;
+  if (axis < 0 || axis >= rank)
+    return false;
+
+  auto get_shape = [&](const ir::Operand &operand) {
+    if (!is_pack)
+      return operand.shape();
+
+    // Pack inserts a new axis of size 1 to every input
+    ir::Shape shape(rank);
+    for (int i = 0, j = 0; i < rank; ++i)
+      shape.dim(i) = (i == axis) ? 1 : operand.shape().dim(j++);
+    return shape;
+  };
+
+  result.shape = get_shape(*inputs.front());
+  result.shape.dim(axis) = 0;
+  for (const auto input : inputs)
+  {
+    if (input->shape().rank() != first_shape.rank())
+      return false;
+    const auto shape = get_shape(*input);
+    if (shape.rank() != rank || input->typeInfo() != output.typeInfo())
+      return false;
+    for (int i = 0; i < rank; ++i)
+    {
+      if (i != axis && shape.dim(i) != result.shape.dim(i))
+        return false;
+    }
+    result.shape.dim(axis) += shape.dim(axis);
+  }
+
+  const auto elem_size = ir::sizeOfDataType(inputs.front()->typeInfo().type());
+  uint64_t outer = 1, inner = elem_size;
+  for (int i = 0; i < axis; ++i)
+    outer *= result.shape.dim(i);
+  for (int i = axis + 1; i < rank; ++i)
+    inner *= result.shape.dim(i);
+
+  result.data.resize(result.shape.num_elements() * elem_size);
+  auto out = result.data.data();
+  for (uint64_t o = 0; o < outer; ++o)
+  {
+    for (const auto input : inputs)
+    {
+      const auto chunk = inner * get_shape(*input).dim(axis);
+      std::memcpy(out, input->data()->base() + o * chunk, chunk);
+      out += chunk;
+    }
+  }
+  return true;
+}
+
+bool foldReshape(const ir::Graph &graph, const ir::Operation &op, FoldedValue &result)
+{
+  const auto &input = graph.operands().at(op.getInputs().at(0));
+  const auto num_elements = input.shape().num_elements();
+  switch (op.opcode())
+  {
+    case ir::OpCode::Reshape:
+    {
+      const auto &reshape = static_cast<const ir::operation::Reshape &>(op);
+      std::vector<int32_t> new_shape = reshape.param().new_shape;
+      if (op.getInputs().size() > ir::operation::Reshape::SHAPE &&
+          op.getInputs().at(ir::operation::Reshape::SHAPE).valid())
+      {
+        const auto &shape = graph.operands().at(op.getInputs().at(ir::operation::Reshape::SHAPE));
+        if (shape.typeInfo().type() != ir::DataType::INT32)
+          return false;
+        new_shape = shape.asVector<int32_t>();
+      }
+      result.shape = shape_inference::inferReshapeShape(new_shape.data(), new_shape.size(),
+                                                        num_elements);
+      break;
+    }
+    case ir::OpCode::Squeeze:
+      result.shape = shape_inference::inferSqueezeShape(
+          input.shape(), static_cast<const ir::operation::Squeeze &>(op).param());
+      break;
+    case ir::OpCode::ExpandDims:
+    {
+      const auto &axis = graph.operands().at(op.getInputs().at(ir::operation::ExpandDims::AXIS));
+      if (axis.typeInfo().type() != ir::DataType::INT32 || axis.shape().num_elements() != 1)
+        return false;
+      result.shape =
+          shape_inference::inferExpandDimsShape(input.shape(), axis.asVector<int32_t>()[0]);
+      break;
+    }
+    default:
+      return false;
+  }
+
+  if (result.shape.num_elements() != num_elements)
+    return false;
+  result.data = copyElements(input);
+  return true;
+}
+
+bool fold(const ir::Graph &graph, const ir::Operation &op, FoldedValue &result)
+{
+  const auto &input = graph.operands().at(op.getInputs().at(0));
+  const auto &output = graph.operands().at(op.getOutputs().at(0));
+  switch (op.opcode())
+  {
+    case ir::OpCode::Cast:
+      return foldCast(input, output, result);
+    case ir::OpCode::Shape:
+      return foldShape(input, output, result);
+    case ir::OpCode::Transpose:
+      return foldTranspose(input, static_cast<const ir::operation::Transpose &>(op).param().perm,
+                           result);
+    case ir::OpCode::StridedSlice:
+      return foldStridedSlice(graph, static_cast<const ir::operation::StridedSlice &>(op),
+                              result);
+    case ir::OpCode::Concat:
+    case ir::OpCode::Pack:
+    {
+      std::vector<const ir::Operand *> inputs;
+      for (const auto &index : op.getInputs())
+        inputs.push_back(&graph.operands().at(index));
+      const bool is_pack = op.opcode() == ir::OpCode::Pack;
+      const auto axis = is_pack ? static_cast<const ir::operation::Pack &>(op).param().axis
+                                : static_cast<const ir::operation::Concat &>(op).param().axis;
+      return foldConcat(inputs, output, axis, is_pack, result);
+    }
+    case ir::OpCode::Reshape:
+    case ir::OpCode::Squeeze:
+    case ir::OpCode::ExpandDims:
+      return foldReshape(graph, op, result);
+    default:
+      return false;
+  }
+}
+
+bool isFoldable(const ir::Graph &graph, const ir::Operation &op)
+{
+  if (op.getOutputs().size() != 1)
+    return false;
+
+  // Graph outputs must be written by the executor
+  const auto &output_index = op.getOutputs().at(0);
+  const auto &output = graph.operands().at(output_index);
+  if (graph.getOutputs().contains(output_index) || output.info().isDynamic())
+    return false;
+
+  for (const auto &index : op.getInputs() | ir::Remove::UNDEFINED)
+  {
+    const auto &input = graph.operands().at(index);
+    if (!input.isConstant() || input.info().isDynamic() || input.shape().hasUnspecifiedDims())
+      return false;
+
+    // Values of a sparse constant are compressed, and do not match its shape
+    if (input.typeInfo().sparsity() != nullptr)
+      return false;
+  }
+  return true;
+}
+
+} // namespace
+
+namespace onert
+{
+
+namespace compiler
+{
+
+ConstantFolder::ConstantFolder(ir::Graph &graph) : _graph{graph}
+{
+  // DO NOTHING
+}
+
+uint32_t ConstantFolder::run()
+{
+  uint32_t num_folded = 0;
+
+  // Outputs of folded operations may make their users foldable, so repeat until nothing changes
+  bool changed = true;
+  while (changed)
+  {
+    changed = false;
+
+    std::vector<ir::OperationIndex> indices;
+    _graph.operations().iterate([&](const ir::OperationIndex &index, const ir::Operation &op) {
+      if (isFoldable(_graph, op))
+        indices.push_back(index);
+    });
+
+    for (const auto &index : indices)
+    {
+      const auto &op = _graph.operations().at(index);
+      FoldedValue result;
+      if (!fold(_graph, op, result))
+        continue;
+
+      VERBOSE(ConstantFolder) << "Fold " << op.name() << " operation #" << index.value()
+                              << std::endl;
+
+      const auto output_index = op.getOutputs().at(0);
+      auto &output = _graph.operands().at(output_index);
+      output.info().shape(result.shape);
+      output.data(std::make_unique<ir::CachedData>(result.data.data(), result.data.size()));
+      output.removeDef(index);
+
+      const auto inputs = op.getInputs() | ir::Remove::UNDEFINED | ir::Remove::DUPLICATED;
+      _graph.operations().remove(index);
+      for (const auto &input_index : inputs)
+      {
+        auto &input = _graph.operands().at(input_index);
+        input.removeUse(index);
+        if (input.getUses().size() == 0 && !_graph.getInputs().contains(input_index) &&
+            !_graph.getOutputs().contains(input_index))
+          _graph.operands().remove(input_index);
+      }
+
+      num_folded++;
+      changed = true;
+    }
+  }
+
+  VERBOSE(ConstantFolder) << num_folded << " operation(s) folded" << std::endl;
+  return num_folded;
+}
+
+} // namespace compiler
+
+} // namespace onert
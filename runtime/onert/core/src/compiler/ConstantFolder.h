@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_COMPILER_CONSTANT_FOLDER_H__
+#define __ONERT_COMPILER_CONSTANT_FOLDER_H__
+
+#include "ir/Graph.h"
+
+namespace onert
+{
+
+namespace compiler
+{
+
+/**
+ * @brief Class to evaluate operations whose inputs are all constant at compile time
+ *
+ * Outputs of folded operations become constant operands and the operations are removed, so
+ * neither execution nor activation memory is needed for them anymore.
+ * Supported operations are Cast, Concat, ExpandDims, Pack, Reshape, Shape, Squeeze,
+ * StridedSlice and Transpose.
+ */
+class ConstantFolder
+{
+public:
+  ConstantFolder(ir::Graph &graph);
+
+public:
+  /**
+   * @brief  Fold constant operations of the graph
+   * @return The number of folded operations
+   */
+  uint32_t run();
+
+private:
+  ir::Graph &_graph;
+};
+
+} // namespace compiler
+
+} // namespace onert
+
+#endif // __ONERT_COMPILER_CONSTANT_FOLDER_H__
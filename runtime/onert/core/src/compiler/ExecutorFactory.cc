@@ -231,6 +231,17 @@ void ExecutorFactory::prepareExternalTensors(ir::LoweredGraph &lowered_graph,
       });
 }
 
+std::unique_ptr<exec::MetricsObserver>
+ExecutorFactory::createMetricsObserver(const ir::LoweredGraph &lowered_graph,
+                                       const compiler::CompilerOptions &options)
+{
+  if (options.metrics_sampling <= 0)
+    return nullptr;
+
+  auto metrics = std::make_shared<exec::Metrics>(options.metrics_sampling);
+  return std::make_unique<exec::MetricsObserver>(metrics, lowered_graph);
+}
+
 exec::IExecutor *
 ExecutorFactory::createLinearExecutor(std::unique_ptr<ir::LoweredGraph> lowered_graph,
                                       const compiler::CompilerOptions &options,
@@ -335,14 +346,23 @@ ExecutorFactory::createLinearExecutor(std::unique_ptr<ir::LoweredGraph> lowered_
     });
   }
 
+  // Create before lowered graph is moved into the executor
+  auto metrics_observer = createMetricsObserver(*lowered_graph, options);
+
   auto exec =
       new exec::LinearExecutor{std::move(lowered_graph), input_tensors,       output_tensors,
                                tensor_builders,          std::move(code_map), order};
 
+  if (metrics_observer)
+  {
+    exec->metrics(metrics_observer->metrics());
+    exec->addObserver(std::move(metrics_observer));
+  }
+
   if (!options.trace_filepath.empty())
   {
-    std::unique_ptr<exec::IExecutionObserver> ctp =
-        std::make_unique<exec::ChromeTracingObserver>(options.trace_filepath, exec->graph());
+    std::unique_ptr<exec::IExecutionObserver> ctp = std::make_unique<exec::ChromeTracingObserver>(
+        options.trace_filepath, options.trace_format, exec->graph(), backend_contexts);
     exec->addObserver(std::move(ctp));
   }
 
@@ -440,6 +460,9 @@ exec::IExecutor *ExecutorFactory::createDataflowExecutor(
     });
   }
 
+  // Create before lowered graph is moved into the executor
+  auto metrics_observer = createMetricsObserver(*lowered_graph, options);
+
   exec::ExecutorBase *exec = nullptr;
   if (parallel)
   {
@@ -466,10 +489,16 @@ exec::IExecutor *ExecutorFactory::createDataflowExecutor(
     exec = dataflow_exec;
   }
 
+  if (metrics_observer)
+  {
+    exec->metrics(metrics_observer->metrics());
+    exec->addObserver(std::move(metrics_observer));
+  }
+
   if (!options.trace_filepath.empty())
   {
-    std::unique_ptr<exec::IExecutionObserver> ctp =
-        std::make_unique<exec::ChromeTracingObserver>(options.trace_filepath, exec->graph());
+    std::unique_ptr<exec::IExecutionObserver> ctp = std::make_unique<exec::ChromeTracingObserver>(
+        options.trace_filepath, options.trace_format, exec->graph(), backend_contexts);
     exec->addObserver(std::move(ctp));
   }
 
@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Fp16WeightsConverter.h"
+
+#include "ir/operation/BatchMatMul.h"
+#include "ir/operation/Conv2D.h"
+#include "ir/operation/FullyConnected.h"
+#include "ir/operation/Gather.h"
+#include "util/logging.h"
+
+#include <Half.h>
+
+using float16 = Half;
+
+namespace
+{
+
+using namespace onert;
+
+bool isFloat32(const ir::Graph &graph, const ir::OperandIndex &index)
+{
+  return graph.operands().at(index).typeInfo().type() == ir::DataType::FLOAT32;
+}
+
+// Whether the kernel of the operation takes fp16 weights at the input index
+bool takesFp16Weights(const ir::Graph &graph, const ir::Operation &op,
+                      const ir::OperandIndex &index)
+{
+  switch (op.opcode())
+  {
+    case ir::OpCode::FullyConnected:
+    {
+      using ir::operation::FullyConnected;
+      return op.getInputs().at(FullyConnected::Input::WEIGHT) == index &&
+             op.getInputs().at(FullyConnected::Input::INPUT) != index &&
+             isFloat32(graph, op.getInputs().at(FullyConnected::Input::INPUT));
+    }
+    case ir::OpCode::Conv2D:
+    {
+      // 1x1 convolution with stride 1 runs as FullyConnected of each pixel
+      using ir::operation::Conv2D;
+      const auto &param = static_cast<const Conv2D &>(op).param();
+      const auto &ker_shape = graph.operands().at(index).shape();
+      const auto &explicit_padding = param.padding.param;
+      const bool is_1x1 = ker_shape.rank() == 4 && ker_shape.dim(1) == 1 && ker_shape.dim(2) == 1;
+      const bool is_stride_1 = param.stride.horizontal == 1 && param.stride.vertical == 1;
+      const bool no_padding = param.padding.type != ir::PaddingType::EXPLICIT ||
+                              (explicit_padding.left == 0 && explicit_padding.right == 0 &&
+                               explicit_padding.top == 0 && explicit_padding.bottom == 0);
+      return op.getInputs().at(Conv2D::Input::KERNEL) == index &&
+             op.getInputs().at(Conv2D::Input::INPUT) != index &&
+             op.getInputs().at(Conv2D::Input::BIAS) != index &&
+             isFloat32(graph, op.getInputs().at(Conv2D::Input::INPUT)) && is_1x1 && is_stride_1 &&
+             no_padding;
+    }
+    case ir::OpCode::BatchMatMul:
+    {
+      // Float rhs is transposed into a temporary area unless adj_y, where fp16 rhs is widened
+      using ir::operation::BatchMatMul;
+      const auto &bmm = static_cast<const BatchMatMul &>(op);
+      return op.getInputs().at(BatchMatMul::Input::RHS) == index &&
+             op.getInputs().at(BatchMatMul::Input::LHS) != index &&
+             isFloat32(graph, op.getInputs().at(BatchMatMul::Input::LHS)) && !bmm.param().adj_y;
+    }
+    case ir::OpCode::Gather:
+    {
+      using ir::operation::Gather;
+      return op.getInputs().at(Gather::Input::INPUT) == index &&
+             op.getInputs().at(Gather::Input::INDICES) != index &&
+             isFloat32(graph, op.getOutputs().at(0));
+    }
+    default:
+      return false;
+  }
+}
+
+} // namespace
+
+namespace onert
+{
+
+namespace compiler
+{
+
+Fp16WeightsConverter::Fp16WeightsConverter(ir::Graph &graph, const Predicate &supports_fp16_weights)
+    : _graph{graph}, _supports_fp16_weights{supports_fp16_weights}
+{
+  // DO NOTHING
+}
+
+bool Fp16WeightsConverter::isConvertible(const ir::OperandIndex &index,
+                                         const ir::Operand &operand) const
+{
+  if (!operand.isConstant() || operand.typeInfo().type() != ir::DataType::FLOAT32 ||
+      operand.typeInfo().sparsity() != nullptr || operand.getUses().size() == 0)
+    return false;
+
+  // Constant model outputs are given to users in float32
+  if (_graph.getOutputs().contains(index))
+    return false;
+
+  for (const auto &use : operand.getUses())
+  {
+    if (!takesFp16Weights(_graph, _graph.operations().at(use), index) ||
+        !_supports_fp16_weights(use))
+      return false;
+  }
+  return true;
+}
+
+uint32_t Fp16WeightsConverter::run()
+{
+  uint32_t num_converted = 0;
+  _graph.operands().iterate([&](const ir::OperandIndex &index, ir::Operand &operand) {
+    if (!isConvertible(index, operand))
+      return;
+
+    const auto num_elements = operand.shape().num_elements();
+    const auto new_size = num_elements * sizeof(float16);
+    auto new_data = std::make_unique<uint8_t[]>(new_size);
+    const auto *from = reinterpret_cast<const float *>(operand.data()->base());
+    auto *into = reinterpret_cast<float16 *>(new_data.get());
+    for (uint64_t i = 0; i < num_elements; ++i)
+      into[i] = static_cast<float16>(from[i]);
+
+    operand.releaseData();
+    operand.data(std::make_unique<ir::CachedData>(new_data.get(), new_size));
+    operand.type(ir::DataType::FLOAT16);
+    num_converted++;
+    VERBOSE(Fp16WeightsConverter) << "Constant operand #" << index.value() << ": fp16" << std::endl;
+  });
+
+  VERBOSE(Fp16WeightsConverter) << num_converted << " operand(s) converted" << std::endl;
+  return num_converted;
+}
+
+} // namespace compiler
+
+} // namespace onert
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_COMPILER_FP16_WEIGHTS_CONVERTER_H__
+#define __ONERT_COMPILER_FP16_WEIGHTS_CONVERTER_H__
+
+#include "ir/Graph.h"
+
+#include <functional>
+
+namespace onert
+{
+
+namespace compiler
+{
+
+/**
+ * @brief Class to store constant float32 weights in fp16, which kernels widen while running
+ *
+ * Weights halve in memory and in bandwidth, while computation stays in float32.
+ * A constant is converted only if it is not sparse and all of its uses are one of
+ *  - WEIGHT of FullyConnected
+ *  - KERNEL of 1x1 Conv2D with stride 1 and no padding
+ *  - RHS of BatchMatMul without adj_y
+ *  - INPUT of Gather
+ * and the given predicate accepts all the operations using it.
+ */
+class Fp16WeightsConverter
+{
+public:
+  using Predicate = std::function<bool(const ir::OperationIndex &)>;
+
+public:
+  Fp16WeightsConverter(ir::Graph &graph, const Predicate &supports_fp16_weights);
+
+public:
+  /**
+   * @brief  Convert constant weights of the graph to fp16
+   * @return The number of converted operands
+   */
+  uint32_t run();
+
+private:
+  bool isConvertible(const ir::OperandIndex &index, const ir::Operand &operand) const;
+
+private:
+  ir::Graph &_graph;
+  Predicate _supports_fp16_weights;
+};
+
+} // namespace compiler
+
+} // namespace onert
+
+#endif // __ONERT_COMPILER_FP16_WEIGHTS_CONVERTER_H__
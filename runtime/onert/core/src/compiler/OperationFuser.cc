@@ -0,0 +1,614 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "OperationFuser.h"
+
+#include "ir/operation/Add.h"
+#include "ir/operation/Conv2D.h"
+#include "ir/operation/DepthwiseConv2D.h"
+#include "ir/operation/Div.h"
+#include "ir/operation/FullyConnected.h"
+#include "ir/operation/Mul.h"
+#include "ir/operation/Pad.h"
+#include "ir/operation/Sub.h"
+#include "ir/operation/Transpose.h"
+#include "util/logging.h"
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+namespace
+{
+
+using namespace onert;
+
+//
+// Graph editing helpers
+//
+
+void removeOperation(ir::Graph &graph, const ir::OperationIndex &index)
+{
+  const auto &op = graph.operations().at(index);
+  for (const auto &input : op.getInputs() | ir::Remove::UNDEFINED | ir::Remove::DUPLICATED)
+    graph.operands().at(input).removeUse(index);
+  for (const auto &output : op.getOutputs())
+    graph.operands().at(output).removeDef(index);
+  graph.operations().remove(index);
+}
+
+ir::OperationIndex insertOperation(ir::Graph &graph, std::unique_ptr<ir::Operation> &&op)
+{
+  const auto index = graph.operations().push(std::move(op));
+  const auto &node = graph.operations().at(index);
+  for (const auto &input : node.getInputs() | ir::Remove::UNDEFINED)
+    graph.operands().at(input).insertUse(index);
+  for (const auto &output : node.getOutputs())
+    graph.operands().at(output).insertDef(index);
+  return index;
+}
+
+// Remove the operand if nothing refers to it anymore
+void removeOperandIfUnused(ir::Graph &graph, const ir::OperandIndex &index)
+{
+  if (!index.valid() || !graph.operands().exist(index))
+    return;
+
+  const auto &operand = graph.operands().at(index);
+  if (operand.getUses().size() == 0 && operand.getDef().size() == 0 &&
+      !graph.getInputs().contains(index) && !graph.getOutputs().contains(index))
+    graph.operands().remove(index);
+}
+
+// Return the only operation which uses the operand, or an undefined index if the operand has
+// other users (including the graph outputs)
+ir::OperationIndex getSingleUse(const ir::Graph &graph, const ir::OperandIndex &index)
+{
+  const auto &operand = graph.operands().at(index);
+  if (operand.getUses().size() != 1 || graph.getOutputs().contains(index))
+    return ir::OperationIndex{};
+  return *operand.getUses().begin();
+}
+
+template <typename T>
+ir::OperandIndex addConstant(ir::Graph &graph, const ir::Shape &shape, const ir::TypeInfo &type,
+                             const std::vector<T> &values)
+{
+  const auto index = graph.addOperand(shape, type);
+  graph.operands().at(index).data(std::make_unique<ir::CachedData>(
+      reinterpret_cast<const uint8_t *>(values.data()), values.size() * sizeof(T)));
+  return index;
+}
+
+// Sparse constants hold compressed values, which cannot be read or rewritten element-wise
+bool isFloatConstant(const ir::Operand &operand)
+{
+  return operand.isConstant() && operand.typeInfo().type() == ir::DataType::FLOAT32 &&
+         operand.typeInfo().sparsity() == nullptr;
+}
+
+// Read the values of a constant which is broadcast along the last axis (channels)
+bool getChannelValues(const ir::Operand &operand, uint32_t num_channels, std::vector<float> &values)
+{
+  if (!isFloatConstant(operand))
+    return false;
+
+  const auto &shape = operand.shape();
+  for (int axis = 0; axis < shape.rank() - 1; ++axis)
+  {
+    if (shape.dim(axis) != 1)
+      return false;
+  }
+
+  const auto data = operand.asVector<float>();
+  if (data.size() == num_channels)
+    values = data;
+  else if (data.size() == 1)
+    values.assign(num_channels, data[0]);
+  else
+    return false;
+  return true;
+}
+
+//
+// Operation helpers
+//
+
+bool getActivation(const ir::Operation &op, ir::Activation &activation)
+{
+  switch (op.opcode())
+  {
+    case ir::OpCode::Conv2D:
+      activation = static_cast<const ir::operation::Conv2D &>(op).param().activation;
+      return true;
+    case ir::OpCode::DepthwiseConv2D:
+      activation = static_cast<const ir::operation::DepthwiseConv2D &>(op).param().activation;
+      return true;
+    case ir::OpCode::FullyConnected:
+      activation = static_cast<const ir::operation::FullyConnected &>(op).param().activation;
+      return true;
+    case ir::OpCode::Add:
+      activation = static_cast<const ir::operation::Add &>(op).param().activation;
+      return true;
+    case ir::OpCode::Sub:
+      activation = static_cast<const ir::operation::Sub &>(op).param().activation;
+      return true;
+    case ir::OpCode::Mul:
+      activation = static_cast<const ir::operation::Mul &>(op).param().activation;
+      return true;
+    case ir::OpCode::Div:
+      activation = static_cast<const ir::operation::Div &>(op).param().activation;
+      return true;
+    default:
+      return false;
+  }
+}
+
+template <typename OpT>
+std::unique_ptr<ir::Operation> cloneWithActivation(const ir::Operation &op,
+                                                   const ir::OperandIndexSequence &inputs,
+                                                   const ir::OperandIndexSequence &outputs,
+                                                   ir::Activation activation)
+{
+  auto param = static_cast<const OpT &>(op).param();
+  param.activation = activation;
+  return std::make_unique<OpT>(inputs, outputs, param);
+}
+
+// Create a copy of the operation which has the given inputs, outputs and fused activation
+std::unique_ptr<ir::Operation> cloneWithActivation(const ir::Operation &op,
+                                                   const ir::OperandIndexSequence &inputs,
+                                                   const ir::OperandIndexSequence &outputs,
+                                                   ir::Activation activation)
+{
+  switch (op.opcode())
+  {
+    case ir::OpCode::Conv2D:
+      return cloneWithActivation<ir::operation::Conv2D>(op, inputs, outputs, activation);
+    case ir::OpCode::DepthwiseConv2D:
+      return cloneWithActivation<ir::operation::DepthwiseConv2D>(op, inputs, outputs, activation);
+    case ir::OpCode::FullyConnected:
+      return cloneWithActivation<ir::operation::FullyConnected>(op, inputs, outputs, activation);
+    case ir::OpCode::Add:
+      return cloneWithActivation<ir::operation::Add>(op, inputs, outputs, activation);
+    case ir::OpCode::Sub:
+      return cloneWithActivation<ir::operation::Sub>(op, inputs, outputs, activation);
+    case ir::OpCode::Mul:
+      return cloneWithActivation<ir::operation::Mul>(op, inputs, outputs, activation);
+    case ir::OpCode::Div:
+      return cloneWithActivation<ir::operation::Div>(op, inputs, outputs, activation);
+    default:
+      throw std::runtime_error{"OperationFuser: unsupported operation " + op.name()};
+  }
+}
+
+//
+// Fusion patterns
+//
+
+class FusionPattern
+{
+public:
+  virtual ~FusionPattern() = default;
+
+public:
+  virtual std::string name() const = 0;
+
+  /**
+   * @brief  Try to apply the pattern to a chain which starts with the given operation
+   * @return @c true if the graph has been rewritten, otherwise @c false
+   */
+  virtual bool apply(ir::Graph &graph, const ir::OperationIndex &index) = 0;
+};
+
+/**
+ * @brief Merge spatial zero padding into the explicit padding of the following convolution
+ */
+class PadConvFusion : public FusionPattern
+{
+public:
+  std::string name() const override { return "Pad+Conv"; }
+
+  bool apply(ir::Graph &graph, const ir::OperationIndex &index) override
+  {
+    const auto &pad = graph.operations().at(index);
+    if (pad.opcode() != ir::OpCode::Pad || graph.layout() != ir::Layout::NHWC)
+      return false;
+
+    // Padding with non-zero value cannot be merged
+    const auto pad_inputs = pad.getInputs();
+    if (pad_inputs.size() > ir::operation::Pad::VALUE &&
+        pad_inputs.at(ir::operation::Pad::VALUE).valid())
+      return false;
+
+    const auto input_index = pad_inputs.at(ir::operation::Pad::INPUT);
+    const auto &pads = graph.operands().at(pad_inputs.at(ir::operation::Pad::PAD));
+    const auto pad_output_index = pad.getOutputs().at(0);
+    if (graph.operands().at(input_index).typeInfo().type() != ir::DataType::FLOAT32 ||
+        !pads.isConstant() || pads.typeInfo().type() != ir::DataType::INT32 ||
+        pads.shape().num_elements() != 8)
+      return false;
+
+    // Only height and width can be padded
+    const auto pad_values = pads.asVector<int32_t>();
+    if (pad_values[0] != 0 || pad_values[1] != 0 || pad_values[6] != 0 || pad_values[7] != 0 ||
+        std::any_of(pad_values.begin(), pad_values.end(), [](int32_t v) { return v < 0; }))
+      return false;
+
+    const auto conv_index = getSingleUse(graph, pad_output_index);
+    if (!conv_index.valid())
+      return false;
+
+    const auto &conv = graph.operations().at(conv_index);
+    if (conv.getInputs().at(0) != pad_output_index)
+      return false;
+
+    const auto top = static_cast<uint32_t>(pad_values[2]);
+    const auto bottom = static_cast<uint32_t>(pad_values[3]);
+    const auto left = static_cast<uint32_t>(pad_values[4]);
+    const auto right = static_cast<uint32_t>(pad_values[5]);
+
+    auto inputs = conv.getInputs();
+    inputs.replace(pad_output_index, input_index);
+
+    std::unique_ptr<ir::Operation> fused;
+    if (conv.opcode() == ir::OpCode::Conv2D)
+    {
+      auto param = static_cast<const ir::operation::Conv2D &>(conv).param();
+      if (!mergePadding(param.padding, left, right, top, bottom))
+        return false;
+      fused = std::make_unique<ir::operation::Conv2D>(inputs, conv.getOutputs(), param);
+    }
+    else if (conv.opcode() == ir::OpCode::DepthwiseConv2D)
+    {
+      auto param = static_cast<const ir::operation::DepthwiseConv2D &>(conv).param();
+      if (!mergePadding(param.padding, left, right, top, bottom))
+        return false;
+      fused = std::make_unique<ir::operation::DepthwiseConv2D>(inputs, conv.getOutputs(), param);
+    }
+    else
+    {
+      return false;
+    }
+
+    removeOperation(graph, conv_index);
+    removeOperation(graph, index);
+    insertOperation(graph, std::move(fused));
+    removeOperandIfUnused(graph, pad_output_index);
+    removeOperandIfUnused(graph, pad_inputs.at(ir::operation::Pad::PAD));
+    return true;
+  }
+
+private:
+  static bool mergePadding(ir::Padding &padding, uint32_t left, uint32_t right, uint32_t top,
+                           uint32_t bottom)
+  {
+    if (padding.type == ir::PaddingType::VALID)
+    {
+      padding = ir::Padding{left, right, top, bottom};
+      return true;
+    }
+    if (padding.type == ir::PaddingType::EXPLICIT)
+    {
+      padding = ir::Padding{padding.param.left + left, padding.param.right + right,
+                            padding.param.top + top, padding.param.bottom + bottom};
+      return true;
+    }
+    // SAME padding depends on the input shape, which is changed by the fusion
+    return false;
+  }
+};
+
+/**
+ * @brief Fold Mul/Add with a per-channel constant into the weights and bias of the preceding
+ *        Conv2D, DepthwiseConv2D or FullyConnected
+ */
+class ConstantEpilogueFusion : public FusionPattern
+{
+public:
+  ConstantEpilogueFusion(ir::OpCode opcode) : _opcode{opcode} {}
+
+  std::string name() const override
+  {
+    return _opcode == ir::OpCode::Mul ? "Conv+Mul(scale)" : "Conv+Add(bias)";
+  }
+
+  bool apply(ir::Graph &graph, const ir::OperationIndex &index) override
+  {
+    const auto &head = graph.operations().at(index);
+    if (head.opcode() != ir::OpCode::Conv2D && head.opcode() != ir::OpCode::DepthwiseConv2D &&
+        head.opcode() != ir::OpCode::FullyConnected)
+      return false;
+
+    ir::Activation activation;
+    if (!getActivation(head, activation) || activation != ir::Activation::NONE)
+      return false;
+
+    // Weights (and bias) are at the same positions for all the supported operations
+    if (head.getInputs().size() < 2)
+      return false;
+    const auto head_output_index = head.getOutputs().at(0);
+    const auto weights_index = head.getInputs().at(ir::operation::Conv2D::KERNEL);
+    const auto bias_index = head.getInputs().size() > ir::operation::Conv2D::BIAS
+                                ? head.getInputs().at(ir::operation::Conv2D::BIAS)
+                                : ir::OperandIndex{};
+    const auto &head_output = graph.operands().at(head_output_index);
+    const auto &weights = graph.operands().at(weights_index);
+    if (head_output.typeInfo().type() != ir::DataType::FLOAT32 || !isFloatConstant(weights) ||
+        (bias_index.valid() && !isFloatConstant(graph.operands().at(bias_index))))
+      return false;
+
+    const auto tail_index = getSingleUse(graph, head_output_index);
+    if (!tail_index.valid())
+      return false;
+
+    const auto &tail = graph.operations().at(tail_index);
+    if (tail.opcode() != _opcode)
+      return false;
+
+    const auto &tail_inputs = tail.getInputs();
+    const auto tail_output_index = tail.getOutputs().at(0);
+    const auto &tail_output = graph.operands().at(tail_output_index);
+    if (tail_inputs.at(0) == tail_inputs.at(1) || !(tail_output.shape() == head_output.shape()) ||
+        !(tail_output.typeInfo() == head_output.typeInfo()))
+      return false;
+
+    const auto const_index = tail_inputs.at(0) == head_output_index ? tail_inputs.at(1)
+                                                                       : tail_inputs.at(0);
+    const auto num_channels = static_cast<uint32_t>(
+        head_output.shape().dim(head_output.shape().rank() - 1));
+    std::vector<float> channel_values;
+    if (!getChannelValues(graph.operands().at(const_index), num_channels, channel_values))
+      return false;
+
+    std::vector<float> bias_values(num_channels, 0.0f);
+    if (bias_index.valid())
+    {
+      bias_values = graph.operands().at(bias_index).asVector<float>();
+      if (bias_values.size() != num_channels)
+        return false;
+    }
+
+    auto new_weights_index = weights_index;
+    if (_opcode == ir::OpCode::Mul)
+    {
+      // Output channel is the first axis of Conv2D/FullyConnected weights and the last one of
+      // DepthwiseConv2D weights
+      auto weights_values = weights.asVector<float>();
+      const bool is_depthwise = head.opcode() == ir::OpCode::DepthwiseConv2D;
+      const size_t block_size = weights_values.size() / num_channels;
+      for (size_t i = 0; i < weights_values.size(); ++i)
+      {
+        const size_t channel = is_depthwise ? i % num_channels : i / block_size;
+        weights_values[i] *= channel_values[channel];
+      }
+      for (uint32_t c = 0; c < num_channels; ++c)
+        bias_values[c] *= channel_values[c];
+
+      new_weights_index = addConstant(graph, weights.shape(), weights.typeInfo(), weights_values);
+    }
+    else
+    {
+      for (uint32_t c = 0; c < num_channels; ++c)
+        bias_values[c] += channel_values[c];
+    }
+
+    const auto new_bias_index =
+        addConstant(graph, ir::Shape{static_cast<int32_t>(num_channels)},
+                    ir::TypeInfo{ir::DataType::FLOAT32}, bias_values);
+    const ir::OperandIndexSequence inputs{head.getInputs().at(0), new_weights_index,
+                                          new_bias_index};
+
+    ir::Activation tail_activation;
+    getActivation(tail, tail_activation);
+    auto fused = cloneWithActivation(head, inputs, tail.getOutputs(), tail_activation);
+
+    removeOperation(graph, tail_index);
+    removeOperation(graph, index);
+    insertOperation(graph, std::move(fused));
+    for (const auto &operand : {head_output_index, const_index, weights_index, bias_index})
+      removeOperandIfUnused(graph, operand);
+    return true;
+  }
+
+private:
+  ir::OpCode _opcode;
+};
+
+/**
+ * @brief Fuse standalone ReLU/ReLU1/ReLU6 into the preceding operation
+ */
+class ActivationFusion : public FusionPattern
+{
+public:
+  std::string name() const override { return "Op+Activation"; }
+
+  bool apply(ir::Graph &graph, const ir::OperationIndex &index) override
+  {
+    const auto &head = graph.operations().at(index);
+    ir::Activation activation;
+    if (!getActivation(head, activation) || activation != ir::Activation::NONE)
+      return false;
+
+    const auto head_output_index = head.getOutputs().at(0);
+    const auto tail_index = getSingleUse(graph, head_output_index);
+    if (!tail_index.valid())
+      return false;
+
+    const auto &tail = graph.operations().at(tail_index);
+    switch (tail.opcode())
+    {
+      case ir::OpCode::ReLU:
+        activation = ir::Activation::RELU;
+        break;
+      case ir::OpCode::ReLU1:
+        activation = ir::Activation::RELU1;
+        break;
+      case ir::OpCode::ReLU6:
+        activation = ir::Activation::RELU6;
+        break;
+      default:
+        return false;
+    }
+
+    // Quantization parameters of the output must be kept as they are
+    const auto &head_output = graph.operands().at(head_output_index);
+    const auto &tail_output = graph.operands().at(tail.getOutputs().at(0));
+    if (!(head_output.shape() == tail_output.shape()) ||
+        !(head_output.typeInfo() == tail_output.typeInfo()))
+      return false;
+
+    auto fused = cloneWithActivation(head, head.getInputs(), tail.getOutputs(), activation);
+
+    removeOperation(graph, tail_index);
+    removeOperation(graph, index);
+    insertOperation(graph, std::move(fused));
+    removeOperandIfUnused(graph, head_output_index);
+    return true;
+  }
+};
+
+/**
+ * @brief Compose two consecutive Transpose operations into one, or remove both of them if
+ *        the composition is identity
+ */
+class TransposeFusion : public FusionPattern
+{
+public:
+  std::string name() const override { return "Transpose+Transpose"; }
+
+  bool apply(ir::Graph &graph, const ir::OperationIndex &index) override
+  {
+    const auto &head = graph.operations().at(index);
+    if (head.opcode() != ir::OpCode::Transpose)
+      return false;
+
+    const auto head_output_index = head.getOutputs().at(0);
+    const auto tail_index = getSingleUse(graph, head_output_index);
+    if (!tail_index.valid())
+      return false;
+
+    const auto &tail = graph.operations().at(tail_index);
+    if (tail.opcode() != ir::OpCode::Transpose)
+      return false;
+
+    const auto &head_perm = static_cast<const ir::operation::Transpose &>(head).param().perm;
+    const auto &tail_perm = static_cast<const ir::operation::Transpose &>(tail).param().perm;
+    if (head_perm.empty() || head_perm.size() != tail_perm.size())
+      return false;
+
+    // output[i] = tail_input[tail_perm[i]] = head_input[head_perm[tail_perm[i]]]
+    ir::operation::Transpose::Param param;
+    bool is_identity = true;
+    for (size_t i = 0; i < tail_perm.size(); ++i)
+    {
+      param.perm.push_back(head_perm.at(tail_perm[i]));
+      is_identity &= (param.perm.back() == static_cast<int>(i));
+    }
+
+    const auto input_index = head.getInputs().at(0);
+    const auto output_index = tail.getOutputs().at(0);
+    removeOperation(graph, tail_index);
+    removeOperation(graph, index);
+    removeOperandIfUnused(graph, head_output_index);
+
+    if (is_identity && !graph.getOutputs().contains(output_index))
+    {
+      // Make users of the output read the input directly
+      const auto uses = graph.operands().at(output_index).getUses();
+      for (const auto &use : uses)
+      {
+        graph.operations().at(use).replaceInputs(output_index, input_index);
+        graph.operands().at(output_index).removeUse(use);
+        graph.operands().at(input_index).insertUse(use);
+      }
+      removeOperandIfUnused(graph, output_index);
+    }
+    else
+    {
+      insertOperation(graph,
+                      std::make_unique<ir::operation::Transpose>(
+                          ir::OperandIndexSequence{input_index},
+                          ir::OperandIndexSequence{output_index}, param));
+    }
+    return true;
+  }
+};
+
+} // namespace
+
+namespace onert
+{
+
+namespace compiler
+{
+
+OperationFuser::OperationFuser(ir::Graph &graph) : _graph{graph}
+{
+  // DO NOTHING
+}
+
+void OperationFuser::run()
+{
+  std::vector<std::unique_ptr<FusionPattern>> patterns;
+  patterns.emplace_back(std::make_unique<PadConvFusion>());
+  patterns.emplace_back(std::make_unique<ConstantEpilogueFusion>(ir::OpCode::Mul));
+  patterns.emplace_back(std::make_unique<ConstantEpilogueFusion>(ir::OpCode::Add));
+  patterns.emplace_back(std::make_unique<ActivationFusion>());
+  patterns.emplace_back(std::make_unique<TransposeFusion>());
+
+  bool changed = true;
+  while (changed)
+  {
+    changed = false;
+
+    std::vector<ir::OperationIndex> indices;
+    _graph.operations().iterate(
+        [&](const ir::OperationIndex &index, const ir::Operation &) { indices.push_back(index); });
+    std::sort(indices.begin(), indices.end(),
+              [](const ir::OperationIndex &lhs, const ir::OperationIndex &rhs) {
+                return lhs.value() < rhs.value();
+              });
+
+    for (const auto &index : indices)
+    {
+      // The operation may have been removed by a previous fusion
+      if (!_graph.operations().exist(index))
+        continue;
+
+      for (const auto &pattern : patterns)
+      {
+        if (pattern->apply(_graph, index))
+        {
+          VERBOSE(OperationFuser) << pattern->name() << " fused at operation #" << index.value()
+                                  << std::endl;
+          _report[pattern->name()]++;
+          changed = true;
+          break;
+        }
+      }
+    }
+  }
+
+  for (const auto &entry : _report)
+  {
+    VERBOSE(OperationFuser) << entry.first << " : " << entry.second << std::endl;
+  }
+}
+
+} // namespace compiler
+
+} // namespace onert
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_COMPILER_OPERATION_FUSER_H__
+#define __ONERT_COMPILER_OPERATION_FUSER_H__
+
+#include "ir/Graph.h"
+
+#include <map>
+#include <string>
+
+namespace onert
+{
+
+namespace compiler
+{
+
+/**
+ * @brief Class to rewrite chains of operations into one operation before lowering
+ *
+ * Patterns are tried on every operation until none of them can be applied anymore.
+ * Supported patterns are
+ *  - Pad(constant spatial padding) + Conv2D/DepthwiseConv2D => explicit padding of convolution
+ *  - Conv2D/DepthwiseConv2D/FullyConnected + Mul(constant)  => scaled weights and bias
+ *  - Conv2D/DepthwiseConv2D/FullyConnected + Add(constant)  => shifted bias
+ *  - Conv2D/DepthwiseConv2D/FullyConnected/Add/Sub/Mul/Div + ReLU/ReLU1/ReLU6
+ *                                                           => fused activation
+ *  - Transpose + Transpose                                  => one Transpose (or nothing)
+ */
+class OperationFuser
+{
+public:
+  OperationFuser(ir::Graph &graph);
+
+public:
+  void run();
+
+  /**
+   * @brief  Return the number of applied fusions for each pattern
+   */
+  const std::map<std::string, uint32_t> &report() const { return _report; }
+
+private:
+  ir::Graph &_graph;
+  std::map<std::string, uint32_t> _report;
+};
+
+} // namespace compiler
+
+} // namespace onert
+
+#endif // __ONERT_COMPILER_OPERATION_FUSER_H__
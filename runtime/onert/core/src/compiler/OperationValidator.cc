@@ -56,6 +56,28 @@ void OperationValidator::checkUnaryOp(const ir::Operation &node)
   OP_REQUIRES(_ctx.at(output_index).shape() == _ctx.at(input_index).shape());
 }
 
+void OperationValidator::checkSparseOperands()
+{
+  // Sparse operands are supported only as float weights of FullyConnected and Conv2D
+  _ctx.iterate([&](const ir::OperandIndex &ind, const ir::Operand &operand) {
+    if (operand.typeInfo().sparsity() == nullptr)
+      return;
+
+    OP_REQUIRES(operand.isConstant());
+    OP_REQUIRES(operand.typeInfo().type() == ir::DataType::FLOAT32);
+    for (const auto &use : operand.getUses())
+    {
+      const auto &op = _graph.operations().at(use);
+      if (op.opcode() == ir::OpCode::FullyConnected)
+        OP_REQUIRES(op.getInputs().at(ir::operation::FullyConnected::Input::WEIGHT) == ind);
+      else if (op.opcode() == ir::OpCode::Conv2D)
+        OP_REQUIRES(op.getInputs().at(ir::operation::Conv2D::Input::KERNEL) == ind);
+      else
+        OP_REQUIRES(false);
+    }
+  });
+}
+
 void OperationValidator::operator()()
 {
   // There is no reason for each subgraph to have subgraphs since compiler has subgraphs when
@@ -66,6 +88,8 @@ void OperationValidator::operator()()
 
   _graph.operations().iterate(
       [&](const ir::OperationIndex &, const ir::Operation &node) { node.accept(*this); });
+
+  checkSparseOperands();
 }
 
 void OperationValidator::visit(const ir::operation::Abs &node) { checkUnaryOp(node); }
@@ -87,8 +111,8 @@ void OperationValidator::visit(const ir::operation::BatchMatMul &node)
   const auto rhs_index(node.getInputs().at(ir::operation::BatchMatMul::Input::RHS));
   const auto out_index{node.getOutputs().at(0)};
 
-  // Constant lhs and rhs is not implemented yet
-  OP_REQUIRES(!_ctx.at(lhs_index).isConstant() && !_ctx.at(rhs_index).isConstant());
+  // Constant lhs is not implemented yet, while constant rhs is taken as weights
+  OP_REQUIRES(!_ctx.at(lhs_index).isConstant());
 
   if (_ctx.at(out_index).info().isDynamic())
     return;
@@ -99,6 +99,7 @@ public:
 
 private:
   void checkUnaryOp(const ir::Operation &node);
+  void checkSparseOperands();
 
 private:
   // TODO Remove _ctx field
@@ -16,8 +16,91 @@
 
 #include "exec/Execution.h"
 
+#include "ThreadPool.h"
+#include "util/ConfigSource.h"
 #include "util/logging.h"
 
+#include <algorithm>
+#include <thread>
+
+namespace
+{
+
+using namespace onert;
+
+class Job : public exec::IFunction
+{
+public:
+  Job(const std::function<void()> &fn) : _fn{fn} {}
+  void run() override { _fn(); }
+
+private:
+  std::function<void()> _fn;
+};
+
+// Shared by all the executions in the process, so that no thread is created per request
+exec::ThreadPool &asyncPool()
+{
+  static exec::ThreadPool pool{[]() {
+    const auto num_threads = util::getConfigInt(util::config::ASYNC_THREADS);
+    if (num_threads > 0)
+      return static_cast<uint32_t>(num_threads);
+    return std::max(1u, std::thread::hardware_concurrency());
+  }()};
+  return pool;
+}
+
+exec::IODescription copyIODescription(const exec::IODescription &src)
+{
+  exec::IODescription dst;
+  for (const auto &input : src.inputs)
+  {
+    if (input)
+      dst.inputs.emplace_back(std::make_unique<exec::InputDesc>(input->info, input->buffer,
+                                                                input->size, input->layout));
+    else
+      dst.inputs.emplace_back(nullptr);
+  }
+  for (const auto &output : src.outputs)
+  {
+    if (output)
+      dst.outputs.emplace_back(std::make_unique<exec::OutputDesc>(output->info, output->buffer,
+                                                                  output->size, output->layout));
+    else
+      dst.outputs.emplace_back(nullptr);
+  }
+  dst.input_shape_signature = src.input_shape_signature;
+  return dst;
+}
+
+// Marks the thread running a completion of an execution, so that the completion can wait for or
+// destroy the execution without waiting for itself
+struct CompletionScope
+{
+  CompletionScope(const exec::Execution *e) : execution{e}, prev{current} { current = this; }
+  ~CompletionScope() { current = prev; }
+
+  static CompletionScope *find(const exec::Execution *e)
+  {
+    for (auto scope = current; scope != nullptr; scope = scope->prev)
+    {
+      if (scope->execution == e)
+        return scope;
+    }
+    return nullptr;
+  }
+
+  const exec::Execution *execution;
+  bool destroyed = false;
+  CompletionScope *prev;
+
+  static thread_local CompletionScope *current;
+};
+
+thread_local CompletionScope *CompletionScope::current = nullptr;
+
+} // namespace
+
 namespace onert
 {
 namespace exec
@@ -32,6 +115,32 @@ Execution::Execution(const std::shared_ptr<ExecutorMap> &executors) : _executors
   _io_desc.outputs.resize(primary_subg.getOutputs().size());
 }
 
+Execution::~Execution()
+{
+  std::deque<std::unique_ptr<Request>> cancelled;
+  {
+    std::unique_lock<std::mutex> lock{_async_mutex};
+    cancelled.swap(_requests);
+  }
+
+  for (auto &request : cancelled)
+  {
+    if (request->completion)
+      request->completion(request->id, RequestResult::CANCELLED);
+  }
+
+  // Destroyed by a completion, which is the last use of this by the running request
+  if (auto scope = CompletionScope::find(this))
+  {
+    scope->destroyed = true;
+    return;
+  }
+
+  // A running request refers to this
+  std::unique_lock<std::mutex> lock{_async_mutex};
+  _async_cv.wait(lock, [this] { return !_async_active; });
+}
+
 void Execution::changeInputShape(const ir::IOIndex &index, const ir::Shape &new_shape)
 {
   // This should be called BEFORE setInput.
@@ -137,17 +246,161 @@ void Execution::execute()
 
 void Execution::startExecute()
 {
-  VERBOSE(Execution) << "Create asynchronous execution thread" << std::endl;
+  VERBOSE(Execution) << "Queue asynchronous execution" << std::endl;
 
-  _exec_thread = std::make_unique<std::thread>(&Execution::execute, this);
+  enqueue(nullptr, true);
 }
 
 void Execution::waitFinish()
 {
   VERBOSE(Execution) << "Wait to finish execution" << std::endl;
 
-  _exec_thread->join();
-  finished = true;
+  std::exception_ptr error;
+  std::vector<ir::Shape> output_shapes;
+  {
+    std::unique_lock<std::mutex> lock{_async_mutex};
+    if (CompletionScope::find(this))
+    {
+      // The running request is the caller, so only queued ones could be waited for
+      if (!_requests.empty())
+        throw std::runtime_error("Cannot wait for queued requests in a completion");
+    }
+    else
+    {
+      _async_cv.wait(lock, [this] { return !_async_active; });
+    }
+    std::swap(error, _async_error);
+    std::swap(output_shapes, _async_output_shapes);
+  }
+
+  if (error)
+    std::rethrow_exception(error);
+
+  // The request ran on a copy of _io_desc, so shapes of dynamic outputs are copied back
+  for (uint32_t i = 0; i < output_shapes.size() && i < _io_desc.outputs.size(); ++i)
+  {
+    if (_io_desc.outputs[i])
+      _io_desc.outputs[i]->info.shape(output_shapes[i]);
+  }
+}
+
+uint64_t Execution::submit(const Completion &completion) { return enqueue(completion, false); }
+
+bool Execution::cancel(uint64_t id)
+{
+  std::unique_ptr<Request> request;
+  {
+    std::unique_lock<std::mutex> lock{_async_mutex};
+    auto it = std::find_if(_requests.begin(), _requests.end(),
+                           [id](const std::unique_ptr<Request> &r) { return r->id == id; });
+    if (it == _requests.end())
+      return false;
+    request = std::move(*it);
+    _requests.erase(it);
+  }
+
+  VERBOSE(Execution) << "Request " << id << " is cancelled" << std::endl;
+
+  if (request->completion)
+    request->completion(request->id, RequestResult::CANCELLED);
+  return true;
+}
+
+bool Execution::hasAsyncRequests()
+{
+  std::unique_lock<std::mutex> lock{_async_mutex};
+  // The request calling its completion is already done
+  if (CompletionScope::find(this))
+    return !_requests.empty();
+  return _async_active;
+}
+
+uint64_t Execution::enqueue(const Completion &completion, bool keep_error)
+{
+  // Buffers are copied, so that they can be set again for the next request
+  auto request = std::make_unique<Request>();
+  request->io_desc = copyIODescription(_io_desc);
+  request->completion = completion;
+  request->keep_error = keep_error;
+  finished = false;
+
+  std::unique_lock<std::mutex> lock{_async_mutex};
+  request->id = ++_last_request_id;
+  const auto id = request->id;
+  _requests.emplace_back(std::move(request));
+
+  // Requests of an execution must run one at a time, so at most one job is on the pool
+  if (!_async_active)
+  {
+    _async_active = true;
+    asyncPool().enqueue(std::make_unique<Job>([this] { runNextRequest(); }));
+  }
+  return id;
+}
+
+void Execution::runNextRequest()
+{
+  std::unique_ptr<Request> request;
+  {
+    std::unique_lock<std::mutex> lock{_async_mutex};
+    // All may have been cancelled after the job is queued
+    if (_requests.empty())
+    {
+      _async_active = false;
+      _async_cv.notify_all();
+      return;
+    }
+    request = std::move(_requests.front());
+    _requests.pop_front();
+  }
+
+  auto result = RequestResult::DONE;
+  try
+  {
+    primary_executor()->execute(request->io_desc);
+    if (request->keep_error)
+    {
+      std::vector<ir::Shape> output_shapes;
+      for (const auto &output : request->io_desc.outputs)
+        output_shapes.emplace_back(output ? output->info.shape() : ir::Shape{});
+
+      std::unique_lock<std::mutex> lock{_async_mutex};
+      _async_output_shapes = std::move(output_shapes);
+    }
+    finished = true;
+  }
+  catch (const std::exception &e)
+  {
+    VERBOSE(Execution) << "Request " << request->id << " failed : " << e.what() << std::endl;
+    result = RequestResult::FAILED;
+    if (request->keep_error)
+    {
+      std::unique_lock<std::mutex> lock{_async_mutex};
+      _async_error = std::current_exception();
+      _async_output_shapes.clear();
+    }
+  }
+
+  if (request->completion)
+  {
+    CompletionScope scope{this};
+    request->completion(request->id, result);
+    if (scope.destroyed)
+      return;
+  }
+
+  std::unique_lock<std::mutex> lock{_async_mutex};
+  if (_requests.empty())
+  {
+    // Notify with the lock held, as this may be destroyed as soon as the lock is released
+    _async_active = false;
+    _async_cv.notify_all();
+  }
+  else
+  {
+    // Take turns with other executions instead of running all the queued requests at once
+    asyncPool().enqueue(std::make_unique<Job>([this] { runNextRequest(); }));
+  }
 }
 
 bool Execution::isFinished(void) const { return finished; }
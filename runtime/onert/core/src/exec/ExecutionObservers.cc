@@ -22,6 +22,27 @@
 #include "exec/IExecutor.h"
 #include "misc/polymorphic_downcast.h"
 #include "ir/OpSequence.h"
+#include "backend/ITensorBuilder.h"
+#include "backend/controlflow/Config.h"
+
+#include <sys/resource.h>
+
+namespace
+{
+
+// NOTE Only tensors with host-accessible buffer are counted
+uint64_t tensorMemory(const onert::ir::Graph &graph, onert::backend::ITensorRegistry &tensor_reg)
+{
+  uint64_t bytes = 0;
+  graph.operands().iterate([&](const onert::ir::OperandIndex &ind, const onert::ir::Operand &) {
+    auto tensor = tensor_reg.getNativeITensor(ind);
+    if (tensor && tensor->buffer() != nullptr)
+      bytes += tensor->total_size();
+  });
+  return bytes;
+}
+
+} // namespace
 
 namespace onert
 {
@@ -69,9 +90,21 @@ void ProfileObserver::handleEnd(IExecutor *exec, const ir::OpSequence *op_seq,
   }
 };
 
-ChromeTracingObserver::ChromeTracingObserver(const std::string &filepath, const ir::Graph &graph)
+ChromeTracingObserver::ChromeTracingObserver(const std::string &filepath,
+                                             const std::string &format, const ir::Graph &graph,
+                                             const backend::BackendContexts &backend_contexts)
     : _ofs{filepath, std::ofstream::out}, _recorder{}, _collector{&_recorder}, _graph{graph}
 {
+  _recorder.setWriteFormat(EventRecorder::toWriteFormat(format));
+
+  for (const auto &e : backend_contexts)
+  {
+    const auto backend_id = e.first->config()->id();
+    // Tensors of controlflow backend hold user buffers
+    if (backend_id == backend::controlflow::Config::ID)
+      continue;
+    _tensor_regs.emplace_back(backend_id, e.second->tensor_builder->tensorRegistry());
+  }
 }
 
 ChromeTracingObserver::~ChromeTracingObserver()
@@ -88,7 +121,8 @@ ChromeTracingObserver::~ChromeTracingObserver()
 
 void ChromeTracingObserver::handleBegin(IExecutor *)
 {
-  _collector.onEvent(EventCollector::Event{EventCollector::Edge::BEGIN, "runtime", "Graph"});
+  traceTensorMemory();
+  _collector.onEvent(EventCollector::Event{EventCollector::Edge::BEGIN, "runtime", "Graph", {}});
 }
 
 void ChromeTracingObserver::handleBegin(IExecutor *, const ir::OpSequence *op_seq,
@@ -96,7 +130,8 @@ void ChromeTracingObserver::handleBegin(IExecutor *, const ir::OpSequence *op_se
 {
   std::string backend_id = backend->config()->id();
   _collector.onEvent(EventCollector::Event{EventCollector::Edge::BEGIN, backend_id,
-                                           opSequenceTag(op_seq, _graph.operations())});
+                                           opSequenceTag(op_seq, _graph.operations()),
+                                           opSequenceArgs(op_seq)});
 }
 
 void ChromeTracingObserver::handleEnd(IExecutor *, const ir::OpSequence *op_seq,
@@ -104,12 +139,13 @@ void ChromeTracingObserver::handleEnd(IExecutor *, const ir::OpSequence *op_seq,
 {
   std::string backend_id = backend->config()->id();
   _collector.onEvent(EventCollector::Event{EventCollector::Edge::END, backend_id,
-                                           opSequenceTag(op_seq, _graph.operations())});
+                                           opSequenceTag(op_seq, _graph.operations()), {}});
 }
 
 void ChromeTracingObserver::handleEnd(IExecutor *)
 {
-  _collector.onEvent(EventCollector::Event{EventCollector::Edge::END, "runtime", "Graph"});
+  _collector.onEvent(EventCollector::Event{EventCollector::Edge::END, "runtime", "Graph", {}});
+  traceTensorMemory();
 }
 
 std::string ChromeTracingObserver::opSequenceTag(const ir::OpSequence *op_seq,
@@ -129,6 +165,124 @@ std::string ChromeTracingObserver::opSequenceTag(const ir::OpSequence *op_seq,
   return tag;
 }
 
+std::map<std::string, std::string>
+ChromeTracingObserver::opSequenceArgs(const ir::OpSequence *op_seq)
+{
+  // ParallelExecutor notifies from its worker threads
+  std::lock_guard<std::mutex> lock{_op_seq_args_mutex};
+
+  auto it = _op_seq_args.find(op_seq);
+  if (it != _op_seq_args.end())
+    return it->second;
+
+  std::string shapes;
+  size_t bytes = 0;
+  for (const auto &ind : op_seq->getInputs() | ir::Remove::UNDEFINED)
+  {
+    const auto &info = _graph.operands().at(ind).info();
+    if (!shapes.empty())
+      shapes += ", ";
+    for (int32_t i = 0; i < info.shape().rank(); ++i)
+      shapes += (i == 0 ? "" : "x") + std::to_string(info.shape().dim(i));
+    bytes += info.total_size();
+  }
+  for (const auto &ind : op_seq->getOutputs() | ir::Remove::UNDEFINED)
+  {
+    bytes += _graph.operands().at(ind).info().total_size();
+  }
+
+  std::map<std::string, std::string> args;
+  args["input_shapes"] = shapes;
+  args["bytes"] = std::to_string(bytes);
+  args["operations"] = std::to_string(op_seq->size());
+
+  return _op_seq_args.emplace(op_seq, std::move(args)).first->second;
+}
+
+void ChromeTracingObserver::traceTensorMemory()
+{
+  for (const auto &e : _tensor_regs)
+  {
+    _collector.onCounter(e.first + " tensor memory", tensorMemory(_graph, *e.second));
+  }
+}
+
+MetricsObserver::MetricsObserver(std::shared_ptr<Metrics> metrics,
+                                 const ir::LoweredGraph &lowered_graph)
+    : _metrics{std::move(metrics)}, _graph{lowered_graph.graph()}, _sampled{false}
+{
+  lowered_graph.op_seqs().iterate([&](const ir::OpSequenceIndex &index,
+                                      const ir::OpSequence &op_seq) {
+    const auto backend = lowered_graph.getLowerInfo(index)->backend();
+    const auto name = ChromeTracingObserver::opSequenceTag(&op_seq, _graph.operations());
+    _op_seqs[&op_seq].id = _metrics->addOperation(name, backend->config()->id());
+  });
+
+  for (const auto &e : lowered_graph.backend_contexts())
+  {
+    const auto backend_id = e.first->config()->id();
+    // Tensors of controlflow backend hold user buffers
+    if (backend_id == backend::controlflow::Config::ID)
+      continue;
+    _tensor_regs.emplace_back(_metrics->addMemory(backend_id + " tensor memory"),
+                              e.second->tensor_builder->tensorRegistry());
+  }
+
+  _maxrss_id = _metrics->addMemory("maxrss");
+}
+
+void MetricsObserver::handleBegin(IExecutor *)
+{
+  _sampled = _metrics->beginRun();
+  if (_sampled)
+    _begin = std::chrono::steady_clock::now();
+}
+
+void MetricsObserver::handleBegin(IExecutor *, const ir::OpSequence *op_seq,
+                                  const backend::Backend *)
+{
+  if (!_sampled)
+    return;
+
+  auto it = _op_seqs.find(op_seq);
+  if (it != _op_seqs.end())
+    it->second.begin = std::chrono::steady_clock::now();
+}
+
+void MetricsObserver::handleEnd(IExecutor *, const ir::OpSequence *op_seq,
+                                const backend::Backend *)
+{
+  if (!_sampled)
+    return;
+
+  auto it = _op_seqs.find(op_seq);
+  if (it == _op_seqs.end())
+    return;
+
+  const auto elapsed = std::chrono::steady_clock::now() - it->second.begin;
+  _metrics->recordOperation(
+      it->second.id, std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count());
+}
+
+void MetricsObserver::handleEnd(IExecutor *)
+{
+  if (!_sampled)
+    return;
+
+  const auto elapsed = std::chrono::steady_clock::now() - _begin;
+  _metrics->recordLatency(std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count());
+
+  // NOTE Dynamic tensors released before the end of the run are not counted
+  for (const auto &e : _tensor_regs)
+  {
+    _metrics->recordMemory(e.first, tensorMemory(_graph, *e.second));
+  }
+
+  struct rusage ru;
+  if (getrusage(RUSAGE_SELF, &ru) == 0)
+    _metrics->recordMemory(_maxrss_id, static_cast<uint64_t>(ru.ru_maxrss) * 1024);
+}
+
 } // namespace exec
 
 } // namespace onert
@@ -22,9 +22,20 @@
 #include "ExecTime.h"
 #include "util/ITimer.h"
 #include "exec/IExecutor.h"
+#include "backend/BackendContext.h"
+#include "backend/ITensorRegistry.h"
+#include "exec/Metrics.h"
+#include "ir/LoweredGraph.h"
 #include "util/EventCollector.h"
 #include "util/EventRecorder.h"
 
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
 namespace onert
 {
 namespace exec
@@ -65,21 +76,68 @@ private:
 class ChromeTracingObserver : public IExecutionObserver
 {
 public:
-  ChromeTracingObserver(const std::string &filepath, const ir::Graph &graph);
+  /**
+   * @param filepath File path to save trace records
+   * @param format   Format of trace records, "snpe" or "chrome"
+   * @param graph    Graph to be executed
+   * @param backend_contexts Backend contexts whose tensor memory is traced
+   */
+  ChromeTracingObserver(const std::string &filepath, const std::string &format,
+                        const ir::Graph &graph, const backend::BackendContexts &backend_contexts);
   ~ChromeTracingObserver();
   void handleBegin(IExecutor *) override;
   void handleBegin(IExecutor *, const ir::OpSequence *, const backend::Backend *) override;
   void handleEnd(IExecutor *, const ir::OpSequence *, const backend::Backend *) override;
   void handleEnd(IExecutor *) override;
 
-private:
   static std::string opSequenceTag(const ir::OpSequence *op_seq, const ir::Operations &operations);
 
+private:
+  std::map<std::string, std::string> opSequenceArgs(const ir::OpSequence *op_seq);
+  void traceTensorMemory();
+
 private:
   std::ofstream _ofs;
   EventRecorder _recorder;
   EventCollector _collector;
   const ir::Graph &_graph;
+  std::vector<std::pair<std::string, std::shared_ptr<backend::ITensorRegistry>>> _tensor_regs;
+  std::mutex _op_seq_args_mutex;
+  std::unordered_map<const ir::OpSequence *, std::map<std::string, std::string>> _op_seq_args;
+};
+
+/**
+ * @brief Observer recording latency, per-operation time and memory peaks to Metrics
+ *
+ * Only every N-th run is timed, so that the overhead of other runs is just a check of a flag.
+ */
+class MetricsObserver : public IExecutionObserver
+{
+public:
+  MetricsObserver(std::shared_ptr<Metrics> metrics, const ir::LoweredGraph &lowered_graph);
+  void handleBegin(IExecutor *) override;
+  void handleBegin(IExecutor *, const ir::OpSequence *, const backend::Backend *) override;
+  void handleEnd(IExecutor *, const ir::OpSequence *, const backend::Backend *) override;
+  void handleEnd(IExecutor *) override;
+
+  const std::shared_ptr<Metrics> &metrics() const { return _metrics; }
+
+private:
+  struct OpSeqRecord
+  {
+    uint32_t id;
+    // NOTE Begin and end of an op sequence are notified on the same thread
+    std::chrono::steady_clock::time_point begin;
+  };
+
+private:
+  std::shared_ptr<Metrics> _metrics;
+  const ir::Graph &_graph;
+  std::atomic<bool> _sampled;
+  std::chrono::steady_clock::time_point _begin;
+  std::unordered_map<const ir::OpSequence *, OpSeqRecord> _op_seqs;
+  std::vector<std::pair<uint32_t, std::shared_ptr<backend::ITensorRegistry>>> _tensor_regs;
+  uint32_t _maxrss_id;
 };
 
 } // namespace exec
@@ -82,6 +82,9 @@ public:
 
   void addObserver(std::unique_ptr<IExecutionObserver> ref) { _subject.add(std::move(ref)); };
 
+  std::shared_ptr<const Metrics> metrics() const final { return _metrics; }
+  void metrics(std::shared_ptr<const Metrics> metrics) { _metrics = std::move(metrics); }
+
   const std::vector<std::shared_ptr<backend::ITensor>> &getInputTensors() const
   {
     return _input_tensors;
@@ -102,6 +105,7 @@ protected:
 
 protected:
   ExecutionObservee _subject;
+  std::shared_ptr<const Metrics> _metrics;
   std::shared_ptr<ir::OperationIndexMap<int64_t>> _indexed_ranks;
   std::unique_ptr<ir::LoweredGraph> _lowered_graph;
   const ir::Graph &_graph;
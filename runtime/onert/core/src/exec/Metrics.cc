@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "exec/Metrics.h"
+
+#include <json/json.h>
+
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+#include <vector>
+
+namespace
+{
+
+void updateMax(std::atomic<uint64_t> &target, uint64_t value)
+{
+  auto current = target.load(std::memory_order_relaxed);
+  while (current < value &&
+         !target.compare_exchange_weak(current, value, std::memory_order_relaxed))
+  {
+    // Retry with the value updated by other thread
+  }
+}
+
+} // namespace
+
+namespace onert
+{
+namespace exec
+{
+
+constexpr uint32_t LatencyHistogram::kSubBucketBits;
+constexpr uint32_t LatencyHistogram::kSubBuckets;
+constexpr uint32_t LatencyHistogram::kNumBuckets;
+
+LatencyHistogram::LatencyHistogram() : _count{0}, _sum{0}, _max{0}
+{
+  for (auto &bucket : _buckets)
+    bucket.store(0, std::memory_order_relaxed);
+}
+
+uint32_t LatencyHistogram::bucketOf(uint64_t value)
+{
+  if (value < kSubBuckets)
+    return static_cast<uint32_t>(value);
+
+  uint32_t msb = 0;
+  for (auto v = value >> 1; v != 0; v >>= 1)
+    ++msb;
+
+  const auto sub = (value >> (msb - kSubBucketBits)) & (kSubBuckets - 1);
+  return kSubBuckets * (msb - kSubBucketBits + 1) + static_cast<uint32_t>(sub);
+}
+
+uint64_t LatencyHistogram::lowerBoundOf(uint32_t bucket)
+{
+  if (bucket < kSubBuckets)
+    return bucket;
+
+  const uint32_t msb = bucket / kSubBuckets + kSubBucketBits - 1;
+  const uint64_t sub = bucket % kSubBuckets;
+  return (kSubBuckets + sub) << (msb - kSubBucketBits);
+}
+
+void LatencyHistogram::record(uint64_t value)
+{
+  _buckets[bucketOf(value)].fetch_add(1, std::memory_order_relaxed);
+  _count.fetch_add(1, std::memory_order_relaxed);
+  _sum.fetch_add(value, std::memory_order_relaxed);
+  updateMax(_max, value);
+}
+
+uint64_t LatencyHistogram::percentile(double p) const
+{
+  // Take a snapshot, as buckets may be updated meanwhile
+  std::vector<uint64_t> counts(kNumBuckets);
+  uint64_t total = 0;
+  for (uint32_t b = 0; b < kNumBuckets; ++b)
+  {
+    counts[b] = _buckets[b].load(std::memory_order_relaxed);
+    total += counts[b];
+  }
+
+  if (total == 0)
+    return 0;
+
+  const auto rank = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(p / 100.0 * total)));
+  uint64_t accumulated = 0;
+  for (uint32_t b = 0; b < kNumBuckets; ++b)
+  {
+    accumulated += counts[b];
+    if (accumulated >= rank)
+      return lowerBoundOf(b);
+  }
+  return max();
+}
+
+Metrics::Metrics(uint32_t sampling_period)
+    : _sampling_period{std::max<uint32_t>(1, sampling_period)}, _runs{0}
+{
+}
+
+uint32_t Metrics::addOperation(const std::string &name, const std::string &backend)
+{
+  _operations.emplace_back(name, backend);
+  return static_cast<uint32_t>(_operations.size() - 1);
+}
+
+uint32_t Metrics::addMemory(const std::string &name)
+{
+  _memories.emplace_back(name);
+  return static_cast<uint32_t>(_memories.size() - 1);
+}
+
+bool Metrics::beginRun()
+{
+  // Record N-th, 2N-th, ... runs, so the first run with warm-up is left out unless N is 1
+  const auto run = _runs.fetch_add(1, std::memory_order_relaxed) + 1;
+  return run % _sampling_period == 0;
+}
+
+void Metrics::recordOperation(uint32_t id, uint64_t us)
+{
+  auto &op = _operations.at(id);
+  op.count.fetch_add(1, std::memory_order_relaxed);
+  op.total_us.fetch_add(us, std::memory_order_relaxed);
+  updateMax(op.max_us, us);
+}
+
+void Metrics::recordMemory(uint32_t id, uint64_t bytes) { updateMax(_memories.at(id).peak, bytes); }
+
+std::string Metrics::toJSON() const
+{
+  Json::Value root{Json::objectValue};
+
+  root["sampling_period"] = _sampling_period;
+  root["runs"] = Json::UInt64{_runs.load(std::memory_order_relaxed)};
+  root["sampled_runs"] = Json::UInt64{_latency.count()};
+
+  auto &latency = root["latency_us"] = Json::Value{Json::objectValue};
+  latency["mean"] = Json::UInt64{_latency.count() == 0 ? 0 : _latency.sum() / _latency.count()};
+  latency["p50"] = Json::UInt64{_latency.percentile(50)};
+  latency["p90"] = Json::UInt64{_latency.percentile(90)};
+  latency["p99"] = Json::UInt64{_latency.percentile(99)};
+  latency["max"] = Json::UInt64{_latency.max()};
+
+  // Most time consuming operations first
+  std::vector<const Operation *> ops;
+  for (const auto &op : _operations)
+    ops.emplace_back(&op);
+  std::stable_sort(ops.begin(), ops.end(), [](const Operation *lhs, const Operation *rhs) {
+    return lhs->total_us.load(std::memory_order_relaxed) >
+           rhs->total_us.load(std::memory_order_relaxed);
+  });
+
+  auto &operations = root["operations"] = Json::Value{Json::arrayValue};
+  for (const auto op : ops)
+  {
+    const auto count = op->count.load(std::memory_order_relaxed);
+    const auto total_us = op->total_us.load(std::memory_order_relaxed);
+
+    Json::Value obj{Json::objectValue};
+    obj["name"] = op->name;
+    obj["backend"] = op->backend;
+    obj["count"] = Json::UInt64{count};
+    obj["total_us"] = Json::UInt64{total_us};
+    obj["mean_us"] = Json::UInt64{count == 0 ? 0 : total_us / count};
+    obj["max_us"] = Json::UInt64{op->max_us.load(std::memory_order_relaxed)};
+    operations.append(obj);
+  }
+
+  auto &memory = root["memory_peak_bytes"] = Json::Value{Json::objectValue};
+  for (const auto &mem : _memories)
+  {
+    memory[mem.name] = Json::UInt64{mem.peak.load(std::memory_order_relaxed)};
+  }
+
+  std::stringstream ss;
+  ss << root;
+  return ss.str();
+}
+
+} // namespace exec
+} // namespace onert
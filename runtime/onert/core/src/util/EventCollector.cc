@@ -18,6 +18,9 @@
 
 // C++ standard libraries
 #include <chrono>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
 
 // POSIX standard libraries
 #include <sys/time.h>
@@ -33,19 +36,33 @@ std::string timestamp(void)
       std::chrono::duration_cast<std::chrono::microseconds>(now.time_since_epoch()).count());
 }
 
+// Number threads in order of appearance, as thread ids are too long to read in a trace viewer
+std::string lane(void)
+{
+  static std::mutex mu;
+  static std::unordered_map<std::thread::id, uint32_t> lanes;
+
+  std::lock_guard<std::mutex> lock{mu};
+  auto res = lanes.emplace(std::this_thread::get_id(), lanes.size());
+  return std::to_string(res.first->second);
+}
+
 class DurationEventBuilder
 {
 public:
   DurationEventBuilder(const std::string &ts) : _ts{ts} {}
 
-  DurationEvent build(const std::string &tid, const std::string &name, const std::string &ph) const
+  DurationEvent build(const EventCollector::Event &event, const std::string &ph) const
   {
     DurationEvent evt;
 
-    evt.name = name;
-    evt.tid = tid;
+    evt.name = event.label;
+    evt.tid = event.backend;
     evt.ph = ph;
     evt.ts = _ts;
+    evt.lane = lane();
+    evt.args = event.args;
+    evt.args["backend"] = event.backend;
 
     return evt;
   }
@@ -91,14 +108,26 @@ void EventCollector::onEvent(const Event &event)
   switch (event.edge)
   {
     case Edge::BEGIN:
-      _rec->emit(DurationEventBuilder(ts).build(event.backend, event.label, "B"));
+      _rec->emit(DurationEventBuilder(ts).build(event, "B"));
       break;
 
     case Edge::END:
-      _rec->emit(DurationEventBuilder(ts).build(event.backend, event.label, "E"));
+      _rec->emit(DurationEventBuilder(ts).build(event, "E"));
       break;
   }
 
   // Trace resource usage per each event notification
   emit_rusage(_rec, ts);
 }
+
+void EventCollector::onCounter(const std::string &name, uint64_t value)
+{
+  CounterEvent evt;
+
+  evt.name = name;
+  evt.ph = "C";
+  evt.ts = timestamp();
+  evt.values["value"] = std::to_string(value);
+
+  _rec->emit(evt);
+}
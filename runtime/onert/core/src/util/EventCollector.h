@@ -19,6 +19,10 @@
 
 #include "util/EventRecorder.h"
 
+#include <cstdint>
+#include <map>
+#include <string>
+
 class EventCollector
 {
 public:
@@ -33,6 +37,7 @@ public:
     Edge edge;
     std::string backend;
     std::string label;
+    std::map<std::string, std::string> args;
   };
 
 public:
@@ -43,6 +48,7 @@ public:
 
 public:
   void onEvent(const Event &event);
+  void onCounter(const std::string &name, uint64_t value);
 
 protected:
   EventRecorder *_rec;
@@ -40,6 +40,8 @@ EventCollectorGlobal::~EventCollectorGlobal()
     {
       // TODO Need better way for saved file path than the hardcoded path
       std::ofstream ofs{"trace.global.json"};
+      _recorder.setWriteFormat(
+          EventRecorder::toWriteFormat(util::getConfigString(util::config::TRACE_FORMAT)));
       _recorder.writeToFile(ofs);
     }
     catch (const std::exception &e)
@@ -58,12 +60,12 @@ EventCollectorGlobal &EventCollectorGlobal::get()
 EventDurationBlock::EventDurationBlock(const std::string &tag) : _tag{tag}
 {
   auto &glob = EventCollectorGlobal::get();
-  glob.collector().onEvent(EventCollector::Event{EventCollector::Edge::BEGIN, "0", _tag});
+  glob.collector().onEvent(EventCollector::Event{EventCollector::Edge::BEGIN, "0", _tag, {}});
 }
 EventDurationBlock::~EventDurationBlock()
 {
   auto &glob = EventCollectorGlobal::get();
-  glob.collector().onEvent(EventCollector::Event{EventCollector::Edge::END, "0", _tag});
+  glob.collector().onEvent(EventCollector::Event{EventCollector::Edge::END, "0", _tag, {}});
 }
 
 EventDurationManual::EventDurationManual(const std::string &tag) : _tag{tag}, _pair{true} {}
@@ -78,7 +80,7 @@ void EventDurationManual::begin()
 {
   _pair = false;
   auto &glob = EventCollectorGlobal::get();
-  glob.collector().onEvent(EventCollector::Event{EventCollector::Edge::BEGIN, "0", _tag});
+  glob.collector().onEvent(EventCollector::Event{EventCollector::Edge::BEGIN, "0", _tag, {}});
 }
 
 void EventDurationManual::end()
@@ -86,7 +88,7 @@ void EventDurationManual::end()
   assert(!_pair);
   _pair = true;
   auto &glob = EventCollectorGlobal::get();
-  glob.collector().onEvent(EventCollector::Event{EventCollector::Edge::END, "0", _tag});
+  glob.collector().onEvent(EventCollector::Event{EventCollector::Edge::END, "0", _tag, {}});
 }
 
 } // namespace util
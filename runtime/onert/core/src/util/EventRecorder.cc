@@ -16,7 +16,10 @@
 
 #include "util/EventRecorder.h"
 
-#include <sstream>
+#include <algorithm>
+#include <cctype>
+#include <set>
+#include <stdexcept>
 #include <vector>
 #include <unordered_map>
 #include <json/json.h>
@@ -25,91 +28,64 @@
 namespace
 {
 
-std::string quote(const std::string &value)
+// Chrome trace viewer requires numbers for timestamps, thread ids and counter values
+Json::Value value(const std::string &str)
 {
-  std::stringstream ss;
-  ss << '"' << value << '"';
-  return ss.str();
+  auto is_digit = [](unsigned char c) { return std::isdigit(c) != 0; };
+  if (!str.empty() && std::all_of(str.begin(), str.end(), is_digit))
+    return Json::Value{Json::UInt64{std::stoull(str)}};
+  return Json::Value{str};
 }
 
-std::string field(const std::string &k, const std::string &v)
+Json::Value object(const Event &evt, const std::string &tid)
 {
-  std::stringstream ss;
-  ss << quote(k) << " : " << quote(v);
-  return ss.str();
-}
-
-struct Content // One Entry in Chrome Event Trace
-{
-  std::vector<std::pair<std::string, std::string>> flds;
-  std::vector<std::pair<std::string, std::string>> args;
-};
-
-std::string object(const Content &content)
-{
-  std::stringstream ss;
-
-  ss << "{ ";
-
-  ss << field(content.flds[0].first, content.flds[0].second);
-
-  for (uint32_t n = 1; n < content.flds.size(); ++n)
-  {
-    ss << ", " << field(content.flds.at(n).first, content.flds.at(n).second);
-  }
-
-  if (content.args.size() > 0)
-  {
-    ss << ", " << quote("args") << " : { ";
-    ss << field(content.args.at(0).first, content.args.at(0).second);
-
-    for (uint32_t n = 1; n < content.args.size(); ++n)
-    {
-      ss << ", " << field(content.args.at(n).first, content.args.at(n).second);
-    }
-
-    ss << "}";
-  }
-
-  ss << " }";
+  Json::Value obj{Json::objectValue};
 
-  return ss.str();
-}
+  obj["name"] = evt.name;
+  obj["pid"] = 0;
+  obj["tid"] = value(tid);
+  obj["ph"] = evt.ph;
+  obj["ts"] = value(evt.ts);
 
-void fill(Content &content, const Event &evt)
-{
-  content.flds.emplace_back("name", evt.name);
-  content.flds.emplace_back("pid", "0");
-  content.flds.emplace_back("tid", evt.tid);
-  content.flds.emplace_back("ph", evt.ph);
-  content.flds.emplace_back("ts", evt.ts);
+  return obj;
 }
 
-std::string object(const DurationEvent &evt)
+Json::Value object(const DurationEvent &evt)
 {
-  Content content;
+  auto obj = object(evt, evt.lane.empty() ? evt.tid : evt.lane);
 
-  fill(content, evt);
+  for (auto &arg : evt.args)
+  {
+    obj["args"][arg.first] = arg.second;
+  }
 
-  return ::object(content);
+  return obj;
 }
 
-std::string object(const CounterEvent &evt)
+Json::Value object(const CounterEvent &evt)
 {
-  Content content;
+  auto obj = object(evt, evt.tid);
 
-  fill(content, evt);
-
-  for (auto it = evt.values.begin(); it != evt.values.end(); ++it)
+  for (auto &kv : evt.values)
   {
-    content.args.emplace_back(it->first, it->second);
+    obj["args"][kv.first] = value(kv.second);
   }
 
-  return ::object(content);
+  return obj;
 }
 
 } // namespace
 
+EventRecorder::WriteFormat EventRecorder::toWriteFormat(const std::string &key)
+{
+  if (key == "snpe")
+    return WriteFormat::SNPE_BENCHMARK;
+  if (key == "chrome")
+    return WriteFormat::CHROME_TRACING;
+
+  throw std::runtime_error{"Invalid trace format: " + key};
+}
+
 void EventRecorder::emit(const DurationEvent &evt)
 {
   std::lock_guard<std::mutex> lock{_mu};
@@ -241,20 +217,35 @@ void EventRecorder::writeSNPEBenchmark(std::ostream &os)
 
 void EventRecorder::writeChromeTrace(std::ostream &os)
 {
-  os << "{\n";
-  os << "  " << quote("traceEvents") << ": [\n";
+  Json::Value root;
+  auto &events = root["traceEvents"] = Json::Value{Json::arrayValue};
 
+  std::set<std::string> lanes;
   for (auto &evt : _duration_events)
   {
-    os << "    " << object(evt) << ",\n";
+    events.append(object(evt));
+    lanes.insert(evt.lane);
   }
 
   for (auto &evt : _counter_events)
   {
-    os << "    " << object(evt) << ",\n";
+    events.append(object(evt));
   }
 
-  os << "    { }\n";
-  os << "  ]\n";
-  os << "}\n";
+  // Name the lanes so that threads are told apart in the viewer
+  for (auto &lane : lanes)
+  {
+    if (lane.empty())
+      continue;
+
+    Json::Value meta{Json::objectValue};
+    meta["name"] = "thread_name";
+    meta["ph"] = "M";
+    meta["pid"] = 0;
+    meta["tid"] = value(lane);
+    meta["args"]["name"] = "thread " + lane;
+    events.append(meta);
+  }
+
+  os << root;
 }
@@ -22,6 +22,7 @@
 #include <mutex>
 
 #include <ostream>
+#include <string>
 #include <vector>
 
 struct Event
@@ -34,7 +35,8 @@ struct Event
 
 struct DurationEvent : public Event
 {
-  // TO BE FILLED
+  std::string lane; // Thread which the event happened on, shown as a lane in Chrome trace
+  std::map<std::string, std::string> args;
 };
 
 struct CounterEvent : public Event
@@ -59,6 +61,12 @@ public:
 public:
   EventRecorder() = default;
 
+public:
+  /**
+   * @brief Get WriteFormat from its key, "snpe" or "chrome"
+   */
+  static WriteFormat toWriteFormat(const std::string &key);
+
 public:
   void emit(const DurationEvent &evt);
   void emit(const CounterEvent &evt);
@@ -74,7 +82,6 @@ private:
 
 private:
   std::mutex _mu;
-  // TODO: Allow user to control write_format
   WriteFormat _write_format{WriteFormat::SNPE_BENCHMARK};
   std::vector<DurationEvent> _duration_events;
   std::vector<CounterEvent> _counter_events;
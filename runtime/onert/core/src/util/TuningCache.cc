@@ -0,0 +1,241 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "util/TuningCache.h"
+
+#include "util/ConfigSource.h"
+#include "util/logging.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <thread>
+
+#include <unistd.h>
+
+namespace
+{
+
+const char kSeparator = '\t';
+const char *kDefaultCacheFile = "tuning_cache.txt";
+
+std::string trim(const std::string &str)
+{
+  const auto begin = str.find_first_not_of(" \t");
+  if (begin == std::string::npos)
+    return "";
+  const auto end = str.find_last_not_of(" \t");
+  return str.substr(begin, end - begin + 1);
+}
+
+// Without autotuning, the cache file is used only when it is given explicitly
+std::string configCacheFile()
+{
+  auto filepath = onert::util::getConfigString(onert::util::config::CPU_TUNING_CACHE);
+  if (filepath.empty() && onert::util::getConfigBool(onert::util::config::CPU_AUTOTUNE))
+    filepath = kDefaultCacheFile;
+  return filepath;
+}
+
+} // namespace
+
+namespace onert
+{
+namespace util
+{
+
+TuningCache &TuningCache::get()
+{
+  static TuningCache cache{configCacheFile(), getConfigBool(config::CPU_AUTOTUNE)};
+  return cache;
+}
+
+std::string TuningCache::currentCPUModel()
+{
+  std::string model;
+
+  // x86 reports "model name", arm reports "Hardware" or "CPU part" of each core
+  std::ifstream cpuinfo("/proc/cpuinfo");
+  std::string line;
+  while (model.empty() && std::getline(cpuinfo, line))
+  {
+    const auto colon = line.find(':');
+    if (colon == std::string::npos)
+      continue;
+
+    const auto name = trim(line.substr(0, colon));
+    if (name == "model name" || name == "Hardware" || name == "CPU part")
+      model = trim(line.substr(colon + 1));
+  }
+
+  if (model.empty())
+    model = "unknown";
+
+  // Kernels are tuned with the thread count of this machine
+  const auto threads = std::thread::hardware_concurrency();
+  model += " x" + std::to_string(threads);
+
+  std::replace(model.begin(), model.end(), kSeparator, ' ');
+  return model;
+}
+
+TuningCache::TuningCache(const std::string &filepath, bool autotune,
+                         const std::string &cpu_model)
+    : _filepath{filepath}, _autotune{autotune}, _cpu_model{cpu_model}
+{
+  load();
+}
+
+std::string TuningCache::find(const std::string &key) const
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+
+  auto it = _entries.find(key);
+  return it == _entries.end() ? "" : it->second;
+}
+
+void TuningCache::update(const std::string &key, const std::string &variant)
+{
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    _entries[key] = variant;
+  }
+  save();
+}
+
+std::string TuningCache::select(const std::string &key, const std::vector<Candidate> &candidates,
+                                uint32_t repeat)
+{
+  const auto recorded = find(key);
+  const auto is_recorded = [&recorded](const Candidate &candidate) {
+    return candidate.first == recorded;
+  };
+  if (std::any_of(candidates.begin(), candidates.end(), is_recorded))
+    return recorded;
+
+  if (!_autotune || candidates.size() < 2)
+    return "";
+
+  std::string fastest;
+  auto fastest_time = std::chrono::steady_clock::duration::max();
+  for (const auto &candidate : candidates)
+  {
+    // Warm up caches and lazily initialized resources (e.g. thread pools)
+    candidate.second();
+
+    auto best_time = std::chrono::steady_clock::duration::max();
+    for (uint32_t i = 0; i < repeat; ++i)
+    {
+      const auto begin = std::chrono::steady_clock::now();
+      candidate.second();
+      best_time = std::min(best_time, std::chrono::steady_clock::now() - begin);
+    }
+
+    VERBOSE(TuningCache) << key << " : " << candidate.first << " takes "
+                         << std::chrono::duration_cast<std::chrono::microseconds>(best_time).count()
+                         << "us" << std::endl;
+
+    if (best_time < fastest_time)
+    {
+      fastest = candidate.first;
+      fastest_time = best_time;
+    }
+  }
+
+  update(key, fastest);
+  return fastest;
+}
+
+void TuningCache::save() const
+{
+  if (_filepath.empty())
+    return;
+
+  std::lock_guard<std::mutex> lock{_mutex};
+
+  // Tuning results are still used by this process even if they cannot be saved
+  const auto warn = [this]() {
+    std::cerr << "W: Fail to save tuning cache file: " << _filepath << std::endl;
+  };
+
+  // Write a temporary file and rename it over the cache file, so that a process loading the
+  // cache never sees a partially written file, and concurrent writers do not mix their lines
+  const auto temp_filepath = _filepath + ".tmp." + std::to_string(getpid());
+  {
+    std::ofstream stream(temp_filepath);
+    if (!stream.is_open())
+    {
+      warn();
+      return;
+    }
+
+    for (const auto &line : _foreign_lines)
+    {
+      stream << line << "\n";
+    }
+    for (const auto &entry : _entries)
+    {
+      stream << _cpu_model << kSeparator << entry.first << kSeparator << entry.second << "\n";
+    }
+
+    stream.flush();
+    if (!stream)
+    {
+      stream.close();
+      std::remove(temp_filepath.c_str());
+      warn();
+      return;
+    }
+  }
+
+  if (std::rename(temp_filepath.c_str(), _filepath.c_str()) != 0)
+  {
+    std::remove(temp_filepath.c_str());
+    warn();
+  }
+}
+
+void TuningCache::load()
+{
+  if (_filepath.empty())
+    return;
+
+  std::ifstream stream(_filepath);
+  std::string line;
+  while (std::getline(stream, line))
+  {
+    const auto first = line.find(kSeparator);
+    const auto last = line.rfind(kSeparator);
+    if (first == std::string::npos || first == last)
+      continue; // Ignore broken lines
+
+    if (line.substr(0, first) != _cpu_model)
+    {
+      _foreign_lines.emplace_back(line);
+      continue;
+    }
+
+    _entries[line.substr(first + 1, last - first - 1)] = line.substr(last + 1);
+  }
+
+  VERBOSE(TuningCache) << "Load " << _entries.size() << " entries for '" << _cpu_model << "' from "
+                       << _filepath << std::endl;
+}
+
+} // namespace util
+} // namespace onert
@@ -23,6 +23,7 @@
 
 #include "flatbuffers/flexbuffers.h"
 
+#include <algorithm>
 #include <map>
 #include <memory>
 #include <fstream>
@@ -53,6 +54,8 @@ protected:
   using SubGraph = typename LoaderDomain::SubGraph;
   using Tensor = typename LoaderDomain::Tensor;
   using TensorType = typename LoaderDomain::TensorType;
+  using SparsityParameters = typename LoaderDomain::SparsityParameters;
+  using DimensionType = typename LoaderDomain::DimensionType;
 
 protected:
   bool isOptionalInputTensor(std::int32_t idx) { return idx == -1; }
@@ -65,7 +68,8 @@ public:
    * @param graph reference on subgraphs
    */
   explicit BaseLoader(std::unique_ptr<ir::Subgraphs> &subgs)
-      : _base{nullptr}, _pagesize(getpagesize()), _fd(-1), _subgraphs(subgs), _model{nullptr}
+      : _base{nullptr}, _size{0}, _pagesize(getpagesize()), _fd(-1), _subgraphs(subgs),
+        _model{nullptr}
   {
   }
 
@@ -85,9 +89,15 @@ protected:
   ir::DataType tensorTypeToDataType(TensorType type);
   ir::OperandIndex tensorIdxToOperandIdx(int32_t tensorIdx);
   void deallocateMmappedArea(uint8_t *ptr, size_t size);
+  // Get the region of buffer data stored outside of flatbuffers
+  // Returns false if the buffer does not have such data
+  virtual bool getExtBufferRegion(const Buffer *, uint64_t &, uint64_t &) { return false; }
 
   // Create operands form tflite::Tensor
   ir::OperandIndex loadOperand(const Tensor *tensor, ir::Graph &subg);
+  // Load sparse format of a constant tensor
+  std::shared_ptr<ir::Sparsity> loadSparsity(const SparsityParameters *sparsity,
+                                             const ir::Shape &shape);
   void loadOperationIO(const Operator *op, ir::OperandIndexSequence &inputs,
                        ir::OperandIndexSequence &outputs);
   // Create operations from Operator
@@ -172,12 +182,15 @@ protected:
   void loadFusedBatchNorm(const Operator *op, ir::Graph &subg);
   void loadLogSoftmax(const Operator *op, ir::Graph &subg);
   void loadQuantize(const Operator *op, ir::Graph &subg);
+  void loadDequantize(const Operator *op, ir::Graph &subg);
   void loadSpaceToDepth(const Operator *op, ir::Graph &subg);
   void loadStatelessRandomUniform(const Operator *op, ir::Graph &subg);
 
 protected:
   // Base address for mapped region for loading (if needed)
   uint8_t *_base;
+  // Size of loaded file
+  size_t _size;
   // Memory page size
   int32_t _pagesize;
   // loaded file description
@@ -206,20 +219,24 @@ void BaseLoader<LoaderDomain, SpecificLoader>::BaseLoader::loadFromFile(const ch
     throw std::runtime_error("Fstat failed or file " + std::string(file_path) +
                              " is not a regular file");
   }
-  int size = file_stat.st_size;
+  _size = file_stat.st_size;
 
   // Map model file into memory region
-  _base = static_cast<uint8_t *>(mmap(NULL, size, PROT_READ, MAP_PRIVATE, _fd, 0));
+  _base = static_cast<uint8_t *>(mmap(NULL, _size, PROT_READ, MAP_PRIVATE, _fd, 0));
   if (_base == MAP_FAILED)
   {
     close(_fd);
     throw std::runtime_error("mmap failed - " + std::string(strerror(errno)));
   }
 
-  _verifier = std::make_unique<Verifier>(reinterpret_cast<const std::uint8_t *>(_base), size);
+  // NOTE Buffer data of a model larger than 2GB is stored after the flatbuffers, so only the
+  //      leading part of the file is given to verifier
+  size_t verify_size = std::min<size_t>(_size, FLATBUFFERS_MAX_BUFFER_SIZE - 1);
+  _verifier =
+      std::make_unique<Verifier>(reinterpret_cast<const std::uint8_t *>(_base), verify_size);
 
   loadModel();
-  munmap(_base, size);
+  munmap(_base, _size);
 
   close(_fd);
 }
@@ -358,16 +375,35 @@ ir::OperandIndex BaseLoader<LoaderDomain, SpecificLoader>::loadOperand(const Ten
   }
   // Create TypeInfo
   ir::TypeInfo type_info(data_type, scale, zero_point);
+  // Sparsity
+  if (tensor->sparsity() != nullptr)
+    type_info.sparsity(loadSparsity(tensor->sparsity(), shape));
   // Create operand
   const auto operand_index = subg.addOperand(shape, type_info);
 
   // Constant tensors are indicated by non-empty data.
-  const auto *data = _model->buffers()->Get(tensor->buffer())->data();
-  if (data != nullptr)
+  const auto *buffer = _model->buffers()->Get(tensor->buffer());
+  const auto *data = buffer->data();
+  uint64_t ext_offset = 0;
+  uint64_t ext_size = 0;
+  if (data != nullptr || getExtBufferRegion(buffer, ext_offset, ext_size))
   {
+    // Buffer data outside of flatbuffers should be in the file
+    if (data == nullptr && (ext_offset > _size || ext_size > _size - ext_offset))
+      throw std::runtime_error("Buffer data is out of the model file");
+
     using std::ptrdiff_t;
-    size_t data_size = data->size();
-    ptrdiff_t unaligned_offset_start = data->data() - _base;
+    size_t data_size = data != nullptr ? data->size() : ext_size;
+    if (const auto *sparsity = type_info.sparsity())
+    {
+      // Data has the values of non-zero blocks only
+      const auto &block_size = sparsity->block_size();
+      if (data_size != sparsity->indices().size() * block_size[0] * block_size[1] *
+                           ir::sizeOfDataType(data_type))
+        throw std::runtime_error("Size of sparse data does not match its sparsity");
+    }
+    ptrdiff_t unaligned_offset_start =
+        data != nullptr ? data->data() - _base : static_cast<ptrdiff_t>(ext_offset);
     ptrdiff_t offset_end = unaligned_offset_start + data_size;
 
     // Calculated aligned offset from base address of mapped region
@@ -389,6 +425,88 @@ ir::OperandIndex BaseLoader<LoaderDomain, SpecificLoader>::loadOperand(const Ten
   return operand_index;
 }
 
+// Copy index vector of a sparse dimension, which may be of any of the given types
+template <typename Int32Vector, typename Uint16Vector, typename Uint8Vector>
+inline std::vector<int32_t> copyIndexVector(const Int32Vector *i32, const Uint16Vector *u16,
+                                            const Uint8Vector *u8)
+{
+  std::vector<int32_t> result;
+  if (i32 != nullptr && i32->values() != nullptr)
+    result.assign(i32->values()->begin(), i32->values()->end());
+  else if (u16 != nullptr && u16->values() != nullptr)
+    result.assign(u16->values()->begin(), u16->values()->end());
+  else if (u8 != nullptr && u8->values() != nullptr)
+    result.assign(u8->values()->begin(), u8->values()->end());
+  return result;
+}
+
+template <typename LoaderDomain, typename SpecificLoader>
+std::shared_ptr<ir::Sparsity>
+BaseLoader<LoaderDomain, SpecificLoader>::loadSparsity(const SparsityParameters *sparsity,
+                                                       const ir::Shape &shape)
+{
+  // Only block compressed sparse row format of a matrix of [d0 * ... * dn-2, dn-1] is supported
+  //   traversal_order : (d0, ..., dn-1) or (d0, ..., dn-1, dn, dn+1) with 2-D blocks
+  //   block_map       : none or (0, n-1)
+  //   dim_metadata    : DENSE for d0, ..., dn-2, SPARSE_CSR for dn-1 and DENSE for blocks
+  const int rank = shape.rank();
+  const auto *traversal_order = sparsity->traversal_order();
+  const auto *block_map = sparsity->block_map();
+  const auto *dim_metadata = sparsity->dim_metadata();
+  const int block_rank = block_map != nullptr ? block_map->size() : 0;
+
+  bool supported = rank >= 1 && (block_rank == 0 || block_rank == 2) &&
+                   traversal_order != nullptr && dim_metadata != nullptr &&
+                   static_cast<int>(traversal_order->size()) == rank + block_rank &&
+                   static_cast<int>(dim_metadata->size()) == rank + block_rank;
+  for (int i = 0; supported && i < rank + block_rank; ++i)
+  {
+    const auto expected_format = (i == rank - 1) ? DimensionType::DimensionType_SPARSE_CSR
+                                                 : DimensionType::DimensionType_DENSE;
+    supported = traversal_order->Get(i) == i && dim_metadata->Get(i)->format() == expected_format;
+  }
+  if (supported && block_rank == 2)
+    supported = block_map->Get(0) == 0 && block_map->Get(1) == rank - 1;
+  if (!supported)
+    throw std::runtime_error("Sparsity: only block compressed sparse row format is supported");
+
+  std::vector<int32_t> block_size{1, 1};
+  if (block_rank == 2)
+  {
+    block_size[0] = dim_metadata->Get(rank)->dense_size();
+    block_size[1] = dim_metadata->Get(rank + 1)->dense_size();
+  }
+
+  const auto *csr = dim_metadata->Get(rank - 1);
+  auto segments = copyIndexVector(csr->array_segments_as_Int32Vector(),
+                                  csr->array_segments_as_Uint16Vector(),
+                                  csr->array_segments_as_Uint8Vector());
+  auto indices = copyIndexVector(csr->array_indices_as_Int32Vector(),
+                                 csr->array_indices_as_Uint16Vector(),
+                                 csr->array_indices_as_Uint8Vector());
+
+  // Kernels trust the indices, so they are validated here
+  const int cols = shape.dim(rank - 1);
+  const int rows = cols > 0 ? shape.num_elements() / cols : 0;
+  if (cols <= 0 || block_size[0] <= 0 || block_size[1] <= 0 || rows % block_size[0] != 0 ||
+      cols % block_size[1] != 0)
+    throw std::runtime_error("Sparsity: invalid block size");
+
+  const int block_rows = rows / block_size[0];
+  const int block_cols = cols / block_size[1];
+  bool valid = static_cast<int>(segments.size()) == block_rows + 1 && segments.front() == 0 &&
+               segments.back() == static_cast<int32_t>(indices.size());
+  for (int r = 0; valid && r < block_rows; ++r)
+    valid = segments[r] <= segments[r + 1];
+  for (auto index : indices)
+    valid = valid && index >= 0 && index < block_cols;
+  if (!valid)
+    throw std::runtime_error("Sparsity: invalid segments or indices");
+
+  return std::make_shared<ir::Sparsity>(std::move(segments), std::move(indices),
+                                        std::move(block_size));
+}
+
 template <typename LoaderDomain, typename SpecificLoader>
 void BaseLoader<LoaderDomain, SpecificLoader>::loadOperationIO(const Operator *op,
                                                                ir::OperandIndexSequence &inputs,
@@ -1792,6 +1910,18 @@ void BaseLoader<LoaderDomain, SpecificLoader>::loadQuantize(const Operator *op,
   subg.addOperation(std::move(new_op));
 }
 
+template <typename LoaderDomain, typename SpecificLoader>
+void BaseLoader<LoaderDomain, SpecificLoader>::loadDequantize(const Operator *op, ir::Graph &subg)
+{
+  ir::OperandIndexSequence inputs;
+  ir::OperandIndexSequence outputs;
+
+  loadOperationIO(op, inputs, outputs);
+
+  std::unique_ptr<ir::Operation> new_op(new ir::operation::Dequantize(inputs, outputs));
+  subg.addOperation(std::move(new_op));
+}
+
 template <typename LoaderDomain, typename SpecificLoader>
 void BaseLoader<LoaderDomain, SpecificLoader>::loadOperation(const Operator *op, ir::Graph &subg)
 {
@@ -2012,6 +2142,9 @@ void BaseLoader<LoaderDomain, SpecificLoader>::loadOperation(const Operator *op,
     case BuiltinOperator::BuiltinOperator_QUANTIZE:
       loadQuantize(op, subg);
       return;
+    case BuiltinOperator::BuiltinOperator_DEQUANTIZE:
+      loadDequantize(op, subg);
+      return;
     case BuiltinOperator::BuiltinOperator_SPACE_TO_DEPTH:
       loadSpaceToDepth(op, subg);
       return;
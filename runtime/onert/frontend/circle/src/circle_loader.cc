@@ -53,6 +53,8 @@ struct LoaderDomain
   using Tensor = circle::Tensor;
   using TensorType = circle::TensorType;
   using SubGraph = circle::SubGraph;
+  using SparsityParameters = circle::SparsityParameters;
+  using DimensionType = circle::DimensionType;
 
   static const char *EnumNameBuiltinOperator(BuiltinOperator e)
   {
@@ -72,6 +74,17 @@ class CircleLoader final : public base_loader::BaseLoader<LoaderDomain, CircleLo
 public:
   using BaseLoader::BaseLoader;
 
+  bool getExtBufferRegion(const Buffer *buffer, uint64_t &offset, uint64_t &size) override
+  {
+    // NOTE offset is valid only if > 1 (0 and 1 are reserved as not-set and placeholder)
+    if (buffer->offset() <= 1)
+      return false;
+
+    offset = buffer->offset();
+    size = buffer->size();
+    return true;
+  }
+
   bool allowOptionalInputTensor(BuiltinOperator op) override
   {
     switch (op)
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <NeuralNetworks.h>
+
+#include <new>
+
+#include "wrapper/ANeuralNetworksBurst.h"
+#include "wrapper/ANeuralNetworksCompilation.h"
+#include "wrapper/ANeuralNetworksExecution.h"
+#include "util/logging.h"
+
+//
+// NNAPI Implementation
+//
+int ANeuralNetworksBurst_create(ANeuralNetworksCompilation *compilation,
+                                ANeuralNetworksBurst **burst)
+{
+  if ((compilation == nullptr) || (burst == nullptr))
+  {
+    VERBOSE(NNAPI::Burst) << "create: Incorrect null pointer parameter(s)" << std::endl;
+    return ANEURALNETWORKS_UNEXPECTED_NULL;
+  }
+
+  std::shared_ptr<onert::exec::ExecutorMap> executors;
+
+  compilation->publish(executors);
+
+  if (executors == nullptr)
+  {
+    VERBOSE(NNAPI::Burst) << "create: Never compiled yet" << std::endl;
+    return ANEURALNETWORKS_BAD_DATA;
+  }
+
+  *burst = new (std::nothrow) ANeuralNetworksBurst{executors};
+  if (*burst == nullptr)
+  {
+    VERBOSE(NNAPI::Burst) << "create: Fail to create burst object" << std::endl;
+    return ANEURALNETWORKS_OUT_OF_MEMORY;
+  }
+
+  return ANEURALNETWORKS_NO_ERROR;
+}
+
+void ANeuralNetworksBurst_free(ANeuralNetworksBurst *burst) { delete burst; }
+
+int ANeuralNetworksExecution_burstCompute(ANeuralNetworksExecution *execution,
+                                          ANeuralNetworksBurst *burst)
+{
+  if ((execution == nullptr) || (burst == nullptr))
+  {
+    VERBOSE(NNAPI::Burst) << "burstCompute: Incorrect null pointer parameter(s)" << std::endl;
+    return ANEURALNETWORKS_UNEXPECTED_NULL;
+  }
+
+  if (!burst->accepts(execution))
+  {
+    VERBOSE(NNAPI::Burst) << "burstCompute: Execution is not from the compilation of burst"
+                          << std::endl;
+    return ANEURALNETWORKS_BAD_DATA;
+  }
+
+  switch (burst->compute(execution))
+  {
+    case ANeuralNetworksBurst::ComputeResult::DONE:
+      return ANEURALNETWORKS_NO_ERROR;
+    case ANeuralNetworksBurst::ComputeResult::BUSY:
+      VERBOSE(NNAPI::Burst) << "burstCompute: Another execution is processing" << std::endl;
+      return ANEURALNETWORKS_BAD_STATE;
+    default:
+      VERBOSE(NNAPI::Burst) << "burstCompute: Fail to execution" << std::endl;
+      return ANEURALNETWORKS_OP_FAILED;
+  }
+}
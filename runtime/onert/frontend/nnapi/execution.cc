@@ -85,6 +85,12 @@ int ANeuralNetworksExecution_setInput(ANeuralNetworksExecution *execution, int32
     return ANEURALNETWORKS_BAD_DATA;
   }
 
+  // Rebinding for the next compute on a reused execution
+  if (execution->isInputBound(index, type, buffer, length))
+  {
+    return ANEURALNETWORKS_NO_ERROR;
+  }
+
   const auto operand_index = execution->getInputOperandIndex(index);
   if (!operand_index.valid())
   {
@@ -173,6 +179,12 @@ int ANeuralNetworksExecution_setOutput(ANeuralNetworksExecution *execution, int3
     return ANEURALNETWORKS_BAD_DATA;
   }
 
+  // Rebinding for the next compute on a reused execution
+  if (execution->isOutputBound(index, type, buffer, length))
+  {
+    return ANEURALNETWORKS_NO_ERROR;
+  }
+
   // Handle optional output
   if (buffer == nullptr)
   {
@@ -257,6 +269,8 @@ int ANeuralNetworksExecution_startCompute(ANeuralNetworksExecution *execution,
   return ANEURALNETWORKS_NO_ERROR;
 }
 
+// NOTE Unlike NNAPI 1.2, an execution can be computed again, keeping its bindings. Setting the
+//      same buffers again before the next compute is skipped without validation.
 int ANeuralNetworksExecution_compute(ANeuralNetworksExecution *execution)
 {
   if (execution == nullptr)
@@ -294,6 +308,13 @@ int ANeuralNetworksExecution_setInputFromMemory(ANeuralNetworksExecution *execut
     return ANEURALNETWORKS_BAD_DATA;
   }
 
+  // Rebinding for the next compute on a reused execution
+  if (memory->vaildAccess(offset, length) &&
+      execution->isInputBound(index, type, memory->base() + offset, length))
+  {
+    return ANEURALNETWORKS_NO_ERROR;
+  }
+
   const auto operand_index = execution->getInputOperandIndex(index);
   if (!operand_index.valid())
   {
@@ -370,6 +391,13 @@ int ANeuralNetworksExecution_setOutputFromMemory(ANeuralNetworksExecution *execu
     return ANEURALNETWORKS_BAD_DATA;
   }
 
+  // Rebinding for the next compute on a reused execution
+  if (memory->vaildAccess(offset, length) &&
+      execution->isOutputBound(index, type, memory->base() + offset, length))
+  {
+    return ANEURALNETWORKS_NO_ERROR;
+  }
+
   const auto operand_index = execution->getOutputOperandIndex(index);
   if (!operand_index.valid())
   {
@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ANeuralNetworksBurst.h"
+#include "ANeuralNetworksExecution.h"
+#include "util/logging.h"
+
+ANeuralNetworksBurst::ANeuralNetworksBurst(
+    const std::shared_ptr<onert::exec::ExecutorMap> &executors) noexcept
+    : _executors{executors}
+{
+  // DO NOTHING
+}
+
+bool ANeuralNetworksBurst::accepts(const ANeuralNetworksExecution *execution) const noexcept
+{
+  return execution->executors() == _executors;
+}
+
+ANeuralNetworksBurst::ComputeResult
+ANeuralNetworksBurst::compute(ANeuralNetworksExecution *execution) noexcept
+{
+  // At most one execution can be processing at a time on a burst
+  if (_processing.test_and_set(std::memory_order_acquire))
+  {
+    VERBOSE(NNAPI::Burst) << "Another execution is processing" << std::endl;
+    return ComputeResult::BUSY;
+  }
+
+  // Bindings have been validated when they are set, so this goes straight into the executor
+  const bool done = execution->execute();
+
+  _processing.clear(std::memory_order_release);
+  return done ? ComputeResult::DONE : ComputeResult::FAILED;
+}
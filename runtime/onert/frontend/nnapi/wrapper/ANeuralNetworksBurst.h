@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __BURST_H__
+#define __BURST_H__
+
+#include <NeuralNetworks.h>
+
+#include <atomic>
+#include <memory>
+
+#include "exec/IExecutor.h"
+
+struct ANeuralNetworksExecution;
+
+struct ANeuralNetworksBurst
+{
+public:
+  enum class ComputeResult
+  {
+    DONE = 0,
+    BUSY,   // another execution is processing on this burst
+    FAILED, // execution failed
+  };
+
+public:
+  ANeuralNetworksBurst(const std::shared_ptr<onert::exec::ExecutorMap> &executors) noexcept;
+
+public:
+  /**
+   * @brief       Check the execution is created from the same compilation as this burst
+   * @param[in]   execution Execution to check
+   * @return      @c true if created from the same compilation, otherwise @c false
+   */
+  bool accepts(const ANeuralNetworksExecution *execution) const noexcept;
+  /**
+   * @brief       Run the execution synchronously on the caller's thread
+   * @param[in]   execution Execution to run, whose bindings are kept for the next compute
+   * @return      @c ComputeResult::DONE if success, @c ComputeResult::BUSY without running if
+   *              another execution is processing on this burst, otherwise
+   *              @c ComputeResult::FAILED
+   */
+  ComputeResult compute(ANeuralNetworksExecution *execution) noexcept;
+
+private:
+  const std::shared_ptr<onert::exec::ExecutorMap> _executors;
+  std::atomic_flag _processing = ATOMIC_FLAG_INIT;
+};
+
+#endif
@@ -137,6 +137,7 @@ bool ANeuralNetworksExecution::setInput(uint32_t index, const ANeuralNetworksOpe
     // model.
     // TODO Set layout of model
     _execution->setInput(input_index, type_info, shape, buffer, length, onert::ir::Layout::NHWC);
+    _input_bindings.at(index).assign(type, buffer, length);
   }
   catch (const std::exception &e)
   {
@@ -166,6 +167,7 @@ bool ANeuralNetworksExecution::setOutput(uint32_t index, const ANeuralNetworksOp
     // model.
     // TODO Set layout of model
     _execution->setOutput(output_index, type_info, shape, buffer, length, onert::ir::Layout::NHWC);
+    _output_bindings.at(index).assign(type, buffer, length);
   }
   catch (const std::exception &e)
   {
@@ -177,6 +179,79 @@ bool ANeuralNetworksExecution::setOutput(uint32_t index, const ANeuralNetworksOp
   return true;
 }
 
+bool ANeuralNetworksExecution::isInputBound(int32_t index, const ANeuralNetworksOperandType *type,
+                                            const void *buffer, size_t length) const noexcept
+{
+  if ((index < 0) || (static_cast<size_t>(index) >= _input_bindings.size()))
+  {
+    return false;
+  }
+
+  return _input_bindings[index].matches(type, buffer, length);
+}
+
+bool ANeuralNetworksExecution::isOutputBound(int32_t index, const ANeuralNetworksOperandType *type,
+                                             const void *buffer, size_t length) const noexcept
+{
+  if ((index < 0) || (static_cast<size_t>(index) >= _output_bindings.size()))
+  {
+    return false;
+  }
+
+  return _output_bindings[index].matches(type, buffer, length);
+}
+
+bool ANeuralNetworksExecution::Binding::matches(const ANeuralNetworksOperandType *type,
+                                                const void *buffer, size_t length) const noexcept
+{
+  // Not bound yet, or bound as an omitted optional one
+  if ((this->buffer == nullptr) || (buffer == nullptr))
+  {
+    return false;
+  }
+
+  if ((this->buffer != buffer) || (this->length != length) || (has_type != (type != nullptr)))
+  {
+    return false;
+  }
+
+  if (type == nullptr)
+  {
+    return true;
+  }
+
+  if ((this->type != type->type) || (dims.size() != type->dimensionCount) ||
+      (scale != type->scale) || (zero_point != type->zeroPoint))
+  {
+    return false;
+  }
+
+  for (uint32_t i = 0; i < type->dimensionCount; ++i)
+  {
+    if (dims[i] != type->dimensions[i])
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+void ANeuralNetworksExecution::Binding::assign(const ANeuralNetworksOperandType *type,
+                                               const void *buffer, size_t length)
+{
+  this->buffer = buffer;
+  this->length = length;
+  has_type = (type != nullptr);
+  if (has_type)
+  {
+    this->type = type->type;
+    dims.assign(type->dimensions, type->dimensions + type->dimensionCount);
+    scale = type->scale;
+    zero_point = type->zeroPoint;
+  }
+}
+
 bool ANeuralNetworksExecution::startExecute(void) noexcept
 {
   try
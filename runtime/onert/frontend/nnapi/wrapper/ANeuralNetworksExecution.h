@@ -20,6 +20,7 @@
 #include <NeuralNetworks.h>
 
 #include <memory>
+#include <vector>
 
 #include "exec/Execution.h"
 
@@ -27,7 +28,9 @@ struct ANeuralNetworksExecution
 {
 public:
   ANeuralNetworksExecution(const std::shared_ptr<onert::exec::ExecutorMap> &executors)
-      : _execution{std::make_shared<onert::exec::Execution>(executors)}
+      : _executors{executors}, _execution{std::make_shared<onert::exec::Execution>(executors)},
+        _input_bindings(_execution->primary_subgraph().getInputs().size()),
+        _output_bindings(_execution->primary_subgraph().getOutputs().size())
   {
     // DO NOTHING
   }
@@ -49,6 +52,33 @@ public:
   bool hasUnspecifiedDims(const onert::ir::OperandIndex index) noexcept;
   size_t getOperandSize(const onert::ir::OperandIndex index) noexcept;
   const std::shared_ptr<onert::exec::Execution> instance(void) noexcept;
+  const std::shared_ptr<onert::exec::ExecutorMap> &executors(void) const noexcept
+  {
+    return _executors;
+  }
+
+  /**
+   * @brief       Check the input is already bound with the same buffer, length and type
+   * @param[in]   index   Input index
+   * @param[in]   type    Operand type passed to set input, or @c nullptr
+   * @param[in]   buffer  Buffer passed to set input
+   * @param[in]   length  Length passed to set input
+   * @return      @c true if bound with the same ones, otherwise @c false
+   * @note        The binding is kept across computes and has been validated already, so setting
+   *              it again for the next compute can be skipped
+   */
+  bool isInputBound(int32_t index, const ANeuralNetworksOperandType *type, const void *buffer,
+                    size_t length) const noexcept;
+  /**
+   * @brief       Check the output is already bound with the same buffer, length and type
+   * @param[in]   index   Output index
+   * @param[in]   type    Operand type passed to set output, or @c nullptr
+   * @param[in]   buffer  Buffer passed to set output
+   * @param[in]   length  Length passed to set output
+   * @return      @c true if bound with the same ones, otherwise @c false
+   */
+  bool isOutputBound(int32_t index, const ANeuralNetworksOperandType *type, const void *buffer,
+                     size_t length) const noexcept;
 
   /**
    * @brief       Get output operand's rank
@@ -68,7 +98,27 @@ public:
   bool getOutputOperandDimensions(uint32_t index, uint32_t *dimensions);
 
 private:
+  // Arguments of the last successful set input or output
+  struct Binding
+  {
+    const void *buffer = nullptr;
+    size_t length = 0;
+    bool has_type = false;
+    int32_t type = 0;
+    std::vector<uint32_t> dims;
+    float scale = 0.0f;
+    int32_t zero_point = 0;
+
+    bool matches(const ANeuralNetworksOperandType *type, const void *buffer,
+                 size_t length) const noexcept;
+    void assign(const ANeuralNetworksOperandType *type, const void *buffer, size_t length);
+  };
+
+private:
+  const std::shared_ptr<onert::exec::ExecutorMap> _executors;
   std::shared_ptr<onert::exec::Execution> _execution;
+  std::vector<Binding> _input_bindings;
+  std::vector<Binding> _output_bindings;
 };
 
 #endif
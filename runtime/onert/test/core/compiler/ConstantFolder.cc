@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <compiler/ConstantFolder.h>
+#include "TestUtils.h"
+
+#include <ir/Graph.h>
+#include <ir/operation/Add.h>
+#include <ir/operation/Cast.h>
+#include <ir/operation/Concat.h>
+#include <ir/operation/Pack.h>
+#include <ir/operation/StridedSlice.h>
+#include <ir/operation/Transpose.h>
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace
+{
+using namespace onert;
+using namespace ir;
+using onert_test::compiler::addConstant;
+
+const TypeInfo float_type{DataType::FLOAT32};
+const TypeInfo int32_type{DataType::INT32};
+const TypeInfo uint8_type{DataType::QUANT_UINT8_ASYMM};
+
+// Make the operand used by a non-constant operation so that it stays in the graph
+void addConsumer(Graph &graph, const OperandIndex &operand)
+{
+  const auto &obj = graph.operands().at(operand);
+  auto input = graph.addOperand(obj.shape(), obj.typeInfo());
+  auto output = graph.addOperand(obj.shape(), obj.typeInfo());
+  operation::Add::Param param;
+  param.activation = Activation::NONE;
+  graph.addOperation(std::make_unique<operation::Add>(OperandIndexSequence{input, operand},
+                                                      OperandIndexSequence{output}, param));
+  graph.addInput(input);
+  graph.addOutput(output);
+}
+
+uint32_t countOperations(const Graph &graph)
+{
+  uint32_t count = 0;
+  graph.operations().iterate([&](const OperationIndex &, const Operation &) { count++; });
+  return count;
+}
+
+} // namespace
+
+TEST(compiler_ConstantFolder, transpose_cast)
+{
+  Graph graph;
+  auto weights = addConstant<float>(graph, Shape{2, 3}, float_type,
+                                    {1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f});
+  auto transposed = graph.addOperand(Shape{3, 2}, float_type);
+  auto casted = graph.addOperand(Shape{3, 2}, int32_type);
+
+  operation::Transpose::Param param;
+  param.perm = {1, 0};
+  graph.addOperation(std::make_unique<operation::Transpose>(
+      OperandIndexSequence{weights}, OperandIndexSequence{transposed}, param));
+  graph.addOperation(std::make_unique<operation::Cast>(OperandIndexSequence{transposed},
+                                                       OperandIndexSequence{casted}));
+  addConsumer(graph, casted);
+  graph.finishBuilding();
+
+  ASSERT_EQ(compiler::ConstantFolder{graph}.run(), 2);
+  ASSERT_EQ(countOperations(graph), 1);
+  ASSERT_FALSE(graph.operands().exist(weights));
+  ASSERT_FALSE(graph.operands().exist(transposed));
+
+  const auto &result = graph.operands().at(casted);
+  ASSERT_TRUE(result.isConstant());
+  ASSERT_EQ(result.shape(), (Shape{3, 2}));
+  ASSERT_EQ(result.asVector<int32_t>(), (std::vector<int32_t>{1, 4, 2, 5, 3, 6}));
+}
+
+TEST(compiler_ConstantFolder, strided_slice_pack)
+{
+  Graph graph;
+  auto dims = addConstant<int32_t>(graph, Shape{4}, int32_type, {1, 224, 224, 3});
+  auto begin = addConstant<int32_t>(graph, Shape{1}, int32_type, {1});
+  auto end = addConstant<int32_t>(graph, Shape{1}, int32_type, {3});
+  auto strides = addConstant<int32_t>(graph, Shape{1}, int32_type, {1});
+  auto height_width = graph.addOperand(Shape{2}, int32_type);
+  auto channels = addConstant<int32_t>(graph, Shape{2}, int32_type, {8, 16});
+  auto packed = graph.addOperand(Shape{2, 2}, int32_type);
+
+  operation::StridedSlice::Param slice_param;
+  slice_param.begin_mask = 0;
+  slice_param.end_mask = 0;
+  slice_param.shrink_axis_mask = 0;
+  graph.addOperation(std::make_unique<operation::StridedSlice>(
+      OperandIndexSequence{dims, begin, end, strides}, OperandIndexSequence{height_width},
+      slice_param));
+  operation::Pack::Param pack_param;
+  pack_param.num = 2;
+  pack_param.axis = 1;
+  graph.addOperation(std::make_unique<operation::Pack>(
+      OperandIndexSequence{height_width, channels}, OperandIndexSequence{packed}, pack_param));
+  addConsumer(graph, packed);
+  graph.finishBuilding();
+
+  ASSERT_EQ(compiler::ConstantFolder{graph}.run(), 2);
+  ASSERT_EQ(countOperations(graph), 1);
+
+  const auto &result = graph.operands().at(packed);
+  ASSERT_EQ(result.shape(), (Shape{2, 2}));
+  ASSERT_EQ(result.asVector<int32_t>(), (std::vector<int32_t>{224, 8, 224, 16}));
+}
+
+TEST(compiler_ConstantFolder, concat)
+{
+  Graph graph;
+  auto lhs = addConstant<uint8_t>(graph, Shape{1, 2}, uint8_type, {1, 2});
+  auto rhs = addConstant<uint8_t>(graph, Shape{1, 2}, uint8_type, {3, 4});
+  auto concat = graph.addOperand(Shape{2, 2}, uint8_type);
+
+  operation::Concat::Param param;
+  param.axis = 0;
+  graph.addOperation(std::make_unique<operation::Concat>(OperandIndexSequence{lhs, rhs},
+                                                         OperandIndexSequence{concat}, param));
+  addConsumer(graph, concat);
+  graph.finishBuilding();
+
+  ASSERT_EQ(compiler::ConstantFolder{graph}.run(), 1);
+
+  const auto &result = graph.operands().at(concat);
+  ASSERT_TRUE(result.isConstant());
+  ASSERT_EQ(result.shape(), (Shape{2, 2}));
+  ASSERT_EQ(result.asVector<uint8_t>(), (std::vector<uint8_t>{1, 2, 3, 4}));
+}
+
+TEST(compiler_ConstantFolder, neg_concat_different_quantization)
+{
+  // Same data type, but inputs and the output are quantized differently
+  for (const auto &output_type : {TypeInfo{DataType::QUANT_UINT8_ASYMM, 0.5f, 0},
+                                  TypeInfo{DataType::QUANT_UINT8_ASYMM, 1.0f, 128}})
+  {
+    Graph graph;
+    auto lhs = addConstant<uint8_t>(graph, Shape{1, 2}, uint8_type, {1, 2});
+    const TypeInfo rhs_type{DataType::QUANT_UINT8_ASYMM, 0.5f, 0};
+    auto rhs = addConstant<uint8_t>(graph, Shape{1, 2}, rhs_type, {3, 4});
+    auto concat = graph.addOperand(Shape{2, 2}, output_type);
+
+    operation::Concat::Param param;
+    param.axis = 0;
+    graph.addOperation(std::make_unique<operation::Concat>(OperandIndexSequence{lhs, rhs},
+                                                           OperandIndexSequence{concat}, param));
+    addConsumer(graph, concat);
+    graph.finishBuilding();
+
+    ASSERT_EQ(compiler::ConstantFolder{graph}.run(), 0);
+    ASSERT_EQ(countOperations(graph), 2);
+    ASSERT_FALSE(graph.operands().at(concat).isConstant());
+  }
+}
+
+TEST(compiler_ConstantFolder, neg_sparse_input)
+{
+  // [[1 2 0 0]
+  //  [0 0 3 4]] with block_size {1, 2}
+  TypeInfo sparse_type{DataType::FLOAT32};
+  sparse_type.sparsity(std::make_shared<Sparsity>(std::vector<int32_t>{0, 1, 2},
+                                                  std::vector<int32_t>{0, 1},
+                                                  std::vector<int32_t>{1, 2}));
+  Graph graph;
+  auto weights = addConstant<float>(graph, Shape{2, 4}, sparse_type, {1.0f, 2.0f, 3.0f, 4.0f});
+  auto transposed = graph.addOperand(Shape{4, 2}, float_type);
+
+  operation::Transpose::Param param;
+  param.perm = {1, 0};
+  graph.addOperation(std::make_unique<operation::Transpose>(
+      OperandIndexSequence{weights}, OperandIndexSequence{transposed}, param));
+  addConsumer(graph, transposed);
+  graph.finishBuilding();
+
+  ASSERT_EQ(compiler::ConstantFolder{graph}.run(), 0);
+  ASSERT_EQ(countOperations(graph), 2);
+  ASSERT_FALSE(graph.operands().at(transposed).isConstant());
+}
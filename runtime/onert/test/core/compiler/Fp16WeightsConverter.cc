@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <compiler/Fp16WeightsConverter.h>
+#include "TestUtils.h"
+
+#include <ir/Graph.h>
+#include <ir/operation/Add.h>
+#include <ir/operation/BatchMatMul.h>
+#include <ir/operation/Conv2D.h>
+#include <ir/operation/FullyConnected.h>
+#include <ir/operation/Gather.h>
+
+#include <Half.h>
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace
+{
+using namespace onert;
+using namespace ir;
+using onert_test::compiler::addConstant;
+
+const TypeInfo float_type{DataType::FLOAT32};
+
+// Input[2,3] -> FullyConnected(4 units) -> Output[2,4]
+OperationIndex addFullyConnected(Graph &graph, const OperandIndex &weights)
+{
+  auto input = graph.addOperand(Shape{2, 3}, float_type);
+  auto output = graph.addOperand(Shape{2, 4}, float_type);
+  operation::FullyConnected::Param param;
+  param.activation = Activation::NONE;
+  auto index = graph.addOperation(std::make_unique<operation::FullyConnected>(
+      OperandIndexSequence{input, weights, OperandIndex{}}, OperandIndexSequence{output}, param));
+  graph.addInput(input);
+  graph.addOutput(output);
+  return index;
+}
+
+// Input[1,3,3,2] -> Conv2D(4 filters of kernel_size x kernel_size) -> Output[1,3,3,4]
+void addConv2D(Graph &graph, const OperandIndex &kernel, const OperandIndex &bias)
+{
+  auto input = graph.addOperand(Shape{1, 3, 3, 2}, float_type);
+  auto output = graph.addOperand(Shape{1, 3, 3, 4}, float_type);
+  operation::Conv2D::Param param;
+  param.padding.type = PaddingType::SAME;
+  param.stride.horizontal = 1;
+  param.stride.vertical = 1;
+  param.activation = Activation::NONE;
+  graph.addOperation(std::make_unique<operation::Conv2D>(
+      OperandIndexSequence{input, kernel, bias}, OperandIndexSequence{output}, param));
+  graph.addInput(input);
+  graph.addOutput(output);
+}
+
+std::vector<float> makeValues(size_t size)
+{
+  std::vector<float> values(size);
+  for (size_t i = 0; i < size; ++i)
+    values[i] = 0.1f * i - 1.f;
+  return values;
+}
+
+} // namespace
+
+TEST(compiler_Fp16WeightsConverter, convert_weights)
+{
+  Graph graph;
+  const auto values = makeValues(12);
+  auto fc_weights = addConstant(graph, Shape{4, 3}, values);
+  addFullyConnected(graph, fc_weights);
+
+  auto table = addConstant(graph, Shape{4, 3}, values);
+  auto indices = graph.addOperand(Shape{2}, TypeInfo{DataType::INT32});
+  auto gathered = graph.addOperand(Shape{2, 3}, float_type);
+  operation::Gather::Param gather_param;
+  gather_param.axis = 0;
+  graph.addOperation(std::make_unique<operation::Gather>(
+      OperandIndexSequence{table, indices}, OperandIndexSequence{gathered}, gather_param));
+  graph.addInput(indices);
+  graph.addOutput(gathered);
+  graph.finishBuilding();
+
+  compiler::Fp16WeightsConverter converter{graph, [](const OperationIndex &) { return true; }};
+  ASSERT_EQ(converter.run(), 2);
+
+  for (const auto &index : {fc_weights, table})
+  {
+    const auto &operand = graph.operands().at(index);
+    ASSERT_EQ(operand.typeInfo().type(), DataType::FLOAT16);
+    ASSERT_EQ(operand.data()->size(), values.size() * sizeof(Half));
+    const auto *halves = reinterpret_cast<const Half *>(operand.data()->base());
+    for (size_t i = 0; i < values.size(); ++i)
+      ASSERT_EQ(static_cast<float>(halves[i]), static_cast<float>(static_cast<Half>(values[i])));
+  }
+}
+
+TEST(compiler_Fp16WeightsConverter, convert_1x1_conv_only)
+{
+  Graph graph;
+  auto kernel_1x1 = addConstant(graph, Shape{4, 1, 1, 2}, makeValues(8));
+  auto bias_1x1 = addConstant(graph, Shape{4}, makeValues(4));
+  addConv2D(graph, kernel_1x1, bias_1x1);
+  auto kernel_3x3 = addConstant(graph, Shape{4, 3, 3, 2}, makeValues(72));
+  auto bias_3x3 = addConstant(graph, Shape{4}, makeValues(4));
+  addConv2D(graph, kernel_3x3, bias_3x3);
+  graph.finishBuilding();
+
+  compiler::Fp16WeightsConverter converter{graph, [](const OperationIndex &) { return true; }};
+  ASSERT_EQ(converter.run(), 1);
+
+  ASSERT_EQ(graph.operands().at(kernel_1x1).typeInfo().type(), DataType::FLOAT16);
+  ASSERT_EQ(graph.operands().at(bias_1x1).typeInfo().type(), DataType::FLOAT32);
+  ASSERT_EQ(graph.operands().at(kernel_3x3).typeInfo().type(), DataType::FLOAT32);
+  ASSERT_EQ(graph.operands().at(bias_3x3).typeInfo().type(), DataType::FLOAT32);
+}
+
+TEST(compiler_Fp16WeightsConverter, neg_unsupported_backend)
+{
+  Graph graph;
+  auto weights = addConstant(graph, Shape{4, 3}, makeValues(12));
+  auto fc = addFullyConnected(graph, weights);
+  auto other_weights = addConstant(graph, Shape{4, 3}, makeValues(12));
+  addFullyConnected(graph, other_weights);
+  graph.finishBuilding();
+
+  // Only the operation fc runs on a backend taking fp16 weights
+  compiler::Fp16WeightsConverter converter{
+      graph, [&](const OperationIndex &index) { return index == fc; }};
+  ASSERT_EQ(converter.run(), 1);
+
+  ASSERT_EQ(graph.operands().at(weights).typeInfo().type(), DataType::FLOAT16);
+  ASSERT_EQ(graph.operands().at(other_weights).typeInfo().type(), DataType::FLOAT32);
+}
+
+TEST(compiler_Fp16WeightsConverter, neg_unsupported_use)
+{
+  Graph graph;
+
+  // Weights used by Add as well
+  auto shared = addConstant(graph, Shape{4, 3}, makeValues(12));
+  addFullyConnected(graph, shared);
+  auto add_input = graph.addOperand(Shape{4, 3}, float_type);
+  auto add_output = graph.addOperand(Shape{4, 3}, float_type);
+  operation::Add::Param add_param;
+  add_param.activation = Activation::NONE;
+  graph.addOperation(std::make_unique<operation::Add>(
+      OperandIndexSequence{add_input, shared}, OperandIndexSequence{add_output}, add_param));
+  graph.addInput(add_input);
+  graph.addOutput(add_output);
+
+  // rhs of BatchMatMul with adj_y is used without transposition
+  auto rhs = addConstant(graph, Shape{4, 3}, makeValues(12));
+  auto lhs = graph.addOperand(Shape{2, 3}, float_type);
+  auto bmm_output = graph.addOperand(Shape{2, 4}, float_type);
+  operation::BatchMatMul::Param bmm_param;
+  bmm_param.adj_x = false;
+  bmm_param.adj_y = true;
+  graph.addOperation(std::make_unique<operation::BatchMatMul>(
+      OperandIndexSequence{lhs, rhs}, OperandIndexSequence{bmm_output}, bmm_param));
+  graph.addInput(lhs);
+  graph.addOutput(bmm_output);
+  graph.finishBuilding();
+
+  compiler::Fp16WeightsConverter converter{graph, [](const OperationIndex &) { return true; }};
+  ASSERT_EQ(converter.run(), 0);
+
+  ASSERT_EQ(graph.operands().at(shared).typeInfo().type(), DataType::FLOAT32);
+  ASSERT_EQ(graph.operands().at(rhs).typeInfo().type(), DataType::FLOAT32);
+}
@@ -0,0 +1,353 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <compiler/OperationFuser.h>
+#include "TestUtils.h"
+
+#include <ir/Graph.h>
+#include <ir/operation/Add.h>
+#include <ir/operation/Conv2D.h>
+#include <ir/operation/DepthwiseConv2D.h>
+#include <ir/operation/FullyConnected.h>
+#include <ir/operation/Mul.h>
+#include <ir/operation/Pad.h>
+#include <ir/operation/ReLU.h>
+#include <ir/operation/Transpose.h>
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace
+{
+using namespace onert;
+using namespace ir;
+using onert_test::compiler::addConstant;
+
+const TypeInfo float_type{DataType::FLOAT32};
+const TypeInfo int32_type{DataType::INT32};
+
+// Input[1,3,3,1] -> Conv2D(2 filters of 1x1) -> Intermediate[1,3,3,2]
+OperandIndex addConv2D(Graph &graph, const OperandIndex &input, const OperandIndex &output)
+{
+  auto kernel = addConstant(graph, Shape{2, 1, 1, 1}, {1.0f, 2.0f});
+  auto bias = addConstant(graph, Shape{2}, {0.5f, -0.5f});
+
+  operation::Conv2D::Param param;
+  param.padding.type = PaddingType::VALID;
+  param.stride.horizontal = 1;
+  param.stride.vertical = 1;
+  param.activation = Activation::NONE;
+  graph.addOperation(std::make_unique<operation::Conv2D>(
+      OperandIndexSequence{input, kernel, bias}, OperandIndexSequence{output}, param));
+  return kernel;
+}
+
+// Input[1,2,2,1] -> Pad(H/W by 1) -> Padded[1,4,4,1] -> Conv2D(3x3, given padding) -> Output
+void addPadConv2D(Graph &graph, const OperandIndex &input, const OperandIndex &padded,
+                  const OperandIndex &output, const Padding &padding)
+{
+  const std::vector<int32_t> pad_values{0, 0, 1, 1, 1, 1, 0, 0};
+  auto pads = addConstant(graph, Shape{4, 2}, int32_type, pad_values);
+  graph.addOperation(std::make_unique<operation::Pad>(OperandIndexSequence{input, pads},
+                                                      OperandIndexSequence{padded}));
+
+  auto kernel = addConstant(graph, Shape{1, 3, 3, 1}, std::vector<float>(9, 1.0f));
+  auto bias = addConstant(graph, Shape{1}, {0.0f});
+  operation::Conv2D::Param param;
+  param.padding = padding;
+  param.stride.horizontal = 1;
+  param.stride.vertical = 1;
+  param.activation = Activation::NONE;
+  graph.addOperation(std::make_unique<operation::Conv2D>(
+      OperandIndexSequence{padded, kernel, bias}, OperandIndexSequence{output}, param));
+}
+
+uint32_t countOperations(const Graph &graph)
+{
+  uint32_t count = 0;
+  graph.operations().iterate([&](const OperationIndex &, const Operation &) { count++; });
+  return count;
+}
+
+const Operation &getOnlyOperation(const Graph &graph)
+{
+  const Operation *result = nullptr;
+  uint32_t count = 0;
+  graph.operations().iterate([&](const OperationIndex &, const Operation &op) {
+    result = &op;
+    count++;
+  });
+  EXPECT_EQ(count, 1);
+  return *result;
+}
+
+} // namespace
+
+TEST(compiler_OperationFuser, fuse_activation)
+{
+  Graph graph;
+  auto input = graph.addOperand(Shape{1, 3, 3, 1}, float_type);
+  auto conv_output = graph.addOperand(Shape{1, 3, 3, 2}, float_type);
+  auto output = graph.addOperand(Shape{1, 3, 3, 2}, float_type);
+  addConv2D(graph, input, conv_output);
+  graph.addOperation(std::make_unique<operation::ReLU>(OperandIndexSequence{conv_output},
+                                                       OperandIndexSequence{output}));
+  graph.addInput(input);
+  graph.addOutput(output);
+  graph.finishBuilding();
+
+  compiler::OperationFuser fuser{graph};
+  fuser.run();
+
+  const auto &op = getOnlyOperation(graph);
+  ASSERT_EQ(op.opcode(), OpCode::Conv2D);
+  ASSERT_EQ(static_cast<const operation::Conv2D &>(op).param().activation, Activation::RELU);
+  ASSERT_EQ(op.getOutputs().at(0), output);
+  ASSERT_FALSE(graph.operands().exist(conv_output));
+  ASSERT_EQ(fuser.report().at("Op+Activation"), 1);
+}
+
+TEST(compiler_OperationFuser, fold_mul_into_conv)
+{
+  Graph graph;
+  auto input = graph.addOperand(Shape{1, 3, 3, 1}, float_type);
+  auto conv_output = graph.addOperand(Shape{1, 3, 3, 2}, float_type);
+  auto output = graph.addOperand(Shape{1, 3, 3, 2}, float_type);
+  addConv2D(graph, input, conv_output);
+  auto scale = addConstant(graph, Shape{1, 1, 1, 2}, {3.0f, 4.0f});
+  operation::Mul::Param param;
+  param.activation = Activation::RELU6;
+  graph.addOperation(std::make_unique<operation::Mul>(OperandIndexSequence{conv_output, scale},
+                                                      OperandIndexSequence{output}, param));
+  graph.addInput(input);
+  graph.addOutput(output);
+  graph.finishBuilding();
+
+  compiler::OperationFuser fuser{graph};
+  fuser.run();
+
+  const auto &op = getOnlyOperation(graph);
+  ASSERT_EQ(op.opcode(), OpCode::Conv2D);
+  ASSERT_EQ(static_cast<const operation::Conv2D &>(op).param().activation, Activation::RELU6);
+  const auto kernel =
+      graph.operands().at(op.getInputs().at(operation::Conv2D::KERNEL)).asVector<float>();
+  const auto bias =
+      graph.operands().at(op.getInputs().at(operation::Conv2D::BIAS)).asVector<float>();
+  ASSERT_EQ(kernel, (std::vector<float>{3.0f, 8.0f}));
+  ASSERT_EQ(bias, (std::vector<float>{1.5f, -2.0f}));
+  ASSERT_EQ(fuser.report().at("Conv+Mul(scale)"), 1);
+}
+
+TEST(compiler_OperationFuser, cancel_transposes)
+{
+  Graph graph;
+  auto input = graph.addOperand(Shape{1, 2, 3, 4}, float_type);
+  auto nchw = graph.addOperand(Shape{1, 4, 2, 3}, float_type);
+  auto nhwc = graph.addOperand(Shape{1, 2, 3, 4}, float_type);
+  auto output = graph.addOperand(Shape{1, 2, 3, 4}, float_type);
+
+  operation::Transpose::Param to_nchw;
+  to_nchw.perm = {0, 3, 1, 2};
+  operation::Transpose::Param to_nhwc;
+  to_nhwc.perm = {0, 2, 3, 1};
+  graph.addOperation(std::make_unique<operation::Transpose>(OperandIndexSequence{input},
+                                                            OperandIndexSequence{nchw}, to_nchw));
+  graph.addOperation(std::make_unique<operation::Transpose>(OperandIndexSequence{nchw},
+                                                            OperandIndexSequence{nhwc}, to_nhwc));
+  graph.addOperation(std::make_unique<operation::ReLU>(OperandIndexSequence{nhwc},
+                                                       OperandIndexSequence{output}));
+  graph.addInput(input);
+  graph.addOutput(output);
+  graph.finishBuilding();
+
+  compiler::OperationFuser fuser{graph};
+  fuser.run();
+
+  const auto &op = getOnlyOperation(graph);
+  ASSERT_EQ(op.opcode(), OpCode::ReLU);
+  ASSERT_EQ(op.getInputs().at(0), input);
+  ASSERT_TRUE(graph.operands().at(input).getUses().contains(
+      *graph.operands().at(output).getDef().begin()));
+  ASSERT_EQ(fuser.report().at("Transpose+Transpose"), 1);
+}
+
+TEST(compiler_OperationFuser, neg_sparse_weights)
+{
+  // Weights [[1 0] [0 2]] in the sparse format without blocks
+  TypeInfo sparse_type{DataType::FLOAT32};
+  sparse_type.sparsity(std::make_shared<Sparsity>(
+      std::vector<int32_t>{0, 1, 2}, std::vector<int32_t>{0, 1}, std::vector<int32_t>{1, 1}));
+
+  Graph graph;
+  auto input = graph.addOperand(Shape{1, 2}, float_type);
+  const std::vector<float> weights_values{1.0f, 2.0f};
+  auto weights = addConstant(graph, Shape{2, 2}, sparse_type, weights_values);
+  auto bias = addConstant(graph, Shape{2}, {0.5f, -0.5f});
+  auto fc_output = graph.addOperand(Shape{1, 2}, float_type);
+  auto output = graph.addOperand(Shape{1, 2}, float_type);
+
+  operation::FullyConnected::Param fc_param;
+  fc_param.activation = Activation::NONE;
+  graph.addOperation(std::make_unique<operation::FullyConnected>(
+      OperandIndexSequence{input, weights, bias}, OperandIndexSequence{fc_output}, fc_param));
+  auto scale = addConstant(graph, Shape{1, 2}, {3.0f, 4.0f});
+  operation::Mul::Param mul_param;
+  mul_param.activation = Activation::NONE;
+  graph.addOperation(std::make_unique<operation::Mul>(OperandIndexSequence{fc_output, scale},
+                                                      OperandIndexSequence{output}, mul_param));
+  graph.addInput(input);
+  graph.addOutput(output);
+  graph.finishBuilding();
+
+  compiler::OperationFuser fuser{graph};
+  fuser.run();
+
+  // Compressed weights are not scaled, and Mul is kept
+  uint32_t count = 0;
+  graph.operations().iterate([&](const OperationIndex &, const Operation &) { count++; });
+  ASSERT_EQ(count, 2);
+  ASSERT_TRUE(graph.operands().exist(fc_output));
+  ASSERT_EQ(graph.operands().at(weights).asVector<float>(), weights_values);
+  ASSERT_EQ(fuser.report().count("Conv+Mul(scale)"), 0);
+}
+
+TEST(compiler_OperationFuser, merge_pad_into_conv)
+{
+  Graph graph;
+  auto input = graph.addOperand(Shape{1, 2, 2, 1}, float_type);
+  auto padded = graph.addOperand(Shape{1, 4, 4, 1}, float_type);
+  auto output = graph.addOperand(Shape{1, 2, 2, 1}, float_type);
+  addPadConv2D(graph, input, padded, output, Padding{PaddingType::VALID});
+  graph.addInput(input);
+  graph.addOutput(output);
+  graph.finishBuilding();
+
+  compiler::OperationFuser fuser{graph};
+  fuser.run();
+
+  const auto &op = getOnlyOperation(graph);
+  ASSERT_EQ(op.opcode(), OpCode::Conv2D);
+  ASSERT_EQ(op.getInputs().at(operation::Conv2D::INPUT), input);
+  const auto &padding = static_cast<const operation::Conv2D &>(op).param().padding;
+  ASSERT_EQ(padding.type, PaddingType::EXPLICIT);
+  ASSERT_EQ(padding.param.left, 1u);
+  ASSERT_EQ(padding.param.right, 1u);
+  ASSERT_EQ(padding.param.top, 1u);
+  ASSERT_EQ(padding.param.bottom, 1u);
+  ASSERT_FALSE(graph.operands().exist(padded));
+  ASSERT_EQ(fuser.report().at("Pad+Conv"), 1);
+}
+
+TEST(compiler_OperationFuser, neg_pad_into_same_conv)
+{
+  Graph graph;
+  auto input = graph.addOperand(Shape{1, 2, 2, 1}, float_type);
+  auto padded = graph.addOperand(Shape{1, 4, 4, 1}, float_type);
+  auto output = graph.addOperand(Shape{1, 4, 4, 1}, float_type);
+  addPadConv2D(graph, input, padded, output, Padding{PaddingType::SAME});
+  graph.addInput(input);
+  graph.addOutput(output);
+  graph.finishBuilding();
+
+  compiler::OperationFuser fuser{graph};
+  fuser.run();
+
+  // SAME padding depends on the input shape, which the fusion would change
+  ASSERT_EQ(countOperations(graph), 2);
+  ASSERT_TRUE(graph.operands().exist(padded));
+  ASSERT_EQ(fuser.report().count("Pad+Conv"), 0);
+}
+
+TEST(compiler_OperationFuser, fold_add_into_fully_connected)
+{
+  Graph graph;
+  auto input = graph.addOperand(Shape{1, 2}, float_type);
+  auto weights = addConstant(graph, Shape{2, 2}, {1.0f, 2.0f, 3.0f, 4.0f});
+  auto fc_output = graph.addOperand(Shape{1, 2}, float_type);
+  auto output = graph.addOperand(Shape{1, 2}, float_type);
+
+  // FullyConnected without bias
+  operation::FullyConnected::Param fc_param;
+  fc_param.activation = Activation::NONE;
+  graph.addOperation(std::make_unique<operation::FullyConnected>(
+      OperandIndexSequence{input, weights}, OperandIndexSequence{fc_output}, fc_param));
+  auto shift = addConstant(graph, Shape{2}, {0.25f, -0.75f});
+  operation::Add::Param add_param;
+  add_param.activation = Activation::RELU;
+  graph.addOperation(std::make_unique<operation::Add>(OperandIndexSequence{shift, fc_output},
+                                                      OperandIndexSequence{output}, add_param));
+  graph.addInput(input);
+  graph.addOutput(output);
+  graph.finishBuilding();
+
+  compiler::OperationFuser fuser{graph};
+  fuser.run();
+
+  const auto &op = getOnlyOperation(graph);
+  ASSERT_EQ(op.opcode(), OpCode::FullyConnected);
+  ASSERT_EQ(static_cast<const operation::FullyConnected &>(op).param().activation,
+            Activation::RELU);
+  ASSERT_EQ(op.getInputs().at(operation::FullyConnected::WEIGHT), weights);
+  const auto bias =
+      graph.operands().at(op.getInputs().at(operation::FullyConnected::BIAS)).asVector<float>();
+  ASSERT_EQ(bias, (std::vector<float>{0.25f, -0.75f}));
+  ASSERT_EQ(op.getOutputs().at(0), output);
+  ASSERT_EQ(fuser.report().at("Conv+Add(bias)"), 1);
+}
+
+TEST(compiler_OperationFuser, fold_mul_into_depthwise_conv)
+{
+  Graph graph;
+  auto input = graph.addOperand(Shape{1, 2, 2, 2}, float_type);
+  auto conv_output = graph.addOperand(Shape{1, 1, 1, 2}, float_type);
+  auto output = graph.addOperand(Shape{1, 1, 1, 2}, float_type);
+
+  // Channels are the last axis of the depthwise kernel
+  auto kernel = addConstant(graph, Shape{1, 2, 2, 2}, {1.0f, 2.0f, 3.0f, 4.0f, //
+                                                       5.0f, 6.0f, 7.0f, 8.0f});
+  auto bias = addConstant(graph, Shape{2}, {1.0f, 1.0f});
+  operation::DepthwiseConv2D::Param conv_param;
+  conv_param.padding.type = PaddingType::VALID;
+  conv_param.stride.horizontal = 1;
+  conv_param.stride.vertical = 1;
+  conv_param.multiplier = 1;
+  conv_param.activation = Activation::NONE;
+  graph.addOperation(std::make_unique<operation::DepthwiseConv2D>(
+      OperandIndexSequence{input, kernel, bias}, OperandIndexSequence{conv_output}, conv_param));
+  auto scale = addConstant(graph, Shape{2}, {2.0f, -1.0f});
+  operation::Mul::Param mul_param;
+  mul_param.activation = Activation::NONE;
+  graph.addOperation(std::make_unique<operation::Mul>(OperandIndexSequence{conv_output, scale},
+                                                      OperandIndexSequence{output}, mul_param));
+  graph.addInput(input);
+  graph.addOutput(output);
+  graph.finishBuilding();
+
+  compiler::OperationFuser fuser{graph};
+  fuser.run();
+
+  const auto &op = getOnlyOperation(graph);
+  ASSERT_EQ(op.opcode(), OpCode::DepthwiseConv2D);
+  const auto new_kernel =
+      graph.operands().at(op.getInputs().at(operation::DepthwiseConv2D::KERNEL)).asVector<float>();
+  const auto new_bias =
+      graph.operands().at(op.getInputs().at(operation::DepthwiseConv2D::BIAS)).asVector<float>();
+  ASSERT_EQ(new_kernel, (std::vector<float>{2.0f, -2.0f, 6.0f, -4.0f, 10.0f, -6.0f, 14.0f, -8.0f}));
+  ASSERT_EQ(new_bias, (std::vector<float>{2.0f, -1.0f}));
+  ASSERT_FALSE(graph.operands().exist(kernel));
+  ASSERT_EQ(fuser.report().at("Conv+Mul(scale)"), 1);
+}
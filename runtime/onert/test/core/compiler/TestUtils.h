@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_TEST_CORE_COMPILER_TEST_UTILS_H__
+#define __ONERT_TEST_CORE_COMPILER_TEST_UTILS_H__
+
+#include "ir/Graph.h"
+
+#include <memory>
+#include <vector>
+
+namespace onert_test
+{
+namespace compiler
+{
+
+/**
+ * @brief Add a constant operand of @p type, with @p values as its data
+ */
+template <typename T>
+onert::ir::OperandIndex addConstant(onert::ir::Graph &graph, const onert::ir::Shape &shape,
+                                    const onert::ir::TypeInfo &type, const std::vector<T> &values)
+{
+  auto index = graph.addOperand(shape, type);
+  graph.setOperandValue(index, std::make_shared<onert::ir::CachedData>(
+                                   reinterpret_cast<const uint8_t *>(values.data()),
+                                   values.size() * sizeof(T)));
+  return index;
+}
+
+/**
+ * @brief Add a float32 constant operand
+ */
+inline onert::ir::OperandIndex addConstant(onert::ir::Graph &graph, const onert::ir::Shape &shape,
+                                           const std::vector<float> &values)
+{
+  return addConstant<float>(graph, shape, onert::ir::TypeInfo{onert::ir::DataType::FLOAT32},
+                            values);
+}
+
+} // namespace compiler
+} // namespace onert_test
+
+#endif // __ONERT_TEST_CORE_COMPILER_TEST_UTILS_H__
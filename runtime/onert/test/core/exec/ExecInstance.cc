@@ -15,6 +15,9 @@
  */
 
 #include <gtest/gtest.h>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
 #include <thread>
 
 #include "ir/Graph.h"
@@ -290,4 +293,202 @@ TEST(ExecInstance, async)
   }
 }
 
+// Output shapes of asynchronous execution are available after waitFinish
+TEST(ExecInstance, async_dynamic_shape)
+{
+  auto mockup = CompiledMockUpModel();
+  auto executors = mockup.executors;
+
+  auto input1 = IOIndex{0};
+  auto input2 = IOIndex{1};
+  auto output = IOIndex{0};
+
+  // rhs2 {1, 2, 2, 1} is broadcasted to the new input shape {2, 2, 2, 1}
+  const Shape new_shape{2, 2, 2, 1};
+  const float input1_buffer[8] = {1, 0, -1, -2, 2, 1, -2, 0};
+  const float input2_buffer[8] = {1, -3, 2, -4, -3, 3, 1, 2};
+  float output_buffer[8] = {};
+  const float output_expected[8] = {5, -2, 0, -1, 2, 5, -2, 7};
+
+  onert::exec::Execution execution{executors};
+
+  execution.changeInputShape(input1, new_shape);
+  execution.changeInputShape(input2, new_shape);
+  execution.setInput(input1, reinterpret_cast<const void *>(input1_buffer), 32);
+  execution.setInput(input2, reinterpret_cast<const void *>(input2_buffer), 32);
+  execution.setOutput(output, reinterpret_cast<void *>(output_buffer), 32);
+  execution.startExecute();
+  execution.waitFinish();
+
+  EXPECT_EQ(execution.getOutputShape(output), new_shape);
+  for (auto i = 0; i < 8; i++)
+  {
+    EXPECT_EQ(output_buffer[i], output_expected[i]);
+  }
+}
+
+// Support multiple outstanding requests
+TEST(ExecInstance, submit)
+{
+  auto mockup = CompiledMockUpModel();
+  auto executors = mockup.executors;
+
+  auto input1 = IOIndex{0};
+  auto input2 = IOIndex{1};
+  auto output = IOIndex{0};
+
+  const float input1_buffer[2][4] = {{1, 0, -1, -2}, {2, 1, -2, 0}};
+  const float input2_buffer[2][4] = {{1, -3, 2, -4}, {-3, 3, 1, 2}};
+  float output_buffer[2][4] = {};
+  const float output_expected[2][4] = {{5, -2, 0, -1}, {2, 5, -2, 7}};
+
+  onert::exec::Execution execution{executors};
+
+  std::atomic<uint32_t> num_done{0};
+  auto completion = [&](uint64_t, onert::exec::Execution::RequestResult result) {
+    if (result == onert::exec::Execution::RequestResult::DONE)
+      num_done++;
+  };
+
+  // Buffers can be set for the next request right after submit
+  for (auto i = 0; i < 2; i++)
+  {
+    execution.setInput(input1, reinterpret_cast<const void *>(input1_buffer[i]), 16);
+    execution.setInput(input2, reinterpret_cast<const void *>(input2_buffer[i]), 16);
+    execution.setOutput(output, reinterpret_cast<void *>(output_buffer[i]), 16);
+    execution.submit(completion);
+  }
+  execution.waitFinish();
+
+  EXPECT_EQ(num_done, 2);
+  EXPECT_FALSE(execution.hasAsyncRequests());
+  for (auto i = 0; i < 4; i++)
+  {
+    EXPECT_EQ(output_buffer[0][i], output_expected[0][i]);
+    EXPECT_EQ(output_buffer[1][i], output_expected[1][i]);
+  }
+}
+
+TEST(ExecInstance, submit_wait_in_completion)
+{
+  auto mockup = CompiledMockUpModel();
+  auto executors = mockup.executors;
+
+  const float input1_buffer[4] = {1, 0, -1, -2};
+  const float input2_buffer[4] = {1, -3, 2, -4};
+  float output_buffer[4] = {};
+
+  onert::exec::Execution execution{executors};
+
+  execution.setInput(IOIndex{0}, reinterpret_cast<const void *>(input1_buffer), 16);
+  execution.setInput(IOIndex{1}, reinterpret_cast<const void *>(input2_buffer), 16);
+  execution.setOutput(IOIndex{0}, reinterpret_cast<void *>(output_buffer), 16);
+
+  std::atomic<bool> waited{false};
+  execution.submit([&](uint64_t, onert::exec::Execution::RequestResult) {
+    // The request calling this is not waited for
+    execution.waitFinish();
+    EXPECT_FALSE(execution.hasAsyncRequests());
+    waited = true;
+  });
+  execution.waitFinish();
+
+  EXPECT_TRUE(waited);
+  EXPECT_TRUE(execution.isFinished());
+}
+
+TEST(ExecInstance, submit_destroy_in_completion)
+{
+  auto mockup = CompiledMockUpModel();
+  auto executors = mockup.executors;
+
+  const float input1_buffer[4] = {1, 0, -1, -2};
+  const float input2_buffer[4] = {1, -3, 2, -4};
+  float output_buffer[2][4] = {};
+
+  auto execution = new onert::exec::Execution{executors};
+
+  std::mutex mutex;
+  std::condition_variable cv;
+  std::vector<onert::exec::Execution::RequestResult> results;
+  auto completion = [&](uint64_t, onert::exec::Execution::RequestResult result) {
+    bool first;
+    {
+      std::unique_lock<std::mutex> lock{mutex};
+      results.emplace_back(result);
+      first = results.size() == 1;
+    }
+    // Cancelled requests are completed in the destructor
+    if (first)
+      delete execution;
+    std::unique_lock<std::mutex> lock{mutex};
+    cv.notify_all();
+  };
+
+  execution->setInput(IOIndex{0}, reinterpret_cast<const void *>(input1_buffer), 16);
+  execution->setInput(IOIndex{1}, reinterpret_cast<const void *>(input2_buffer), 16);
+  for (auto i = 0; i < 2; i++)
+  {
+    execution->setOutput(IOIndex{0}, reinterpret_cast<void *>(output_buffer[i]), 16);
+    execution->submit(completion);
+  }
+
+  // The second request is cancelled by destruction in the completion of the first one
+  std::unique_lock<std::mutex> lock{mutex};
+  cv.wait(lock, [&] { return results.size() == 2; });
+  EXPECT_EQ(results[0], onert::exec::Execution::RequestResult::DONE);
+  EXPECT_EQ(results[1], onert::exec::Execution::RequestResult::CANCELLED);
+}
+
+TEST(ExecInstance, neg_wait_queued_in_completion)
+{
+  auto mockup = CompiledMockUpModel();
+  auto executors = mockup.executors;
+
+  const float input1_buffer[4] = {1, 0, -1, -2};
+  const float input2_buffer[4] = {1, -3, 2, -4};
+  float output_buffer[2][4] = {};
+
+  onert::exec::Execution execution{executors};
+
+  execution.setInput(IOIndex{0}, reinterpret_cast<const void *>(input1_buffer), 16);
+  execution.setInput(IOIndex{1}, reinterpret_cast<const void *>(input2_buffer), 16);
+
+  std::atomic<bool> thrown{false};
+  execution.setOutput(IOIndex{0}, reinterpret_cast<void *>(output_buffer[0]), 16);
+  execution.submit([&](uint64_t, onert::exec::Execution::RequestResult) {
+    // The second request cannot run until this returns
+    EXPECT_TRUE(execution.hasAsyncRequests());
+    EXPECT_ANY_THROW(execution.waitFinish());
+    thrown = true;
+  });
+  execution.setOutput(IOIndex{0}, reinterpret_cast<void *>(output_buffer[1]), 16);
+  execution.submit(nullptr);
+  execution.waitFinish();
+
+  EXPECT_TRUE(thrown);
+}
+
+TEST(ExecInstance, neg_cancel)
+{
+  auto mockup = CompiledMockUpModel();
+  auto executors = mockup.executors;
+
+  const float input1_buffer[4] = {1, 0, -1, -2};
+  const float input2_buffer[4] = {1, -3, 2, -4};
+  float output_buffer[4] = {};
+
+  onert::exec::Execution execution{executors};
+
+  execution.setInput(IOIndex{0}, reinterpret_cast<const void *>(input1_buffer), 16);
+  execution.setInput(IOIndex{1}, reinterpret_cast<const void *>(input2_buffer), 16);
+  execution.setOutput(IOIndex{0}, reinterpret_cast<void *>(output_buffer), 16);
+  auto id = execution.submit(nullptr);
+  execution.waitFinish();
+
+  // Completed or unknown requests cannot be cancelled
+  EXPECT_FALSE(execution.cancel(id));
+  EXPECT_FALSE(execution.cancel(id + 1));
+}
+
 } // namespace
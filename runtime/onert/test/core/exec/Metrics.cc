@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "exec/Metrics.h"
+
+#include <gtest/gtest.h>
+#include <json/json.h>
+
+#include <thread>
+#include <vector>
+
+namespace
+{
+using namespace onert::exec;
+
+TEST(LatencyHistogram, bucket_bounds)
+{
+  for (uint64_t value : {0ull, 1ull, 7ull, 8ull, 9ull, 15ull, 16ull, 1000ull, 123456789ull})
+  {
+    const auto bucket = LatencyHistogram::bucketOf(value);
+    ASSERT_LT(bucket, LatencyHistogram::kNumBuckets);
+    ASSERT_LE(LatencyHistogram::lowerBoundOf(bucket), value);
+    ASSERT_GT(LatencyHistogram::lowerBoundOf(bucket + 1), value);
+  }
+  ASSERT_EQ(LatencyHistogram::bucketOf(UINT64_MAX), LatencyHistogram::kNumBuckets - 1);
+}
+
+TEST(LatencyHistogram, percentile)
+{
+  LatencyHistogram histogram;
+  for (uint64_t value = 1; value <= 100; ++value)
+    histogram.record(value);
+
+  ASSERT_EQ(histogram.count(), 100);
+  ASSERT_EQ(histogram.max(), 100);
+  // Within 12.5% of the actual value
+  ASSERT_NEAR(histogram.percentile(50), 50, 50 / 8);
+  ASSERT_NEAR(histogram.percentile(99), 99, 99 / 8);
+}
+
+TEST(Metrics, record_from_threads)
+{
+  Metrics metrics{2};
+  const auto op = metrics.addOperation("$0 Conv2D", "cpu");
+  const auto mem = metrics.addMemory("cpu tensor memory");
+
+  // Every 2nd run is sampled
+  ASSERT_FALSE(metrics.beginRun());
+  ASSERT_TRUE(metrics.beginRun());
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t)
+  {
+    threads.emplace_back([&, t]() {
+      for (int i = 0; i < 100; ++i)
+      {
+        metrics.recordOperation(op, 10);
+        metrics.recordMemory(mem, 100 * t);
+      }
+    });
+  }
+  for (auto &thread : threads)
+    thread.join();
+  metrics.recordLatency(40);
+
+  Json::Value root;
+  Json::Reader reader;
+  ASSERT_TRUE(reader.parse(metrics.toJSON(), root));
+
+  ASSERT_EQ(root["runs"].asUInt64(), 2);
+  ASSERT_EQ(root["sampled_runs"].asUInt64(), 1);
+  ASSERT_EQ(root["latency_us"]["max"].asUInt64(), 40);
+  ASSERT_EQ(root["operations"][0]["count"].asUInt64(), 400);
+  ASSERT_EQ(root["operations"][0]["total_us"].asUInt64(), 4000);
+  ASSERT_EQ(root["memory_peak_bytes"]["cpu tensor memory"].asUInt64(), 300);
+}
+
+} // namespace
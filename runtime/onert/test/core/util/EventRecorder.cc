@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "util/EventRecorder.h"
+
+#include <gtest/gtest.h>
+#include <json/json.h>
+
+#include <sstream>
+
+namespace
+{
+
+DurationEvent makeDurationEvent(const std::string &name, const std::string &ph,
+                                const std::string &ts, const std::string &lane)
+{
+  DurationEvent evt;
+  evt.name = name;
+  evt.tid = "cpu";
+  evt.ph = ph;
+  evt.ts = ts;
+  evt.lane = lane;
+  evt.args["backend"] = "cpu";
+  return evt;
+}
+
+TEST(EventRecorder, chrome_trace)
+{
+  EventRecorder recorder;
+  recorder.setWriteFormat(EventRecorder::toWriteFormat("chrome"));
+
+  recorder.emit(makeDurationEvent("op0", "B", "10", "0"));
+  recorder.emit(makeDurationEvent("op1", "B", "11", "1"));
+  recorder.emit(makeDurationEvent("op0", "E", "20", "0"));
+  recorder.emit(makeDurationEvent("op1", "E", "21", "1"));
+
+  CounterEvent counter;
+  counter.name = "cpu tensor memory";
+  counter.ph = "C";
+  counter.ts = "10";
+  counter.values["value"] = "1024";
+  recorder.emit(counter);
+
+  std::stringstream ss;
+  recorder.writeToFile(ss);
+
+  Json::Value root;
+  Json::Reader reader;
+  ASSERT_TRUE(reader.parse(ss.str(), root));
+
+  const auto &events = root["traceEvents"];
+  // 4 duration events, 1 counter event and 2 thread names
+  ASSERT_EQ(events.size(), 7);
+
+  const auto &op1 = events[1];
+  ASSERT_EQ(op1["name"].asString(), "op1");
+  ASSERT_EQ(op1["tid"].asUInt64(), 1);
+  ASSERT_EQ(op1["ts"].asUInt64(), 11);
+  ASSERT_EQ(op1["args"]["backend"].asString(), "cpu");
+
+  ASSERT_EQ(events[4]["args"]["value"].asUInt64(), 1024);
+
+  ASSERT_EQ(events[5]["ph"].asString(), "M");
+  ASSERT_EQ(events[6]["args"]["name"].asString(), "thread 1");
+}
+
+TEST(EventRecorder, neg_invalid_format)
+{
+  ASSERT_THROW(EventRecorder::toWriteFormat("unknown"), std::runtime_error);
+}
+
+} // namespace
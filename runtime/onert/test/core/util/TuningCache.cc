@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "util/TuningCache.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <thread>
+
+#include <unistd.h>
+
+namespace
+{
+using namespace onert::util;
+
+const char *kCacheFile = "test_tuning_cache.txt";
+
+TEST(TuningCache, select_fastest)
+{
+  std::remove(kCacheFile);
+  {
+    TuningCache cache{kCacheFile, true, "cpu_a"};
+
+    int fast_runs = 0;
+    int slow_runs = 0;
+    auto fast = [&]() { ++fast_runs; };
+    auto slow = [&]() {
+      ++slow_runs;
+      std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    };
+
+    ASSERT_EQ(cache.select("op", {{"slow", slow}, {"fast", fast}}, 2), "fast");
+    ASSERT_EQ(fast_runs, 3); // warm-up + 2 measurements
+    ASSERT_EQ(slow_runs, 3);
+
+    // Recorded variant is returned without benchmark
+    ASSERT_EQ(cache.select("op", {{"slow", slow}, {"fast", fast}}, 2), "fast");
+    ASSERT_EQ(fast_runs, 3);
+  }
+  {
+    // Later compile picks the recorded variant without autotuning
+    TuningCache cache{kCacheFile, false, "cpu_a"};
+    ASSERT_EQ(cache.find("op"), "fast");
+    ASSERT_EQ(cache.select("op", {{"slow", [] {}}, {"fast", [] {}}}), "fast");
+  }
+  std::remove(kCacheFile);
+}
+
+TEST(TuningCache, keyed_by_cpu_model)
+{
+  std::remove(kCacheFile);
+  {
+    TuningCache cache{kCacheFile, false, "cpu_a"};
+    cache.update("op", "variant_a");
+  }
+  {
+    TuningCache cache{kCacheFile, false, "cpu_b"};
+    ASSERT_EQ(cache.find("op"), "");
+    cache.update("op", "variant_b");
+  }
+  {
+    // Entries of other CPU models are preserved
+    TuningCache cache_a{kCacheFile, false, "cpu_a"};
+    TuningCache cache_b{kCacheFile, false, "cpu_b"};
+    ASSERT_EQ(cache_a.find("op"), "variant_a");
+    ASSERT_EQ(cache_b.find("op"), "variant_b");
+  }
+  std::remove(kCacheFile);
+}
+
+TEST(TuningCache, save_replaces_file)
+{
+  {
+    std::ofstream stream(kCacheFile);
+    stream << "cpu_a\told_op\told_variant\n";
+  }
+  {
+    TuningCache cache{kCacheFile, false, "cpu_a"};
+    cache.update("op", "a");
+  }
+
+  // No temporary file is left behind
+  const auto temp_filepath = std::string{kCacheFile} + ".tmp." + std::to_string(getpid());
+  ASSERT_FALSE(std::ifstream(temp_filepath).good());
+
+  TuningCache cache{kCacheFile, false, "cpu_a"};
+  ASSERT_EQ(cache.find("old_op"), "old_variant");
+  ASSERT_EQ(cache.find("op"), "a");
+  std::remove(kCacheFile);
+}
+
+TEST(TuningCache, neg_no_decision_without_autotune)
+{
+  TuningCache cache{"", false, "cpu_a"};
+  bool run = false;
+  auto candidate = [&]() { run = true; };
+
+  ASSERT_EQ(cache.select("op", {{"a", candidate}, {"b", candidate}}), "");
+  ASSERT_FALSE(run);
+
+  // Unknown variant recorded (e.g. by another version) is ignored
+  cache.update("op", "c");
+  ASSERT_EQ(cache.select("op", {{"a", candidate}, {"b", candidate}}), "");
+}
+
+TEST(TuningCache, neg_unwritable_file)
+{
+  TuningCache cache{"/nonexistent_dir/tuning_cache.txt", true, "cpu_a"};
+
+  // Result is kept in memory even if it cannot be saved
+  ASSERT_NO_THROW(cache.update("op", "a"));
+  ASSERT_EQ(cache.find("op"), "a");
+}
+
+} // namespace
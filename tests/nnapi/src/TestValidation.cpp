@@ -616,4 +616,56 @@ TEST_F(ValidationTestExecution, StartCompute) {
 TEST_F(ValidationTestExecution, EventWait) {
     EXPECT_EQ(ANeuralNetworksEvent_wait(nullptr), ANEURALNETWORKS_UNEXPECTED_NULL);
 }
+
+TEST_F(ValidationTestExecution, BurstCreate) {
+    ANeuralNetworksBurst* burst;
+    EXPECT_EQ(ANeuralNetworksBurst_create(nullptr, &burst), ANEURALNETWORKS_UNEXPECTED_NULL);
+    EXPECT_EQ(ANeuralNetworksBurst_create(mCompilation, nullptr),
+              ANEURALNETWORKS_UNEXPECTED_NULL);
+
+    EXPECT_EQ(ANeuralNetworksBurst_create(mCompilation, &burst), ANEURALNETWORKS_NO_ERROR);
+    ANeuralNetworksBurst_free(burst);
+    ANeuralNetworksBurst_free(nullptr);
+}
+
+TEST_F(ValidationTestExecution, BurstCompute) {
+    ANeuralNetworksBurst* burst;
+    ASSERT_EQ(ANeuralNetworksBurst_create(mCompilation, &burst), ANEURALNETWORKS_NO_ERROR);
+
+    EXPECT_EQ(ANeuralNetworksExecution_burstCompute(nullptr, burst),
+              ANEURALNETWORKS_UNEXPECTED_NULL);
+    EXPECT_EQ(ANeuralNetworksExecution_burstCompute(mExecution, nullptr),
+              ANEURALNETWORKS_UNEXPECTED_NULL);
+
+    // Compute back to back with the same execution, rebinding the same buffers
+    float in0 = 0.0f, in1 = 1.0f, out = 0.0f;
+    for (int i = 0; i < 3; ++i) {
+        in0 = static_cast<float>(i);
+        ASSERT_EQ(ANeuralNetworksExecution_setInput(mExecution, 0, nullptr, &in0, sizeof(float)),
+                  ANEURALNETWORKS_NO_ERROR);
+        ASSERT_EQ(ANeuralNetworksExecution_setInput(mExecution, 1, nullptr, &in1, sizeof(float)),
+                  ANEURALNETWORKS_NO_ERROR);
+        ASSERT_EQ(ANeuralNetworksExecution_setOutput(mExecution, 0, nullptr, &out, sizeof(float)),
+                  ANEURALNETWORKS_NO_ERROR);
+        ASSERT_EQ(ANeuralNetworksExecution_burstCompute(mExecution, burst),
+                  ANEURALNETWORKS_NO_ERROR);
+        EXPECT_EQ(out, in0 + in1);
+    }
+
+    ANeuralNetworksBurst_free(burst);
+}
+
+TEST_F(ValidationTestExecution, BurstComputeOtherCompilation) {
+    // Another compilation of the same model
+    ANeuralNetworksCompilation* compilation;
+    ASSERT_EQ(ANeuralNetworksCompilation_create(mModel, &compilation), ANEURALNETWORKS_NO_ERROR);
+    ASSERT_EQ(ANeuralNetworksCompilation_finish(compilation), ANEURALNETWORKS_NO_ERROR);
+
+    ANeuralNetworksBurst* burst;
+    ASSERT_EQ(ANeuralNetworksBurst_create(compilation, &burst), ANEURALNETWORKS_NO_ERROR);
+    EXPECT_EQ(ANeuralNetworksExecution_burstCompute(mExecution, burst), ANEURALNETWORKS_BAD_DATA);
+
+    ANeuralNetworksBurst_free(burst);
+    ANeuralNetworksCompilation_free(compilation);
+}
 }  // namespace
@@ -17,6 +17,8 @@
 #include "NNPackages.h"
 #include "fixtures.h"
 
+#include <nnfw_experimental.h>
+
 using ValidationTestFourAddModelsSetInput = ValidationTestFourModelsSetInput<NNPackages::ADD>;
 
 TEST_F(ValidationTestFourAddModelsSetInput, run_001)
@@ -42,3 +44,43 @@ TEST_F(ValidationTestFourAddModelsSetInput, run_async)
   for (auto obj : _objects)
     ASSERT_EQ(nnfw_await(obj.session), NNFW_STATUS_NO_ERROR);
 }
+
+TEST_F(ValidationTestFourAddModelsSetInput, submit_and_poll)
+{
+  auto session = _objects[0].session;
+  uint64_t ids[3];
+  for (auto &id : ids)
+    ASSERT_EQ(nnfw_submit(session, nullptr, nullptr, &id), NNFW_STATUS_NO_ERROR);
+
+  int fd = -1;
+  ASSERT_EQ(nnfw_completion_fd(session, &fd), NNFW_STATUS_NO_ERROR);
+  ASSERT_GE(fd, 0);
+
+  // Completions are taken in the order of submission
+  for (auto expected : ids)
+  {
+    uint64_t id = 0;
+    NNFW_REQUEST_RESULT result;
+    while (id == 0)
+      ASSERT_EQ(nnfw_poll_completion(session, &id, &result), NNFW_STATUS_NO_ERROR);
+    ASSERT_EQ(id, expected);
+    ASSERT_EQ(result, NNFW_REQUEST_DONE);
+  }
+
+  ASSERT_EQ(nnfw_run(session), NNFW_STATUS_NO_ERROR);
+}
+
+TEST_F(ValidationTestFourAddModelsSetInput, neg_cancel_completed)
+{
+  auto session = _objects[0].session;
+  uint64_t id = 0;
+  ASSERT_EQ(nnfw_submit(session, nullptr, nullptr, &id), NNFW_STATUS_NO_ERROR);
+
+  uint64_t completed = 0;
+  NNFW_REQUEST_RESULT result;
+  while (completed == 0)
+    ASSERT_EQ(nnfw_poll_completion(session, &completed, &result), NNFW_STATUS_NO_ERROR);
+
+  ASSERT_EQ(nnfw_cancel(session, id), NNFW_STATUS_ERROR);
+  ASSERT_EQ(nnfw_submit(session, nullptr, nullptr, nullptr), NNFW_STATUS_UNEXPECTED_NULL);
+}
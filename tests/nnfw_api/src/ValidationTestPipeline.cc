@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "NNPackages.h"
+#include "fixtures.h"
+
+#include <nnfw_experimental.h>
+
+#include <thread>
+
+using ValidationTestPipeline = ValidationTestFourModelsSetInput<NNPackages::ADD>;
+
+TEST_F(ValidationTestPipeline, run_three_stages)
+{
+  const uint32_t num_frames = 16;
+
+  // Expected results by running the last session three times in a row
+  auto &ref = _objects[3];
+  std::vector<float> expected;
+  for (uint32_t f = 0; f < num_frames; ++f)
+  {
+    ref.inputs[0].assign(ref.inputs[0].size(), static_cast<float>(f));
+    for (int s = 0; s < 3; ++s)
+    {
+      ASSERT_EQ(nnfw_run(ref.session), NNFW_STATUS_NO_ERROR);
+      ref.inputs[0] = ref.outputs[0];
+    }
+    expected.insert(expected.end(), ref.outputs[0].begin(), ref.outputs[0].end());
+  }
+
+  nnfw_pipeline *pipeline = nullptr;
+  ASSERT_EQ(nnfw_pipeline_create(&pipeline, 2), NNFW_STATUS_NO_ERROR);
+  for (int s = 0; s < 3; ++s)
+    ASSERT_EQ(nnfw_pipeline_add_stage(pipeline, _objects[s].session), NNFW_STATUS_NO_ERROR);
+  ASSERT_EQ(nnfw_pipeline_connect(pipeline, 1, 0, 0), NNFW_STATUS_NO_ERROR);
+  ASSERT_EQ(nnfw_pipeline_start(pipeline), NNFW_STATUS_NO_ERROR);
+
+  // Push on another thread, as push blocks when the pipeline is full
+  std::thread producer([&]() {
+    std::vector<float> input(_objects[0].inputs[0].size());
+    for (uint32_t f = 0; f < num_frames; ++f)
+    {
+      input.assign(input.size(), static_cast<float>(f));
+      const void *buffers[] = {input.data()};
+      const size_t lengths[] = {input.size() * sizeof(float)};
+      EXPECT_EQ(nnfw_pipeline_push(pipeline, buffers, lengths), NNFW_STATUS_NO_ERROR);
+    }
+  });
+
+  std::vector<float> actual;
+  std::vector<float> output(_objects[2].outputs[0].size());
+  for (uint32_t f = 0; f < num_frames; ++f)
+  {
+    void *buffers[] = {output.data()};
+    const size_t lengths[] = {output.size() * sizeof(float)};
+    ASSERT_EQ(nnfw_pipeline_pop(pipeline, buffers, lengths), NNFW_STATUS_NO_ERROR);
+    actual.insert(actual.end(), output.begin(), output.end());
+  }
+  producer.join();
+
+  ASSERT_EQ(nnfw_pipeline_destroy(pipeline), NNFW_STATUS_NO_ERROR);
+  ASSERT_EQ(actual, expected);
+}
+
+TEST_F(ValidationTestPipeline, neg_create_zero_depth)
+{
+  nnfw_pipeline *pipeline = nullptr;
+  ASSERT_EQ(nnfw_pipeline_create(&pipeline, 0), NNFW_STATUS_ERROR);
+  ASSERT_EQ(nnfw_pipeline_create(nullptr, 1), NNFW_STATUS_UNEXPECTED_NULL);
+}
+
+TEST_F(ValidationTestPipeline, neg_start_without_stage)
+{
+  nnfw_pipeline *pipeline = nullptr;
+  ASSERT_EQ(nnfw_pipeline_create(&pipeline, 1), NNFW_STATUS_NO_ERROR);
+  ASSERT_EQ(nnfw_pipeline_start(pipeline), NNFW_STATUS_INVALID_STATE);
+  ASSERT_EQ(nnfw_pipeline_destroy(pipeline), NNFW_STATUS_NO_ERROR);
+}
+
+TEST_F(ValidationTestPipeline, neg_connect_invalid)
+{
+  nnfw_pipeline *pipeline = nullptr;
+  ASSERT_EQ(nnfw_pipeline_create(&pipeline, 1), NNFW_STATUS_NO_ERROR);
+  ASSERT_EQ(nnfw_pipeline_add_stage(pipeline, _objects[0].session), NNFW_STATUS_NO_ERROR);
+  ASSERT_EQ(nnfw_pipeline_add_stage(pipeline, _objects[1].session), NNFW_STATUS_NO_ERROR);
+  // The first stage is fed by push only
+  ASSERT_EQ(nnfw_pipeline_connect(pipeline, 0, 0, 0), NNFW_STATUS_ERROR);
+  ASSERT_EQ(nnfw_pipeline_connect(pipeline, 2, 0, 0), NNFW_STATUS_ERROR);
+  ASSERT_EQ(nnfw_pipeline_connect(pipeline, 1, 100, 0), NNFW_STATUS_ERROR);
+  ASSERT_EQ(nnfw_pipeline_connect(pipeline, 1, 0, 100), NNFW_STATUS_ERROR);
+  ASSERT_EQ(nnfw_pipeline_destroy(pipeline), NNFW_STATUS_NO_ERROR);
+}
+
+TEST_F(ValidationTestPipeline, neg_push_before_start)
+{
+  nnfw_pipeline *pipeline = nullptr;
+  ASSERT_EQ(nnfw_pipeline_create(&pipeline, 1), NNFW_STATUS_NO_ERROR);
+  ASSERT_EQ(nnfw_pipeline_add_stage(pipeline, _objects[0].session), NNFW_STATUS_NO_ERROR);
+
+  auto &input = _objects[0].inputs[0];
+  const void *buffers[] = {input.data()};
+  const size_t lengths[] = {input.size() * sizeof(float)};
+  ASSERT_EQ(nnfw_pipeline_push(pipeline, buffers, lengths), NNFW_STATUS_INVALID_STATE);
+  ASSERT_EQ(nnfw_pipeline_destroy(pipeline), NNFW_STATUS_NO_ERROR);
+}
@@ -212,6 +212,16 @@ void Args::Initialize(void)
          "0: prints the only result. Messages btw run don't print\n"
          "1: prints result and message btw run\n"
          "2: prints all of messages to print\n")
+    ("load_duration", po::value<uint32_t>()->default_value(0)->notifier([&](const auto &v) { _load_duration = v; }),
+         "Generate load for the given seconds instead of running `num_runs` times\n"
+         "Latency percentiles and throughput are reported. 0 means no load generation\n")
+    ("load_sessions", po::value<uint32_t>()->default_value(1)->notifier([&](const auto &v) { _load_sessions = v; }),
+         "The number of sessions to generate load on, each with its own inputs and outputs")
+    ("load_concurrency", po::value<uint32_t>()->default_value(0)->notifier([&](const auto &v) { _load_concurrency = v; }),
+         "Closed loop: the number of requests in flight. 0 means `load_sessions`")
+    ("load_qps", po::value<double>()->default_value(0)->notifier([&](const auto &v) { _load_qps = v; }),
+         "Open loop: requests per second arriving regardless of completion\n"
+         "Latency includes waiting for a free session. 0 means closed loop\n")
     ;
   // clang-format on
 
@@ -261,6 +271,19 @@ void Args::Parse(const int argc, char **argv)
     exit(1);
   }
 
+  if (_load_sessions == 0)
+  {
+    std::cerr << "'--load_sessions' must be positive" << std::endl;
+    exit(1);
+  }
+
+  if (_load_duration == 0 && (!vm["load_sessions"].defaulted() ||
+                              !vm["load_concurrency"].defaulted() || !vm["load_qps"].defaulted()))
+  {
+    std::cerr << "'--load_duration' is required to generate load" << std::endl;
+    exit(1);
+  }
+
   // This must be run after `notify` as `_warm_up_runs` must have been processed before.
   if (vm.count("mem_poll"))
   {
@@ -51,6 +51,10 @@ public:
   const TensorShapeMap &getShapeMapForPrepare() { return _shape_prepare; }
   const TensorShapeMap &getShapeMapForRun() { return _shape_run; }
   const int getVerboseLevel(void) const { return _verbose_level; }
+  const uint32_t getLoadSessions(void) const { return _load_sessions; }
+  const uint32_t getLoadConcurrency(void) const { return _load_concurrency; }
+  const double getLoadQps(void) const { return _load_qps; }
+  const uint32_t getLoadDuration(void) const { return _load_duration; }
 
 private:
   void Initialize();
@@ -76,6 +80,10 @@ private:
   bool _write_report;
   bool _print_version = false;
   int _verbose_level;
+  uint32_t _load_sessions;
+  uint32_t _load_concurrency;
+  double _load_qps;
+  uint32_t _load_duration;
 };
 
 } // end of namespace nnpkg_run
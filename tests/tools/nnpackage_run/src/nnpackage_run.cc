@@ -61,6 +61,67 @@ NNFW_STATUS resolve_op_backend(nnfw_session *session)
   return NNFW_STATUS_NO_ERROR;
 }
 
+namespace nnpkg_run
+{
+
+void setTensorInfo(nnfw_session *session, const TensorShapeMap &tensor_shape_map)
+{
+  for (auto tensor_shape : tensor_shape_map)
+  {
+    auto ind = tensor_shape.first;
+    auto &shape = tensor_shape.second;
+    nnfw_tensorinfo ti;
+    // to fill dtype
+    NNPR_ENSURE_STATUS(nnfw_input_tensorinfo(session, ind, &ti));
+
+    ti.rank = shape.size();
+    for (int i = 0; i < ti.rank; i++)
+      ti.dims[i] = shape.at(i);
+    NNPR_ENSURE_STATUS(nnfw_set_input_tensorinfo(session, ind, &ti));
+  }
+}
+
+void prepareOutputs(nnfw_session *session,
+                    const std::unordered_map<uint32_t, uint32_t> &output_sizes,
+                    std::vector<Allocation> &outputs)
+{
+  for (uint32_t i = 0; i < outputs.size(); i++)
+  {
+    nnfw_tensorinfo ti;
+    uint64_t output_size_in_bytes = 0;
+    {
+      auto found = output_sizes.find(i);
+      if (found == output_sizes.end())
+      {
+        NNPR_ENSURE_STATUS(nnfw_output_tensorinfo(session, i, &ti));
+        output_size_in_bytes = bufsize_for(&ti);
+      }
+      else
+      {
+        output_size_in_bytes = found->second;
+      }
+    }
+    outputs[i].alloc(output_size_in_bytes);
+    NNPR_ENSURE_STATUS(
+        nnfw_set_output(session, i, ti.dtype, outputs[i].data(), output_size_in_bytes));
+    NNPR_ENSURE_STATUS(nnfw_set_output_layout(session, i, NNFW_LAYOUT_CHANNELS_LAST));
+  }
+}
+
+std::string nnpkgBasename(const std::string &nnpackage_path)
+{
+  char buf[PATH_MAX];
+  char *res = realpath(nnpackage_path.c_str(), buf);
+  if (!res)
+  {
+    std::cerr << "E: during getting realpath from nnpackage_path." << std::endl;
+    exit(-1);
+  }
+  return basename(buf);
+}
+
+} // end of namespace nnpkg_run
+
 int main(const int argc, char **argv)
 {
   using namespace nnpkg_run;
@@ -138,27 +199,11 @@ int main(const int argc, char **argv)
       }
     };
 
-    auto setTensorInfo = [session](const TensorShapeMap &tensor_shape_map) {
-      for (auto tensor_shape : tensor_shape_map)
-      {
-        auto ind = tensor_shape.first;
-        auto &shape = tensor_shape.second;
-        nnfw_tensorinfo ti;
-        // to fill dtype
-        NNPR_ENSURE_STATUS(nnfw_input_tensorinfo(session, ind, &ti));
-
-        ti.rank = shape.size();
-        for (int i = 0; i < ti.rank; i++)
-          ti.dims[i] = shape.at(i);
-        NNPR_ENSURE_STATUS(nnfw_set_input_tensorinfo(session, ind, &ti));
-      }
-    };
-
     verifyInputTypes();
     verifyOutputTypes();
 
     // set input shape before compilation
-    setTensorInfo(args.getShapeMapForPrepare());
+    setTensorInfo(session, args.getShapeMapForPrepare());
 
     // prepare execution
 
@@ -168,7 +213,7 @@ int main(const int argc, char **argv)
     });
 
     // set input shape after compilation and before execution
-    setTensorInfo(args.getShapeMapForRun());
+    setTensorInfo(session, args.getShapeMapForRun());
 
     // prepare input
     std::vector<Allocation> inputs(num_inputs);
@@ -185,27 +230,73 @@ int main(const int argc, char **argv)
     uint32_t num_outputs = 0;
     NNPR_ENSURE_STATUS(nnfw_output_size(session, &num_outputs));
     std::vector<Allocation> outputs(num_outputs);
-    auto output_sizes = args.getOutputSizes();
-    for (uint32_t i = 0; i < num_outputs; i++)
+    prepareOutputs(session, args.getOutputSizes(), outputs);
+
+    // Generate load on several sessions instead of EXECUTE
+    if (args.getLoadDuration() > 0)
     {
-      nnfw_tensorinfo ti;
-      uint64_t output_size_in_bytes = 0;
+      phases.run("WARMUP",
+                 [&](const benchmark::Phase &, uint32_t) { NNPR_ENSURE_STATUS(nnfw_run(session)); },
+                 args.getWarmupRuns());
+
+      // The primary session is ready. Others are prepared the same way, with their own buffers.
+      const uint32_t num_sessions = args.getLoadSessions();
+      std::vector<nnfw_session *> sessions{session};
+      std::vector<std::vector<Allocation>> session_inputs(num_sessions);
+      std::vector<std::vector<Allocation>> session_outputs(num_sessions);
+      for (uint32_t i = 1; i < num_sessions; ++i)
       {
-        auto found = output_sizes.find(i);
-        if (found == output_sizes.end())
-        {
-          NNPR_ENSURE_STATUS(nnfw_output_tensorinfo(session, i, &ti));
-          output_size_in_bytes = bufsize_for(&ti);
-        }
+        nnfw_session *s = nullptr;
+        NNPR_ENSURE_STATUS(nnfw_create_session(&s));
+        sessions.emplace_back(s);
+
+        NNPR_ENSURE_STATUS(nnfw_load_model_from_file(s, nnpackage_path.c_str()));
+        if (available_backends)
+          NNPR_ENSURE_STATUS(nnfw_set_available_backends(s, available_backends));
+        NNPR_ENSURE_STATUS(resolve_op_backend(s));
+        setTensorInfo(s, args.getShapeMapForPrepare());
+        NNPR_ENSURE_STATUS(nnfw_prepare(s));
+        setTensorInfo(s, args.getShapeMapForRun());
+
+        session_inputs[i].resize(num_inputs);
+#if defined(ONERT_HAVE_HDF5) && ONERT_HAVE_HDF5 == 1
+        if (!args.getLoadFilename().empty())
+          H5Formatter(s).loadInputs(args.getLoadFilename(), session_inputs[i]);
         else
-        {
-          output_size_in_bytes = found->second;
-        }
+          RandomGenerator(s).generate(session_inputs[i]);
+#else
+        RandomGenerator(s).generate(session_inputs[i]);
+#endif
+        session_outputs[i].resize(num_outputs);
+        prepareOutputs(s, args.getOutputSizes(), session_outputs[i]);
+
+        // So that the first request on this session does not take extra time
+        NNPR_ENSURE_STATUS(nnfw_run(s));
       }
-      outputs[i].alloc(output_size_in_bytes);
-      NNPR_ENSURE_STATUS(
-          nnfw_set_output(session, i, ti.dtype, outputs[i].data(), output_size_in_bytes));
-      NNPR_ENSURE_STATUS(nnfw_set_output_layout(session, i, NNFW_LAYOUT_CHANNELS_LAST));
+
+      benchmark::LoadOption option;
+      option.sessions = num_sessions;
+      option.concurrency = args.getLoadConcurrency();
+      option.qps = args.getLoadQps();
+      option.duration = args.getLoadDuration();
+      option.memory = args.getMemoryPoll();
+
+      auto result = benchmark::LoadGenerator(option).run(
+          [&](uint32_t i) { NNPR_ENSURE_STATUS(nnfw_run(sessions[i])); });
+
+      for (auto s : sessions)
+        NNPR_ENSURE_STATUS(nnfw_close_session(s));
+
+      benchmark::printLoadResult(option, result);
+
+      if (args.getWriteReport())
+      {
+        std::string backend_name = (available_backends) ? available_backends : default_backend_cand;
+        benchmark::writeLoadResult(option, result, basename(argv[0]),
+                                   nnpkgBasename(nnpackage_path), backend_name);
+      }
+
+      return 0;
     }
 
     // NOTE: Measuring memory can't avoid taking overhead. Therefore, memory will be measured on the
@@ -260,23 +351,9 @@ int main(const int argc, char **argv)
       return 0;
 
     // prepare csv task
-    std::string exec_basename;
-    std::string nnpkg_basename;
+    std::string exec_basename = basename(argv[0]);
+    std::string nnpkg_basename = nnpkgBasename(nnpackage_path);
     std::string backend_name = (available_backends) ? available_backends : default_backend_cand;
-    {
-      char buf[PATH_MAX];
-      char *res = realpath(nnpackage_path.c_str(), buf);
-      if (res)
-      {
-        nnpkg_basename = basename(buf);
-      }
-      else
-      {
-        std::cerr << "E: during getting realpath from nnpackage_path." << std::endl;
-        exit(-1);
-      }
-      exec_basename = basename(argv[0]);
-    }
 
     benchmark::writeResult(result, exec_basename, nnpkg_basename, backend_name);
 
@@ -65,6 +65,19 @@ std::string get_key_string(const std::string &key, OperationInfo &info)
   return info[key];
 }
 
+bool has_key(const std::string &key, OperationInfo &info) { return info.find(key) != info.end(); }
+
+int get_key_int(const std::string &key, OperationInfo &info, int default_value)
+{
+  return has_key(key, info) ? std::stoi(info[key]) : default_value;
+}
+
+std::string get_key_string(const std::string &key, OperationInfo &info,
+                           const std::string &default_value)
+{
+  return has_key(key, info) ? info[key] : default_value;
+}
+
 } // namespace kbenchmark
 
 #endif // __KBENCHMARK_UTILS_H__
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file BatchMatMul benchmark of cker kernels
+ */
+
+#include <nonius/nonius.h++>
+
+#include <cker/operation/BatchMatMul.h>
+
+#include "cker_common/Utils.h"
+
+using namespace nnfw::cker;
+using namespace kbenchmark::kernels::cker_common;
+
+//
+// Benchmark Parameters
+//
+NONIUS_PARAM(LHS, std::string{"1,12,128,64"})
+NONIUS_PARAM(RHS, std::string{"1,12,64,128"})
+
+NONIUS_PARAM(ADJ_X, 0);
+NONIUS_PARAM(ADJ_Y, 0);
+
+//
+// Configuration Helpers
+//
+namespace
+{
+
+Shape outputShape(const Shape &lhs, const Shape &rhs, bool adj_x, bool adj_y)
+{
+  const int rank = std::max(lhs.DimensionsCount(), rhs.DimensionsCount());
+  const auto extended_lhs = Shape::ExtendedShape(rank, lhs);
+  const auto extended_rhs = Shape::ExtendedShape(rank, rhs);
+
+  Shape shape(rank);
+  for (int i = 0; i < rank - 2; ++i)
+  {
+    shape.SetDim(i, std::max(extended_lhs.Dims(i), extended_rhs.Dims(i)));
+  }
+  shape.SetDim(rank - 2, adj_x ? extended_lhs.Dims(rank - 1) : extended_lhs.Dims(rank - 2));
+  shape.SetDim(rank - 1, adj_y ? extended_rhs.Dims(rank - 2) : extended_rhs.Dims(rank - 1));
+  return shape;
+}
+
+} // namespace
+
+//
+// Benchmark Implementations
+//
+namespace
+{
+
+inline nonius::benchmark_registry &local_benchmark_registry()
+{
+  static nonius::benchmark_registry registry;
+  return registry;
+}
+
+} // namespace
+
+#define NONIUS_LOCAL_BENCHMARK(name, ...)                                              \
+  namespace                                                                            \
+  {                                                                                    \
+  static ::nonius::benchmark_registrar                                                 \
+      NONIUS_DETAIL_UNIQUE_NAME(benchmark_registrar)(local_benchmark_registry(), name, \
+                                                     __VA_ARGS__);                     \
+  }
+
+NONIUS_LOCAL_BENCHMARK("CkerBatchMatMul_Float", [](nonius::chronometer meter) {
+  const auto lhs_shape = asShape(meter.param<LHS>());
+  const auto rhs_shape = asShape(meter.param<RHS>());
+  const bool adj_x = meter.param<ADJ_X>() != 0;
+  const bool adj_y = meter.param<ADJ_Y>() != 0;
+  const auto output_shape = outputShape(lhs_shape, rhs_shape, adj_x, adj_y);
+
+  auto lhs = makeData(lhs_shape);
+  auto rhs = makeData(rhs_shape);
+  std::vector<float> output(output_shape.FlatSize());
+
+  BatchMatMul kernel;
+  kernel.prepare(lhs_shape, rhs_shape, adj_x, adj_y);
+
+  // Run!
+  meter.measure([&](int) {
+    kernel(lhs_shape, lhs.data(), rhs_shape, rhs.data(), adj_x, adj_y, output_shape,
+           output.data());
+  });
+})
+
+extern "C" nonius::benchmark_registry &benchmark_functions(void)
+{
+  return local_benchmark_registry();
+}
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file Elementwise binary arithmetic benchmark of cker kernels
+ */
+
+#include <nonius/nonius.h++>
+
+#include <cker/operation/BinaryArithmeticOps.h>
+
+#include "cker_common/Utils.h"
+
+using namespace nnfw::cker;
+using namespace kbenchmark::kernels::cker_common;
+
+//
+// Benchmark Parameters
+//
+NONIUS_PARAM(LHS, std::string{"1,56,56,64"})
+NONIUS_PARAM(RHS, std::string{"1,1,1,64"})
+
+NONIUS_PARAM(FUSED_ACT, std::string{"NONE"})
+
+//
+// Configuration Helpers
+//
+namespace
+{
+
+template <BinaryArithmeticOpType op_type> void run(nonius::chronometer meter)
+{
+  const auto lhs_shape = asShape(meter.param<LHS>());
+  const auto rhs_shape = asShape(meter.param<RHS>());
+  const auto output_shape = broadcastShape(lhs_shape, rhs_shape);
+
+  auto lhs = makeData(lhs_shape);
+  // Keep divisors away from zero
+  auto rhs = makeData<float>(rhs_shape, 0.5f, 2.0f);
+  std::vector<float> output(output_shape.FlatSize());
+
+  BinaryArithmeticOpParam params;
+  activationRange(meter.param<FUSED_ACT>(), &params.float_activation_min,
+                  &params.float_activation_max);
+
+  // Same as the cpu backend, broadcasting is decided once before running
+  const bool need_broadcast = ProcessBroadcastShapes(lhs_shape, rhs_shape, &params);
+
+  // Run!
+  if (need_broadcast)
+  {
+    meter.measure([&](int) {
+      BroadcastBinaryArithmeticOp<op_type>(params, lhs_shape, lhs.data(), rhs_shape, rhs.data(),
+                                           output_shape, output.data());
+    });
+  }
+  else
+  {
+    meter.measure([&](int) {
+      BinaryArithmeticOp<op_type>(params, lhs_shape, lhs.data(), rhs_shape, rhs.data(),
+                                  output_shape, output.data());
+    });
+  }
+}
+
+} // namespace
+
+//
+// Benchmark Implementations
+//
+namespace
+{
+
+inline nonius::benchmark_registry &local_benchmark_registry()
+{
+  static nonius::benchmark_registry registry;
+  return registry;
+}
+
+} // namespace
+
+#define NONIUS_LOCAL_BENCHMARK(name, ...)                                              \
+  namespace                                                                            \
+  {                                                                                    \
+  static ::nonius::benchmark_registrar                                                 \
+      NONIUS_DETAIL_UNIQUE_NAME(benchmark_registrar)(local_benchmark_registry(), name, \
+                                                     __VA_ARGS__);                     \
+  }
+
+NONIUS_LOCAL_BENCHMARK("CkerAdd_Float", run<BinaryArithmeticOpType::ADD>)
+NONIUS_LOCAL_BENCHMARK("CkerSub_Float", run<BinaryArithmeticOpType::SUB>)
+NONIUS_LOCAL_BENCHMARK("CkerMul_Float", run<BinaryArithmeticOpType::MUL>)
+NONIUS_LOCAL_BENCHMARK("CkerDiv_Float", run<BinaryArithmeticOpType::DIV>)
+
+extern "C" nonius::benchmark_registry &benchmark_functions(void)
+{
+  return local_benchmark_registry();
+}
@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file Conv2D benchmark of cker kernels
+ */
+
+#include <nonius/nonius.h++>
+
+#include <cker/operation/Conv.h>
+
+#include "cker_common/Utils.h"
+
+using namespace nnfw::cker;
+using namespace kbenchmark::kernels::cker_common;
+
+//
+// Benchmark Parameters
+//
+NONIUS_PARAM(BATCH, 1);
+
+NONIUS_PARAM(IFM_C, 3);
+NONIUS_PARAM(IFM_H, 244);
+NONIUS_PARAM(IFM_W, 244);
+
+NONIUS_PARAM(OFM_C, 3);
+NONIUS_PARAM(OFM_H, 244);
+NONIUS_PARAM(OFM_W, 244);
+
+NONIUS_PARAM(KER_H, 3);
+NONIUS_PARAM(KER_W, 3);
+
+NONIUS_PARAM(STRIDE_H, 1);
+NONIUS_PARAM(STRIDE_W, 1);
+
+NONIUS_PARAM(PADDING, std::string{"SAME"})
+NONIUS_PARAM(FUSED_ACT, std::string{"RELU"})
+
+//
+// Configuration Helpers
+//
+namespace
+{
+
+struct Configuration
+{
+  Shape ifm_shape;
+  Shape ofm_shape;
+  Shape ker_shape;
+  Shape bias_shape;
+
+  ConvParams params;
+
+  Configuration(nonius::chronometer meter)
+      : ifm_shape{meter.param<BATCH>(), meter.param<IFM_H>(), meter.param<IFM_W>(),
+                  meter.param<IFM_C>()},
+        ofm_shape{meter.param<BATCH>(), meter.param<OFM_H>(), meter.param<OFM_W>(),
+                  meter.param<OFM_C>()},
+        ker_shape{meter.param<OFM_C>(), meter.param<KER_H>(), meter.param<KER_W>(),
+                  meter.param<IFM_C>()},
+        bias_shape{meter.param<OFM_C>()}
+  {
+    const auto padding = calculatePadding(
+        meter.param<PADDING>(), meter.param<IFM_H>(), meter.param<IFM_W>(), meter.param<OFM_H>(),
+        meter.param<OFM_W>(), meter.param<STRIDE_H>(), meter.param<STRIDE_W>(),
+        meter.param<KER_H>(), meter.param<KER_W>());
+
+    params.padding_type = asPaddingType(meter.param<PADDING>());
+    params.padding_values.height = padding.top;
+    params.padding_values.width = padding.left;
+    params.stride_height = meter.param<STRIDE_H>();
+    params.stride_width = meter.param<STRIDE_W>();
+    params.dilation_height_factor = 1;
+    params.dilation_width_factor = 1;
+    activationRange(meter.param<FUSED_ACT>(), &params.float_activation_min,
+                    &params.float_activation_max);
+  }
+};
+
+void run(nonius::chronometer meter, bool use_reference)
+{
+  Configuration p{meter};
+
+  auto ifm = makeData(p.ifm_shape);
+  auto ker = makeData(p.ker_shape);
+  auto bias = makeData(p.bias_shape);
+  std::vector<float> ofm(p.ofm_shape.FlatSize());
+
+  Conv conv;
+  conv.useReferenceFloat(use_reference);
+  if (!use_reference)
+  {
+    // Filter is constant, so it is transposed once as the cpu backend does
+    bool is_replaced_weights = false;
+    conv.prepare(p.ker_shape, ker.data(), p.params.padding_type, is_replaced_weights);
+  }
+
+  // Run!
+  meter.measure([&](int) {
+    conv(p.params, p.ifm_shape, ifm.data(), p.ker_shape, ker.data(), p.bias_shape, bias.data(),
+         p.ofm_shape, ofm.data());
+  });
+}
+
+} // namespace
+
+//
+// Benchmark Implementations
+//
+namespace
+{
+
+inline nonius::benchmark_registry &local_benchmark_registry()
+{
+  static nonius::benchmark_registry registry;
+  return registry;
+}
+
+} // namespace
+
+#define NONIUS_LOCAL_BENCHMARK(name, ...)                                              \
+  namespace                                                                            \
+  {                                                                                    \
+  static ::nonius::benchmark_registrar                                                 \
+      NONIUS_DETAIL_UNIQUE_NAME(benchmark_registrar)(local_benchmark_registry(), name, \
+                                                     __VA_ARGS__);                     \
+  }
+
+// Eigen based kernel, which falls back to reference one if it is not usable
+NONIUS_LOCAL_BENCHMARK("CkerConv_Multithreaded",
+                       [](nonius::chronometer meter) { run(meter, false); })
+
+NONIUS_LOCAL_BENCHMARK("CkerConv_Reference", [](nonius::chronometer meter) { run(meter, true); })
+
+extern "C" nonius::benchmark_registry &benchmark_functions(void)
+{
+  return local_benchmark_registry();
+}
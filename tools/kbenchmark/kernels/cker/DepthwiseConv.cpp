@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file DepthwiseConv2D benchmark of cker kernels
+ */
+
+#include <nonius/nonius.h++>
+
+#include <cker/operation/DepthwiseConv.h>
+
+#include "cker_common/Utils.h"
+
+using namespace nnfw::cker;
+using namespace kbenchmark::kernels::cker_common;
+
+//
+// Benchmark Parameters
+//
+NONIUS_PARAM(BATCH, 1);
+
+NONIUS_PARAM(IFM_C, 32);
+NONIUS_PARAM(IFM_H, 112);
+NONIUS_PARAM(IFM_W, 112);
+
+NONIUS_PARAM(OFM_C, 32);
+NONIUS_PARAM(OFM_H, 112);
+NONIUS_PARAM(OFM_W, 112);
+
+NONIUS_PARAM(KER_H, 3);
+NONIUS_PARAM(KER_W, 3);
+
+NONIUS_PARAM(STRIDE_H, 1);
+NONIUS_PARAM(STRIDE_W, 1);
+
+NONIUS_PARAM(DILATION_H, 1);
+NONIUS_PARAM(DILATION_W, 1);
+
+NONIUS_PARAM(MULTIPLIER, 1);
+
+NONIUS_PARAM(PADDING, std::string{"SAME"})
+NONIUS_PARAM(FUSED_ACT, std::string{"RELU6"})
+
+//
+// Configuration Helpers
+//
+namespace
+{
+
+struct Configuration
+{
+  Shape ifm_shape;
+  Shape ofm_shape;
+  Shape ker_shape;
+  Shape bias_shape;
+
+  DepthwiseConvParams params;
+
+  Configuration(nonius::chronometer meter)
+      : ifm_shape{meter.param<BATCH>(), meter.param<IFM_H>(), meter.param<IFM_W>(),
+                  meter.param<IFM_C>()},
+        ofm_shape{meter.param<BATCH>(), meter.param<OFM_H>(), meter.param<OFM_W>(),
+                  meter.param<OFM_C>()},
+        ker_shape{1, meter.param<KER_H>(), meter.param<KER_W>(), meter.param<OFM_C>()},
+        bias_shape{meter.param<OFM_C>()}
+  {
+    const int32_t effective_ker_H = (meter.param<KER_H>() - 1) * meter.param<DILATION_H>() + 1;
+    const int32_t effective_ker_W = (meter.param<KER_W>() - 1) * meter.param<DILATION_W>() + 1;
+    const auto padding = calculatePadding(
+        meter.param<PADDING>(), meter.param<IFM_H>(), meter.param<IFM_W>(), meter.param<OFM_H>(),
+        meter.param<OFM_W>(), meter.param<STRIDE_H>(), meter.param<STRIDE_W>(), effective_ker_H,
+        effective_ker_W);
+
+    params.padding_type = asPaddingType(meter.param<PADDING>());
+    params.padding_values.height = padding.top;
+    params.padding_values.width = padding.left;
+    params.stride_height = meter.param<STRIDE_H>();
+    params.stride_width = meter.param<STRIDE_W>();
+    params.dilation_height_factor = meter.param<DILATION_H>();
+    params.dilation_width_factor = meter.param<DILATION_W>();
+    params.depth_multiplier = meter.param<MULTIPLIER>();
+    activationRange(meter.param<FUSED_ACT>(), &params.float_activation_min,
+                    &params.float_activation_max);
+  }
+};
+
+} // namespace
+
+//
+// Benchmark Implementations
+//
+namespace
+{
+
+inline nonius::benchmark_registry &local_benchmark_registry()
+{
+  static nonius::benchmark_registry registry;
+  return registry;
+}
+
+} // namespace
+
+#define NONIUS_LOCAL_BENCHMARK(name, ...)                                              \
+  namespace                                                                            \
+  {                                                                                    \
+  static ::nonius::benchmark_registrar                                                 \
+      NONIUS_DETAIL_UNIQUE_NAME(benchmark_registrar)(local_benchmark_registry(), name, \
+                                                     __VA_ARGS__);                     \
+  }
+
+NONIUS_LOCAL_BENCHMARK("CkerDepthwiseConv_Float", [](nonius::chronometer meter) {
+  Configuration p{meter};
+
+  auto ifm = makeData(p.ifm_shape);
+  auto ker = makeData(p.ker_shape);
+  auto bias = makeData(p.bias_shape);
+  std::vector<float> ofm(p.ofm_shape.FlatSize());
+
+  // Run!
+  meter.measure([&](int) {
+    DepthwiseConv(p.params, p.ifm_shape, ifm.data(), p.ker_shape, ker.data(), p.bias_shape,
+                  bias.data(), p.ofm_shape, ofm.data());
+  });
+})
+
+extern "C" nonius::benchmark_registry &benchmark_functions(void)
+{
+  return local_benchmark_registry();
+}
@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file FullyConnected benchmark of cker kernels
+ */
+
+#include <nonius/nonius.h++>
+
+#include <cker/operation/FullyConnected.h>
+
+#include <ruy/context.h>
+
+#include "cker_common/Utils.h"
+
+using namespace nnfw::cker;
+using namespace kbenchmark::kernels::cker_common;
+
+//
+// Benchmark Parameters
+//
+NONIUS_PARAM(BATCH, 1);
+NONIUS_PARAM(INPUT_SIZE, 1024);
+NONIUS_PARAM(NUM_UNITS, 1000);
+
+NONIUS_PARAM(FUSED_ACT, std::string{"NONE"})
+
+//
+// Configuration Helpers
+//
+namespace
+{
+
+struct Configuration
+{
+  Shape input_shape;
+  Shape weights_shape;
+  Shape bias_shape;
+  Shape output_shape;
+
+  std::string fused_act;
+
+  Configuration(nonius::chronometer meter)
+      : input_shape{meter.param<BATCH>(), meter.param<INPUT_SIZE>()},
+        weights_shape{meter.param<NUM_UNITS>(), meter.param<INPUT_SIZE>()},
+        bias_shape{meter.param<NUM_UNITS>()},
+        output_shape{meter.param<BATCH>(), meter.param<NUM_UNITS>()},
+        fused_act{meter.param<FUSED_ACT>()}
+  {
+  }
+};
+
+} // namespace
+
+//
+// Benchmark Implementations
+//
+namespace
+{
+
+inline nonius::benchmark_registry &local_benchmark_registry()
+{
+  static nonius::benchmark_registry registry;
+  return registry;
+}
+
+} // namespace
+
+#define NONIUS_LOCAL_BENCHMARK(name, ...)                                              \
+  namespace                                                                            \
+  {                                                                                    \
+  static ::nonius::benchmark_registrar                                                 \
+      NONIUS_DETAIL_UNIQUE_NAME(benchmark_registrar)(local_benchmark_registry(), name, \
+                                                     __VA_ARGS__);                     \
+  }
+
+NONIUS_LOCAL_BENCHMARK("CkerFullyConnected_Float", [](nonius::chronometer meter) {
+  Configuration p{meter};
+
+  FullyConnectedParams params;
+  params.activation = asActivationType(p.fused_act);
+  activationRange(p.fused_act, &params.float_activation_min, &params.float_activation_max);
+
+  auto input = makeData(p.input_shape);
+  auto weights = makeData(p.weights_shape);
+  auto bias = makeData(p.bias_shape);
+  std::vector<float> output(p.output_shape.FlatSize());
+
+  // Run!
+  meter.measure([&](int) {
+    FullyConnected(params, p.input_shape, input.data(), p.weights_shape, weights.data(),
+                   p.bias_shape, bias.data(), p.output_shape, output.data());
+  });
+})
+
+NONIUS_LOCAL_BENCHMARK("CkerFullyConnected_Quant8", [](nonius::chronometer meter) {
+  Configuration p{meter};
+
+  // Quantization parameters do not affect the speed, use typical ones
+  const double real_multiplier = 0.5 / p.weights_shape.Dims(1);
+  FullyConnectedParams params;
+  params.input_offset = -128;
+  params.weights_offset = -128;
+  params.output_offset = 128;
+  QuantizeMultiplier(real_multiplier, &params.output_multiplier, &params.output_shift);
+  params.quantized_activation_min = 0;
+  params.quantized_activation_max = 255;
+
+  auto input = makeData<uint8_t>(p.input_shape, 0, 255);
+  auto weights = makeData<uint8_t>(p.weights_shape, 0, 255);
+  auto bias = makeData<int32_t>(p.bias_shape, -1024, 1024);
+  std::vector<uint8_t> output(p.output_shape.FlatSize());
+
+  // Run!
+  meter.measure([&](int) {
+    FullyConnected(params, p.input_shape, input.data(), p.weights_shape, weights.data(),
+                   p.bias_shape, bias.data(), p.output_shape, output.data());
+  });
+})
+
+// Float input with int8 symmetric weights
+NONIUS_LOCAL_BENCHMARK("CkerFullyConnected_Hybrid", [](nonius::chronometer meter) {
+  Configuration p{meter};
+
+  FullyConnectedParams params;
+  params.activation = asActivationType(p.fused_act);
+  params.weights_scale = 1.0f / 127;
+
+  auto input = makeData(p.input_shape);
+  auto weights = makeData<int8_t>(p.weights_shape, -127, 127);
+  auto bias = makeData(p.bias_shape);
+  std::vector<float> output(p.output_shape.FlatSize());
+
+  FCTempArena temp_arena;
+  temp_arena.prepare(p.input_shape, p.weights_shape);
+
+  // Same as the default of the cpu backend
+  ruy::Context ruy_context;
+  ruy_context.max_num_threads = 1;
+#ifdef USE_RUY_GEMV
+  ruy_context.cache_policy = ruy::kCacheLHSOnNarrowMul;
+#endif
+
+  // Run!
+  meter.measure([&](int) {
+    FullyConnectedHybrid(params, p.input_shape, input.data(), p.weights_shape, weights.data(),
+                         p.bias_shape, bias.data(), p.output_shape, output.data(), temp_arena,
+                         &ruy_context);
+  });
+})
+
+extern "C" nonius::benchmark_registry &benchmark_functions(void)
+{
+  return local_benchmark_registry();
+}
@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file Pool2D benchmark of cker kernels
+ */
+
+#include <nonius/nonius.h++>
+
+#include <cker/operation/AveragePool.h>
+#include <cker/operation/MaxPool.h>
+
+#include "cker_common/Utils.h"
+
+using namespace nnfw::cker;
+using namespace kbenchmark::kernels::cker_common;
+
+//
+// Benchmark Parameters
+//
+NONIUS_PARAM(BATCH, 1);
+
+NONIUS_PARAM(IFM_C, 64);
+NONIUS_PARAM(IFM_H, 112);
+NONIUS_PARAM(IFM_W, 112);
+
+NONIUS_PARAM(OFM_H, 56);
+NONIUS_PARAM(OFM_W, 56);
+
+NONIUS_PARAM(KER_H, 3);
+NONIUS_PARAM(KER_W, 3);
+
+NONIUS_PARAM(STRIDE_H, 2);
+NONIUS_PARAM(STRIDE_W, 2);
+
+NONIUS_PARAM(PADDING, std::string{"SAME"})
+NONIUS_PARAM(FUSED_ACT, std::string{"NONE"})
+
+//
+// Configuration Helpers
+//
+namespace
+{
+
+struct Configuration
+{
+  Shape ifm_shape;
+  Shape ofm_shape;
+
+  PoolParams params;
+
+  Configuration(nonius::chronometer meter)
+      : ifm_shape{meter.param<BATCH>(), meter.param<IFM_H>(), meter.param<IFM_W>(),
+                  meter.param<IFM_C>()},
+        ofm_shape{meter.param<BATCH>(), meter.param<OFM_H>(), meter.param<OFM_W>(),
+                  meter.param<IFM_C>()}
+  {
+    const auto padding = calculatePadding(
+        meter.param<PADDING>(), meter.param<IFM_H>(), meter.param<IFM_W>(), meter.param<OFM_H>(),
+        meter.param<OFM_W>(), meter.param<STRIDE_H>(), meter.param<STRIDE_W>(),
+        meter.param<KER_H>(), meter.param<KER_W>());
+
+    params.padding_type = asPaddingType(meter.param<PADDING>());
+    params.padding_values.height = padding.top;
+    params.padding_values.width = padding.left;
+    params.stride_height = meter.param<STRIDE_H>();
+    params.stride_width = meter.param<STRIDE_W>();
+    params.filter_height = meter.param<KER_H>();
+    params.filter_width = meter.param<KER_W>();
+    activationRange(meter.param<FUSED_ACT>(), &params.float_activation_min,
+                    &params.float_activation_max);
+  }
+};
+
+} // namespace
+
+//
+// Benchmark Implementations
+//
+namespace
+{
+
+inline nonius::benchmark_registry &local_benchmark_registry()
+{
+  static nonius::benchmark_registry registry;
+  return registry;
+}
+
+} // namespace
+
+#define NONIUS_LOCAL_BENCHMARK(name, ...)                                              \
+  namespace                                                                            \
+  {                                                                                    \
+  static ::nonius::benchmark_registrar                                                 \
+      NONIUS_DETAIL_UNIQUE_NAME(benchmark_registrar)(local_benchmark_registry(), name, \
+                                                     __VA_ARGS__);                     \
+  }
+
+NONIUS_LOCAL_BENCHMARK("CkerAveragePool_Float", [](nonius::chronometer meter) {
+  Configuration p{meter};
+
+  auto ifm = makeData(p.ifm_shape);
+  std::vector<float> ofm(p.ofm_shape.FlatSize());
+
+  // Run!
+  meter.measure(
+      [&](int) { AveragePool(p.params, p.ifm_shape, ifm.data(), p.ofm_shape, ofm.data()); });
+})
+
+NONIUS_LOCAL_BENCHMARK("CkerMaxPool_Float", [](nonius::chronometer meter) {
+  Configuration p{meter};
+
+  auto ifm = makeData(p.ifm_shape);
+  std::vector<float> ofm(p.ofm_shape.FlatSize());
+
+  // Run!
+  meter.measure([&](int) { MaxPool(p.params, p.ifm_shape, ifm.data(), p.ofm_shape, ofm.data()); });
+})
+
+extern "C" nonius::benchmark_registry &benchmark_functions(void)
+{
+  return local_benchmark_registry();
+}
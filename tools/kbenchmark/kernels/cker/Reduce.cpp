@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file Reduce benchmark of cker kernels
+ */
+
+#include <nonius/nonius.h++>
+
+#include <cker/operation/Reduce.h>
+#include <cker/operation/ReduceMean.h>
+
+#include "cker_common/Utils.h"
+
+using namespace nnfw::cker;
+using namespace kbenchmark::kernels::cker_common;
+
+//
+// Benchmark Parameters
+//
+NONIUS_PARAM(INPUT, std::string{"1,7,7,1024"})
+NONIUS_PARAM(AXES, std::string{"1,2"})
+NONIUS_PARAM(KEEP_DIMS, 0);
+
+//
+// Configuration Helpers
+//
+namespace
+{
+
+struct Configuration
+{
+  Shape input_shape;
+  Shape output_shape;
+  std::vector<int> axes;
+  bool keep_dims;
+
+  Configuration(nonius::chronometer meter)
+      : input_shape{asShape(meter.param<INPUT>())}, axes{asInts(meter.param<AXES>())},
+        keep_dims{meter.param<KEEP_DIMS>() != 0}
+  {
+    const int rank = input_shape.DimensionsCount();
+    std::vector<bool> reduced(rank, false);
+    for (auto axis : axes)
+    {
+      reduced.at(axis < 0 ? axis + rank : axis) = true;
+    }
+
+    std::vector<int32_t> dims;
+    for (int i = 0; i < rank; ++i)
+    {
+      if (!reduced[i])
+        dims.push_back(input_shape.Dims(i));
+      else if (keep_dims)
+        dims.push_back(1);
+    }
+    output_shape.ReplaceWith(static_cast<int>(dims.size()), dims.data());
+  }
+};
+
+template <typename T>
+void runGeneric(nonius::chronometer meter, T init_value, T reducer(const T current, const T in))
+{
+  Configuration p{meter};
+
+  auto input = makeData(p.input_shape);
+  std::vector<T> output(p.output_shape.FlatSize());
+
+  Reduce kernel;
+  kernel.prepare(p.input_shape.DimensionsCount(), p.axes.size());
+
+  // Run!
+  meter.measure([&](int) {
+    kernel.ReduceGeneric<T>(p.input_shape, input.data(), p.output_shape, output.data(), p.axes,
+                            p.keep_dims, init_value, reducer);
+  });
+}
+
+} // namespace
+
+//
+// Benchmark Implementations
+//
+namespace
+{
+
+inline nonius::benchmark_registry &local_benchmark_registry()
+{
+  static nonius::benchmark_registry registry;
+  return registry;
+}
+
+} // namespace
+
+#define NONIUS_LOCAL_BENCHMARK(name, ...)                                              \
+  namespace                                                                            \
+  {                                                                                    \
+  static ::nonius::benchmark_registrar                                                 \
+      NONIUS_DETAIL_UNIQUE_NAME(benchmark_registrar)(local_benchmark_registry(), name, \
+                                                     __VA_ARGS__);                     \
+  }
+
+NONIUS_LOCAL_BENCHMARK("CkerMean_Float", [](nonius::chronometer meter) {
+  Configuration p{meter};
+
+  auto input = makeData(p.input_shape);
+  std::vector<float> output(p.output_shape.FlatSize());
+
+  // Run!
+  meter.measure([&](int) {
+    Mean(p.input_shape, input.data(), p.output_shape, output.data(), p.axes);
+  });
+})
+
+NONIUS_LOCAL_BENCHMARK("CkerSum_Float", [](nonius::chronometer meter) {
+  runGeneric<float>(meter, 0.0f, [](const float current, const float in) { return in + current; });
+})
+
+NONIUS_LOCAL_BENCHMARK("CkerReduceMax_Float", [](nonius::chronometer meter) {
+  runGeneric<float>(meter, std::numeric_limits<float>::lowest(),
+                    [](const float current, const float in) { return std::max(in, current); });
+})
+
+extern "C" nonius::benchmark_registry &benchmark_functions(void)
+{
+  return local_benchmark_registry();
+}
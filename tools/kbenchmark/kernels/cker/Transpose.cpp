@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file Transpose benchmark of cker kernels
+ */
+
+#include <nonius/nonius.h++>
+
+#include <cker/operation/Transpose.h>
+
+#include "cker_common/Utils.h"
+
+using namespace nnfw::cker;
+using namespace kbenchmark::kernels::cker_common;
+
+//
+// Benchmark Parameters
+//
+NONIUS_PARAM(INPUT, std::string{"1,56,56,64"})
+NONIUS_PARAM(PERM, std::string{"0,3,1,2"})
+
+//
+// Benchmark Implementations
+//
+namespace
+{
+
+inline nonius::benchmark_registry &local_benchmark_registry()
+{
+  static nonius::benchmark_registry registry;
+  return registry;
+}
+
+} // namespace
+
+#define NONIUS_LOCAL_BENCHMARK(name, ...)                                              \
+  namespace                                                                            \
+  {                                                                                    \
+  static ::nonius::benchmark_registrar                                                 \
+      NONIUS_DETAIL_UNIQUE_NAME(benchmark_registrar)(local_benchmark_registry(), name, \
+                                                     __VA_ARGS__);                     \
+  }
+
+NONIUS_LOCAL_BENCHMARK("CkerTranspose_Float", [](nonius::chronometer meter) {
+  const auto input_shape = asShape(meter.param<INPUT>());
+  const auto perm = asInts(meter.param<PERM>());
+
+  TransposeParams params;
+  if (perm.size() > sizeof(params.perm) / sizeof(params.perm[0]))
+    throw std::runtime_error{"Transpose of rank > 4 is not supported"};
+  params.perm_count = static_cast<int8_t>(perm.size());
+  std::copy(perm.begin(), perm.end(), params.perm);
+
+  Shape output_shape(input_shape.DimensionsCount());
+  for (int i = 0; i < input_shape.DimensionsCount(); ++i)
+  {
+    output_shape.SetDim(i, input_shape.Dims(perm.at(i)));
+  }
+
+  auto input = makeData(input_shape);
+  std::vector<float> output(output_shape.FlatSize());
+
+  // Run!
+  meter.measure(
+      [&](int) { Transpose(params, input_shape, input.data(), output_shape, output.data()); });
+})
+
+extern "C" nonius::benchmark_registry &benchmark_functions(void)
+{
+  return local_benchmark_registry();
+}
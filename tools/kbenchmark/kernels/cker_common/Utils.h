@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __KBENCHMARK_KERNELS_CKER_COMMON_UTILS_H__
+#define __KBENCHMARK_KERNELS_CKER_COMMON_UTILS_H__
+
+#include <cker/Shape.h>
+#include <cker/Types.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace kbenchmark
+{
+namespace kernels
+{
+namespace cker_common
+{
+
+// Parse comma separated integers, e.g. "1,224,224,3"
+inline std::vector<int32_t> asInts(const std::string &src)
+{
+  std::vector<int32_t> values;
+
+  std::stringstream ss(src);
+  int32_t i;
+  while (ss >> i)
+  {
+    values.push_back(i);
+    if (ss.peek() == ',')
+      ss.ignore();
+  }
+  return values;
+}
+
+inline nnfw::cker::Shape asShape(const std::string &src)
+{
+  auto dims = asInts(src);
+  return nnfw::cker::Shape(static_cast<int>(dims.size()), dims.data());
+}
+
+// Shape of the result of broadcasting two shapes
+inline nnfw::cker::Shape broadcastShape(const nnfw::cker::Shape &lhs, const nnfw::cker::Shape &rhs)
+{
+  const int rank = std::max(lhs.DimensionsCount(), rhs.DimensionsCount());
+  const auto extended_lhs = nnfw::cker::Shape::ExtendedShape(rank, lhs);
+  const auto extended_rhs = nnfw::cker::Shape::ExtendedShape(rank, rhs);
+
+  nnfw::cker::Shape shape(rank);
+  for (int i = 0; i < rank; ++i)
+  {
+    const auto lhs_dim = extended_lhs.Dims(i);
+    const auto rhs_dim = extended_rhs.Dims(i);
+    if (lhs_dim != rhs_dim && lhs_dim != 1 && rhs_dim != 1)
+      throw std::runtime_error{"Shapes are not broadcastable"};
+    shape.SetDim(i, std::max(lhs_dim, rhs_dim));
+  }
+  return shape;
+}
+
+// Fill with random values, so kernels do not take shortcuts for zero inputs
+template <typename T> std::vector<T> makeData(const nnfw::cker::Shape &shape, T min, T max)
+{
+  std::vector<T> data(shape.FlatSize());
+
+  std::mt19937 gen{0};
+  std::uniform_real_distribution<float> dist{static_cast<float>(min), static_cast<float>(max)};
+  std::generate(data.begin(), data.end(), [&]() { return static_cast<T>(dist(gen)); });
+  return data;
+}
+
+inline std::vector<float> makeData(const nnfw::cker::Shape &shape)
+{
+  return makeData<float>(shape, -1.0f, 1.0f);
+}
+
+struct PaddingInfo
+{
+  int32_t top;
+  int32_t left;
+};
+
+inline PaddingInfo calculatePadding(const std::string &padding_name, int32_t ifm_H, int32_t ifm_W,
+                                    int32_t ofm_H, int32_t ofm_W, int32_t vertical_stride,
+                                    int32_t horizontal_stride, int32_t ker_H, int32_t ker_W)
+{
+  if (padding_name == "VALID")
+  {
+    return PaddingInfo{0, 0};
+  }
+  else if (padding_name == "SAME")
+  {
+    const int32_t vertical_needed_input = (ofm_H - 1) * vertical_stride + ker_H;
+    const int32_t vertical_total_padding = std::max(0, vertical_needed_input - ifm_H);
+
+    const int32_t horizontal_needed_input = (ofm_W - 1) * horizontal_stride + ker_W;
+    const int32_t horizontal_total_padding = std::max(0, horizontal_needed_input - ifm_W);
+
+    return PaddingInfo{vertical_total_padding / 2, horizontal_total_padding / 2};
+  }
+  else
+  {
+    throw std::runtime_error{"Not supported padding type"};
+  }
+}
+
+inline nnfw::cker::PaddingType asPaddingType(const std::string &padding_name)
+{
+  if (padding_name == "VALID")
+    return nnfw::cker::PaddingType::kValid;
+  else if (padding_name == "SAME")
+    return nnfw::cker::PaddingType::kSame;
+  else
+    throw std::runtime_error{"Not supported padding type"};
+}
+
+inline nnfw::cker::FusedActivationFunctionType asActivationType(const std::string &act_name)
+{
+  if (act_name == "NONE")
+    return nnfw::cker::FusedActivationFunctionType::kNone;
+  else if (act_name == "RELU")
+    return nnfw::cker::FusedActivationFunctionType::kRelu;
+  else if (act_name == "RELU_N1_TO_1")
+    return nnfw::cker::FusedActivationFunctionType::kRelu1;
+  else if (act_name == "RELU6")
+    return nnfw::cker::FusedActivationFunctionType::kRelu6;
+  else
+    throw std::runtime_error{"Not supported activation type"};
+}
+
+template <typename T> void activationRange(const std::string &act_name, T *min, T *max)
+{
+  switch (asActivationType(act_name))
+  {
+    case nnfw::cker::FusedActivationFunctionType::kNone:
+      *min = std::numeric_limits<T>::lowest();
+      *max = std::numeric_limits<T>::max();
+      break;
+    case nnfw::cker::FusedActivationFunctionType::kRelu:
+      *min = 0;
+      *max = std::numeric_limits<T>::max();
+      break;
+    case nnfw::cker::FusedActivationFunctionType::kRelu1:
+      *min = -1;
+      *max = 1;
+      break;
+    case nnfw::cker::FusedActivationFunctionType::kRelu6:
+      *min = 0;
+      *max = 6;
+      break;
+  }
+}
+
+} // namespace cker_common
+} // namespace kernels
+} // namespace kbenchmark
+
+#endif // __KBENCHMARK_KERNELS_CKER_COMMON_UTILS_H__
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __KBENCHMARK_OPERATIONS_BATCH_MATMUL_H__
+#define __KBENCHMARK_OPERATIONS_BATCH_MATMUL_H__
+
+#include "Operation.h"
+#include "Utils.h"
+
+namespace kbenchmark
+{
+namespace operation
+{
+
+class BatchMatMul final : public Operation
+{
+public:
+  BatchMatMul() = default;
+
+  nonius::parameters params(int layer_num, OperationInfo &info) override
+  {
+    nonius::parameters params;
+
+    params.insert({"LAYER", nonius::param{layer_num}});
+
+    // Shapes are passed as comma separated dimensions, e.g. "1,4,16,32"
+    auto _lhs = get_key_string({"input0"}, info);
+    auto _rhs = get_key_string({"input1"}, info);
+    params.insert({"LHS", nonius::param{_lhs}});
+    params.insert({"RHS", nonius::param{_rhs}});
+
+    auto _adj_x = get_key_int({"adj_x"}, info, 0);
+    auto _adj_y = get_key_int({"adj_y"}, info, 0);
+    params.insert({"ADJ_X", nonius::param{_adj_x}});
+    params.insert({"ADJ_Y", nonius::param{_adj_y}});
+
+    return params;
+  }
+};
+
+} // namespace operation
+} // namespace kbenchmark
+
+#endif // __KBENCHMARK_OPERATIONS_BATCH_MATMUL_H__
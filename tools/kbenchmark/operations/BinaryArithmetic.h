@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __KBENCHMARK_OPERATIONS_BINARY_ARITHMETIC_H__
+#define __KBENCHMARK_OPERATIONS_BINARY_ARITHMETIC_H__
+
+#include "Operation.h"
+#include "Utils.h"
+
+namespace kbenchmark
+{
+namespace operation
+{
+
+class BinaryArithmetic final : public Operation
+{
+public:
+  BinaryArithmetic() = default;
+
+  nonius::parameters params(int layer_num, OperationInfo &info) override
+  {
+    nonius::parameters params;
+
+    params.insert({"LAYER", nonius::param{layer_num}});
+
+    // Shapes are passed as comma separated dimensions, e.g. "1,56,56,64"
+    auto _lhs = get_key_string({"input0"}, info);
+    auto _rhs = get_key_string({"input1"}, info);
+    params.insert({"LHS", nonius::param{_lhs}});
+    params.insert({"RHS", nonius::param{_rhs}});
+
+    auto _act = get_key_string({"fused_act"}, info, "NONE");
+    params.insert({"FUSED_ACT", nonius::param{_act}});
+
+    return params;
+  }
+};
+
+} // namespace operation
+} // namespace kbenchmark
+
+#endif // __KBENCHMARK_OPERATIONS_BINARY_ARITHMETIC_H__
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __KBENCHMARK_OPERATIONS_FULLY_CONNECTED_H__
+#define __KBENCHMARK_OPERATIONS_FULLY_CONNECTED_H__
+
+#include "Operation.h"
+#include "Utils.h"
+
+namespace kbenchmark
+{
+namespace operation
+{
+
+class FullyConnected final : public Operation
+{
+public:
+  FullyConnected() = default;
+
+  nonius::parameters params(int layer_num, OperationInfo &info) override
+  {
+    nonius::parameters params;
+
+    params.insert({"LAYER", nonius::param{layer_num}});
+
+    // Input of any rank is flattened to [BATCH, INPUT_SIZE]
+    auto _input = get_key_dims({"input0"}, info);
+    auto _weights = get_key_dims({"input1"}, info);
+    int _input_size = _weights[1];
+    int _flat_size = 1;
+    for (auto dim : _input)
+      _flat_size *= dim;
+    params.insert({"BATCH", nonius::param{_flat_size / _input_size}});
+    params.insert({"INPUT_SIZE", nonius::param{_input_size}});
+    params.insert({"NUM_UNITS", nonius::param{_weights[0]}});
+
+    auto _act = get_key_string({"fused_act"}, info, "NONE");
+    params.insert({"FUSED_ACT", nonius::param{_act}});
+
+    return params;
+  }
+};
+
+} // namespace operation
+} // namespace kbenchmark
+
+#endif // __KBENCHMARK_OPERATIONS_FULLY_CONNECTED_H__
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __KBENCHMARK_OPERATIONS_REDUCE_H__
+#define __KBENCHMARK_OPERATIONS_REDUCE_H__
+
+#include "Operation.h"
+#include "Utils.h"
+
+namespace kbenchmark
+{
+namespace operation
+{
+
+class Reduce final : public Operation
+{
+public:
+  Reduce() = default;
+
+  nonius::parameters params(int layer_num, OperationInfo &info) override
+  {
+    nonius::parameters params;
+
+    params.insert({"LAYER", nonius::param{layer_num}});
+
+    auto _input = get_key_string({"input0"}, info);
+    params.insert({"INPUT", nonius::param{_input}});
+
+    // Axes are only known when they are constant, reduce the last axis otherwise
+    auto _rank = get_key_dims({"input0"}, info).size();
+    auto _axes = get_key_string({"axis"}, info, std::to_string(_rank - 1));
+    params.insert({"AXES", nonius::param{_axes}});
+
+    auto _keep_dims = get_key_int({"keep_dims"}, info, 0);
+    params.insert({"KEEP_DIMS", nonius::param{_keep_dims}});
+
+    return params;
+  }
+};
+
+} // namespace operation
+} // namespace kbenchmark
+
+#endif // __KBENCHMARK_OPERATIONS_REDUCE_H__
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __KBENCHMARK_OPERATIONS_TRANSPOSE_H__
+#define __KBENCHMARK_OPERATIONS_TRANSPOSE_H__
+
+#include "Operation.h"
+#include "Utils.h"
+
+namespace kbenchmark
+{
+namespace operation
+{
+
+class Transpose final : public Operation
+{
+public:
+  Transpose() = default;
+
+  nonius::parameters params(int layer_num, OperationInfo &info) override
+  {
+    nonius::parameters params;
+
+    params.insert({"LAYER", nonius::param{layer_num}});
+
+    auto _input = get_key_dims({"input0"}, info);
+    params.insert({"INPUT", nonius::param{get_key_string({"input0"}, info)}});
+
+    // Permutation is only known when it is constant, reverse the axes otherwise
+    std::string _reversed;
+    for (auto i = _input.size(); i > 0; --i)
+      _reversed += std::to_string(i - 1) + (i > 1 ? "," : "");
+    auto _perm = get_key_string({"perm"}, info, _reversed);
+    params.insert({"PERM", nonius::param{_perm}});
+
+    return params;
+  }
+};
+
+} // namespace operation
+} // namespace kbenchmark
+
+#endif // __KBENCHMARK_OPERATIONS_TRANSPOSE_H__
@@ -0,0 +1,87 @@
+#!/usr/bin/python
+
+# Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#    http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# Merge csv reports of kbenchmark into one csv and one json file for trend tracking
+#
+# kbenchmark with '--reporter csv' writes 'test_benchmark_<config>_<layer>.csv' per layer.
+# Each report has one column per benchmark and one row per sample in seconds.
+
+import argparse
+import csv
+import glob
+import json
+import os
+import statistics
+
+FIELDS = ['config', 'layer', 'benchmark', 'samples', 'mean_us', 'median_us', 'min_us', 'stddev_us']
+
+
+def parse_report(path):
+    name = os.path.splitext(os.path.basename(path))[0]
+    config, layer = name[len('test_benchmark_'):].rsplit('_', 1)
+
+    with open(path) as f:
+        rows = [row for row in csv.reader(f) if row]
+    if len(rows) < 2:
+        return []
+
+    results = []
+    for col, benchmark in enumerate(rows[0]):
+        samples = [float(row[col]) * 1e6 for row in rows[1:] if col < len(row) and row[col]]
+        if not samples:
+            continue
+        results.append({
+            'config': config,
+            'layer': int(layer),
+            'benchmark': benchmark,
+            'samples': len(samples),
+            'mean_us': statistics.mean(samples),
+            'median_us': statistics.median(samples),
+            'min_us': min(samples),
+            'stddev_us': statistics.stdev(samples) if len(samples) > 1 else 0.0
+        })
+    return results
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Summarize csv reports of kbenchmark')
+    parser.add_argument(
+        'reports', nargs='*', help='csv reports (default: test_benchmark_*.csv in cwd)')
+    parser.add_argument(
+        '-o', '--output', default='kbenchmark_summary', help='output file name w/o extension')
+    args = parser.parse_args()
+
+    reports = args.reports if args.reports else sorted(glob.glob('test_benchmark_*.csv'))
+
+    results = []
+    for report in reports:
+        results.extend(parse_report(report))
+    results.sort(key=lambda r: (r['config'], r['layer'], r['benchmark']))
+
+    with open(args.output + '.csv', 'w') as f:
+        writer = csv.DictWriter(f, fieldnames=FIELDS)
+        writer.writeheader()
+        writer.writerows(results)
+
+    with open(args.output + '.json', 'w') as f:
+        json.dump({'results': results}, f, indent=2)
+
+    print('Summarized {} results of {} reports to {}.csv and {}.json'.format(
+        len(results), len(reports), args.output, args.output))
+
+
+if __name__ == '__main__':
+    main()
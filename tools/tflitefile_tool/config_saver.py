@@ -14,6 +14,8 @@
 # See the License for the specific language governing permissions and
 # limitations under the License.
 
+import struct
+
 from operator_wrapping import Operator
 from tensor_printer import TensorPrinter
 from option_printer import OptionPrinter
@@ -100,6 +102,17 @@ class ConfigSaver(object):
         elif self.operator.options.Padding() == 1:
             self.f.write("padding: VALID\n")
 
+    def SaveInt32Values(self, key, tensor):
+        # Values of a constant tensor such as axis and perm, nothing if not constant
+        if tensor.tf_buffer == None or tensor.tf_buffer.DataLength() == 0:
+            return
+        if tensor.type_name != 'INT32':
+            return
+        data = bytearray(tensor.tf_buffer.Data(idx)
+                         for idx in range(tensor.tf_buffer.DataLength()))
+        values = struct.unpack('<{}i'.format(len(data) // 4), data)
+        self.f.write("{}: [{}]\n".format(key, ", ".join(str(v) for v in values)))
+
     def SaveFusedAct(self):
         if self.operator.fused_activation is not "NONE":
             self.f.write("fused_act: {}\n".format(self.operator.fused_activation))
@@ -126,5 +139,15 @@ class ConfigSaver(object):
             self.SavePadding()
             self.f.write("depthmultiplier: {}\n".format(
                 self.operator.options.DepthMultiplier()))
+        elif self.op_name == 'SOFTMAX':
+            self.f.write("beta: {}\n".format(self.operator.options.Beta()))
+        elif self.op_name == 'BATCH_MATMUL':
+            self.f.write("adj_x: {}\n".format(int(self.operator.options.AdjointLhs())))
+            self.f.write("adj_y: {}\n".format(int(self.operator.options.AdjointRhs())))
+        elif self.op_name in ('MEAN', 'SUM', 'REDUCE_MAX', 'REDUCE_MIN', 'REDUCE_PROD'):
+            self.SaveInt32Values("axis", self.operator.inputs[1])
+            self.f.write("keep_dims: {}\n".format(int(self.operator.options.KeepDims())))
+        elif self.op_name == 'TRANSPOSE':
+            self.SaveInt32Values("perm", self.operator.inputs[1])
 
         self.SaveFusedAct()